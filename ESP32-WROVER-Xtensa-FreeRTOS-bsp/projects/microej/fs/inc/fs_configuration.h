@@ -30,7 +30,7 @@
  * This value must not be changed by the user of the CCO.
  * This value must be incremented by the implementor of the CCO when a configuration define is added, deleted or modified.
  */
-#define FS_CONFIGURATION_VERSION (1)
+#define FS_CONFIGURATION_VERSION (2)
 
 /**
  * @brief By default, use the SD card initialization. Comment this to enable use of SPI flash.
@@ -86,6 +86,14 @@ extern MICROEJ_ASYNC_WORKER_handle_t fs_worker;
  */
 #define FS_WAITING_LIST_SIZE (16)
 
+/**
+ * @brief Number of tasks that execute the FS jobs. Each task has its own stack of FS_WORKER_STACK_SIZE bytes.
+ * With several tasks, a short FS operation does not wait for the end of a long one queued before it. FatFs
+ * still serializes the operations on the same volume (FF_FS_REENTRANT): the tasks run concurrently only
+ * when they access different volumes or while FatFs is not called (e.g. copying the read data).
+ */
+#define FS_WORKER_TASK_COUNT (1)
+
 /**
  * @brief Size of the FS stack in bytes.
  */
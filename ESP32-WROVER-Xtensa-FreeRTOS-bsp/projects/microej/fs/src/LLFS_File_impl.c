@@ -34,7 +34,7 @@
  * the configuration fs_configuration.h must be updated based on the one provided
  * by the new CCO version.
  */
-#if FS_CONFIGURATION_VERSION != 1
+#if FS_CONFIGURATION_VERSION != 2
 
 	#error "Version of the configuration file fs_configuration.h is not compatible with this implementation."
 
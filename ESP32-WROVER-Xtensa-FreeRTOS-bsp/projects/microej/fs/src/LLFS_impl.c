@@ -34,7 +34,7 @@
  * the configuration fs_configuration.h must be updated based on the one provided
  * by the new CCO version.
  */
-#if FS_CONFIGURATION_VERSION != 1
+#if FS_CONFIGURATION_VERSION != 2
 
 	#error "Version of the configuration file fs_configuration.h is not compatible with this implementation."
 
@@ -42,7 +42,7 @@
 
 #ifndef FS_CUSTOM_WORKER
 /* Async worker task declaration ---------------------------------------------*/
-MICROEJ_ASYNC_WORKER_worker_declare(fs_worker, FS_WORKER_JOB_COUNT, FS_worker_param_t, FS_WAITING_LIST_SIZE);
+MICROEJ_ASYNC_WORKER_worker_declare_tasks(fs_worker, FS_WORKER_JOB_COUNT, FS_worker_param_t, FS_WAITING_LIST_SIZE, FS_WORKER_TASK_COUNT);
 OSAL_task_stack_declare(fs_worker_stack, FS_WORKER_STACK_SIZE);
 #endif
 
@@ -21,6 +21,7 @@
 #include "microej_pool.h"
 #include "LLFS_File_impl.h"
 #include "diskio.h"
+#include "freertos/FreeRTOS.h"
 
 #ifdef __cplusplus
 	extern "C" {
@@ -54,6 +55,22 @@ static POOL_ctx_t gst_pool_dir_ctx =
 	sizeof(gpst_pool_dir)/sizeof(DIR)
 };
 
+/** @brief lock of the pools: the FS worker may execute its jobs in several tasks, on both cores */
+static portMUX_TYPE gst_pool_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static POOL_status_t fs_pool_reserve(POOL_ctx_t* pool_ctx, void** item) {
+	portENTER_CRITICAL(&gst_pool_lock);
+	POOL_status_t pool_res = POOL_reserve_f(pool_ctx, item);
+	portEXIT_CRITICAL(&gst_pool_lock);
+	return pool_res;
+}
+
+static void fs_pool_free(POOL_ctx_t* pool_ctx, void* item) {
+	portENTER_CRITICAL(&gst_pool_lock);
+	(void)POOL_free_f(pool_ctx, item);
+	portEXIT_CRITICAL(&gst_pool_lock);
+}
+
 void LLFS_IMPL_get_last_modified_action(MICROEJ_ASYNC_WORKER_job_t* job) {
 
 	FS_last_modified_t* param = (FS_last_modified_t*) job->params;
@@ -144,7 +161,7 @@ void LLFS_IMPL_open_directory_action(MICROEJ_ASYNC_WORKER_job_t* job) {
 
 	uint8_t* path = (uint8_t*)&param->path;
 
-	pool_res = POOL_reserve_f(&gst_pool_dir_ctx, (void**)&pdir);
+	pool_res = fs_pool_reserve(&gst_pool_dir_ctx, (void**)&pdir);
 	if (pool_res != POOL_NO_ERROR) {
 		param->result = LLFS_NOK;
 	} else {
@@ -152,7 +169,7 @@ void LLFS_IMPL_open_directory_action(MICROEJ_ASYNC_WORKER_job_t* job) {
 		if (res == FR_OK) {
 			param->result = (int32_t)pdir;
 		} else {
-			POOL_free_f(&gst_pool_dir_ctx, (void*)pdir);
+			fs_pool_free(&gst_pool_dir_ctx, (void*)pdir);
 			param->result = LLFS_NOK;
 		}
 	}
@@ -193,7 +210,7 @@ void LLFS_IMPL_close_directory_action(MICROEJ_ASYNC_WORKER_job_t* job) {
 		param->result = LLFS_OK;
 	}
 
-	POOL_free_f(&gst_pool_dir_ctx, (void*)directory_ID);
+	fs_pool_free(&gst_pool_dir_ctx, (void*)directory_ID);
 
 	LLFS_DEBUG_TRACE("[%s:%u] close dir %ld (err %d)\n", __func__, __LINE__, directory_ID, res);
 }
@@ -532,7 +549,7 @@ void LLFS_File_IMPL_open_action(MICROEJ_ASYNC_WORKER_job_t* job) {
 		return;
 	}
 
-	pool_res = POOL_reserve_f(&gst_pool_file_ctx, (void**)&fp);
+	pool_res = fs_pool_reserve(&gst_pool_file_ctx, (void**)&fp);
 	if (pool_res != POOL_NO_ERROR) {
 		param->result = LLFS_NOK;
 		param->error_code = pool_res;
@@ -540,7 +557,7 @@ void LLFS_File_IMPL_open_action(MICROEJ_ASYNC_WORKER_job_t* job) {
 	} else {
 		res = f_open(fp, (TCHAR*)path, b_internal_mode);
 		if (res != FR_OK) {
-			POOL_free_f(&gst_pool_file_ctx, (void*)fp);
+			fs_pool_free(&gst_pool_file_ctx, (void*)fp);
 			param->result = LLFS_NOK;
 			param->error_code = res;
 			param->error_message = "f_open failed";
@@ -617,7 +634,7 @@ void LLFS_File_IMPL_close_action(MICROEJ_ASYNC_WORKER_job_t* job) {
 		param->result = LLFS_OK;
 	}
 
-	POOL_free_f(&gst_pool_file_ctx, (void*)fd);
+	fs_pool_free(&gst_pool_file_ctx, (void*)fd);
 
 	LLFS_DEBUG_TRACE("[%s:%u] close file %ld (status %ld err %d)\n", __func__, __LINE__, (int32_t)fd, param->result, res);
 }
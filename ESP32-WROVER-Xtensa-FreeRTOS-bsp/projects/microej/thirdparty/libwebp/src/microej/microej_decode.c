@@ -1,74 +1,228 @@
 // Copyright 2021-2022 MicroEJ Corp. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be found with this software.
 
+#include <string.h>
 #include "src/microej/microej_decode.h"
+#include "src/microej/microej_scratch.h"
 #include "src/webp/decode.h"
+#include "src/dsp/dsp.h"
+
+// MicroUI RGB565 pixels are 16-bit words in the CPU byte order (little-endian)
+#if (WEBP_SWAP_16BIT_CSP != 1)
+#error "WEBP_SWAP_16BIT_CSP must be set to 1 to decode RGB565 images"
+#endif
 
 // -----------------------------------------------------------------------------
 
-LLUI_DISPLAY_Status MICROEJ_DECODE_webp(uint8_t* addr, uint32_t length, MICROUI_ImageFormat expectedFormat, MICROUI_Image* data, bool* isFullyOpaque) {
+// Asks libwebp to downscale the image while decoding when it does not fit in
+// the given bounds (0 when a side is not bounded). The aspect ratio is kept.
+static void MICROEJ_DECODE_webp_scale(WebPDecoderConfig* config, uint32_t maxWidth, uint32_t maxHeight) {
+
+	WebPBitstreamFeatures* const bitstream = &config->input;
+	uint32_t width = (uint32_t)bitstream->width;
+	uint32_t height = (uint32_t)bitstream->height;
+	uint32_t max_width = (0 == maxWidth) ? width : maxWidth;
+	uint32_t max_height = (0 == maxHeight) ? height : maxHeight;
+
+	if ((width > max_width) || (height > max_height)) {
+		uint32_t scaled_width;
+		uint32_t scaled_height;
+
+		// the most constrained side gives the scaling factor
+		if (((uint64_t)width * max_height) >= ((uint64_t)height * max_width)) {
+			scaled_width = max_width;
+			scaled_height = (uint32_t)(((uint64_t)height * max_width) / width);
+		}
+		else {
+			scaled_width = (uint32_t)(((uint64_t)width * max_height) / height);
+			scaled_height = max_height;
+		}
+
+		config->options.use_scaling = 1;
+		config->options.scaled_width = (0 == scaled_width) ? 1 : (int)scaled_width;
+		config->options.scaled_height = (0 == scaled_height) ? 1 : (int)scaled_height;
+	}
+}
+
+// Selects the output format from the bitstream features, allocates the image in
+// the images heap and sets it as the decoder output.
+static LLUI_DISPLAY_Status MICROEJ_DECODE_webp_prepare(WebPDecoderConfig* config, MICROUI_ImageFormat expectedFormat, uint32_t maxWidth, uint32_t maxHeight, MICROUI_Image* data, bool* isFullyOpaque) {
+
+	WebPBitstreamFeatures* const bitstream = &config->input;
+	LLUI_DISPLAY_Status ret;
+
+	WEBP_CSP_MODE format;
+	if ((MICROUI_IMAGE_FORMAT_RGB565 == expectedFormat) && !(bitstream->has_alpha)) {
+		// opaque image: 2 bytes per pixel, stored in the CPU byte order (see WEBP_SWAP_16BIT_CSP)
+		format = MODE_RGB_565;
+		*isFullyOpaque = true;
+	}
+	else {
+		// XXX to check with MODE_RGBA_4444 for MICROUI_IMAGE_FORMAT_ARGB4444
+		format = MODE_BGRA;
+		expectedFormat = MICROUI_IMAGE_FORMAT_ARGB8888;
+		*isFullyOpaque = !(bitstream->has_alpha);
+	}
+
+	// fill image data, at its final size
+	MICROEJ_DECODE_webp_scale(config, maxWidth, maxHeight);
+	if (config->options.use_scaling) {
+		data->width = config->options.scaled_width;
+		data->height = config->options.scaled_height;
+	}
+	else {
+		data->width = bitstream->width;
+		data->height = bitstream->height;
+	}
+	data->format = expectedFormat;
+
+	// allocate space in images heap
+	if (!LLUI_DISPLAY_allocateImageBuffer(data, 0)) {
+		ret = LLUI_DISPLAY_OUT_OF_MEMORY;
+	}
+	else {
+		// decode straight into the image buffer, with the stride given by the Graphics Engine
+		WebPRGBABuffer* const output = &config->output.u.RGBA;
+		config->output.colorspace = format;
+		config->output.is_external_memory = 1;
+		output->rgba = LLUI_DISPLAY_getBufferAddress(data);
+		output->stride = LLUI_DISPLAY_getStrideInBytes(data);
+		output->size = output->stride * data->height;
+		ret = LLUI_DISPLAY_OK;
+	}
+	return ret;
+}
+
+// -----------------------------------------------------------------------------
+
+LLUI_DISPLAY_Status MICROEJ_DECODE_webp(uint8_t* addr, uint32_t length, MICROUI_ImageFormat expectedFormat, uint32_t maxWidth, uint32_t maxHeight, MICROUI_Image* data, bool* isFullyOpaque) {
 
 	WebPDecoderConfig config;
-	WebPBitstreamFeatures* const bitstream = &config.input;
 	LLUI_DISPLAY_Status ret;
 
 	// reset config
 	if (!WebPInitDecoderConfig(&config)) {
 		ret = LLUI_DISPLAY_NOK;
 	}
+	// retrieve image information
+	else if (WebPGetFeatures(addr, length, &config.input) != VP8_STATUS_OK) {
+		ret = LLUI_DISPLAY_NOK;
+	}
 	else {
+		ret = MICROEJ_DECODE_webp_prepare(&config, expectedFormat, maxWidth, maxHeight, data, isFullyOpaque);
+		if (LLUI_DISPLAY_OK == ret) {
+			if (WebPDecode(addr, length, &config) != VP8_STATUS_OK) {
+				LLUI_DISPLAY_freeImageBuffer(data);
+				ret = LLUI_DISPLAY_NOK;
+			}
+		}
+	}
+	// release the decoder working memory
+	MICROEJ_SCRATCH_reset();
+	return ret;
+}
+
+// -----------------------------------------------------------------------------
+
+void MICROEJ_DECODE_webp_stream_start(MICROEJ_DECODE_webp_stream_t* stream, MICROUI_ImageFormat expectedFormat, uint32_t maxWidth, uint32_t maxHeight, MICROUI_Image* data, uint8_t* scratch, uint32_t scratchSize) {
+	stream->decoder = NULL;
+	stream->image = data;
+	stream->expected_format = expectedFormat;
+	stream->max_width = maxWidth;
+	stream->max_height = maxHeight;
+	MICROEJ_SCRATCH_initialize(&stream->scratch, scratch, scratchSize);
+	stream->is_fully_opaque = false;
+	stream->header_length = 0;
+	stream->decoded_rows = 0;
+}
+
+// Decodes a chunk, the arena of the stream being selected.
+static MICROEJ_DECODE_stream_status_t MICROEJ_DECODE_webp_stream_decode(MICROEJ_DECODE_webp_stream_t* stream, const uint8_t* addr, uint32_t length) {
 
-		// retrieve image information
-		VP8StatusCode status = WebPGetFeatures(addr, length, bitstream);
+	if (NULL == stream->decoder) {
+		// gather the headers until the image characteristics are known
+		uint32_t header_bytes = MICROEJ_DECODE_WEBP_HEADER_SIZE - stream->header_length;
+		VP8StatusCode status;
+
+		if (header_bytes > length) {
+			header_bytes = length;
+		}
+		memcpy(stream->header + stream->header_length, addr, header_bytes);
+		stream->header_length += header_bytes;
+		addr += header_bytes;
+		length -= header_bytes;
+
+		if (!WebPInitDecoderConfig(&stream->config)) {
+			return MICROEJ_DECODE_STREAM_ERROR;
+		}
+		status = WebPGetFeatures(stream->header, stream->header_length, &stream->config.input);
+		if (VP8_STATUS_NOT_ENOUGH_DATA == status) {
+			return (stream->header_length < MICROEJ_DECODE_WEBP_HEADER_SIZE) ? MICROEJ_DECODE_STREAM_SUSPENDED : MICROEJ_DECODE_STREAM_ERROR;
+		}
 		if (status != VP8_STATUS_OK) {
-			ret = LLUI_DISPLAY_NOK;
+			return MICROEJ_DECODE_STREAM_ERROR;
 		}
-		else {
 
-			WEBP_CSP_MODE format;
-			switch(expectedFormat) {
-			default:
-			case MICROUI_IMAGE_FORMAT_ARGB8888:
-			case MICROUI_IMAGE_FORMAT_ARGB1555:
-			case MICROUI_IMAGE_FORMAT_ARGB4444: // XXX to check with MODE_RGBA_4444
-			case MICROUI_IMAGE_FORMAT_RGB888:
-			case MICROUI_IMAGE_FORMAT_A8:
-				format = MODE_BGRA;
-				expectedFormat = MICROUI_IMAGE_FORMAT_ARGB8888;
-				*isFullyOpaque = !(bitstream->has_alpha);
-				break;
-				// not functional yet
-				//	case MICROUI_IMAGE_FORMAT_RGB565:
-				//		format = MODE_RGB_565;
-				//		*isFullyOpaque = true;
-				// break;
-			}
+		// allocate the image and create the incremental decoder writing into it
+		switch (MICROEJ_DECODE_webp_prepare(&stream->config, stream->expected_format, stream->max_width, stream->max_height, stream->image, &stream->is_fully_opaque)) {
+		case LLUI_DISPLAY_OK:
+			break;
+		case LLUI_DISPLAY_OUT_OF_MEMORY:
+			return MICROEJ_DECODE_STREAM_OUT_OF_MEMORY;
+		default:
+			return MICROEJ_DECODE_STREAM_ERROR;
+		}
+		stream->decoder = WebPIDecode(NULL, 0, &stream->config);
+		if (NULL == stream->decoder) {
+			LLUI_DISPLAY_freeImageBuffer(stream->image);
+			return MICROEJ_DECODE_STREAM_OUT_OF_MEMORY;
+		}
 
-			// fill image data
-			data->width = bitstream->width;
-			data->height = bitstream->height;
-			data->format = expectedFormat;
+		// decode the gathered headers first (a tiny image may be complete)
+		MICROEJ_DECODE_stream_status_t header_status = MICROEJ_DECODE_webp_stream_decode(stream, stream->header, stream->header_length);
+		if (header_status != MICROEJ_DECODE_STREAM_SUSPENDED) {
+			return header_status;
+		}
+	}
 
-			// allocate space in images heap
-			if (!LLUI_DISPLAY_allocateImageBuffer(data, 0)) {
-				ret = LLUI_DISPLAY_OUT_OF_MEMORY;
-			}
-			else {
-
-				uint8_t* ret_addr;
-				if (MODE_RGB_565 == format)	{
-					// not functional yet
-					ret_addr = WebPDecodeBGRInto(addr, length, LLUI_DISPLAY_getBufferAddress(data), LLUI_DISPLAY_getStrideInBytes(data) * data->height, LLUI_DISPLAY_getStrideInBytes(data));
-				}
-				else {
-					ret_addr = WebPDecodeBGRAInto(addr, length, LLUI_DISPLAY_getBufferAddress(data), LLUI_DISPLAY_getStrideInBytes(data) * data->height, LLUI_DISPLAY_getStrideInBytes(data));
-				}
-
-				ret = ret_addr != LLUI_DISPLAY_getBufferAddress(data) ? LLUI_DISPLAY_NOK : LLUI_DISPLAY_OK;
-			}
+	if (length > 0) {
+		int last_y;
+		VP8StatusCode status = WebPIAppend(stream->decoder, addr, length);
+
+		if (WebPIDecGetRGB(stream->decoder, &last_y, NULL, NULL, NULL) != NULL) {
+			stream->decoded_rows = (uint32_t)last_y;
+		}
+
+		if (VP8_STATUS_OK == status) {
+			return MICROEJ_DECODE_STREAM_DONE;
+		}
+		else if (status != VP8_STATUS_SUSPENDED) {
+			return MICROEJ_DECODE_STREAM_ERROR;
 		}
 	}
-	return ret;
+	return MICROEJ_DECODE_STREAM_SUSPENDED;
+}
+
+MICROEJ_DECODE_stream_status_t MICROEJ_DECODE_webp_stream_append(MICROEJ_DECODE_webp_stream_t* stream, const uint8_t* addr, uint32_t length) {
+	MICROEJ_SCRATCH_arena_t* previous = MICROEJ_SCRATCH_select(&stream->scratch);
+	MICROEJ_DECODE_stream_status_t status = MICROEJ_DECODE_webp_stream_decode(stream, addr, length);
+	(void)MICROEJ_SCRATCH_select(previous);
+	return status;
+}
+
+void MICROEJ_DECODE_webp_stream_end(MICROEJ_DECODE_webp_stream_t* stream, MICROEJ_DECODE_stream_status_t status) {
+	if (NULL != stream->decoder) {
+		MICROEJ_SCRATCH_arena_t* previous = MICROEJ_SCRATCH_select(&stream->scratch);
+		WebPIDelete(stream->decoder);
+		stream->decoder = NULL;
+		if (MICROEJ_DECODE_STREAM_DONE != status) {
+			// incomplete or corrupted image
+			LLUI_DISPLAY_freeImageBuffer(stream->image);
+		}
+		// release the decoder working memory
+		MICROEJ_SCRATCH_reset();
+		(void)MICROEJ_SCRATCH_select(previous);
+	}
 }
 
 //------------------------------------------------------------------------------
@@ -5,6 +5,8 @@
 #define WEBP_MICROEJ_MICROEJ_DECODE_H_
 
 #include "LLUI_DISPLAY_impl.h"
+#include "src/webp/decode.h"
+#include "src/microej/microej_scratch.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -13,7 +15,77 @@ extern "C" {
 //------------------------------------------------------------------------------
 // MicroEJ WEBP decoder entry point
 
-LLUI_DISPLAY_Status MICROEJ_DECODE_webp(uint8_t* addr, uint32_t length, MICROUI_ImageFormat expectedFormat, MICROUI_Image* data, bool* isFullyOpaque);
+// Decodes a WEBP image in the images heap. Images larger than maxWidth x maxHeight
+// are downscaled while decoding (libwebp rescaler), keeping their aspect ratio:
+// they take less memory in the images heap and can be drawn without scaling.
+// A 0 bound leaves the side unconstrained; (0, 0) decodes the image at its
+// original size.
+LLUI_DISPLAY_Status MICROEJ_DECODE_webp(uint8_t* addr, uint32_t length, MICROUI_ImageFormat expectedFormat, uint32_t maxWidth, uint32_t maxHeight, MICROUI_Image* data, bool* isFullyOpaque);
+
+//------------------------------------------------------------------------------
+// MicroEJ WEBP streaming decoder
+//
+// Decodes an image while its encoded data arrives (LLFS file, socket...),
+// without keeping the whole file in memory: the rows are written into the
+// MicroUI image as soon as they are decoded (libwebp incremental decoder).
+// Usage:
+//
+//   MICROEJ_DECODE_webp_stream_t stream;
+//   MICROEJ_DECODE_stream_status_t status;
+//   MICROEJ_DECODE_webp_stream_start(&stream, expectedFormat, 0, 0, image, scratch, sizeof(scratch));
+//   do {
+//     length = read(fd, buffer, sizeof(buffer));
+//     status = MICROEJ_DECODE_webp_stream_append(&stream, buffer, length);
+//     // stream.decoded_rows rows of the image are available
+//   } while ((status == MICROEJ_DECODE_STREAM_SUSPENDED) && (length > 0));
+//   MICROEJ_DECODE_webp_stream_end(&stream, status);
+//
+// The decoder working memory lives in the scratch memory given to the stream,
+// its own arena (see microej_scratch.h): several streams can be decoded at the
+// same time, each one fed by a single task. The image and the allocations which
+// do not fit in the scratch memory are allocated in the images heap, like the
+// one-shot decodings.
+
+// Size of the buffer which gathers the headers, enough to get the image characteristics
+#define MICROEJ_DECODE_WEBP_HEADER_SIZE 64
+
+typedef enum {
+	MICROEJ_DECODE_STREAM_DONE,          // the image is fully decoded
+	MICROEJ_DECODE_STREAM_SUSPENDED,     // more data is expected
+	MICROEJ_DECODE_STREAM_ERROR,         // invalid or unsupported data
+	MICROEJ_DECODE_STREAM_OUT_OF_MEMORY  // the image or the decoder cannot be allocated
+} MICROEJ_DECODE_stream_status_t;
+
+typedef struct {
+	WebPDecoderConfig config;
+	WebPIDecoder* decoder;
+	MICROUI_Image* image;
+	MICROUI_ImageFormat expected_format;
+	uint32_t max_width;
+	uint32_t max_height;
+	MICROEJ_SCRATCH_arena_t scratch;
+	uint32_t header_length;
+	uint8_t header[MICROEJ_DECODE_WEBP_HEADER_SIZE];
+	// number of rows of the image already decoded
+	uint32_t decoded_rows;
+	// valid once the image is allocated (decoded_rows > 0)
+	bool is_fully_opaque;
+} MICROEJ_DECODE_webp_stream_t;
+
+// Starts a decoding in the given MicroUI image, downscaled to maxWidth x maxHeight
+// like MICROEJ_DECODE_webp(). The image is allocated as soon as its
+// characteristics are known. The decoder working memory is allocated in the
+// given scratch memory (8-byte aligned, 0 bytes to use the images heap only),
+// which must stay available until MICROEJ_DECODE_webp_stream_end().
+void MICROEJ_DECODE_webp_stream_start(MICROEJ_DECODE_webp_stream_t* stream, MICROUI_ImageFormat expectedFormat, uint32_t maxWidth, uint32_t maxHeight, MICROUI_Image* data, uint8_t* scratch, uint32_t scratchSize);
+
+// Decodes the next chunk of encoded data. The chunk is not referenced after
+// the call.
+MICROEJ_DECODE_stream_status_t MICROEJ_DECODE_webp_stream_append(MICROEJ_DECODE_webp_stream_t* stream, const uint8_t* addr, uint32_t length);
+
+// Releases the decoder. Must be called once the decoding started, giving the
+// last status: the image is freed unless the decoding is done.
+void MICROEJ_DECODE_webp_stream_end(MICROEJ_DECODE_webp_stream_t* stream, MICROEJ_DECODE_stream_status_t status);
 
 //------------------------------------------------------------------------------
 
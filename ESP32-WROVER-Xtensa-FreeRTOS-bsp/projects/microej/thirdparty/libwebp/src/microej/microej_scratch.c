@@ -0,0 +1,129 @@
+// Copyright 2026 MicroEJ Corp. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be found with this software.
+// -----------------------------------------------------------------------------
+//
+// Scratch arena for the decoder working memory, see microej_scratch.h.
+
+#include <stddef.h>
+#include "src/microej/microej_scratch.h"
+
+#include "LLUI_DISPLAY_impl.h"
+#include "esp_attr.h"
+
+// -----------------------------------------------------------------------------
+
+// Blocks alignment, also the size of the header which holds the block size and
+// the generation of the arena when the block was allocated
+#define SCRATCH_ALIGNMENT 8u
+
+#define SCRATCH_ALIGN(size) (((size) + (SCRATCH_ALIGNMENT - 1u)) & ~(SCRATCH_ALIGNMENT - 1u))
+
+#if MICROEJ_SCRATCH_SIZE > 0
+
+#ifdef MICROEJ_SCRATCH_IN_EXTERNAL_RAM
+#define SCRATCH_SECTION EXT_RAM_ATTR
+#else
+#define SCRATCH_SECTION
+#endif
+
+static uint8_t SCRATCH_SECTION __attribute__((aligned(SCRATCH_ALIGNMENT))) default_memory[MICROEJ_SCRATCH_SIZE];
+
+static MICROEJ_SCRATCH_arena_t default_arena = { default_memory, 0, 0, 0, { MICROEJ_SCRATCH_SIZE, 0, 0, 0, 0, 0 } };
+
+#else
+
+static MICROEJ_SCRATCH_arena_t default_arena = { NULL, 0, 0, 0, { 0, 0, 0, 0, 0, 0 } };
+
+#endif
+
+// Arena selected by the calling task, NULL for the default arena
+static __thread MICROEJ_SCRATCH_arena_t* selected_arena = NULL;
+
+static inline MICROEJ_SCRATCH_arena_t* current_arena(void) {
+  return (NULL == selected_arena) ? &default_arena : selected_arena;
+}
+
+static inline bool in_arena(const MICROEJ_SCRATCH_arena_t* arena, const void* ptr) {
+  return (NULL != arena->memory) && ((const uint8_t*)ptr >= arena->memory) && ((const uint8_t*)ptr < (arena->memory + arena->stats.size));
+}
+
+// -----------------------------------------------------------------------------
+
+void MICROEJ_SCRATCH_initialize(MICROEJ_SCRATCH_arena_t* arena, uint8_t* memory, uint32_t size) {
+  arena->memory = (0 == size) ? NULL : memory;
+  arena->top = 0;
+  arena->live_blocks = 0;
+  arena->generation = 0;
+  arena->stats.size = (NULL == memory) ? 0 : size;
+  arena->stats.used = 0;
+  arena->stats.high_water_mark = 0;
+  arena->stats.allocations = 0;
+  arena->stats.fallbacks = 0;
+  arena->stats.leaked_blocks = 0;
+}
+
+MICROEJ_SCRATCH_arena_t* MICROEJ_SCRATCH_select(MICROEJ_SCRATCH_arena_t* arena) {
+  MICROEJ_SCRATCH_arena_t* previous = selected_arena;
+  selected_arena = arena;
+  return previous;
+}
+
+void* MICROEJ_SCRATCH_allocate(uint32_t size) {
+  MICROEJ_SCRATCH_arena_t* arena = current_arena();
+  uint32_t block_size = SCRATCH_ALIGNMENT + SCRATCH_ALIGN(size);
+  if ((NULL != arena->memory) && (size <= arena->stats.size) && (block_size <= (arena->stats.size - arena->top))) {
+    uint8_t* block = arena->memory + arena->top;
+    ((uint32_t*)block)[0] = block_size;
+    ((uint32_t*)block)[1] = arena->generation;
+    arena->top += block_size;
+    arena->live_blocks++;
+    arena->stats.allocations++;
+    arena->stats.used = arena->top;
+    if (arena->top > arena->stats.high_water_mark) {
+      arena->stats.high_water_mark = arena->top;
+    }
+    return block + SCRATCH_ALIGNMENT;
+  }
+  arena->stats.fallbacks++;
+  return LLUI_DISPLAY_IMPL_image_heap_allocate(size);
+}
+
+void MICROEJ_SCRATCH_free(void* ptr) {
+  MICROEJ_SCRATCH_arena_t* arena = current_arena();
+  if (in_arena(arena, ptr)) {
+    uint8_t* block = (uint8_t*)ptr - SCRATCH_ALIGNMENT;
+    uint32_t block_size = ((uint32_t*)block)[0];
+    if (((uint32_t*)block)[1] != arena->generation) {
+      // allocated before the last reset: already reclaimed
+      return;
+    }
+    arena->live_blocks--;
+    if (0 == arena->live_blocks) {
+      // all the blocks are freed: reclaim the whole arena
+      arena->top = 0;
+    }
+    else if ((uint32_t)(block - arena->memory) + block_size == arena->top) {
+      // last allocated block: reclaim it
+      arena->top -= block_size;
+    }
+    arena->stats.used = arena->top;
+    return;
+  }
+  LLUI_DISPLAY_IMPL_image_heap_free((uint8_t*)ptr);
+}
+
+void MICROEJ_SCRATCH_reset(void) {
+  MICROEJ_SCRATCH_arena_t* arena = current_arena();
+  // the decoding is over: the blocks still allocated will never be freed
+  arena->stats.leaked_blocks += arena->live_blocks;
+  arena->live_blocks = 0;
+  arena->generation++;
+  arena->top = 0;
+  arena->stats.used = 0;
+}
+
+void MICROEJ_SCRATCH_get_stats(MICROEJ_SCRATCH_stats_t* stats_out) {
+  *stats_out = current_arena()->stats;
+}
+
+//------------------------------------------------------------------------------
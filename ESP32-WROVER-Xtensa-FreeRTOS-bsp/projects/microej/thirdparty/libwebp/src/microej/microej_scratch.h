@@ -0,0 +1,93 @@
+// Copyright 2026 MicroEJ Corp. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be found with this software.
+// -----------------------------------------------------------------------------
+//
+// Scratch arena for the decoder working memory (row caches, Huffman tables...).
+// The decoder allocations are served from a dedicated memory area instead of
+// the MicroUI images heap, so that they do not fragment the heap where the
+// long-lived images are allocated. The arena is a bump allocator: a block is
+// reclaimed when it is the last allocated one, and the whole arena is reclaimed
+// when all its blocks are freed and at the end of each decoding. The
+// allocations which do not fit fall back to the images heap.
+//
+// The one-shot decodings use the default arena, from the MicroUI thread. A
+// decoder which lives across several calls (streaming decoding) has its own
+// arena, selected for the calling task while the decoder runs: the default
+// arena is not thread-safe, the arena of a decoder is only used by the task
+// which feeds it.
+
+#ifndef WEBP_MICROEJ_MICROEJ_SCRATCH_H_
+#define WEBP_MICROEJ_MICROEJ_SCRATCH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//------------------------------------------------------------------------------
+// Configuration
+
+// Size of the scratch arena in bytes, 0 to allocate everything in the images
+// heap. A lossy 480x640 image needs about 60 KB; lossless images need 4 bytes
+// per pixel and usually fall back to the images heap.
+#define MICROEJ_SCRATCH_SIZE (64 * 1024)
+
+// Place the arena in the external RAM (PSRAM). Comment this define to place it
+// in the internal RAM: faster, but the internal RAM is scarce.
+#define MICROEJ_SCRATCH_IN_EXTERNAL_RAM
+
+//------------------------------------------------------------------------------
+// API
+
+typedef struct {
+  uint32_t size;            // arena size in bytes
+  uint32_t used;            // bytes currently used in the arena
+  uint32_t high_water_mark; // maximum bytes used in the arena
+  uint32_t allocations;     // number of allocations served by the arena
+  uint32_t fallbacks;       // number of allocations served by the images heap
+  uint32_t leaked_blocks;   // number of blocks still allocated when the arena was reset
+} MICROEJ_SCRATCH_stats_t;
+
+typedef struct {
+  uint8_t* memory;          // 8-byte aligned, NULL when the arena is empty
+  uint32_t top;             // offset of the first free byte
+  uint32_t live_blocks;     // blocks allocated and not freed yet
+  uint32_t generation;      // number of resets, stored in the blocks headers
+  MICROEJ_SCRATCH_stats_t stats;
+} MICROEJ_SCRATCH_arena_t;
+
+// Initializes an arena on the given memory (8-byte aligned). A 0 size makes
+// all the allocations fall back to the images heap.
+void MICROEJ_SCRATCH_initialize(MICROEJ_SCRATCH_arena_t* arena, uint8_t* memory, uint32_t size);
+
+// Selects the arena of the calling task for the next calls to the functions
+// below, NULL to select the default arena. Returns the arena previously
+// selected (NULL for the default arena), to restore it.
+MICROEJ_SCRATCH_arena_t* MICROEJ_SCRATCH_select(MICROEJ_SCRATCH_arena_t* arena);
+
+// Allocates a block: 8-byte aligned in the arena, 4-byte aligned when it falls
+// back to the images heap (best fit allocator blocks). Returns NULL when out of
+// memory.
+void* MICROEJ_SCRATCH_allocate(uint32_t size);
+
+// Frees a block allocated by MICROEJ_SCRATCH_allocate() with the same arena
+// selected.
+void MICROEJ_SCRATCH_free(void* ptr);
+
+// Reclaims the whole arena. Called at the end of each decoding: the blocks
+// still allocated in the arena are leaks of the decoder, they are counted in
+// the leaked_blocks statistic. Freeing them afterwards has no effect.
+void MICROEJ_SCRATCH_reset(void);
+
+// Returns the statistics of the selected arena.
+void MICROEJ_SCRATCH_get_stats(MICROEJ_SCRATCH_stats_t* stats);
+
+//------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}    // extern "C"
+#endif
+
+#endif  // WEBP_MICROEJ_MICROEJ_SCRATCH_H_
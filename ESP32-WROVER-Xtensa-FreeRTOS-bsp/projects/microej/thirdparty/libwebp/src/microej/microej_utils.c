@@ -4,25 +4,25 @@
 //
 // Replace the allocator functions WebPSafe*: the original allocator is using
 // malloc and calloc functions (see src/utils/utils.c). The MicroEJ allocator
-// uses the Graphics Engine's heap allocator.
+// uses the decoder scratch arena, which falls back on the Graphics Engine's
+// heap allocator (see microej_scratch.h).
 
 // get allocator prototypes
 #include "src/utils/utils.h"
 
-#include "LLUI_DISPLAY_impl.h"
-#include "microui_heap.h"
+#include "src/microej/microej_scratch.h"
 
 // -----------------------------------------------------------------------------
 
 void* WebPSafeMalloc(uint64_t nmemb, size_t size) {
   assert(nmemb * size > 0);
-  return (void*)LLUI_DISPLAY_IMPL_image_heap_allocate((uint32_t)(nmemb * size));
+  return MICROEJ_SCRATCH_allocate((uint32_t)(nmemb * size));
 }
 
 void* WebPSafeCalloc(uint64_t nmemb, size_t size) {
   void* ptr;
   assert(nmemb * size > 0);
-  ptr = (void*)LLUI_DISPLAY_IMPL_image_heap_allocate((uint32_t)(nmemb * size));
+  ptr = MICROEJ_SCRATCH_allocate((uint32_t)(nmemb * size));
   if (!ptr) return NULL;
   memset(ptr, 0, (size_t)(nmemb * size));
   return ptr;
@@ -30,7 +30,7 @@ void* WebPSafeCalloc(uint64_t nmemb, size_t size) {
 
 void WebPSafeFree(void* const ptr) {
   if (ptr != NULL) {
-    LLUI_DISPLAY_IMPL_image_heap_free((uint8_t*)ptr);
+    MICROEJ_SCRATCH_free(ptr);
   }
 }
 
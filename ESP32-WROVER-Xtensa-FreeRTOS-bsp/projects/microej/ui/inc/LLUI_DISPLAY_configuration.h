@@ -40,5 +40,68 @@
  */
 #define LLUI_DISPLAY_BPP 16
 
+/**
+ * Enable the dirty regions detection on flush. Comment this define to always transfer the
+ * whole flush bounding box to the LCD.
+ *
+ * The screen is split in tiles of LLUI_DISPLAY_DIRTY_TILE_SIZE x LLUI_DISPLAY_DIRTY_TILE_SIZE
+ * pixels. On each flush, the tiles covered by the flush bounding box are compared with the
+ * content sent during the previous flushes (by signature) and only the tiles which have changed
+ * are transferred. The changed tiles are gathered in at most LLUI_DISPLAY_DIRTY_REGIONS_MAX
+ * rectangles; two rectangles are merged when the extra pixels sent cost less than the setup of
+ * a new LCD window (CASET/RASET/RAMWR commands).
+ */
+#define LLUI_DISPLAY_DIRTY_REGIONS_ENABLED
+
+/**
+ * Maximum number of rectangles transferred on each flush.
+ */
+#define LLUI_DISPLAY_DIRTY_REGIONS_MAX 8
+
+/**
+ * Size in pixels of the side of a dirty tile.
+ */
+#define LLUI_DISPLAY_DIRTY_TILE_SIZE 16
+
+/**
+ * Cost in bytes of the setup of a new LCD window, expressed as the number of pixel bytes that
+ * could be sent over SPI in the same time. It includes the CASET/RASET/RAMWR commands and their
+ * data, the D/C line toggling and the SPI driver overhead for each queued transaction.
+ */
+#define LLUI_DISPLAY_DIRTY_REGIONS_SETUP_COST 512
+
+/**
+ * Number of tiles sent on each flush whatever their signatures, in turn over the whole screen.
+ * The 32-bit tile signatures may collide: a changed tile is then not sent and stays stale on the
+ * LCD until it changes again. The refreshed tiles bound the time a stale tile stays on the LCD:
+ * with 1 tile per flush, a 320x240 screen (300 tiles) is fully refreshed every 300 flushes.
+ * Set to 0 to disable the refresh.
+ */
+#define LLUI_DISPLAY_DIRTY_REGIONS_REFRESH_TILES 1
+
+/**
+ * Enable the double buffering (SWITCH mode). Comment this define to use a single buffer
+ * (COPY mode): MicroUI then waits for the end of the LCD transfer before drawing the next frame.
+ *
+ * Two frame buffers are allocated in PSRAM. On flush, MicroUI switches to the other buffer: the
+ * flush bounding box is copied into it (the rest of the frame is the same in both buffers), then
+ * MicroUI draws the next frame while the previous one is transferred to the LCD.
+ */
+#define LLUI_DISPLAY_DOUBLE_BUFFER_ENABLED
+
+/**
+ * Maximum size in pixels of the WebP images decoded at runtime (typically the display size), or
+ * 0 to leave a side unconstrained.
+ *
+ * A larger image is downscaled while it is decoded, keeping its aspect ratio: it takes less
+ * space in the images heap and is drawn without scaling. The bounds apply to every WebP image
+ * decoded by the Graphics Engine: the application gets the image at its downscaled size
+ * (Image.getWidth() and Image.getHeight()). Only set them when the application draws its WebP
+ * images to fit the screen and does not rely on their original size. Otherwise, the application
+ * can bound the images one by one before loading them (see display_webp.h).
+ */
+#define LLUI_DISPLAY_WEBP_MAX_WIDTH 0
+#define LLUI_DISPLAY_WEBP_MAX_HEIGHT 0
+
 
 #endif
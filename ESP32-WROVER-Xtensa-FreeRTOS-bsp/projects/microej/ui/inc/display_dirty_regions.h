@@ -0,0 +1,137 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef _DISPLAY_DIRTY_REGIONS
+#define _DISPLAY_DIRTY_REGIONS
+
+/* Includes ------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "LLUI_DISPLAY_configuration.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Maximum screen side handled by the tiles signatures, in pixels */
+#define DISPLAY_DIRTY_REGIONS_MAX_SIDE 320
+
+/* Number of tiles on each side of the screen */
+#define DISPLAY_DIRTY_REGIONS_MAX_TILES ((DISPLAY_DIRTY_REGIONS_MAX_SIDE + LLUI_DISPLAY_DIRTY_TILE_SIZE - 1) / LLUI_DISPLAY_DIRTY_TILE_SIZE)
+
+/* Structures ----------------------------------------------------------------*/
+
+/*
+ * Rectangle of the screen, bounds are included.
+ */
+typedef struct {
+    uint16_t x1;
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+} display_rect_t;
+
+/*
+ * Bounded queue of rectangles to transfer to the LCD.
+ */
+typedef struct {
+    display_rect_t rects[LLUI_DISPLAY_DIRTY_REGIONS_MAX + 1]; // +1: spare slot used to merge when the queue is full
+    uint32_t count;
+} display_dirty_regions_t;
+
+/*
+ * Transfer statistics, updated by DISPLAY_DIRTY_REGIONS_detect().
+ */
+typedef struct {
+    uint32_t flush_count;       // number of flushes
+    uint32_t rect_count;        // number of rectangles transferred
+    uint64_t bbox_bytes;        // bytes that would have been sent transferring the flush bounding boxes
+    uint64_t transferred_bytes; // bytes actually sent
+} display_dirty_regions_stats_t;
+
+/* API -----------------------------------------------------------------------*/
+
+/*
+ * Empty the queue.
+ */
+void DISPLAY_DIRTY_REGIONS_clear(display_dirty_regions_t* regions);
+
+/*
+ * Add a rectangle to the queue. The rectangle is merged with an existing one when the
+ * extra pixels to send cost less than LLUI_DISPLAY_DIRTY_REGIONS_SETUP_COST. When the
+ * queue is full, the two cheapest rectangles to merge are merged.
+ */
+void DISPLAY_DIRTY_REGIONS_add(display_dirty_regions_t* regions, uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2);
+
+/*
+ * Return the number of pixel bytes to send to transfer all the rectangles of the queue.
+ */
+uint32_t DISPLAY_DIRTY_REGIONS_get_bytes(display_dirty_regions_t* regions);
+
+/*
+ * Forget the tiles signatures: the next call to DISPLAY_DIRTY_REGIONS_detect() transfers
+ * the whole flush bounding box. Must be called when the LCD content no longer matches the
+ * content sent during the previous flushes.
+ */
+void DISPLAY_DIRTY_REGIONS_invalidate(void);
+
+/*
+ * Fill the queue with the rectangles of the given flush bounding box which have changed
+ * since the previous flushes, plus the tiles refreshed whatever their signatures (see
+ * LLUI_DISPLAY_DIRTY_REGIONS_REFRESH_TILES), which may lie outside the bounding box.
+ *
+ * @param[out] regions the queue to fill.
+ * @param[in] buffer the RGB565 frame buffer to flush.
+ * @param[in] width the frame buffer width in pixels (row stride).
+ * @param[in] height the frame buffer height in pixels.
+ * @param[in] xmin, ymin, xmax, ymax the flush bounding box (bounds included).
+ */
+void DISPLAY_DIRTY_REGIONS_detect(display_dirty_regions_t* regions, const uint8_t* buffer, uint32_t width, uint32_t height, uint32_t xmin, uint32_t ymin, uint32_t xmax, uint32_t ymax);
+
+/*
+ * Return the transfer statistics.
+ */
+void DISPLAY_DIRTY_REGIONS_get_stats(display_dirty_regions_stats_t* stats);
+
+/*
+ * Reset the transfer statistics.
+ */
+void DISPLAY_DIRTY_REGIONS_reset_stats(void);
+
+/*
+ * Print the transfer statistics on the standard output.
+ */
+void DISPLAY_DIRTY_REGIONS_dump_stats(void);
+
+/* Java API ------------------------------------------------------------------*/
+
+#ifndef javaDisplayDirtyRegionsDump
+#define javaDisplayDirtyRegionsDump		Java_com_is2t_debug_DisplayDirtyRegions_dump
+#endif
+
+#ifndef javaDisplayDirtyRegionsReset
+#define javaDisplayDirtyRegionsReset		Java_com_is2t_debug_DisplayDirtyRegions_reset
+#endif
+
+/*
+ * Print the transfer statistics and reset them.
+ */
+void javaDisplayDirtyRegionsDump(void);
+
+/*
+ * Reset the transfer statistics.
+ */
+void javaDisplayDirtyRegionsReset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _DISPLAY_DIRTY_REGIONS
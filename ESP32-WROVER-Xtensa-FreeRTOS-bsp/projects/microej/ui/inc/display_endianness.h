@@ -0,0 +1,35 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef _DISPLAY_ENDIANNESS
+#define _DISPLAY_ENDIANNESS
+
+/* Includes ------------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* API -----------------------------------------------------------------------*/
+
+/*
+ * Copy 16-bit pixels and swap their bytes on the fly: each pixel is read and written once.
+ * Source and destination do not need the same 32-bit alignment.
+ *
+ * @param[out] dst the destination, 16-bit aligned.
+ * @param[in] src the source pixels, 16-bit aligned. Must not overlap the destination.
+ * @param[in] length the number of bytes to copy, a multiple of 2.
+ */
+void DISPLAY_ENDIANNESS_copy_swap(uint8_t* dst, const uint8_t* src, uint32_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _DISPLAY_ENDIANNESS
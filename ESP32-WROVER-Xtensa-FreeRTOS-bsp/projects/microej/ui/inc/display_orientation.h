@@ -0,0 +1,82 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Display orientation, implemented by the LCD controller (MADCTL register): the frame buffer
+ * is always drawn and transferred as is, the rotation costs nothing per frame.
+ *
+ * The size of the display is given to MicroUI once, at startup: an orientation which swaps
+ * the width and the height can only be selected before MicroUI starts. Afterwards, only the
+ * orientations with the same size can be selected (upside down).
+ */
+
+#ifndef _DISPLAY_ORIENTATION
+#define _DISPLAY_ORIENTATION
+
+/* Includes ------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Structures ----------------------------------------------------------------*/
+
+/*
+ * Orientation of the display, as seen by the user whatever the LCD panel.
+ */
+typedef enum {
+    DISPLAY_ORIENTATION_PORTRAIT,
+    DISPLAY_ORIENTATION_LANDSCAPE,
+    DISPLAY_ORIENTATION_PORTRAIT_FLIP,
+    DISPLAY_ORIENTATION_LANDSCAPE_FLIP
+} display_orientation_t;
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Tell whether the orientation is a landscape one (width > height) */
+#define DISPLAY_ORIENTATION_IS_LANDSCAPE(orientation) ((((uint32_t)(orientation)) & 1) != 0)
+
+/* API -----------------------------------------------------------------------*/
+
+/*
+ * Select the orientation of the display.
+ *
+ * Before MicroUI starts, any orientation can be selected: it gives the width and the height
+ * of the display. Afterwards, the orientation is applied by the LCD transfer task before the
+ * next transfer, and the whole screen is sent again; a flush is requested.
+ *
+ * Return false when the orientation is unknown or when it would swap the width and the height
+ * of the display after MicroUI has started.
+ */
+bool DISPLAY_ORIENTATION_set(display_orientation_t orientation);
+
+/*
+ * Return the selected orientation of the display.
+ */
+display_orientation_t DISPLAY_ORIENTATION_get(void);
+
+/* Default Java API ----------------------------------------------------------*/
+
+/*
+ * The orientation is selected by the application: its natives are not in the com.is2t.debug
+ * package of the monitoring natives (framerate, images heap, drawing statistics).
+ */
+#ifndef javaDisplayOrientationSet
+#define javaDisplayOrientationSet		Java_com_microej_display_DisplayOrientation_set
+#endif
+#ifndef javaDisplayOrientationGet
+#define javaDisplayOrientationGet		Java_com_microej_display_DisplayOrientation_get
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _DISPLAY_ORIENTATION
@@ -0,0 +1,58 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Bounds of the WebP images decoded at runtime by LLUI_DISPLAY_IMPL_decodeImage(): a larger
+ * image is downscaled while it is decoded, keeping its aspect ratio.
+ *
+ * By default, the bounds LLUI_DISPLAY_WEBP_MAX_WIDTH and LLUI_DISPLAY_WEBP_MAX_HEIGHT
+ * (LLUI_DISPLAY_configuration.h) apply to every image. The application can bound a single
+ * image instead: the bounds set by a Java thread apply to the next image this thread decodes
+ * (ResourceImage.loadImage()), then the default bounds apply again.
+ */
+
+#ifndef _DISPLAY_WEBP
+#define _DISPLAY_WEBP
+
+/* Includes ------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* API -----------------------------------------------------------------------*/
+
+/*
+ * Set the maximum size in pixels of the next image decoded by the current Java thread, 0 to
+ * leave a side unconstrained (the default bounds do not apply to this image). The bounds are
+ * used by the next decoding of this thread, whatever the format of the image (they are
+ * ignored when it is not a WebP image). Only one Java thread at a time can have bounds
+ * pending: the bounds set by another thread replace them.
+ *
+ * Must be called from a Java native. Return false when a size is negative or when the caller
+ * is not a Java thread.
+ */
+bool DISPLAY_WEBP_set_next_max_size(int32_t max_width, int32_t max_height);
+
+/* Default Java API ----------------------------------------------------------*/
+
+/*
+ * The bounds are set by the application: its natives are not in the com.is2t.debug package
+ * of the monitoring natives (framerate, images heap, drawing statistics).
+ */
+#ifndef javaDisplayWebpSetNextMaxSize
+#define javaDisplayWebpSetNextMaxSize		Java_com_microej_display_WebPDecoder_setNextMaxSize
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _DISPLAY_WEBP
@@ -0,0 +1,166 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Drawing statistics: for each kind of drawing (LOG_DRAW identifier of
+ * LLUI_PAINTER_impl.c and LLDW_PAINTER_impl.c), the number of calls, the number of pixels
+ * of the drawn regions and the histogram of the drawing durations.
+ * @author MicroEJ Developer Team
+ */
+
+#if !defined _DRAWING_STATS_H__
+# define _DRAWING_STATS_H__
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <stdint.h>
+
+#include "LLUI_PAINTER_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Configuration
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Define this to collect the statistics (disabled by default). A drawing costs two
+ * reads of the CPU cycle counter and a few additions; when not defined, the macros are empty.
+ */
+//#define DRAWING_STATS_ENABLED
+
+/*
+ * @brief Number of classes of the durations histogram. The class 0 holds the durations
+ * lower than 2^DRAWING_STATS_HISTOGRAM_SHIFT CPU cycles, each next class doubles the
+ * upper bound and the last class holds all the longer durations.
+ */
+#define DRAWING_STATS_HISTOGRAM_SIZE (16)
+#define DRAWING_STATS_HISTOGRAM_SHIFT (8)
+
+// -----------------------------------------------------------------------------
+// Macros
+// -----------------------------------------------------------------------------
+
+#ifdef DRAWING_STATS_ENABLED
+
+/*
+ * @brief Starts timing a drawing.
+ */
+#define DRAWING_STATS_START() DRAWING_STATS_start()
+
+/*
+ * @brief Adds the pixels of the given rectangle (corners in any order) clipped by the
+ * graphics context clip to the current drawing.
+ */
+#define DRAWING_STATS_REGION(gc, x1, y1, x2, y2) DRAWING_STATS_region((gc), (x1), (y1), (x2), (y2))
+
+/*
+ * @brief Adds the pixels of the bounding box of a line drawn with the given margin around
+ * its points (thick lines).
+ */
+#define DRAWING_STATS_LINE_REGION(gc, x1, y1, x2, y2, margin) DRAWING_STATS_line_region((gc), (x1), (y1), (x2), (y2), (margin))
+
+/*
+ * @brief Adds the pixels of an image region drawn with the given flip (DRAWING_Flip).
+ */
+#define DRAWING_STATS_FLIPPED_IMAGE_REGION(gc, x, y, width, height, flip) DRAWING_STATS_flipped_image_region((gc), (x), (y), (width), (height), (jint)(flip))
+
+/*
+ * @brief Adds the pixels of the bounding box of an image drawn with the given rotation.
+ */
+#define DRAWING_STATS_ROTATED_IMAGE_REGION(gc, img, x, y, rotationX, rotationY, angle) DRAWING_STATS_rotated_image_region((gc), (img), (x), (y), (rotationX), (rotationY), (angle))
+
+/*
+ * @brief Ends the current drawing and accounts for it in the statistics of the given
+ * LOG_DRAW identifier.
+ */
+#define DRAWING_STATS_END(id) DRAWING_STATS_end(id)
+
+#else
+
+#define DRAWING_STATS_START() ((void)0)
+#define DRAWING_STATS_REGION(gc, x1, y1, x2, y2) ((void)0)
+#define DRAWING_STATS_LINE_REGION(gc, x1, y1, x2, y2, margin) ((void)0)
+#define DRAWING_STATS_FLIPPED_IMAGE_REGION(gc, x, y, width, height, flip) ((void)0)
+#define DRAWING_STATS_ROTATED_IMAGE_REGION(gc, img, x, y, rotationX, rotationY, angle) ((void)0)
+#define DRAWING_STATS_END(id) ((void)0)
+
+#endif // DRAWING_STATS_ENABLED
+
+// -----------------------------------------------------------------------------
+// API
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Statistics of a kind of drawing.
+ */
+typedef struct
+{
+	uint32_t calls;
+	uint32_t max_cycles;
+	uint64_t pixels;
+	uint64_t cycles;
+	uint32_t histogram[DRAWING_STATS_HISTOGRAM_SIZE];
+} DRAWING_STATS_entry_t;
+
+/*
+ * @brief Returns the statistics of the given LOG_DRAW identifier, or NULL when this
+ * identifier is unknown or the statistics are not enabled.
+ */
+const DRAWING_STATS_entry_t* DRAWING_STATS_get(uint8_t id);
+
+/*
+ * @brief Returns the number of drawings which have not been timed because the MicroUI
+ * task moved to the other CPU core during the drawing (the cycle counters of the cores
+ * are not synchronized).
+ */
+uint32_t DRAWING_STATS_get_untimed(void);
+
+/*
+ * @brief Clears the statistics.
+ */
+void DRAWING_STATS_reset(void);
+
+/*
+ * @brief Prints the statistics of the drawings which have been called, one line per
+ * LOG_DRAW identifier.
+ */
+void DRAWING_STATS_dump(void);
+
+void DRAWING_STATS_start(void);
+void DRAWING_STATS_region(MICROUI_GraphicsContext* gc, jint x1, jint y1, jint x2, jint y2);
+void DRAWING_STATS_line_region(MICROUI_GraphicsContext* gc, jint x1, jint y1, jint x2, jint y2, jint margin);
+void DRAWING_STATS_flipped_image_region(MICROUI_GraphicsContext* gc, jint x, jint y, jint width, jint height, jint flip);
+void DRAWING_STATS_rotated_image_region(MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jint rotationX, jint rotationY, jfloat angle);
+void DRAWING_STATS_end(uint8_t id);
+
+// -----------------------------------------------------------------------------
+// Default Java API
+// -----------------------------------------------------------------------------
+
+#ifndef javaDrawingStatsDump
+#define javaDrawingStatsDump Java_com_is2t_debug_DrawingStats_dump
+#endif
+
+#ifndef javaDrawingStatsReset
+#define javaDrawingStatsReset Java_com_is2t_debug_DrawingStats_reset
+#endif
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !defined _DRAWING_STATS_H__
@@ -0,0 +1,193 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Drawing trace recorder: records the arguments of the drawings performed by
+ * LLUI_PAINTER_impl.c and LLDW_PAINTER_impl.c and the flushes in a compact binary log,
+ * which can be replayed on a Linux host by drawing_trace_replay.c.
+ * @author MicroEJ Developer Team
+ */
+
+#if !defined _DRAWING_TRACE_H__
+# define _DRAWING_TRACE_H__
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "LLUI_PAINTER_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Configuration
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Define this to compile the recorder. When not defined, the recording macros
+ * are empty and the drawings are not slowed down.
+ */
+//#define DRAWING_TRACE_ENABLED
+
+/*
+ * @brief Size of the log in bytes. The recording stops when the log is full.
+ */
+#define DRAWING_TRACE_BUFFER_SIZE (256 * 1024)
+
+/*
+ * @brief Define this to place the log in the external RAM.
+ */
+#define DRAWING_TRACE_IN_EXTERNAL_RAM
+
+// -----------------------------------------------------------------------------
+// Log format
+// -----------------------------------------------------------------------------
+
+/*
+ * The log starts with the 4 bytes DRAWING_TRACE_MAGIC followed by the records. A record
+ * starts with its tag byte and its values are encoded as zigzag LEB128 variable length
+ * integers (small values, negative or not, take one byte):
+ *
+ * - DRAWING_TRACE_TAG_TARGET: target, width, height, format. The destination of the next
+ * drawings changed; the target is an identifier of the destination image.
+ * - DRAWING_TRACE_TAG_STATE: color, clip enabled, clip x1, clip y1, clip x2, clip y2. The
+ * graphics context state used by the next drawings changed.
+ * - DRAWING_TRACE_TAG_DRAW: one byte LOG_DRAW identifier, one byte arguments count, then
+ * the arguments of the UI_DRAWING_* or DW_DRAWING_* function (after the graphics context).
+ * An image argument takes four values: identifier, width, height, format. A float argument
+ * is stored as its IEEE 754 bit pattern.
+ * - DRAWING_TRACE_TAG_FLUSH: xmin, ymin, xmax, ymax.
+ */
+#define DRAWING_TRACE_MAGIC "UIT1"
+
+#define DRAWING_TRACE_TAG_TARGET (1)
+#define DRAWING_TRACE_TAG_STATE (2)
+#define DRAWING_TRACE_TAG_DRAW (3)
+#define DRAWING_TRACE_TAG_FLUSH (4)
+
+/*
+ * @brief Maximum number of values of a drawing record.
+ */
+#define DRAWING_TRACE_MAX_ARGUMENTS (16)
+
+// -----------------------------------------------------------------------------
+// Recording macros
+// -----------------------------------------------------------------------------
+
+#ifdef DRAWING_TRACE_ENABLED
+
+/*
+ * @brief Records a drawing: the LOG_DRAW identifier of the function fn and the arguments
+ * given to its UI_DRAWING_* or DW_DRAWING_* function (see DRAWING_TRACE_IMAGE and
+ * DRAWING_TRACE_FLOAT).
+ */
+#define DRAWING_TRACE_RECORD(gc, fn, ...) do { \
+		const int32_t trace_args[] = { __VA_ARGS__ }; \
+		DRAWING_TRACE_draw((gc), CONCAT_DEFINES(LOG_DRAW_, fn), trace_args, sizeof(trace_args) / sizeof(trace_args[0])); \
+	} while (0)
+
+/*
+ * @brief Records a flush of the given region of the back buffer.
+ */
+#define DRAWING_TRACE_FLUSH(xmin, ymin, xmax, ymax) DRAWING_TRACE_flush((xmin), (ymin), (xmax), (ymax))
+
+#else
+
+#define DRAWING_TRACE_RECORD(gc, fn, ...) ((void)0)
+#define DRAWING_TRACE_FLUSH(xmin, ymin, xmax, ymax) ((void)0)
+
+#endif // DRAWING_TRACE_ENABLED
+
+/*
+ * @brief Expands to the four values of an image argument.
+ */
+#define DRAWING_TRACE_IMAGE(img) (int32_t)(uintptr_t)(img), (int32_t)(img)->width, (int32_t)(img)->height, (int32_t)(img)->format
+
+/*
+ * @brief Expands to the value of a float argument.
+ */
+#define DRAWING_TRACE_FLOAT(f) DRAWING_TRACE_float_bits(f)
+
+static inline int32_t DRAWING_TRACE_float_bits(jfloat f)
+{
+	int32_t bits;
+	memcpy(&bits, &f, sizeof(bits));
+	return bits;
+}
+
+// -----------------------------------------------------------------------------
+// API
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Clears the log and starts recording.
+ */
+void DRAWING_TRACE_start(void);
+
+/*
+ * @brief Stops recording; the log is kept until the next start.
+ */
+void DRAWING_TRACE_stop(void);
+
+/*
+ * @brief Returns the log and its length in bytes.
+ */
+uint32_t DRAWING_TRACE_get_log(const uint8_t** log);
+
+/*
+ * @brief Returns true when the recording stopped because the log was full.
+ */
+bool DRAWING_TRACE_is_truncated(void);
+
+/*
+ * @brief Prints the log on the standard output in hexadecimal, one "DRAWING_TRACE:" line
+ * of 32 bytes at a time (drawing_trace_replay reads this output).
+ */
+void DRAWING_TRACE_dump(void);
+
+/*
+ * @brief Records a drawing, see DRAWING_TRACE_RECORD.
+ */
+void DRAWING_TRACE_draw(MICROUI_GraphicsContext* gc, uint8_t id, const int32_t* args, uint32_t count);
+
+/*
+ * @brief Records a flush, see DRAWING_TRACE_FLUSH.
+ */
+void DRAWING_TRACE_flush(uint32_t xmin, uint32_t ymin, uint32_t xmax, uint32_t ymax);
+
+// -----------------------------------------------------------------------------
+// Default Java API
+// -----------------------------------------------------------------------------
+
+#ifndef javaDrawingTraceStart
+#define javaDrawingTraceStart Java_com_is2t_debug_DrawingTrace_start
+#endif
+
+#ifndef javaDrawingTraceStop
+#define javaDrawingTraceStop Java_com_is2t_debug_DrawingTrace_stop
+#endif
+
+#ifndef javaDrawingTraceDump
+#define javaDrawingTraceDump Java_com_is2t_debug_DrawingTrace_dump
+#endif
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !defined _DRAWING_TRACE_H__
@@ -34,6 +34,49 @@ void framerate_increment(void);
  */
 uint32_t framerate_get(void);
 
+/*
+ * Add the duration of a flush (transfer to the LCD), in microseconds
+ */
+void framerate_add_flush_time(uint32_t time_us);
+
+/*
+ * Return the average flush duration during the last period, in microseconds
+ */
+uint32_t framerate_get_flush_time(void);
+
+/*
+ * Return the maximum flush duration during the last period, in microseconds
+ */
+uint32_t framerate_get_flush_time_max(void);
+
+/*
+ * Notify a flush (LLUI_DISPLAY_IMPL_flush), with a timestamp in microseconds
+ */
+void framerate_add_flush(uint32_t timestamp_us);
+
+/*
+ * Notify the end of a flush (LLUI_DISPLAY_flushDone), with a timestamp in microseconds
+ */
+void framerate_add_flush_done(uint32_t timestamp_us);
+
+/*
+ * Return the given percentile (0 to 100) of the intervals between two flushes during the
+ * last period, in microseconds (0 when there was no interval)
+ */
+uint32_t framerate_get_frame_time(uint32_t percentile);
+
+/*
+ * Return the given percentile (0 to 100) of the durations between a flush and the end of
+ * this flush during the last period, in microseconds (0 when there was no flush)
+ */
+uint32_t framerate_get_flush_latency(uint32_t percentile);
+
+/*
+ * Return the number of frames dropped during the last period, according to
+ * FRAMERATE_FRAME_PERIOD_US
+ */
+uint32_t framerate_get_dropped_frames(void);
+
 /* Default Java API ----------------------------------------------------------*/
 
 #ifndef javaFramerateInit
@@ -42,5 +85,20 @@ uint32_t framerate_get(void);
 #ifndef javaFramerateGet
 #define javaFramerateGet		Java_com_is2t_debug_Framerate_get
 #endif
+#ifndef javaFramerateGetFlushTime
+#define javaFramerateGetFlushTime		Java_com_is2t_debug_Framerate_getFlushTime
+#endif
+#ifndef javaFramerateGetFlushTimeMax
+#define javaFramerateGetFlushTimeMax		Java_com_is2t_debug_Framerate_getFlushTimeMax
+#endif
+#ifndef javaFramerateGetFrameTime
+#define javaFramerateGetFrameTime		Java_com_is2t_debug_Framerate_getFrameTime
+#endif
+#ifndef javaFramerateGetFlushLatency
+#define javaFramerateGetFlushLatency		Java_com_is2t_debug_Framerate_getFlushLatency
+#endif
+#ifndef javaFramerateGetDroppedFrames
+#define javaFramerateGetDroppedFrames		Java_com_is2t_debug_Framerate_getDroppedFrames
+#endif
 
 #endif	// _FRAMERATE_INTERN
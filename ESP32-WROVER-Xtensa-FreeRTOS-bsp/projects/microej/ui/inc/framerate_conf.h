@@ -14,4 +14,16 @@
  */
 #define FRAMERATE_ENABLED
 
+/*
+ * Expected duration between two frames, in microseconds: a longer interval between two
+ * flushes counts the frames which should have been displayed in between as dropped
+ */
+#define FRAMERATE_FRAME_PERIOD_US 16667
+
+/*
+ * Intervals between two flushes longer than this duration, in microseconds, are idle
+ * periods of the application (nothing to render): they are not frame intervals
+ */
+#define FRAMERATE_IDLE_INTERVAL_US 250000
+
 #endif
@@ -0,0 +1,118 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * LCD bus: transport of the commands and pixels between the display driver and the LCD
+ * controller. Implement the LCD_BUS_* functions according to the bus, one implementation
+ * is linked:
+ * - lcd_bus_spi.c: ESP32 SPI master, D/C line driven by a GPIO.
+ * - lcd_bus_sim.c: in-memory LCD controller modelling the SPI bandwidth and the command
+ *   overhead, to run the display driver without the hardware.
+ */
+
+#ifndef _LCD_BUS
+#define _LCD_BUS
+
+/* Includes ------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+
+/*
+ * Maximum number of transactions queued with LCD_BUS_queue_command() and LCD_BUS_queue_data()
+ * and not yet waited with LCD_BUS_wait().
+ */
+#define LCD_BUS_QUEUE_SIZE 16
+
+/* Structures ----------------------------------------------------------------*/
+
+/*
+ * Bus statistics since LCD_BUS_initialize().
+ */
+typedef struct {
+    uint32_t commands;     // number of command bytes sent
+    uint32_t transactions; // number of transactions (commands and data)
+    uint64_t data_bytes;   // number of data bytes sent
+    uint64_t busy_time_us; // time spent by the bus to send the transactions (simulator only)
+} lcd_bus_stats_t;
+
+/* API -----------------------------------------------------------------------*/
+
+/*
+ * Initialize the bus at a low clock, compatible with the LCD initialization and with the
+ * LCD registers reading.
+ */
+void LCD_BUS_initialize(void);
+
+/*
+ * Switch the bus to the given clock for the LCD operation. The registers can no longer be
+ * read afterwards.
+ */
+void LCD_BUS_set_high_speed(uint32_t clock_hz);
+
+/*
+ * Drive the LCD reset line.
+ */
+void LCD_BUS_set_reset(bool reset);
+
+/*
+ * Switch the LCD backlight on or off.
+ */
+void LCD_BUS_set_backlight(bool on);
+
+/*
+ * Send a command and its parameters; waits until the transfer is complete.
+ */
+void LCD_BUS_command(uint8_t cmd, const uint8_t* data, uint32_t length);
+
+/*
+ * Send a command and read its answer; waits until the transfer is complete.
+ */
+void LCD_BUS_read(uint8_t cmd, uint8_t* data, uint32_t length);
+
+/*
+ * Queue a command byte, without waiting for the transfer.
+ */
+void LCD_BUS_queue_command(uint8_t cmd);
+
+/*
+ * Queue data, without waiting for the transfer. Up to 4 bytes are copied; larger data is
+ * sent from the given buffer, which must stay untouched until the transaction is waited.
+ */
+void LCD_BUS_queue_data(const uint8_t* data, uint32_t length);
+
+/*
+ * Wait for the end of the given number of queued transactions, the oldest first.
+ */
+void LCD_BUS_wait(uint32_t count);
+
+/*
+ * Allocate a buffer which can be sent by LCD_BUS_queue_data() without copy.
+ */
+uint8_t* LCD_BUS_allocate_dma(uint32_t size);
+
+/*
+ * Return true when the bus can send data directly from the given address.
+ */
+bool LCD_BUS_is_dma_capable(const void* address);
+
+/*
+ * Return the bus statistics.
+ */
+void LCD_BUS_get_stats(lcd_bus_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _LCD_BUS
@@ -0,0 +1,110 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Specific API of the simulated LCD bus (lcd_bus_sim.c), used to check the content sent to
+ * the LCD, the commands stream and the bus usage of each frame.
+ */
+
+#ifndef _LCD_BUS_SIM
+#define _LCD_BUS_SIM
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "lcd_bus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Size of the simulated LCD memory, in pixels, for each side */
+#define LCD_BUS_SIM_GRAM_SIDE 320
+
+/*
+ * Time spent by the bus for each transaction besides the data itself: driver setup,
+ * D/C line toggling and chip select, in nanoseconds.
+ */
+#define LCD_BUS_SIM_TRANSACTION_OVERHEAD_NS 8000
+
+/*
+ * Define this to make LCD_BUS_wait() sleep for the modelled duration of the waited
+ * transactions, so that the flush latency measured by the framerate module is realistic.
+ */
+//#define LCD_BUS_SIM_REALTIME
+
+/* Number of commands kept by the commands log */
+#define LCD_BUS_SIM_COMMANDS_LOG_SIZE 64
+
+/* Number of parameters kept for each command of the log */
+#define LCD_BUS_SIM_COMMAND_PARAMS 4
+
+/* Number of buffers allocated by LCD_BUS_allocate_dma() which are known as DMA capable */
+#define LCD_BUS_SIM_DMA_BUFFERS 8
+
+/* Structures ----------------------------------------------------------------*/
+
+/*
+ * Command of the commands log.
+ */
+typedef struct {
+    uint8_t cmd;
+    uint8_t params[LCD_BUS_SIM_COMMAND_PARAMS]; // first data bytes following the command
+    uint32_t length;                            // number of data bytes following the command
+} lcd_bus_sim_command_t;
+
+/* API -----------------------------------------------------------------------*/
+
+/*
+ * Return the simulated LCD memory: LCD_BUS_SIM_GRAM_SIDE lines of LCD_BUS_SIM_GRAM_SIDE
+ * 16-bit pixels, stored as received on the bus.
+ */
+const uint8_t* LCD_BUS_SIM_get_gram(void);
+
+/*
+ * Reset the bus statistics, typically at the start of a frame.
+ */
+void LCD_BUS_SIM_reset_stats(void);
+
+/*
+ * Return the number of commands sent since LCD_BUS_initialize() or LCD_BUS_SIM_clear_commands(),
+ * and the log of these commands, in order. Only the first LCD_BUS_SIM_COMMANDS_LOG_SIZE commands
+ * are logged.
+ */
+uint32_t LCD_BUS_SIM_get_commands(const lcd_bus_sim_command_t** commands);
+
+/*
+ * Clear the commands log.
+ */
+void LCD_BUS_SIM_clear_commands(void);
+
+/*
+ * Make the given memory range DMA capable, besides the buffers allocated by
+ * LCD_BUS_allocate_dma(); a size of 0 removes the range. By default, no other memory is DMA
+ * capable: like the PSRAM display buffers on the target (EXT_RAM_ATTR).
+ */
+void LCD_BUS_SIM_set_dma_capable(const void* start, uint32_t size);
+
+/*
+ * Return the number of data transactions queued from a buffer which is not DMA capable since
+ * LCD_BUS_initialize() or LCD_BUS_SIM_reset_stats(): the SPI driver would copy them into a
+ * temporary DMA buffer.
+ */
+uint32_t LCD_BUS_SIM_get_non_dma_transactions(void);
+
+/*
+ * Return the number of data transactions queued from the range given to
+ * LCD_BUS_SIM_set_dma_capable() since LCD_BUS_initialize() or LCD_BUS_SIM_reset_stats().
+ */
+uint32_t LCD_BUS_SIM_get_dma_range_transactions(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _LCD_BUS_SIM
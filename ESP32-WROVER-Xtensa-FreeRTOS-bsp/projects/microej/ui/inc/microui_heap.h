@@ -9,7 +9,7 @@
  * @file
  * @brief See LLUI_DISPLAY_HEAP_impl.c.
  * @author MicroEJ Developer Team
- * @version 1.1.0
+ * @version 1.2.0
  * @date 16 July 2021
  * @since MicroEJ UI Pack 13.1.0
  */
@@ -27,6 +27,67 @@
 extern "C" {
 #endif
 
+// -----------------------------------------------------------------------------
+// Configuration
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Maximum number of allocated blocks whose address is tracked to compute
+ * the free blocks (4 bytes per block), slab pages excluded. The blocks allocated
+ * while this number is reached are not tracked: the free blocks functions return
+ * MICROUI_HEAP_UNKNOWN until they are freed.
+ */
+#define MICROUI_HEAP_TRACKED_BLOCKS (128)
+
+/*
+ * @brief Value returned by the free blocks functions while some allocated blocks
+ * are not tracked (see MICROUI_HEAP_TRACKED_BLOCKS): the free blocks are unknown.
+ * It is -1 for the Java natives.
+ */
+#define MICROUI_HEAP_UNKNOWN (0xffffffffu)
+
+/*
+ * @brief Number of classes of the free blocks histogram. The class i holds the
+ * free blocks whose size is lower than 2^(i + 8) bytes (256 bytes for the first
+ * class); the last class holds all the larger blocks.
+ */
+#define MICROUI_HEAP_HISTOGRAM_SIZE (12)
+
+/*
+ * @brief Define this to serve the small allocations from slab pages: pages of
+ * MICROUI_HEAP_SLAB_PAGE_SIZE bytes are allocated in the best fit heap and cut in
+ * slots of a single size. A small block costs no allocator header nor footer and
+ * the small blocks do not scatter the heap free space, but a page is kept whole
+ * while one of its slots is used: measure the heap peak usage of the application
+ * before enabling it (see the images heap tests of projects/unit_tests/host).
+ *
+ * The slots are 4-byte aligned: a page is a best fit block, which the best fit
+ * allocator returns 4-byte aligned, and the page header size is a multiple of 8
+ * bytes. This is enough for the 32-bit target; the slots are not aligned on the
+ * size of a 64-bit pointer.
+ */
+//#define MICROUI_HEAP_SLAB_ENABLED
+
+/*
+ * @brief Size of a slab page in bytes. Each size class keeps a partly used page: the
+ * larger the pages, the more space the slab layer holds beyond the live slots.
+ */
+#define MICROUI_HEAP_SLAB_PAGE_SIZE (1024)
+
+/*
+ * @brief Sizes of the slots, one size class per size, sorted by increasing size.
+ * Larger allocations are served by the best fit allocator. The 8-byte header and
+ * footer of a best fit block only weigh on the small blocks, and the gaps between
+ * the classes are the space lost by the rounding of the slots.
+ */
+#define MICROUI_HEAP_SLAB_CLASSES { 16, 32, 48, 64, 96, 128 }
+
+/*
+ * @brief Maximum number of slab pages; the small allocations are served by the best
+ * fit allocator when this number is reached.
+ */
+#define MICROUI_HEAP_SLAB_MAX_PAGES (32)
+
 // -----------------------------------------------------------------------------
 // API
 // -----------------------------------------------------------------------------
@@ -58,6 +119,66 @@ uint32_t MICROUI_HEAP_free_space(void);
  */
 uint32_t MICROUI_HEAP_number_of_allocated_blocks(void);
 
+/*
+ * @brief Returns the maximum number of bytes used in the MicroUI image heap since
+ * its initialization.
+ */
+uint32_t MICROUI_HEAP_high_water_mark(void);
+
+/*
+ * @brief Returns the size in bytes of the largest free block, header and footer
+ * included. An allocation fails when its size plus the allocator overhead is
+ * larger than this block, even if MICROUI_HEAP_free_space() is larger.
+ *
+ * Returns MICROUI_HEAP_UNKNOWN while some allocated blocks are not tracked (see
+ * MICROUI_HEAP_TRACKED_BLOCKS).
+ */
+uint32_t MICROUI_HEAP_largest_free_block(void);
+
+/*
+ * @brief Returns the fragmentation of the free space, in percent: 0 when the free
+ * space is one contiguous block, close to 100 when it is scattered in small
+ * blocks (100 - 100 * largest free block / free space).
+ *
+ * Returns MICROUI_HEAP_UNKNOWN while some allocated blocks are not tracked (see
+ * MICROUI_HEAP_TRACKED_BLOCKS).
+ */
+uint32_t MICROUI_HEAP_fragmentation(void);
+
+/*
+ * @brief Fills the histogram of the free blocks sizes (see MICROUI_HEAP_HISTOGRAM_SIZE)
+ * and returns the number of free blocks.
+ *
+ * Returns MICROUI_HEAP_UNKNOWN (and an empty histogram) while some allocated
+ * blocks are not tracked (see MICROUI_HEAP_TRACKED_BLOCKS).
+ *
+ * @param[out] histogram an array of MICROUI_HEAP_HISTOGRAM_SIZE elements.
+ */
+uint32_t MICROUI_HEAP_free_blocks_histogram(uint32_t* histogram);
+
+// -----------------------------------------------------------------------------
+// Default Java API
+// -----------------------------------------------------------------------------
+
+#ifndef javaImageHeapGetTotalSpace
+#define javaImageHeapGetTotalSpace		Java_com_is2t_debug_ImageHeap_getTotalSpace
+#endif
+#ifndef javaImageHeapGetFreeSpace
+#define javaImageHeapGetFreeSpace		Java_com_is2t_debug_ImageHeap_getFreeSpace
+#endif
+#ifndef javaImageHeapGetHighWaterMark
+#define javaImageHeapGetHighWaterMark		Java_com_is2t_debug_ImageHeap_getHighWaterMark
+#endif
+#ifndef javaImageHeapGetLargestFreeBlock
+#define javaImageHeapGetLargestFreeBlock		Java_com_is2t_debug_ImageHeap_getLargestFreeBlock
+#endif
+#ifndef javaImageHeapGetFragmentation
+#define javaImageHeapGetFragmentation		Java_com_is2t_debug_ImageHeap_getFragmentation
+#endif
+#ifndef javaImageHeapGetFreeBlocksHistogram
+#define javaImageHeapGetFreeBlocksHistogram		Java_com_is2t_debug_ImageHeap_getFreeBlocksHistogram
+#endif
+
 // -----------------------------------------------------------------------------
 // EOF
 // -----------------------------------------------------------------------------
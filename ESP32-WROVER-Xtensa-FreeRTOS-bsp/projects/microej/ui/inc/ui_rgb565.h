@@ -0,0 +1,201 @@
+/*
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief RGB565 pixels conversions, blending and fills shared by the RGB565 drawing
+ * overrides (ui_drawing_rgb565.c and dw_drawing_rgb565.c).
+ * @author MicroEJ Developer Team
+ */
+
+#if !defined _UI_RGB565_H__
+# define _UI_RGB565_H__
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "LLUI_PAINTER_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Number of 32-bit words written by each iteration of the unrolled fill loop.
+ */
+#define UI_RGB565_FILL_UNROLL 8
+
+// -----------------------------------------------------------------------------
+// API
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Tells if the graphics context targets a buffer of RGB565 pixels.
+ */
+static inline bool UI_RGB565_is_destination(MICROUI_GraphicsContext* gc)
+{
+	return (MICROUI_IMAGE_FORMAT_LCD == gc->image.format) || (MICROUI_IMAGE_FORMAT_RGB565 == gc->image.format);
+}
+
+/*
+ * @brief Tells if the image pixels are RGB565 pixels.
+ */
+static inline bool UI_RGB565_is_image(MICROUI_Image* img)
+{
+	return (MICROUI_IMAGE_FORMAT_LCD == img->format) || (MICROUI_IMAGE_FORMAT_RGB565 == img->format);
+}
+
+/*
+ * @brief Converts an RGB565 pixel into 8-bit channels (the low bits replicate the high ones).
+ */
+static inline uint32_t UI_RGB565_to_rgb888(uint32_t pixel)
+{
+	uint32_t r = (pixel >> 11) & 0x1f;
+	uint32_t g = (pixel >> 5) & 0x3f;
+	uint32_t b = pixel & 0x1f;
+	return (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+}
+
+static inline uint16_t UI_RGB565_from_rgb888(uint32_t color)
+{
+	return (uint16_t)(((color >> 8) & 0xf800) | ((color >> 5) & 0x07e0) | ((color >> 3) & 0x001f));
+}
+
+/*
+ * @brief Expands the red and blue channels of an RGB565 pixel to 8 bits, in the lanes
+ * 0x00ff00ff of a 32-bit word (the low bits replicate the high ones).
+ */
+static inline uint32_t UI_RGB565_to_rb_lanes(uint32_t pixel)
+{
+	uint32_t rb = ((pixel & 0xf800u) << 8) | ((pixel & 0x001fu) << 3);
+	return rb | ((rb >> 5) & 0x00070007u);
+}
+
+/*
+ * @brief Expands the green channel of an RGB565 pixel to 8 bits, in the lane 0x0000ff00.
+ */
+static inline uint32_t UI_RGB565_to_g_lane(uint32_t pixel)
+{
+	uint32_t g = (pixel & 0x07e0u) << 5;
+	return g | ((g >> 6) & 0x00000300u);
+}
+
+/*
+ * @brief Blends two colors given by their 8-bit channels in the lanes 0x00ff00ff (red and
+ * blue) and 0x0000ff00 (green): (foreground * alpha + background * (255 - alpha)) / 255 on
+ * each channel, rounded, as LLUI_DISPLAY_blend(). Each product takes 16 bits: the red and
+ * blue channels are computed together, the green channel apart. Returns an RGB565 pixel.
+ */
+static inline uint16_t UI_RGB565_blend_lanes(uint32_t foreground_rb, uint32_t foreground_g, uint32_t background_rb, uint32_t background_g, uint32_t alpha)
+{
+	uint32_t rb = (foreground_rb * alpha) + (background_rb * (255 - alpha)) + 0x00800080u;
+	uint32_t g = (foreground_g * alpha) + (background_g * (255 - alpha)) + 0x00008000u;
+
+	// (channel + 127) / 255 for channel in [0, 255 * 255]: (c + 128 + ((c + 128) >> 8)) >> 8
+	rb = (rb + ((rb >> 8) & 0x00ff00ffu)) >> 8;
+	g = (g + ((g >> 8) & 0x0000ff00u)) >> 8;
+	return (uint16_t)(((rb >> 8) & 0xf800u) | ((g >> 5) & 0x07e0u) | ((rb >> 3) & 0x001fu));
+}
+
+/*
+ * @brief Blends an RGB888 foreground color on an RGB565 background pixel:
+ * (foreground * alpha + background * (255 - alpha)) / 255 on each channel, rounded.
+ */
+static inline uint16_t UI_RGB565_blend(uint32_t foreground, uint32_t background, uint32_t alpha)
+{
+	return UI_RGB565_blend_lanes(foreground & 0x00ff00ffu, foreground & 0x0000ff00u, UI_RGB565_to_rb_lanes(background), UI_RGB565_to_g_lane(background), alpha);
+}
+
+/*
+ * @brief Blends an RGB565 foreground pixel on an RGB565 background pixel, as
+ * UI_RGB565_blend() with the foreground expanded to 8 bits per channel.
+ */
+static inline uint16_t UI_RGB565_blend_rgb565(uint32_t foreground, uint32_t background, uint32_t alpha)
+{
+	return UI_RGB565_blend_lanes(UI_RGB565_to_rb_lanes(foreground), UI_RGB565_to_g_lane(foreground), UI_RGB565_to_rb_lanes(background), UI_RGB565_to_g_lane(background), alpha);
+}
+
+/*
+ * @brief Draws an ARGB8888 color on an RGB565 pixel applying its alpha and a global alpha.
+ */
+static inline void UI_RGB565_draw_argb8888(uint16_t* pixel, uint32_t color, uint32_t alpha)
+{
+	uint32_t pixel_alpha = color >> 24;
+
+	if (255 != alpha)
+	{
+		// (pixel_alpha * alpha) / 255, rounded
+		pixel_alpha = (pixel_alpha * alpha) + 128;
+		pixel_alpha = (pixel_alpha + (pixel_alpha >> 8)) >> 8;
+	}
+
+	if (255 == pixel_alpha)
+	{
+		*pixel = UI_RGB565_from_rgb888(color);
+	}
+	else if (0 != pixel_alpha)
+	{
+		*pixel = UI_RGB565_blend(color, *pixel, pixel_alpha);
+	}
+	// else: transparent pixel
+}
+
+/*
+ * @brief Fills a span of pixels with the given pair of pixels (the same RGB565 pixel in
+ * both halves of a 32-bit word).
+ */
+static inline void UI_RGB565_fill_span(uint16_t* pixels, uint32_t length, uint32_t pair)
+{
+	uint32_t* words;
+	uint32_t count;
+
+	if ((length > 0) && (((uintptr_t)pixels & (sizeof(uint32_t) - 1)) != 0))
+	{
+		*pixels++ = (uint16_t)pair;
+		length--;
+	}
+
+	words = (uint32_t*)pixels;
+	count = length / 2;
+	for (; count >= UI_RGB565_FILL_UNROLL; count -= UI_RGB565_FILL_UNROLL)
+	{
+		words[0] = pair;
+		words[1] = pair;
+		words[2] = pair;
+		words[3] = pair;
+		words[4] = pair;
+		words[5] = pair;
+		words[6] = pair;
+		words[7] = pair;
+		words += UI_RGB565_FILL_UNROLL;
+	}
+	while (count-- > 0)
+	{
+		*words++ = pair;
+	}
+
+	if ((length & 1) != 0)
+	{
+		*(uint16_t*)words = (uint16_t)pair;
+	}
+}
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !defined _UI_RGB565_H__
@@ -27,6 +27,12 @@
 // use graphical engine functions to synchronize drawings
 #include "LLUI_DISPLAY.h"
 
+// records the drawings
+#include "drawing_trace.h"
+
+// collects the drawings statistics
+#include "drawing_stats.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -35,9 +41,9 @@ extern "C" {
 // Macros and Defines
 // --------------------------------------------------------------------------------
 
-// macros to log a drawing
-#define LOG_DRAW_START(fn) LLUI_DISPLAY_logDrawingStart(CONCAT_DEFINES(LOG_DRAW_, fn))
-#define LOG_DRAW_END(fn) LLUI_DISPLAY_logDrawingEnd(CONCAT_DEFINES(LOG_DRAW_, fn))
+// macros to log a drawing and to collect its statistics
+#define LOG_DRAW_START(fn) do { LLUI_DISPLAY_logDrawingStart(CONCAT_DEFINES(LOG_DRAW_, fn)); DRAWING_STATS_START(); } while (0)
+#define LOG_DRAW_END(fn) do { DRAWING_STATS_END(CONCAT_DEFINES(LOG_DRAW_, fn)); LLUI_DISPLAY_logDrawingEnd(CONCAT_DEFINES(LOG_DRAW_, fn)); } while (0)
 
 #define DRAWING_PAINTER_NATIVE_NAME(fn) (CONCAT_DEFINES(DRAWING_PAINTER_NATIVE_PREFIX, fn))
 
@@ -69,6 +75,8 @@ void DRAWING_PAINTER_NATIVE(drawThickFadedPoint, MICROUI_GraphicsContext* gc, ji
 	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)&DRAWING_PAINTER_NATIVE_NAME(drawThickFadedPoint)))
 	{
 		LOG_DRAW_START(drawThickFadedPoint);
+		DRAWING_TRACE_RECORD(gc, drawThickFadedPoint, x, y, thickness, fade);
+		DRAWING_STATS_REGION(gc, x - (thickness / 2) - fade, y - (thickness / 2) - fade, x + (thickness / 2) + fade, y + (thickness / 2) + fade);
 		LLUI_DISPLAY_setDrawingStatus(DW_DRAWING_drawThickFadedPoint(gc, x, y, thickness, fade));
 		LOG_DRAW_END(drawThickFadedPoint);
 	}
@@ -79,6 +87,8 @@ void DRAWING_PAINTER_NATIVE(drawThickFadedLine, MICROUI_GraphicsContext* gc, jin
 	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)&DRAWING_PAINTER_NATIVE_NAME(drawThickFadedLine)))
 	{
 		LOG_DRAW_START(drawThickFadedLine);
+		DRAWING_TRACE_RECORD(gc, drawThickFadedLine, startX, startY, endX, endY, thickness, fade, startCap, endCap);
+		DRAWING_STATS_LINE_REGION(gc, startX, startY, endX, endY, (thickness / 2) + fade);
 		LLUI_DISPLAY_setDrawingStatus(DW_DRAWING_drawThickFadedLine(gc, startX, startY, endX, endY, thickness, fade, startCap, endCap));
 		LOG_DRAW_END(drawThickFadedLine);
 	}
@@ -89,6 +99,8 @@ void DRAWING_PAINTER_NATIVE(drawThickFadedCircle, MICROUI_GraphicsContext* gc, j
 	if (diameter > 0 && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)&DRAWING_PAINTER_NATIVE_NAME(drawThickFadedCircle)))
 	{
 		LOG_DRAW_START(drawThickFadedCircle);
+		DRAWING_TRACE_RECORD(gc, drawThickFadedCircle, x, y, diameter, thickness, fade);
+		DRAWING_STATS_REGION(gc, x - (thickness / 2) - fade, y - (thickness / 2) - fade, x + diameter - 1 + (thickness / 2) + fade, y + diameter - 1 + (thickness / 2) + fade);
 		LLUI_DISPLAY_setDrawingStatus(DW_DRAWING_drawThickFadedCircle(gc, x, y, diameter, thickness, fade));
 		LOG_DRAW_END(drawThickFadedCircle);
 	}
@@ -99,6 +111,8 @@ void DRAWING_PAINTER_NATIVE(drawThickFadedCircleArc, MICROUI_GraphicsContext* gc
 	if (diameter > 0 && (int32_t)arcAngle != 0 && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)&DRAWING_PAINTER_NATIVE_NAME(drawThickFadedCircleArc)))
 	{
 		LOG_DRAW_START(drawThickFadedCircleArc);
+		DRAWING_TRACE_RECORD(gc, drawThickFadedCircleArc, x, y, diameter, DRAWING_TRACE_FLOAT(startAngle), DRAWING_TRACE_FLOAT(arcAngle), thickness, fade, start, end);
+		DRAWING_STATS_REGION(gc, x - (thickness / 2) - fade, y - (thickness / 2) - fade, x + diameter - 1 + (thickness / 2) + fade, y + diameter - 1 + (thickness / 2) + fade);
 		LLUI_DISPLAY_setDrawingStatus(DW_DRAWING_drawThickFadedCircleArc(gc, x, y, diameter, startAngle, arcAngle, thickness, fade, start, end));
 		LOG_DRAW_END(drawThickFadedCircleArc);
 	}
@@ -109,6 +123,8 @@ void DRAWING_PAINTER_NATIVE(drawThickFadedEllipse, MICROUI_GraphicsContext* gc,
 	if (width > 0 && height > 0 && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)&DRAWING_PAINTER_NATIVE_NAME(drawThickFadedEllipse)))
 	{
 		LOG_DRAW_START(drawThickFadedEllipse);
+		DRAWING_TRACE_RECORD(gc, drawThickFadedEllipse, x, y, width, height, thickness, fade);
+		DRAWING_STATS_REGION(gc, x - (thickness / 2) - fade, y - (thickness / 2) - fade, x + width - 1 + (thickness / 2) + fade, y + height - 1 + (thickness / 2) + fade);
 		LLUI_DISPLAY_setDrawingStatus(DW_DRAWING_drawThickFadedEllipse(gc, x, y, width, height, thickness, fade));
 		LOG_DRAW_END(drawThickFadedEllipse);
 	}
@@ -119,6 +135,8 @@ void DRAWING_PAINTER_NATIVE(drawThickLine, MICROUI_GraphicsContext* gc, jint sta
 	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)&DRAWING_PAINTER_NATIVE_NAME(drawThickLine)))
 	{
 		LOG_DRAW_START(drawThickLine);
+		DRAWING_TRACE_RECORD(gc, drawThickLine, startX, startY, endX, endY, thickness);
+		DRAWING_STATS_LINE_REGION(gc, startX, startY, endX, endY, thickness / 2);
 		LLUI_DISPLAY_setDrawingStatus(DW_DRAWING_drawThickLine(gc, startX, startY, endX, endY, thickness));
 		LOG_DRAW_END(drawThickLine);
 	}
@@ -129,6 +147,8 @@ void DRAWING_PAINTER_NATIVE(drawThickCircle, MICROUI_GraphicsContext* gc, jint x
 	if (diameter > 0 && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)&DRAWING_PAINTER_NATIVE_NAME(drawThickCircle)))
 	{
 		LOG_DRAW_START(drawThickCircle);
+		DRAWING_TRACE_RECORD(gc, drawThickCircle, x, y, diameter, thickness);
+		DRAWING_STATS_REGION(gc, x - (thickness / 2), y - (thickness / 2), x + diameter - 1 + (thickness / 2), y + diameter - 1 + (thickness / 2));
 		LLUI_DISPLAY_setDrawingStatus(DW_DRAWING_drawThickCircle(gc, x, y, diameter, thickness));
 		LOG_DRAW_END(drawThickCircle);
 	}
@@ -139,6 +159,8 @@ void DRAWING_PAINTER_NATIVE(drawThickEllipse, MICROUI_GraphicsContext* gc, jint
 	if (width > 0 && height > 0 && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)&DRAWING_PAINTER_NATIVE_NAME(drawThickEllipse)))
 	{
 		LOG_DRAW_START(drawThickEllipse);
+		DRAWING_TRACE_RECORD(gc, drawThickEllipse, x, y, width, height, thickness);
+		DRAWING_STATS_REGION(gc, x - (thickness / 2), y - (thickness / 2), x + width - 1 + (thickness / 2), y + height - 1 + (thickness / 2));
 		LLUI_DISPLAY_setDrawingStatus(DW_DRAWING_drawThickEllipse(gc, x, y, width, height, thickness));
 		LOG_DRAW_END(drawThickEllipse);
 	}
@@ -149,6 +171,8 @@ void DRAWING_PAINTER_NATIVE(drawThickCircleArc, MICROUI_GraphicsContext* gc, jin
 	if (diameter > 0 && (int32_t)arcAngle != 0 && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)&DRAWING_PAINTER_NATIVE_NAME(drawThickCircleArc)))
 	{
 		LOG_DRAW_START(drawThickCircleArc);
+		DRAWING_TRACE_RECORD(gc, drawThickCircleArc, x, y, diameter, DRAWING_TRACE_FLOAT(startAngle), DRAWING_TRACE_FLOAT(arcAngle), thickness);
+		DRAWING_STATS_REGION(gc, x - (thickness / 2), y - (thickness / 2), x + diameter - 1 + (thickness / 2), y + diameter - 1 + (thickness / 2));
 		LLUI_DISPLAY_setDrawingStatus(DW_DRAWING_drawThickCircleArc(gc, x, y, diameter, startAngle, arcAngle, thickness));
 		LOG_DRAW_END(drawThickCircleArc);
 	}
@@ -159,6 +183,8 @@ void DRAWING_PAINTER_NATIVE(drawFlippedImage, MICROUI_GraphicsContext* gc, MICRO
 	if (!LLUI_DISPLAY_isClosed(img) && alpha > 0 && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)&DRAWING_PAINTER_NATIVE_NAME(drawFlippedImage)))
 	{
 		LOG_DRAW_START(drawFlippedImage);
+		DRAWING_TRACE_RECORD(gc, drawFlippedImage, DRAWING_TRACE_IMAGE(img), regionX, regionY, width, height, x, y, transformation, alpha);
+		DRAWING_STATS_FLIPPED_IMAGE_REGION(gc, x, y, width, height, transformation);
 		LLUI_DISPLAY_setDrawingStatus(DW_DRAWING_drawFlippedImage(gc, img, regionX, regionY, width, height, x, y, transformation, alpha));
 		LOG_DRAW_END(drawFlippedImage);
 	}
@@ -169,6 +195,8 @@ void DRAWING_PAINTER_NATIVE(drawRotatedImageNearestNeighbor, MICROUI_GraphicsCon
 	if (!LLUI_DISPLAY_isClosed(img) && alpha > 0 && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)&DRAWING_PAINTER_NATIVE_NAME(drawRotatedImageNearestNeighbor)))
 	{
 		LOG_DRAW_START(drawRotatedImageNearestNeighbor);
+		DRAWING_TRACE_RECORD(gc, drawRotatedImageNearestNeighbor, DRAWING_TRACE_IMAGE(img), x, y, rotationX, rotationY, DRAWING_TRACE_FLOAT(angle), alpha);
+		DRAWING_STATS_ROTATED_IMAGE_REGION(gc, img, x, y, rotationX, rotationY, angle);
 		LLUI_DISPLAY_setDrawingStatus(DW_DRAWING_drawRotatedImageNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle, alpha));
 		LOG_DRAW_END(drawRotatedImageNearestNeighbor);
 	}
@@ -179,6 +207,8 @@ void DRAWING_PAINTER_NATIVE(drawRotatedImageBilinear, MICROUI_GraphicsContext* g
 	if (!LLUI_DISPLAY_isClosed(img) && alpha > 0 && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)&DRAWING_PAINTER_NATIVE_NAME(drawRotatedImageBilinear)))
 	{
 		LOG_DRAW_START(drawRotatedImageBilinear);
+		DRAWING_TRACE_RECORD(gc, drawRotatedImageBilinear, DRAWING_TRACE_IMAGE(img), x, y, rotationX, rotationY, DRAWING_TRACE_FLOAT(angle), alpha);
+		DRAWING_STATS_ROTATED_IMAGE_REGION(gc, img, x, y, rotationX, rotationY, angle);
 		LLUI_DISPLAY_setDrawingStatus(DW_DRAWING_drawRotatedImageBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha));
 		LOG_DRAW_END(drawRotatedImageBilinear);
 	}
@@ -189,6 +219,8 @@ void DRAWING_PAINTER_NATIVE(drawScaledImageNearestNeighbor, MICROUI_GraphicsCont
 	if (!LLUI_DISPLAY_isClosed(img) && alpha > 0 && factorX > 0 && factorY > 0 && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)&DRAWING_PAINTER_NATIVE_NAME(drawScaledImageNearestNeighbor)))
 	{
 		LOG_DRAW_START(drawScaledImageNearestNeighbor);
+		DRAWING_TRACE_RECORD(gc, drawScaledImageNearestNeighbor, DRAWING_TRACE_IMAGE(img), x, y, DRAWING_TRACE_FLOAT(factorX), DRAWING_TRACE_FLOAT(factorY), alpha);
+		DRAWING_STATS_REGION(gc, x, y, x + (jint)(img->width * factorX) - 1, y + (jint)(img->height * factorY) - 1);
 		LLUI_DISPLAY_setDrawingStatus(DW_DRAWING_drawScaledImageNearestNeighbor(gc, img, x, y, factorX, factorY, alpha));
 		LOG_DRAW_END(drawScaledImageNearestNeighbor);
 	}
@@ -199,6 +231,8 @@ void DRAWING_PAINTER_NATIVE(drawScaledImageBilinear, MICROUI_GraphicsContext* gc
 	if (!LLUI_DISPLAY_isClosed(img) && alpha > 0 && factorX > 0 && factorY > 0 && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)&DRAWING_PAINTER_NATIVE_NAME(drawScaledImageBilinear)))
 	{
 		LOG_DRAW_START(drawScaledImageBilinear);
+		DRAWING_TRACE_RECORD(gc, drawScaledImageBilinear, DRAWING_TRACE_IMAGE(img), x, y, DRAWING_TRACE_FLOAT(factorX), DRAWING_TRACE_FLOAT(factorY), alpha);
+		DRAWING_STATS_REGION(gc, x, y, x + (jint)(img->width * factorX) - 1, y + (jint)(img->height * factorY) - 1);
 		LLUI_DISPLAY_setDrawingStatus(DW_DRAWING_drawScaledImageBilinear(gc, img, x, y, factorX, factorY, alpha));
 		LOG_DRAW_END(drawScaledImageBilinear);
 	}
@@ -11,46 +11,40 @@
 #include <stdbool.h>
 #include "LLUI_DISPLAY_configuration.h"
 #include "LLUI_DISPLAY_impl.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
-#include "freertos/semphr.h"
+#include "osal.h"
 #include "microej.h"
 #include "bsp_util.h"
 #include "framerate.h"
+#include "display_dirty_regions.h"
+#include "display_orientation.h"
+#include "display_webp.h"
+#include "display_endianness.h"
+#include "drawing_trace.h"
+#include "lcd_bus.h"
 
 #include "sni.h"
 
-#include "esp_system.h"
 #include "esp_attr.h"
-#include "driver/spi_master.h"
-#include "soc/gpio_struct.h"
-#include "driver/gpio.h"
+#include "esp_timer.h"
 #include "src/microej/microej_decode.h"
 
 /* Set the default orientation mode as LANDSCAPE. Comment to use the PORTRAIT mode*/
 #define DEFAULT_ORIENTATION_MODE_LANDSCAPE
 
+/* Orientation used when DISPLAY_ORIENTATION_set() is not called before MicroUI starts */
+#ifdef DEFAULT_ORIENTATION_MODE_LANDSCAPE
+#define DEFAULT_ORIENTATION         DISPLAY_ORIENTATION_LANDSCAPE
+#else
+#define DEFAULT_ORIENTATION         DISPLAY_ORIENTATION_PORTRAIT
+#endif
+
 /* Set the correct configuration for ESP32-WROVER-KIT v3 */
 #define DEFAULT_TFT_DISPLAY_WIDTH   240
 #define DEFAULT_TFT_DISPLAY_HEIGHT  320
 #define DISP_COLOR_BITS_16          0x55
 #define DEFAULT_GAMMA_CURVE         0
 
-/* LCD pin connection */
-#define PIN_NUM_MISO 25
-#define PIN_NUM_MOSI 23
-#define PIN_NUM_CLK  19
-#define PIN_NUM_CS   22
-#define PIN_NUM_DC   21
-#define PIN_NUM_RST  18
-#define PIN_NUM_BCKL  5
-
-/* Backlight pin settings */
-#define PIN_BCKL_ON   0
-#define PIN_BCKL_OFF  1
-
 /* Clock configuration */
-#define LCD_INIT_SPI_CLOCK          26000000
 #define ST7789V_HIGH_SPI_CLOCK      40000000
 #define ILI9341_HIGH_SPI_CLOCK      40000000
 
@@ -132,14 +126,21 @@ typedef enum {
 #define ST7789V_TFT_ROTATION TFT_INVERT_ROTATION1
 #define ILI9341_TFT_ROTATION TFT_NO_INVERT_ROTATION
 
-/* Define size to allocate for Display buffer. (320 * 240 * 2) x 1 : 1 for BACK_BUFFER */
+/* Number of Display buffers: the back buffer, and the buffer restored during the transfer in double buffering */
+#ifdef LLUI_DISPLAY_DOUBLE_BUFFER_ENABLED
+#define DISPLAY_BUFFER_COUNT 2
+#else
+#define DISPLAY_BUFFER_COUNT 1
+#endif
+
+/* Define size to allocate for each Display buffer. (320 * 240 * 2) */
 #define DISPLAY_BUFFER_SIZE	0x25800
 
 /* Declare MicroEJ Display buffer */
-static uint8_t EXT_RAM_ATTR display_buffer[DISPLAY_BUFFER_SIZE] = {0};
+static uint8_t EXT_RAM_ATTR display_buffer[DISPLAY_BUFFER_COUNT][DISPLAY_BUFFER_SIZE] = {0};
 
 /* Define the address of the back buffer */
-#define BACK_BUFFER   ((int32_t)(&display_buffer[0]))
+#define BACK_BUFFER   (&display_buffer[0][0])
 
 /* LCD transfer task defines */
 #define LCD_TRANSFER_STACK_SIZE       (4 * 1024)
@@ -147,9 +148,25 @@ static uint8_t EXT_RAM_ATTR display_buffer[DISPLAY_BUFFER_SIZE] = {0};
 #define LCD_TRANSFER_TASK_STACK_SIZE  (LCD_TRANSFER_STACK_SIZE / 4)
 #define LCD_TRANSFER_TASK_NAME        "LCD Transfer"
 
+/*
+ * LCD transfer pipeline: the pixels are sent by chunks of several lines, from a ring of
+ * DMA capable buffers. A chunk is refilled while the previous ones are in flight.
+ */
+#define LCD_TRANSFER_CHUNK_COUNT        (3)
+#define LCD_TRANSFER_CHUNK_SIZE         (4 * 1024)  // in bytes, must hold at least one display line
+#define LCD_TRANSFER_SETUP_TRANSACTIONS (4)         // CASET, CASET data, RASET, RASET data
+#define LCD_TRANSFER_TRANSACTIONS       (LCD_TRANSFER_SETUP_TRANSACTIONS + (2 * LCD_TRANSFER_CHUNK_COUNT)) // + RAMWR/WRMEMC and data for each chunk
+
+#if LCD_TRANSFER_TRANSACTIONS > LCD_BUS_QUEUE_SIZE
+#error "The LCD bus cannot queue all the transactions of the transfer pipeline, reduce LCD_TRANSFER_CHUNK_COUNT"
+#endif
+
 /* LCD update region structure */
 typedef struct {
     uint8_t* srcAddr;
+#ifdef LLUI_DISPLAY_DOUBLE_BUFFER_ENABLED
+    uint8_t* dstAddr;   // new back buffer, to restore
+#endif
     uint32_t xmin;
     uint32_t ymin;
     uint32_t xmax;
@@ -212,74 +229,42 @@ static lcd_type_t lcd_type = LCD_MAX_TYPE;
  */
 static bool lcd_little_endian = true;
 
-/* SPI device handle */
-static spi_device_handle_t spi_handle;
-
 /* LCD update region */
 static lcd_region_t region;
 
+/* Rectangles of the LCD update region to transfer */
+static display_dirty_regions_t dirty_regions;
+
 /* Synchronization semaphores */
-static SemaphoreHandle_t transfer_sem;
+static OSAL_binary_semaphore_handle_t transfer_sem;
+
+/* LCD transfer task */
+static OSAL_task_handle_t transfer_task;
+static OSAL_task_stack_declare(transfer_task_stack, LCD_TRANSFER_TASK_STACK_SIZE);
 
 /* LCD width and height */
 static int32_t width = DEFAULT_TFT_DISPLAY_WIDTH;
 static int32_t height = DEFAULT_TFT_DISPLAY_HEIGHT;
 
-/* Transaction descriptors */
-static spi_transaction_t trans[6];
-
-/*
- * Send a command to the LCD. Uses spi_device_transmit, which waits until
- * the transfer is complete.
- */
-static void lcd_cmd(spi_device_handle_t spi, const uint8_t cmd) {
-    spi_transaction_t t;
-
-    memset(&t, 0, sizeof(t));            // Zero out the transaction
-    t.length = 8;                        // Command is 8 bits
-    t.tx_buffer = &cmd;                  // The data is the cmd itself
-    t.user = (void *)0;                  // D/C needs to be set to 0
-    spi_device_transmit(spi, &t);        // Transmit!
-}
-
-/*
- * Send data to the LCD. Uses spi_device_transmit, which waits until
- * the transfer is complete.
- */
-static void lcd_data(spi_device_handle_t spi, const uint8_t *data, int len) {
-    spi_transaction_t t;
-
-    if (len == 0) return;                // no need to send anything
-
-    memset(&t, 0, sizeof(t));            // Zero out the transaction
-    t.length = len * 8;                  // len is in bytes, transaction length is in bits.
-    t.tx_buffer = data;                  // Data
-    t.user = (void *)1;                  // D/C needs to be set to 1
-    spi_device_transmit(spi, &t);        // Transmit!
-}
+/* Orientation selected by DISPLAY_ORIENTATION_set() */
+static volatile display_orientation_t orientation = DEFAULT_ORIENTATION;
 
-/*
- * Read data from the LCD. Uses spi_device_transmit, which waits until
- * the transfer is complete.
- */
-static void lcd_read(spi_device_handle_t spi, const uint8_t cmd, uint8_t *data, int len) {
-    spi_transaction_t t;
+/* Orientation applied to the LCD, only updated by the transfer task once MicroUI has started */
+static display_orientation_t lcd_orientation = DEFAULT_ORIENTATION;
 
-    if (len == 0) return;                // no need to send anything
+/* Whether the display size has been given to MicroUI */
+static bool display_initialized = false;
 
-    lcd_cmd(spi, cmd);                   // Send the command
-    memset(&t, 0, sizeof(t));            // Zero out the transaction
-    t.length = len * 8;                  // len is in bytes, transaction length is in bits.
-    t.rx_buffer = data;                  // Data
-    t.user = (void *)1;                  // D/C needs to be set to 1
-    spi_device_transmit(spi, &t);        // Transmit!
-}
+/* Bounds of the next image decoded by a Java thread, set by DISPLAY_WEBP_set_next_max_size() */
+static int32_t webp_next_thread = SNI_ERROR;
+static uint32_t webp_next_max_width;
+static uint32_t webp_next_max_height;
 
 /*
  * Companion code to parse the initialization table.
  * Reads and issues a series of LCD commands stored in byte array
  */
-static void lcd_send_command_list(spi_device_handle_t spi, const uint8_t *addr) {
+static void lcd_send_command_list(const uint8_t *addr) {
     uint8_t numCommands, numArgs, cmd;
     uint16_t ms;
 
@@ -290,14 +275,13 @@ static void lcd_send_command_list(spi_device_handle_t spi, const uint8_t *addr)
         ms       = numArgs & TFT_CMD_DELAY; // If high bit set, delay follows arguments
         numArgs &= ~TFT_CMD_DELAY;          // Mask out delay bit
 
-        lcd_cmd(spi, cmd);
-        lcd_data(spi, (uint8_t *)addr, numArgs);
+        LCD_BUS_command(cmd, addr, numArgs);
 
         addr += numArgs;
 
         if (ms) {
             ms = *addr++;                   // Read post-command delay time (ms)
-            vTaskDelay(ms / portTICK_RATE_MS);
+            OSAL_sleep(ms);
         }
     }
 }
@@ -305,7 +289,7 @@ static void lcd_send_command_list(spi_device_handle_t spi, const uint8_t *addr)
 /*
  * Set the screen rotation
  */
-static void lcd_set_rotation(spi_device_handle_t spi, lcd_orientation_mode_t rotation) {
+static void lcd_set_rotation(lcd_orientation_mode_t rotation) {
     lcd_rotation_t rot;
     uint8_t madctl;
     uint8_t rgb;
@@ -411,46 +395,46 @@ static void lcd_set_rotation(spi_device_handle_t spi, lcd_orientation_mode_t rot
     }
 
     /* Send the command */
-    lcd_cmd(spi, TFT_MADCTL);
-    lcd_data(spi, &madctl, 1);
+    LCD_BUS_command(TFT_MADCTL, &madctl, 1);
+}
+
+/*
+ * Get the screen rotation of the LCD panel showing the given orientation: the ST7789V and ILI9341
+ * panels are not mounted the same way on the board.
+ */
+static lcd_orientation_mode_t lcd_get_rotation(display_orientation_t display_orientation) {
+    static const lcd_orientation_mode_t ST7789V_rotations[] = { PORTRAIT, LANDSCAPE_FLIP, PORTRAIT_FLIP, LANDSCAPE };
+    static const lcd_orientation_mode_t ILI9341_rotations[] = { PORTRAIT_FLIP, LANDSCAPE, PORTRAIT, LANDSCAPE_FLIP };
+
+    return (lcd_type == LCD_ST7789V) ? ST7789V_rotations[display_orientation] : ILI9341_rotations[display_orientation];
 }
 
 /*
  * Set gamma curve
  */
-static void lcd_set_gamma_curve(spi_device_handle_t spi, uint8_t gm) {
+static void lcd_set_gamma_curve(uint8_t gm) {
     uint8_t gamma_curve = 1 << (gm & 0x03);
-    lcd_cmd(spi, TFT_GAMSET);
-    lcd_data(spi, &gamma_curve, 1);
+    LCD_BUS_command(TFT_GAMSET, &gamma_curve, 1);
 }
 
 /*
  * Initialize the display
  */
-static void lcd_display_init(spi_device_handle_t spi) {
+static void lcd_display_init(void) {
     uint32_t lcd_id = 0;
 
-    /* Set the D/C line low */
-    gpio_set_direction(PIN_NUM_DC, GPIO_MODE_OUTPUT);
-    gpio_set_level(PIN_NUM_DC, 0);
-
-    /* Disable the backlight */
-    gpio_set_direction(PIN_NUM_BCKL, GPIO_MODE_OUTPUT);
-    gpio_set_level(PIN_NUM_BCKL, PIN_BCKL_OFF);
-
     /* Reset the display */
-    gpio_set_direction(PIN_NUM_RST, GPIO_MODE_OUTPUT);
-    gpio_set_level(PIN_NUM_RST, 0);
-    vTaskDelay(20 / portTICK_RATE_MS);
-    gpio_set_level(PIN_NUM_RST, 1);
-    vTaskDelay(150 / portTICK_RATE_MS);
+    LCD_BUS_set_reset(true);
+    OSAL_sleep(20);
+    LCD_BUS_set_reset(false);
+    OSAL_sleep(150);
 
     /* Read the LCD id */
-    lcd_read(spi, TFT_RDDID, (uint8_t *)&lcd_id, 3);
+    LCD_BUS_read(TFT_RDDID, (uint8_t *)&lcd_id, 3);
 
     if (lcd_id == 0) {
         /* Read the LCD ID4 */
-        lcd_read(spi, ILI9341_TFT_RDID4, (uint8_t *)&lcd_id, 4);
+        LCD_BUS_read(ILI9341_TFT_RDID4, (uint8_t *)&lcd_id, 4);
 
         /*
          * Reading the ID4 is possible only if EXTC pin is high, as this command belongs to the external command list.
@@ -468,181 +452,222 @@ static void lcd_display_init(spi_device_handle_t spi) {
         lcd_type = LCD_ILI9341;
 
         /* Perform ILI9341 initialization */
-        lcd_send_command_list(spi, ILI9341_init);
-#ifdef DEFAULT_ORIENTATION_MODE_LANDSCAPE
-        /* Set screen rotation */
-        lcd_set_rotation(spi, LANDSCAPE);
-#else
-        /* Set screen rotation */
-        lcd_set_rotation(spi, PORTRAIT_FLIP);
-#endif
+        lcd_send_command_list(ILI9341_init);
     } else {
         /* ST7789V LCD detected */
         lcd_type = LCD_ST7789V;
 
         /* Perform ST7789V initialization */
-        lcd_send_command_list(spi, ST7789V_init);
-#ifdef DEFAULT_ORIENTATION_MODE_LANDSCAPE
-        /* Set screen rotation */
-        lcd_set_rotation(spi, LANDSCAPE_FLIP);
-#else
-        /* Set screen rotation */
-        lcd_set_rotation(spi, PORTRAIT);
-#endif
-
+        lcd_send_command_list(ST7789V_init);
     }
 
+    /* Set screen rotation, it gives the width and the height of the display */
+    lcd_set_rotation(lcd_get_rotation(lcd_orientation));
+
     /* Set default gamma curve */
-    lcd_set_gamma_curve(spi, DEFAULT_GAMMA_CURVE);
+    lcd_set_gamma_curve(DEFAULT_GAMMA_CURVE);
 
     /* Enable backlight */
-    gpio_set_level(PIN_NUM_BCKL, PIN_BCKL_ON);
+    LCD_BUS_set_backlight(true);
 }
 
 /*
- * This function is called (in irq context!) just before a transmission starts.
- * It will set the D/C line to the value indicated in the user field.
+ * Transfer one rectangle of the source buffer to the LCD.
+ *
+ * The window setup transactions are queued first, then the rectangle lines are sent by chunks.
+ * Up to LCD_TRANSFER_CHUNK_COUNT chunks are in flight: a chunk buffer is refilled as soon as
+ * the transactions previously sent from it are done. When the source buffer is DMA capable and
+ * the rectangle lines are contiguous, the chunks are sent directly from the source buffer.
  */
-static void IRAM_ATTR lcd_spi_pre_transfer_callback(spi_transaction_t *t) {
-    int32_t dc = (int32_t)t->user;
-    gpio_set_level(PIN_NUM_DC, dc);
-}
+static void IRAM_ATTR lcd_transfer_rect(uint8_t *src_addr, const display_rect_t *rect, uint8_t *chunk[LCD_TRANSFER_CHUNK_COUNT]) {
+    uint32_t line_bytes = (rect->x2 - rect->x1 + 1) * (LLUI_DISPLAY_BPP / 8);
+    uint32_t stride = width * (LLUI_DISPLAY_BPP / 8);
+    uint32_t chunk_lines = LCD_TRANSFER_CHUNK_SIZE / line_bytes;
+    uint8_t *src = src_addr + (rect->y1 * stride) + (rect->x1 * (LLUI_DISPLAY_BPP / 8));
+    bool zero_copy = lcd_little_endian && (line_bytes == stride) && LCD_BUS_is_dma_capable(src);
+    int32_t pending;
+    uint32_t slot = 0;
+    uint8_t columns[4];
+    uint8_t rows[4];
+
+    columns[0] = rect->x1 >> 8;                                        // Start Column High
+    columns[1] = rect->x1 & 0xff;                                      // Start Column Low
+    columns[2] = rect->x2 >> 8;                                        // End Column High
+    columns[3] = rect->x2 & 0xff;                                      // End Column Low
+    rows[0] = rect->y1 >> 8;                                           // Start Row High
+    rows[1] = rect->y1 & 0xff;                                         // Start Row Low
+    rows[2] = rect->y2 >> 8;                                           // End Row High
+    rows[3] = rect->y2 & 0xff;                                         // End Row Low
+
+    /* Send the first 4 transactions, setting the column and row settings; do not wait for them */
+    LCD_BUS_queue_command(TFT_CASET);
+    LCD_BUS_queue_data(columns, sizeof(columns));
+    LCD_BUS_queue_command(TFT_RASET);
+    LCD_BUS_queue_data(rows, sizeof(rows));
+    pending = LCD_TRANSFER_SETUP_TRANSACTIONS;
+
+    for (uint32_t y = rect->y1; y <= rect->y2; ) {
+        uint32_t lines = rect->y2 - y + 1;
+        uint8_t *data;
+        int32_t to_wait;
+
+        if (lines > chunk_lines) {
+            lines = chunk_lines;
+        }
 
-/*
- * This function send a number of transactions over SPI.
- * The transactions are queued and the function does not wait for them to complete
- */
-static void IRAM_ATTR lcd_send_transactions(spi_device_handle_t spi, int32_t start, int32_t end) {
-    for (int32_t x = start; x <= end; x++) {
-        spi_device_queue_trans(spi, &trans[x], portMAX_DELAY);
-    }
-}
+        /*
+         * Transactions complete in order: wait until the chunk previously sent from this slot
+         * is done, keeping the chunks of the other slots in flight.
+         */
+        to_wait = pending - (2 * (LCD_TRANSFER_CHUNK_COUNT - 1));
+        if (to_wait > 0) {
+            LCD_BUS_wait(to_wait);
+            pending -= to_wait;
+        }
 
-/*
- * This function waits until a number of transactions are sent completely over SPI.
- */
-static void IRAM_ATTR lcd_wait_transactions(spi_device_handle_t spi, int32_t num) {
-    spi_transaction_t *rtrans;
+        if (zero_copy) {
+            data = src;
+        } else {
+            /* Prepare the chunk while the previous ones are being sent */
+            uint8_t *dst = chunk[slot];
+            const uint8_t *line = src;
+            for (uint32_t l = 0; l < lines; l++) {
+                if (lcd_little_endian) {
+                    memcpy(dst, line, line_bytes);
+                } else {
+                    /* Convert from little-endian to big-endian while copying */
+                    DISPLAY_ENDIANNESS_copy_swap(dst, line, line_bytes);
+                }
+                dst += line_bytes;
+                line += stride;
+            }
+            data = chunk[slot];
+        }
+
+        /* Send the memory write command and the chunk data: the first chunk starts the window, the next ones continue it */
+        LCD_BUS_queue_command((y == rect->y1) ? TFT_RAMWR : TFT_WRMEMC);
+        LCD_BUS_queue_data(data, lines * line_bytes);
+        pending += 2;
 
-    for (int32_t x = 0; x < num; x++) {
-        spi_device_get_trans_result(spi, &rtrans, portMAX_DELAY);
+        src += lines * stride;
+        y += lines;
+        slot = (slot + 1) % LCD_TRANSFER_CHUNK_COUNT;
     }
+
+    /* Wait for the end of the rectangle before reusing the chunks */
+    LCD_BUS_wait(pending);
 }
 
-/**
- * This function will convert a frame buffer from little-endian to big-endian, pixel by pixel
+#ifdef LLUI_DISPLAY_DOUBLE_BUFFER_ENABLED
+/*
+ * Copy one rectangle of the flushed buffer into the new back buffer.
  */
-static void IRAM_ATTR lcd_convert_frame_endianness(uint8_t *buffer, uint32_t length) {
-    /* Pixel data is 16-bit, so endianness matter. We need to swap the endianness of all the pixels */
-    for (uint32_t offset = 0; offset < length; offset += (LLUI_DISPLAY_BPP / 8)) {
-        uint16_t pixel = *(uint16_t *)(buffer + offset);
-        pixel = ((pixel & 0x00FF) << 8) | ((pixel & 0xFF00) >> 8);
-        *(uint16_t *)(buffer + offset) = pixel;
+static void IRAM_ATTR lcd_restore_rect(uint8_t *dst_addr, const uint8_t *src_addr, const display_rect_t *rect) {
+    uint32_t line_bytes = (rect->x2 - rect->x1 + 1) * (LLUI_DISPLAY_BPP / 8);
+    uint32_t stride = width * (LLUI_DISPLAY_BPP / 8);
+    uint32_t offset = (rect->y1 * stride) + (rect->x1 * (LLUI_DISPLAY_BPP / 8));
+
+    if (line_bytes == stride) {
+        memcpy(dst_addr + offset, src_addr + offset, (rect->y2 - rect->y1 + 1) * line_bytes);
+    } else {
+        for (uint32_t y = rect->y1; y <= rect->y2; y++) {
+            memcpy(dst_addr + offset, src_addr + offset, line_bytes);
+            offset += stride;
+        }
     }
 }
+#endif
 
 /*
  * LCD Transfer task main function
  */
 static void IRAM_ATTR lcd_transfer_task(void * pvParameters) {
-    spi_device_handle_t *spi = (spi_device_handle_t *)pvParameters;
-    uint8_t *line[2];
-
-    /* Initialize transaction descriptors */
-    for (int32_t x = 0; x < (sizeof(trans) / sizeof(trans[0])); x++) {
-        memset(&trans[x], 0, sizeof(spi_transaction_t));
-        if ((x & 1) == 0) {
-            /* Even transfers are commands */
-            trans[x].length = 8;
-            trans[x].user = (void *)0;
-        } else {
-            /* Odd transfers are data */
-            trans[x].length = 8 * 4;
-            trans[x].user = (void *)1;
-        }
-        trans[x].flags = SPI_TRANS_USE_TXDATA;
-    }
+    uint8_t *chunk[LCD_TRANSFER_CHUNK_COUNT];
+    (void)pvParameters;
 
-    /* Allocate 2 display lines in DMA capable region */
-    line[0] = (uint8_t *)heap_caps_malloc(width * (LLUI_DISPLAY_BPP / 8), MALLOC_CAP_DMA);
-    line[1] = (uint8_t *)heap_caps_malloc(width * (LLUI_DISPLAY_BPP / 8), MALLOC_CAP_DMA);
-
-    /* Fill the fixed part of the transfer, common for all transactions that we will do */
-    trans[0].tx_data[0] = TFT_CASET; // Column Address Set
-    trans[2].tx_data[0] = TFT_RASET; // Row Address Set
-    trans[5].flags = 0;              // Undo SPI_TRANS_USE_TXDATA flag for the last transfer which contains the data
+    /* Allocate the chunks ring in DMA capable region */
+    for (int32_t x = 0; x < LCD_TRANSFER_CHUNK_COUNT; x++) {
+        chunk[x] = LCD_BUS_allocate_dma(LCD_TRANSFER_CHUNK_SIZE);
+    }
 
     /* Enter the task loop */
     do {
-        uint8_t sending_line = 0;
-        uint8_t calc_line = 1;
-        int32_t offset;
+        lcd_region_t flush_region;
+#ifdef FRAMERATE_ENABLED
+        int64_t flush_start;
+#endif
 
         /* Wait for a transfer to be requested */
-        xSemaphoreTake(transfer_sem, portMAX_DELAY);
-
-        /* Calculate the initial offset by skipping the lines and columns which do not need to be flushed */
-        offset = (region.ymin * width * (LLUI_DISPLAY_BPP / 8)) + (region.xmin * (LLUI_DISPLAY_BPP / 8));
-
-        /* Fill the transfer-variable part of the transfer, common for all transactions in one display update */
-        trans[1].tx_data[0] = region.xmin >> 8;                            // Start Column High
-        trans[1].tx_data[1] = region.xmin & 0xff;                          // Start Column Low
-        trans[1].tx_data[2] = region.xmax >> 8;                            // End Column High
-        trans[1].tx_data[3] = region.xmax & 0xff;                          // End Column Low
-        trans[3].tx_data[0] = region.ymin >> 8;                            // Start Row High
-        trans[3].tx_data[1] = region.ymin & 0xff;                          // Start Row Low
-        trans[3].tx_data[2] = region.ymax >> 8;                            // End Row High
-        trans[3].tx_data[3] = region.ymax & 0xff;                          // End Row Low
-        trans[4].tx_data[0] = TFT_RAMWR;                                   // Write Memory
-        trans[5].length = (region.xmax - region.xmin + 1) * LLUI_DISPLAY_BPP; // Data length, in bits
-
-        /* Send the first 4 transactions, setting the column and row settings */
-        lcd_send_transactions(*spi, 0, 3);
-
-        /* Prepare the first line to be transfered */
-        memcpy((uint8_t *)line[sending_line], (uint8_t *)(region.srcAddr + offset), (region.xmax - region.xmin + 1) * (LLUI_DISPLAY_BPP / 8));
-
-        /* Convert the line frame from little-endian to big-endian if needed */
-        if (!lcd_little_endian) {
-            lcd_convert_frame_endianness((uint8_t *)line[sending_line], (region.xmax - region.xmin + 1) * (LLUI_DISPLAY_BPP / 8));
+        OSAL_binary_semaphore_take(&transfer_sem, OSAL_INFINITE_TIME);
+#ifdef FRAMERATE_ENABLED
+        flush_start = esp_timer_get_time();
+#endif
+
+        /* Keep the update region: in double buffering, the next flush can occur during the transfer */
+        flush_region = region;
+
+        /*
+         * Apply a new orientation between two transfers. The LCD memory keeps the pixels written
+         * in the previous orientation: the whole screen has to be sent again. The frame buffer
+         * and the CASET/RASET windows are in the display coordinates, which the LCD maps
+         * according to the orientation.
+         */
+        if (orientation != lcd_orientation) {
+            lcd_orientation = orientation;
+            lcd_set_rotation(lcd_get_rotation(lcd_orientation));
+            flush_region.xmin = 0;
+            flush_region.ymin = 0;
+            flush_region.xmax = width - 1;
+            flush_region.ymax = height - 1;
+#ifdef LLUI_DISPLAY_DIRTY_REGIONS_ENABLED
+            DISPLAY_DIRTY_REGIONS_invalidate();
+#endif
         }
 
-        /* Wait for the first 4 transactions to be done */
-        lcd_wait_transactions(*spi, 4);
+#ifdef LLUI_DISPLAY_DIRTY_REGIONS_ENABLED
+        /* Only transfer the parts of the update region which have changed */
+        DISPLAY_DIRTY_REGIONS_detect(&dirty_regions, flush_region.srcAddr, width, height, flush_region.xmin, flush_region.ymin, flush_region.xmax, flush_region.ymax);
+#else
+        dirty_regions.rects[0].x1 = flush_region.xmin;
+        dirty_regions.rects[0].y1 = flush_region.ymin;
+        dirty_regions.rects[0].x2 = flush_region.xmax;
+        dirty_regions.rects[0].y2 = flush_region.ymax;
+        dirty_regions.count = 1;
+#endif
 
-        for (int32_t x = region.ymin; x < (region.ymax + 1); x++) {
-            /* Prepare the data transactions */
-            if (x != region.ymin) {
-                trans[4].tx_data[0] = TFT_WRMEMC;            // Write Memory Continue
-            }
-            trans[5].tx_buffer = (void *)line[sending_line]; // Finally send the data
-
-            /* Send the last 2 transactions, containing the memory write command and data */
-            lcd_send_transactions(*spi, 4, 5);
-
-            /*
-             * When we are here, the SPI driver is busy (in the background) getting the transactions sent.
-             * That happens mostly using DMA, so the CPU doesn't have much to do here. We're not going to
-             * wait for the transaction to finish because we will spend the time preparing the next line.
-             */
-            offset += width * (LLUI_DISPLAY_BPP / 8);
-
-            /* Prepare the next line to be transfered */
-            memcpy((uint8_t *)line[calc_line], (uint8_t *)(region.srcAddr + offset), (region.xmax - region.xmin + 1) * (LLUI_DISPLAY_BPP / 8));
-            sending_line = calc_line;
-            calc_line = (calc_line == 1) ? 0 : 1;
-
-            /* Convert the line frame from little-endian to big-endian if needed */
-            if (!lcd_little_endian) {
-                lcd_convert_frame_endianness((uint8_t *)line[sending_line], (region.xmax - region.xmin + 1) * (LLUI_DISPLAY_BPP / 8));
-            }
+#ifdef LLUI_DISPLAY_DOUBLE_BUFFER_ENABLED
+        /*
+         * The new back buffer holds the frame before this update: only the flush bounding box
+         * has to be restored. The whole box is copied, whatever the dirty regions: a tile
+         * signature collision must not leave the back buffer out of date. MicroUI can then
+         * draw the next frame during the transfer.
+         */
+        {
+            display_rect_t restore_rect = { (uint16_t)flush_region.xmin, (uint16_t)flush_region.ymin, (uint16_t)flush_region.xmax, (uint16_t)flush_region.ymax };
+            lcd_restore_rect(flush_region.dstAddr, flush_region.srcAddr, &restore_rect);
+        }
+#ifdef FRAMERATE_ENABLED
+        framerate_add_flush_done((uint32_t)esp_timer_get_time());
+#endif
+        LLUI_DISPLAY_flushDone(false);
+#endif
 
-            /* Wait for the last 2 transactions to be done */
-            lcd_wait_transactions(*spi, 2);
+        /* Stream each rectangle on its own */
+        for (uint32_t i = 0; i < dirty_regions.count; i++) {
+            lcd_transfer_rect(flush_region.srcAddr, &dirty_regions.rects[i], chunk);
         }
 
+#ifdef FRAMERATE_ENABLED
+        framerate_add_flush_time((uint32_t)(esp_timer_get_time() - flush_start));
+#endif
+
+#ifndef LLUI_DISPLAY_DOUBLE_BUFFER_ENABLED
         /* The LCD update is finished */
+#ifdef FRAMERATE_ENABLED
+        framerate_add_flush_done((uint32_t)esp_timer_get_time());
+#endif
         LLUI_DISPLAY_flushDone(false);
+#endif
 
     } while (1);
 }
@@ -651,112 +676,151 @@ static void IRAM_ATTR lcd_transfer_task(void * pvParameters) {
 
 void LLUI_DISPLAY_IMPL_initialize(LLUI_DISPLAY_SInitData* init_data)
 {
+    OSAL_binary_semaphore_handle_t semaphore;
 
-    spi_bus_config_t buscfg = {
-        .miso_io_num     = PIN_NUM_MISO,
-        .mosi_io_num     = PIN_NUM_MOSI,
-        .sclk_io_num     = PIN_NUM_CLK,
-        .quadwp_io_num   = -1,
-        .quadhd_io_num   = -1,
-        .max_transfer_sz = DEFAULT_TFT_DISPLAY_WIDTH * DEFAULT_TFT_DISPLAY_HEIGHT * (LLUI_DISPLAY_BPP / 8),
-        .intr_flags      = ESP_INTR_FLAG_IRAM
-    };
-
-    spi_device_interface_config_t devcfg = {
-        .command_bits     = 0,                                // No command bits
-        .address_bits     = 0,                                // No address bits
-        .dummy_bits       = 0,                                // No dummy bits
-        .mode             = 0,                                // SPI mode 0
-        .duty_cycle_pos   = 128,                              // 50%/50% duty of the clock
-        .cs_ena_pretrans  = 0,                                // No extra cycles for CS to stay active before the transmission
-        .cs_ena_posttrans = 0,                                // No extra cycles for CS to stay active after the transmission
-        .clock_speed_hz   = LCD_INIT_SPI_CLOCK,               // Low clock for LCD initialization
-        .spics_io_num     = PIN_NUM_CS,                       // CS pin
-        .flags            = 0,                                // Work in full-duplex for LCD initialization
-        .queue_size       = 4,                                // The max number of transactions queued at a certain time
-        .pre_cb           = lcd_spi_pre_transfer_callback,    // Specify pre-transfer callback to handle D/C line
-        .post_cb          = NULL                              // No post-transfer callback
-    };
-
-    /* Initialize the SPI bus */
-    spi_bus_initialize(HSPI_HOST, &buscfg, 1);
-
-    /* Attach the LCD to the SPI bus */
-    spi_bus_add_device(HSPI_HOST, &devcfg, &spi_handle);
-
-    /* Initialize the LCD */
-    lcd_display_init(spi_handle);
-
-    /* Remove the LCD from the SPI bus */
-    spi_bus_remove_device(spi_handle);
+    /* Initialize the bus at low speed */
+    LCD_BUS_initialize();
+
+    /* Initialize the LCD in the selected orientation */
+    lcd_orientation = orientation;
+    lcd_display_init();
 
     /* Initialize the init_data struct, must be done after lcd_display_init() */ 
-    init_data->binary_semaphore_0 = (LLUI_DISPLAY_binary_semaphore*)xSemaphoreCreateBinary();
-    init_data->binary_semaphore_1 = (LLUI_DISPLAY_binary_semaphore*)xSemaphoreCreateBinary();
+    OSAL_binary_semaphore_create((uint8_t*)"MicroUI 0", 0, &semaphore);
+    init_data->binary_semaphore_0 = (LLUI_DISPLAY_binary_semaphore*)semaphore;
+    OSAL_binary_semaphore_create((uint8_t*)"MicroUI 1", 0, &semaphore);
+    init_data->binary_semaphore_1 = (LLUI_DISPLAY_binary_semaphore*)semaphore;
     init_data->back_buffer_address = (uint8_t*) BACK_BUFFER;
     init_data->lcd_width = (uint32_t) width;
     init_data->lcd_height = (uint32_t) height;
+    display_initialized = true;
 
     /* Configure the LCD for operation */
     if (lcd_type == LCD_ILI9341) {
-        devcfg.clock_speed_hz = ILI9341_HIGH_SPI_CLOCK;       // High clock for LCD operation
+        LCD_BUS_set_high_speed(ILI9341_HIGH_SPI_CLOCK);
     } else if (lcd_type == LCD_ST7789V) {
-        devcfg.clock_speed_hz = ST7789V_HIGH_SPI_CLOCK;       // High clock for LCD operation
+        LCD_BUS_set_high_speed(ST7789V_HIGH_SPI_CLOCK);
     }
-    devcfg.flags = SPI_DEVICE_HALFDUPLEX;                     // Work in half-duplex to achieve speed > 26MHz
-
-    /* Attach the LCD to the SPI bus */
-    spi_bus_add_device(HSPI_HOST, &devcfg, &spi_handle);
 
     /* Create synchronization semaphores */
-    vSemaphoreCreateBinary(transfer_sem);
-    xSemaphoreTake(transfer_sem, 0);
+    OSAL_binary_semaphore_create((uint8_t*)"LCD transfer", 0, &transfer_sem);
 
     /* Create transfer task */
-    xTaskCreate(lcd_transfer_task, LCD_TRANSFER_TASK_NAME, LCD_TRANSFER_TASK_STACK_SIZE,
-            (void *)&spi_handle, LCD_TRANSFER_TASK_PRIORITY, NULL);
+    OSAL_task_create(lcd_transfer_task, (uint8_t*)LCD_TRANSFER_TASK_NAME, transfer_task_stack,
+            LCD_TRANSFER_TASK_PRIORITY, NULL, &transfer_task);
 }
 
 uint8_t* LLUI_DISPLAY_IMPL_flush(MICROUI_GraphicsContext* gc, uint8_t* srcAddr, uint32_t xmin, uint32_t ymin, uint32_t xmax, uint32_t ymax)
 {
+    (void)gc;
 #ifdef FRAMERATE_ENABLED
     framerate_increment();
+    framerate_add_flush((uint32_t)esp_timer_get_time());
 #endif
+    DRAWING_TRACE_FLUSH(xmin, ymin, xmax, ymax);
     /* Store the parameters to be accessible by the transfer task */
     region.srcAddr = srcAddr;
     region.xmin = xmin;
     region.ymin = ymin;
     region.xmax = xmax;
     region.ymax = ymax;
+#ifdef LLUI_DISPLAY_DOUBLE_BUFFER_ENABLED
+    /* SWITCH mode: MicroUI will draw in the other buffer once it is restored */
+    region.dstAddr = (srcAddr == display_buffer[0]) ? display_buffer[1] : display_buffer[0];
+#endif
 
     /* Wake up the task that will transfer the data to the LCD memory */
-    xSemaphoreGive(transfer_sem);
+    OSAL_binary_semaphore_give(&transfer_sem);
 
+#ifdef LLUI_DISPLAY_DOUBLE_BUFFER_ENABLED
+    return region.dstAddr;
+#else
     return srcAddr;
+#endif
 }
 
 void LLUI_DISPLAY_IMPL_binarySemaphoreTake(void* sem){
-    xSemaphoreTake((xSemaphoreHandle)sem, portMAX_DELAY);
+    OSAL_binary_semaphore_handle_t handle = (OSAL_binary_semaphore_handle_t)sem;
+    OSAL_binary_semaphore_take(&handle, OSAL_INFINITE_TIME);
 }
 
 void LLUI_DISPLAY_IMPL_binarySemaphoreGive(void* sem, bool under_isr){
-    if (under_isr)
-	{
-		portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
-		xSemaphoreGiveFromISR((xSemaphoreHandle)sem, &xHigherPriorityTaskWoken);
-		if (xHigherPriorityTaskWoken != pdFALSE)
-		{
-			// Force a context switch here.
-			portYIELD_FROM_ISR();
-		}
-	}
-	else
-	{
-		xSemaphoreGive((xSemaphoreHandle)sem);
-	}
+    /* The OSAL port detects the interrupt context by itself */
+    OSAL_binary_semaphore_handle_t handle = (OSAL_binary_semaphore_handle_t)sem;
+    (void)under_isr;
+    OSAL_binary_semaphore_give(&handle);
 }
 
 LLUI_DISPLAY_Status LLUI_DISPLAY_IMPL_decodeImage(uint8_t* addr, uint32_t length, MICROUI_ImageFormat expectedFormat, MICROUI_Image* data, bool* isFullyOpaque)
 {
-	return MICROEJ_DECODE_webp(addr, length, expectedFormat, data, isFullyOpaque);
+	uint32_t max_width = LLUI_DISPLAY_WEBP_MAX_WIDTH;
+	uint32_t max_height = LLUI_DISPLAY_WEBP_MAX_HEIGHT;
+
+	/* Called in the Java thread which loads the image: use its bounds once */
+	if ((SNI_ERROR != webp_next_thread) && (SNI_getCurrentJavaThreadID() == webp_next_thread)) {
+		max_width = webp_next_max_width;
+		max_height = webp_next_max_height;
+		webp_next_thread = SNI_ERROR;
+	}
+	return MICROEJ_DECODE_webp(addr, length, expectedFormat, max_width, max_height, data, isFullyOpaque);
+}
+
+/* display_orientation.h functions -------------------------------------------*/
+
+bool DISPLAY_ORIENTATION_set(display_orientation_t new_orientation) {
+    if ((uint32_t)new_orientation > DISPLAY_ORIENTATION_LANDSCAPE_FLIP) {
+        return false;
+    }
+
+    if (!display_initialized) {
+        /* Applied by LLUI_DISPLAY_IMPL_initialize() */
+        orientation = new_orientation;
+        return true;
+    }
+
+    /* MicroUI cannot change the size of the display */
+    if (DISPLAY_ORIENTATION_IS_LANDSCAPE(new_orientation) != DISPLAY_ORIENTATION_IS_LANDSCAPE(orientation)) {
+        return false;
+    }
+
+    if (new_orientation != orientation) {
+        orientation = new_orientation;
+        /* Make the transfer task apply it, even if the application does not draw anything */
+        LLUI_DISPLAY_requestFlush(true);
+    }
+    return true;
+}
+
+display_orientation_t DISPLAY_ORIENTATION_get(void) {
+    return orientation;
+}
+
+/* display_webp.h functions --------------------------------------------------*/
+
+bool DISPLAY_WEBP_set_next_max_size(int32_t max_width, int32_t max_height) {
+    int32_t thread = SNI_getCurrentJavaThreadID();
+
+    if ((max_width < 0) || (max_height < 0) || (SNI_ERROR == thread)) {
+        return false;
+    }
+
+    /* The natives and the decodings are executed by the virtual machine task, one at a time */
+    webp_next_max_width = (uint32_t)max_width;
+    webp_next_max_height = (uint32_t)max_height;
+    webp_next_thread = thread;
+    return true;
+}
+
+/* Java API ------------------------------------------------------------------*/
+
+jboolean javaDisplayOrientationSet(jint new_orientation) {
+    return ((new_orientation >= 0) && DISPLAY_ORIENTATION_set((display_orientation_t)new_orientation)) ? JTRUE : JFALSE;
+}
+
+jint javaDisplayOrientationGet(void) {
+    return (jint)DISPLAY_ORIENTATION_get();
+}
+
+jboolean javaDisplayWebpSetNextMaxSize(jint max_width, jint max_height) {
+    return DISPLAY_WEBP_set_next_max_size(max_width, max_height) ? JTRUE : JFALSE;
 }
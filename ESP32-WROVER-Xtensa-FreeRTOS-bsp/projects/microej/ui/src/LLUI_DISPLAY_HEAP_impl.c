@@ -9,11 +9,21 @@
  * @file
  * @brief This MicroUI images heap allocator replaces the default allocator embedded in the
  * MicroUI Graphics Engine. It is using a best fit allocator and provides some additional APIs
- * to retrieve the heap information: total space, free space, number of blocks allocated.
+ * to retrieve the heap information: total space, free space, number of blocks allocated,
+ * high water mark and free blocks (largest one, histogram, fragmentation).
+ *
+ * The small allocations can be served by a slab layer (see MICROUI_HEAP_SLAB_ENABLED): the
+ * slab pages are best fit blocks cut in slots of a single size, the free slots of a page
+ * are linked through their first word. The heap information is the best fit one: a slab
+ * page counts as one allocated block.
+ *
+ * The best fit allocator does not expose its free list: the allocated blocks addresses are
+ * kept sorted and the free blocks are the gaps between them (the allocator merges the
+ * adjacent free blocks).
  *
  * @see LLUI_DISPLAY_impl.h file comment
  * @author MicroEJ Developer Team
- * @version 1.1.0
+ * @version 1.2.0
  * @date 16 July 2021
  * @since MicroEJ UI Pack 13.1.0
  */
@@ -22,8 +32,10 @@
 // Includes
 // -----------------------------------------------------------------------------
 
+#include <string.h>
 #include "microui_heap.h"
 #include "BESTFIT_ALLOCATOR.h"
+#include "sni.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -45,6 +57,58 @@ extern "C" {
  */
 #define BESTFITALLOCATOR_BLOCK_SIZE(block) ((*(uint32_t*)((block)-sizeof(uint32_t))) & 0x7ffffff)
 
+/*
+ * @brief Retrieves the address of the block header (start of the full block).
+ */
+#define BESTFITALLOCATOR_BLOCK_START(block) ((block)-sizeof(uint32_t))
+
+/*
+ * @brief Size of the blocks of the first class of the free blocks histogram.
+ */
+#define HISTOGRAM_FIRST_CLASS_SIZE (256)
+
+#ifdef MICROUI_HEAP_SLAB_ENABLED
+
+/*
+ * @brief Number of slab size classes.
+ */
+#define SLAB_CLASSES_NUMBER (sizeof(slab_class_sizes) / sizeof(slab_class_sizes[0]))
+
+// --------------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Slab page header, followed by the slots.
+ */
+typedef struct slab_page
+{
+	struct slab_page* next;     // next page of the same size class
+	void* free_slots;           // linked list of the free slots
+	uint16_t slot_size;
+	uint16_t used_slots_number;
+	uint32_t slots_number;
+} slab_page_t;
+
+/*
+ * @brief Size of the page header, rounded to 8 bytes: the slots keep the alignment of the
+ * page, which is a best fit block (4-byte aligned).
+ */
+#define SLAB_PAGE_HEADER_SIZE ((sizeof(slab_page_t) + 7u) & ~7u)
+
+#endif // MICROUI_HEAP_SLAB_ENABLED
+
+/*
+ * @brief Number of tracked slab pages: the slab pages are always tracked, on top of the
+ * MICROUI_HEAP_TRACKED_BLOCKS other blocks. An untracked page kept for the alloc/free
+ * bursts would leave the free blocks unknown after all the blocks are freed.
+ */
+#ifdef MICROUI_HEAP_SLAB_ENABLED
+#define SLAB_TRACKED_PAGES MICROUI_HEAP_SLAB_MAX_PAGES
+#else
+#define SLAB_TRACKED_PAGES 0
+#endif
+
 // --------------------------------------------------------------------------------
 // Private fields
 // --------------------------------------------------------------------------------
@@ -53,6 +117,152 @@ static BESTFIT_ALLOCATOR image_heap;
 static uint32_t heap_size;
 static uint32_t free_space;
 static uint32_t allocated_blocks_number;
+static uint32_t max_used_space;
+
+/*
+ * @brief Range of the blocks: the heap without the allocator main header.
+ */
+static uint8_t* blocks_start;
+static uint8_t* blocks_end;
+
+/*
+ * @brief Allocated blocks, sorted by address, and number of blocks which did not fit in
+ * the array.
+ */
+static uint8_t* tracked_blocks[MICROUI_HEAP_TRACKED_BLOCKS + SLAB_TRACKED_PAGES];
+static uint32_t tracked_blocks_number;
+static uint32_t untracked_blocks_number;
+
+#ifdef MICROUI_HEAP_SLAB_ENABLED
+
+static const uint16_t slab_class_sizes[] = MICROUI_HEAP_SLAB_CLASSES;
+
+/*
+ * @brief Pages of each size class, and all the pages sorted by address to find the page
+ * of a slot.
+ */
+static slab_page_t* slab_classes[SLAB_CLASSES_NUMBER];
+static slab_page_t* slab_pages[MICROUI_HEAP_SLAB_MAX_PAGES];
+static uint32_t slab_pages_number;
+
+#endif // MICROUI_HEAP_SLAB_ENABLED
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Returns the index of the first tracked block whose address is greater than or
+ * equal to the given one.
+ */
+static uint32_t MICROUI_HEAP_find_block(uint8_t* block)
+{
+	uint32_t low = 0;
+	uint32_t high = tracked_blocks_number;
+
+	while (low < high)
+	{
+		uint32_t middle = (low + high) / 2;
+		if (tracked_blocks[middle] < block)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+	return low;
+}
+
+/*
+ * @brief Tracks an allocated block when fewer than the given number of blocks are tracked.
+ */
+static void MICROUI_HEAP_track_block(uint8_t* block, uint32_t limit)
+{
+	if (tracked_blocks_number < limit)
+	{
+		uint32_t index = MICROUI_HEAP_find_block(block);
+		memmove(&tracked_blocks[index + 1], &tracked_blocks[index], (tracked_blocks_number - index) * sizeof(uint8_t*));
+		tracked_blocks[index] = block;
+		tracked_blocks_number++;
+	}
+	else
+	{
+		untracked_blocks_number++;
+	}
+}
+
+static void MICROUI_HEAP_untrack_block(uint8_t* block)
+{
+	uint32_t index = MICROUI_HEAP_find_block(block);
+
+	if ((index < tracked_blocks_number) && (tracked_blocks[index] == block))
+	{
+		tracked_blocks_number--;
+		memmove(&tracked_blocks[index], &tracked_blocks[index + 1], (tracked_blocks_number - index) * sizeof(uint8_t*));
+	}
+	else
+	{
+		untracked_blocks_number--;
+	}
+}
+
+/*
+ * @brief Walks the free blocks (the gaps between the allocated blocks). Fills the largest
+ * free block size, the free space and the histogram (when not null); returns the number of
+ * free blocks, or MICROUI_HEAP_UNKNOWN when some allocated blocks are not tracked.
+ */
+static uint32_t MICROUI_HEAP_walk_free_blocks(uint32_t* largest, uint32_t* total, uint32_t* histogram)
+{
+	uint32_t count = 0;
+	uint8_t* free_start = blocks_start;
+
+	*largest = 0;
+	*total = 0;
+	if ((uint32_t*)0 != histogram)
+	{
+		memset(histogram, 0, MICROUI_HEAP_HISTOGRAM_SIZE * sizeof(uint32_t));
+	}
+
+	if (0 != untracked_blocks_number)
+	{
+		return MICROUI_HEAP_UNKNOWN;
+	}
+
+	for (uint32_t i = 0; i <= tracked_blocks_number; i++)
+	{
+		uint8_t* free_end = (i < tracked_blocks_number) ? BESTFITALLOCATOR_BLOCK_START(tracked_blocks[i]) : blocks_end;
+
+		if (free_end > free_start)
+		{
+			uint32_t size = (uint32_t)(free_end - free_start);
+			count++;
+			*total += size;
+			if (size > *largest)
+			{
+				*largest = size;
+			}
+			if ((uint32_t*)0 != histogram)
+			{
+				uint32_t bucket = 0;
+				uint32_t class_limit = HISTOGRAM_FIRST_CLASS_SIZE;
+				while ((size >= class_limit) && (bucket < (MICROUI_HEAP_HISTOGRAM_SIZE - 1)))
+				{
+					bucket++;
+					class_limit <<= 1;
+				}
+				histogram[bucket]++;
+			}
+		}
+
+		if (i < tracked_blocks_number)
+		{
+			free_start = BESTFITALLOCATOR_BLOCK_START(tracked_blocks[i]) + BESTFITALLOCATOR_BLOCK_SIZE(tracked_blocks[i]);
+		}
+	}
+	return count;
+}
 
 // --------------------------------------------------------------------------------
 // microui_heap.h functions
@@ -73,6 +283,232 @@ uint32_t MICROUI_HEAP_number_of_allocated_blocks(void)
 	return allocated_blocks_number;
 }
 
+uint32_t MICROUI_HEAP_high_water_mark(void)
+{
+	return max_used_space;
+}
+
+uint32_t MICROUI_HEAP_largest_free_block(void)
+{
+	uint32_t largest;
+	uint32_t total;
+	if (MICROUI_HEAP_UNKNOWN == MICROUI_HEAP_walk_free_blocks(&largest, &total, (uint32_t*)0))
+	{
+		return MICROUI_HEAP_UNKNOWN;
+	}
+	return largest;
+}
+
+uint32_t MICROUI_HEAP_fragmentation(void)
+{
+	uint32_t largest;
+	uint32_t total;
+	if (MICROUI_HEAP_UNKNOWN == MICROUI_HEAP_walk_free_blocks(&largest, &total, (uint32_t*)0))
+	{
+		return MICROUI_HEAP_UNKNOWN;
+	}
+	return (0 == total) ? 0 : (100 - (uint32_t)(((uint64_t)largest * 100) / total));
+}
+
+uint32_t MICROUI_HEAP_free_blocks_histogram(uint32_t* histogram)
+{
+	uint32_t largest;
+	uint32_t total;
+	return MICROUI_HEAP_walk_free_blocks(&largest, &total, histogram);
+}
+
+// --------------------------------------------------------------------------------
+// Best fit allocator
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Allocates a block in the best fit heap; the block is tracked when fewer than the
+ * given number of blocks are tracked.
+ */
+static uint8_t* MICROUI_HEAP_bestfit_allocate(uint32_t size, uint32_t tracked_limit)
+{
+	uint8_t* addr = (uint8_t*)BESTFIT_ALLOCATOR_allocate(&image_heap, (int32_t)size);
+
+	if ((uint8_t*)0 != addr)
+	{
+		free_space -= BESTFITALLOCATOR_BLOCK_SIZE(addr);
+		if ((heap_size - free_space) > max_used_space)
+		{
+			max_used_space = heap_size - free_space;
+		}
+		MICROUI_HEAP_track_block(addr, tracked_limit);
+	}
+	return addr;
+}
+
+static void MICROUI_HEAP_bestfit_free(uint8_t* block)
+{
+	free_space += BESTFITALLOCATOR_BLOCK_SIZE(block);
+	MICROUI_HEAP_untrack_block(block);
+	BESTFIT_ALLOCATOR_free(&image_heap, (void*)block);
+}
+
+// --------------------------------------------------------------------------------
+// Slab allocator
+// --------------------------------------------------------------------------------
+
+#ifdef MICROUI_HEAP_SLAB_ENABLED
+
+/*
+ * @brief Returns the page which holds the given block, or null when the block is not a
+ * slot.
+ */
+static slab_page_t* MICROUI_HEAP_slab_find_page(uint8_t* block)
+{
+	uint32_t low = 0;
+	uint32_t high = slab_pages_number;
+
+	// last page whose address is lower than the block
+	while (low < high)
+	{
+		uint32_t middle = (low + high) / 2;
+		if ((uint8_t*)slab_pages[middle] < block)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+	if ((0 != low) && (block < ((uint8_t*)slab_pages[low - 1] + MICROUI_HEAP_SLAB_PAGE_SIZE)))
+	{
+		return slab_pages[low - 1];
+	}
+	return (slab_page_t*)0;
+}
+
+static slab_page_t* MICROUI_HEAP_slab_new_page(uint32_t class_index)
+{
+	slab_page_t* page = (slab_page_t*)0;
+
+	if (slab_pages_number < MICROUI_HEAP_SLAB_MAX_PAGES)
+	{
+		// the tracked pages do not count in MICROUI_HEAP_TRACKED_BLOCKS
+		page = (slab_page_t*)MICROUI_HEAP_bestfit_allocate(MICROUI_HEAP_SLAB_PAGE_SIZE, MICROUI_HEAP_TRACKED_BLOCKS + slab_pages_number + 1);
+	}
+
+	if ((slab_page_t*)0 != page)
+	{
+		uint32_t slot_size = slab_class_sizes[class_index];
+		uint8_t* slot = (uint8_t*)page + SLAB_PAGE_HEADER_SIZE;
+		uint32_t index = slab_pages_number;
+
+		page->slot_size = (uint16_t)slot_size;
+		page->used_slots_number = 0;
+		page->slots_number = (MICROUI_HEAP_SLAB_PAGE_SIZE - SLAB_PAGE_HEADER_SIZE) / slot_size;
+		page->free_slots = (void*)0;
+		for (uint32_t i = 0; i < page->slots_number; i++)
+		{
+			// link the slots by increasing address
+			uint8_t* last = slot + ((page->slots_number - 1 - i) * slot_size);
+			*(void**)last = page->free_slots;
+			page->free_slots = last;
+		}
+
+		page->next = slab_classes[class_index];
+		slab_classes[class_index] = page;
+
+		// keep the pages sorted by address
+		while ((0 != index) && (slab_pages[index - 1] > page))
+		{
+			slab_pages[index] = slab_pages[index - 1];
+			index--;
+		}
+		slab_pages[index] = page;
+		slab_pages_number++;
+	}
+	return page;
+}
+
+static void MICROUI_HEAP_slab_free_page(uint32_t class_index, slab_page_t* page)
+{
+	slab_page_t** link = &slab_classes[class_index];
+	uint32_t index = 0;
+
+	while (*link != page)
+	{
+		link = &(*link)->next;
+	}
+	*link = page->next;
+
+	while (slab_pages[index] != page)
+	{
+		index++;
+	}
+	slab_pages_number--;
+	memmove(&slab_pages[index], &slab_pages[index + 1], (slab_pages_number - index) * sizeof(slab_page_t*));
+
+	MICROUI_HEAP_bestfit_free((uint8_t*)page);
+}
+
+/*
+ * @brief Allocates a slot, or returns null when the size is not a small one or when no
+ * page can be allocated.
+ */
+static uint8_t* MICROUI_HEAP_slab_allocate(uint32_t size)
+{
+	uint32_t class_index = 0;
+	slab_page_t* page;
+	uint8_t* slot;
+
+	while ((class_index < SLAB_CLASSES_NUMBER) && (size > slab_class_sizes[class_index]))
+	{
+		class_index++;
+	}
+	if ((0 == size) || (SLAB_CLASSES_NUMBER == class_index))
+	{
+		return (uint8_t*)0;
+	}
+
+	page = slab_classes[class_index];
+	while (((slab_page_t*)0 != page) && ((void*)0 == page->free_slots))
+	{
+		page = page->next;
+	}
+	if ((slab_page_t*)0 == page)
+	{
+		page = MICROUI_HEAP_slab_new_page(class_index);
+		if ((slab_page_t*)0 == page)
+		{
+			return (uint8_t*)0;
+		}
+	}
+
+	slot = (uint8_t*)page->free_slots;
+	page->free_slots = *(void**)slot;
+	page->used_slots_number++;
+	return slot;
+}
+
+static void MICROUI_HEAP_slab_free(slab_page_t* page, uint8_t* block)
+{
+	*(void**)block = page->free_slots;
+	page->free_slots = block;
+	page->used_slots_number--;
+
+	if (0 == page->used_slots_number)
+	{
+		uint32_t class_index = 0;
+		while (slab_class_sizes[class_index] != page->slot_size)
+		{
+			class_index++;
+		}
+		// keep the last page of the class to absorb the alloc/free bursts
+		if ((slab_classes[class_index] != page) || ((slab_page_t*)0 != page->next))
+		{
+			MICROUI_HEAP_slab_free_page(class_index, page);
+		}
+	}
+}
+
+#endif // MICROUI_HEAP_SLAB_ENABLED
+
 // --------------------------------------------------------------------------------
 // LLUI_DISPLAY_impl.h functions
 // --------------------------------------------------------------------------------
@@ -82,17 +518,37 @@ void LLUI_DISPLAY_IMPL_image_heap_initialize(uint8_t* heap_start, uint8_t* heap_
 {
 	heap_size = heap_limit - heap_start - BESTFITALLOCATOR_HEADER_SIZE;
 	free_space = heap_size;
+	max_used_space = 0;
+	blocks_start = heap_start + BESTFITALLOCATOR_HEADER_SIZE;
+	blocks_end = heap_limit;
+	tracked_blocks_number = 0;
+	untracked_blocks_number = 0;
+#ifdef MICROUI_HEAP_SLAB_ENABLED
+	memset(slab_classes, 0, sizeof(slab_classes));
+	slab_pages_number = 0;
+#endif
 	BESTFIT_ALLOCATOR_new(&image_heap);
-	BESTFIT_ALLOCATOR_initialize(&image_heap, (int32_t)heap_start, (int32_t)heap_limit);
+	BESTFIT_ALLOCATOR_initialize(&image_heap, (int32_t)(uintptr_t)heap_start, (int32_t)(uintptr_t)heap_limit);
 }
 
 uint8_t* LLUI_DISPLAY_IMPL_image_heap_allocate(uint32_t size)
 {
-	uint8_t* addr = (uint8_t*)BESTFIT_ALLOCATOR_allocate(&image_heap, (int32_t)size);
+	uint8_t* addr = (uint8_t*)0;
+
+#ifdef MICROUI_HEAP_SLAB_ENABLED
+	addr = MICROUI_HEAP_slab_allocate(size);
+#endif
+	if ((uint8_t*)0 == addr)
+	{
+#ifdef MICROUI_HEAP_SLAB_ENABLED
+		addr = MICROUI_HEAP_bestfit_allocate(size, MICROUI_HEAP_TRACKED_BLOCKS + slab_pages_number);
+#else
+		addr = MICROUI_HEAP_bestfit_allocate(size, MICROUI_HEAP_TRACKED_BLOCKS);
+#endif
+	}
 
 	if ((uint8_t*)0 != addr)
 	{
-		free_space -= BESTFITALLOCATOR_BLOCK_SIZE(addr);
 		allocated_blocks_number++;
 	}
 	return addr;
@@ -100,9 +556,62 @@ uint8_t* LLUI_DISPLAY_IMPL_image_heap_allocate(uint32_t size)
 
 void LLUI_DISPLAY_IMPL_image_heap_free(uint8_t* block)
 {
-	free_space += BESTFITALLOCATOR_BLOCK_SIZE(block);
 	allocated_blocks_number--;
-	BESTFIT_ALLOCATOR_free(&image_heap, (void*)block);
+#ifdef MICROUI_HEAP_SLAB_ENABLED
+	slab_page_t* page = MICROUI_HEAP_slab_find_page(block);
+	if ((slab_page_t*)0 != page)
+	{
+		MICROUI_HEAP_slab_free(page, block);
+		return;
+	}
+#endif
+	MICROUI_HEAP_bestfit_free(block);
+}
+
+// --------------------------------------------------------------------------------
+// Java API
+// --------------------------------------------------------------------------------
+
+uint32_t javaImageHeapGetTotalSpace(void)
+{
+	return MICROUI_HEAP_total_space();
+}
+
+uint32_t javaImageHeapGetFreeSpace(void)
+{
+	return MICROUI_HEAP_free_space();
+}
+
+uint32_t javaImageHeapGetHighWaterMark(void)
+{
+	return MICROUI_HEAP_high_water_mark();
+}
+
+uint32_t javaImageHeapGetLargestFreeBlock(void)
+{
+	return MICROUI_HEAP_largest_free_block();
+}
+
+uint32_t javaImageHeapGetFragmentation(void)
+{
+	return MICROUI_HEAP_fragmentation();
+}
+
+/*
+ * @brief Fills the given Java int array with the free blocks histogram (at most
+ * MICROUI_HEAP_HISTOGRAM_SIZE elements) and returns the number of free blocks.
+ */
+uint32_t javaImageHeapGetFreeBlocksHistogram(jint* histogram)
+{
+	uint32_t classes[MICROUI_HEAP_HISTOGRAM_SIZE];
+	uint32_t count = MICROUI_HEAP_free_blocks_histogram(classes);
+	uint32_t length = (uint32_t)SNI_getArrayLength(histogram);
+
+	for (uint32_t i = 0; (i < length) && (i < MICROUI_HEAP_HISTOGRAM_SIZE); i++)
+	{
+		histogram[i] = (jint)classes[i];
+	}
+	return count;
 }
 
 // --------------------------------------------------------------------------------
@@ -27,6 +27,12 @@
 // use graphical engine functions to synchronize drawings
 #include "LLUI_DISPLAY.h"
 
+// records the drawings
+#include "drawing_trace.h"
+
+// collects the drawings statistics
+#include "drawing_stats.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -35,9 +41,9 @@ extern "C" {
 // Macros and Defines
 // --------------------------------------------------------------------------------
 
-// macros to log a drawing
-#define LOG_DRAW_START(fn) LLUI_DISPLAY_logDrawingStart(CONCAT_DEFINES(LOG_DRAW_, fn))
-#define LOG_DRAW_END(fn) LLUI_DISPLAY_logDrawingEnd(CONCAT_DEFINES(LOG_DRAW_, fn))
+// macros to log a drawing and to collect its statistics
+#define LOG_DRAW_START(fn) do { LLUI_DISPLAY_logDrawingStart(CONCAT_DEFINES(LOG_DRAW_, fn)); DRAWING_STATS_START(); } while (0)
+#define LOG_DRAW_END(fn) do { DRAWING_STATS_END(CONCAT_DEFINES(LOG_DRAW_, fn)); LLUI_DISPLAY_logDrawingEnd(CONCAT_DEFINES(LOG_DRAW_, fn)); } while (0)
 
 #define MICROUI_PAINTER_NATIVE_NAME(fn) (CONCAT_DEFINES(MICROUI_PAINTER_NATIVE_PREFIX, fn))
 
@@ -99,6 +105,8 @@ void MICROUI_PAINTER_NATIVE(writePixel, MICROUI_GraphicsContext* gc, jint x, jin
 		if (LLUI_DISPLAY_isPixelInClip(gc, x, y))
 		{
 			LLUI_DISPLAY_configureClip(gc, false/* point is in clip */);
+			DRAWING_TRACE_RECORD(gc, writePixel, x, y);
+			DRAWING_STATS_REGION(gc, x, y, x, y);
 			status = UI_DRAWING_writePixel(gc, x, y);
 		}
 		else
@@ -118,6 +126,8 @@ void MICROUI_PAINTER_NATIVE(drawLine, MICROUI_GraphicsContext* gc, jint startX,
 	{
 		LOG_DRAW_START(drawLine);
 		// cannot reduce/clip line: may be endX < startX and / or endY < startY
+		DRAWING_TRACE_RECORD(gc, drawLine, startX, startY, endX, endY);
+		DRAWING_STATS_REGION(gc, startX, startY, endX, endY);
 		LLUI_DISPLAY_setDrawingStatus(UI_DRAWING_drawLine(gc, startX, startY, endX, endY));
 		LOG_DRAW_END(drawLine);
 	}
@@ -138,6 +148,8 @@ void MICROUI_PAINTER_NATIVE(drawHorizontalLine, MICROUI_GraphicsContext* gc, jin
 		if (length > 0 && LLUI_DISPLAY_clipHorizontalLine(gc, &x1, &x2, y))
 		{
 			LLUI_DISPLAY_configureClip(gc, false /* line has been clipped */);
+			DRAWING_TRACE_RECORD(gc, drawHorizontalLine, x1, x2, y);
+			DRAWING_STATS_REGION(gc, x1, y, x2, y);
 			status = UI_DRAWING_drawHorizontalLine(gc, x1, x2, y);
 		}
 		else
@@ -165,6 +177,8 @@ void MICROUI_PAINTER_NATIVE(drawVerticalLine, MICROUI_GraphicsContext* gc, jint
 		if (length > 0 && LLUI_DISPLAY_clipVerticalLine(gc, &y1, &y2, x))
 		{
 			LLUI_DISPLAY_configureClip(gc, false /* line has been clipped */);
+			DRAWING_TRACE_RECORD(gc, drawVerticalLine, x, y1, y2);
+			DRAWING_STATS_REGION(gc, x, y1, x, y2);
 			status = UI_DRAWING_drawVerticalLine(gc, x, y1, y2);
 		}
 		else
@@ -195,6 +209,8 @@ void MICROUI_PAINTER_NATIVE(drawRectangle, MICROUI_GraphicsContext* gc, jint x,
 
 			// cannot reduce rectangle; can only check if it is fully in clip
 			LLUI_DISPLAY_configureClip(gc, !LLUI_DISPLAY_isRectangleInClip(gc, x1, y1, x2, y2));
+			DRAWING_TRACE_RECORD(gc, drawRectangle, x1, y1, x2, y2);
+			DRAWING_STATS_REGION(gc, x1, y1, x2, y2);
 			status = UI_DRAWING_drawRectangle(gc, x1, y1, x2, y2);
 		}
 		else
@@ -224,6 +240,8 @@ void MICROUI_PAINTER_NATIVE(fillRectangle, MICROUI_GraphicsContext* gc, jint x,
 		if (width > 0 && height > 0 && LLUI_DISPLAY_clipRectangle(gc, &x1, &y1, &x2, &y2))
 		{
 			LLUI_DISPLAY_configureClip(gc, false /* rectangle has been clipped */);
+			DRAWING_TRACE_RECORD(gc, fillRectangle, x1, y1, x2, y2);
+			DRAWING_STATS_REGION(gc, x1, y1, x2, y2);
 			status = UI_DRAWING_fillRectangle(gc, x1, y1, x2, y2);
 		}
 		else
@@ -249,6 +267,8 @@ void MICROUI_PAINTER_NATIVE(drawRoundedRectangle, MICROUI_GraphicsContext* gc, j
 		{
 			// cannot reduce rectangle; can only check if it is fully in clip
 			LLUI_DISPLAY_configureClip(gc, !LLUI_DISPLAY_isRegionInClip(gc, x, y, width, height));
+			DRAWING_TRACE_RECORD(gc, drawRoundedRectangle, x, y, width, height, cornerEllipseWidth, cornerEllipseHeight);
+			DRAWING_STATS_REGION(gc, x, y, x + width - 1, y + height - 1);
 			status = UI_DRAWING_drawRoundedRectangle(gc, x, y, width, height, cornerEllipseWidth, cornerEllipseHeight);
 		}
 		else
@@ -274,6 +294,8 @@ void MICROUI_PAINTER_NATIVE(fillRoundedRectangle, MICROUI_GraphicsContext* gc, j
 		{
 			// cannot reduce rectangle; can only check if it is fully in clip
 			LLUI_DISPLAY_configureClip(gc, !LLUI_DISPLAY_isRegionInClip(gc, x, y, width, height));
+			DRAWING_TRACE_RECORD(gc, fillRoundedRectangle, x, y, width, height, cornerEllipseWidth, cornerEllipseHeight);
+			DRAWING_STATS_REGION(gc, x, y, x + width - 1, y + height - 1);
 			status = UI_DRAWING_fillRoundedRectangle(gc, x, y, width, height, cornerEllipseWidth, cornerEllipseHeight);
 		}
 		else
@@ -299,6 +321,8 @@ void MICROUI_PAINTER_NATIVE(drawCircleArc, MICROUI_GraphicsContext* gc, jint x,
 		{
 			// cannot reduce rectangle; can only check if it is fully in clip
 			LLUI_DISPLAY_configureClip(gc, !LLUI_DISPLAY_isRegionInClip(gc, x, y, diameter, diameter));
+			DRAWING_TRACE_RECORD(gc, drawCircleArc, x, y, diameter, DRAWING_TRACE_FLOAT(startAngle), DRAWING_TRACE_FLOAT(arcAngle));
+			DRAWING_STATS_REGION(gc, x, y, x + diameter - 1, y + diameter - 1);
 			status = UI_DRAWING_drawCircleArc(gc, x, y, diameter, startAngle, arcAngle);
 		}
 		else
@@ -324,6 +348,8 @@ void MICROUI_PAINTER_NATIVE(drawEllipseArc, MICROUI_GraphicsContext* gc, jint x,
 		{
 			// cannot reduce rectangle; can only check if it is fully in clip
 			LLUI_DISPLAY_configureClip(gc, !LLUI_DISPLAY_isRegionInClip(gc, x, y, width, height));
+			DRAWING_TRACE_RECORD(gc, drawEllipseArc, x, y, width, height, DRAWING_TRACE_FLOAT(startAngle), DRAWING_TRACE_FLOAT(arcAngle));
+			DRAWING_STATS_REGION(gc, x, y, x + width - 1, y + height - 1);
 			status = UI_DRAWING_drawEllipseArc(gc, x, y, width, height, startAngle, arcAngle);
 		}
 		else
@@ -349,6 +375,8 @@ void MICROUI_PAINTER_NATIVE(fillCircleArc, MICROUI_GraphicsContext* gc, jint x,
 		{
 			// cannot reduce rectangle; can only check if it is fully in clip
 			LLUI_DISPLAY_configureClip(gc, !LLUI_DISPLAY_isRegionInClip(gc, x, y, diameter, diameter));
+			DRAWING_TRACE_RECORD(gc, fillCircleArc, x, y, diameter, DRAWING_TRACE_FLOAT(startAngle), DRAWING_TRACE_FLOAT(arcAngle));
+			DRAWING_STATS_REGION(gc, x, y, x + diameter - 1, y + diameter - 1);
 			status = UI_DRAWING_fillCircleArc(gc, x, y, diameter, startAngle, arcAngle);
 		}
 		else
@@ -374,6 +402,8 @@ void MICROUI_PAINTER_NATIVE(fillEllipseArc, MICROUI_GraphicsContext* gc, jint x,
 		{
 			// cannot reduce rectangle; can only check if it is fully in clip
 			LLUI_DISPLAY_configureClip(gc, !LLUI_DISPLAY_isRegionInClip(gc, x, y, width, height));
+			DRAWING_TRACE_RECORD(gc, fillEllipseArc, x, y, width, height, DRAWING_TRACE_FLOAT(startAngle), DRAWING_TRACE_FLOAT(arcAngle));
+			DRAWING_STATS_REGION(gc, x, y, x + width - 1, y + height - 1);
 			status = UI_DRAWING_fillEllipseArc(gc, x, y, width, height, startAngle, arcAngle);
 		}
 		else
@@ -399,6 +429,8 @@ void MICROUI_PAINTER_NATIVE(drawEllipse, MICROUI_GraphicsContext* gc, jint x, ji
 		{
 			// cannot reduce rectangle; can only check if it is fully in clip
 			LLUI_DISPLAY_configureClip(gc, !LLUI_DISPLAY_isRegionInClip(gc, x, y, width, height));
+			DRAWING_TRACE_RECORD(gc, drawEllipse, x, y, width, height);
+			DRAWING_STATS_REGION(gc, x, y, x + width - 1, y + height - 1);
 			status = UI_DRAWING_drawEllipse(gc, x, y, width, height);
 		}
 		else
@@ -424,6 +456,8 @@ void MICROUI_PAINTER_NATIVE(fillEllipse, MICROUI_GraphicsContext* gc, jint x, ji
 		{
 			// cannot reduce rectangle; can only check if it is fully in clip
 			LLUI_DISPLAY_configureClip(gc, !LLUI_DISPLAY_isRegionInClip(gc, x, y, width, height));
+			DRAWING_TRACE_RECORD(gc, fillEllipse, x, y, width, height);
+			DRAWING_STATS_REGION(gc, x, y, x + width - 1, y + height - 1);
 			status = UI_DRAWING_fillEllipse(gc, x, y, width, height);
 		}
 		else
@@ -449,6 +483,8 @@ void MICROUI_PAINTER_NATIVE(drawCircle, MICROUI_GraphicsContext* gc, jint x, jin
 		{
 			// cannot reduce rectangle; can only check if it is fully in clip
 			LLUI_DISPLAY_configureClip(gc, !LLUI_DISPLAY_isRegionInClip(gc, x, y, diameter, diameter));
+			DRAWING_TRACE_RECORD(gc, drawCircle, x, y, diameter);
+			DRAWING_STATS_REGION(gc, x, y, x + diameter - 1, y + diameter - 1);
 			status = UI_DRAWING_drawCircle(gc, x, y, diameter);
 		}
 		else
@@ -474,6 +510,8 @@ void MICROUI_PAINTER_NATIVE(fillCircle, MICROUI_GraphicsContext* gc, jint x, jin
 		{
 			// cannot reduce rectangle; can only check if it is fully in clip
 			LLUI_DISPLAY_configureClip(gc, !LLUI_DISPLAY_isRegionInClip(gc, x, y, diameter, diameter));
+			DRAWING_TRACE_RECORD(gc, fillCircle, x, y, diameter);
+			DRAWING_STATS_REGION(gc, x, y, x + diameter - 1, y + diameter - 1);
 			status = UI_DRAWING_fillCircle(gc, x, y, diameter);
 		}
 		else
@@ -510,6 +548,8 @@ void MICROUI_PAINTER_NATIVE(drawImage, MICROUI_GraphicsContext* gc, MICROUI_Imag
 			if (width > 0 && height > 0 && LLUI_DISPLAY_clipRegion(gc, &regionX, &regionY, &width, &height, &x, &y))
 			{
 				LLUI_DISPLAY_configureClip(gc, false /* region has been clipped */);
+				DRAWING_TRACE_RECORD(gc, drawImage, DRAWING_TRACE_IMAGE(img), regionX, regionY, width, height, x, y, alpha);
+				DRAWING_STATS_REGION(gc, x, y, x + width - 1, y + height - 1);
 				status = UI_DRAWING_drawImage(gc, img, regionX, regionY, width, height, x, y, alpha);
 			}
 			// else: nothing to do
@@ -0,0 +1,325 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Dirty regions detection for the LCD flush.
+ *
+ * MicroUI gives a single bounding box per flush. This module splits the screen in tiles,
+ * keeps a signature of each tile as it has been sent to the LCD, and rebuilds the list of
+ * rectangles which really changed inside the bounding box. The rectangles are kept in a
+ * bounded queue and merged according to the cost of the LCD window setup.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+#include "display_dirty_regions.h"
+
+#ifdef LLUI_DISPLAY_DIRTY_REGIONS_ENABLED
+
+/* Defines -------------------------------------------------------------------*/
+
+#define BYTES_PER_PIXEL (LLUI_DISPLAY_BPP / 8)
+
+/* MurmurHash3 (x86, 32-bit) parameters used to compute the tiles signatures */
+#define SIGNATURE_SEED 0x9747B28Cu
+#define SIGNATURE_C1   0xCC9E2D51u
+#define SIGNATURE_C2   0x1B873593u
+
+/* Globals -------------------------------------------------------------------*/
+
+/* Signature of each tile, as sent to the LCD */
+static uint32_t signatures[DISPLAY_DIRTY_REGIONS_MAX_TILES][DISPLAY_DIRTY_REGIONS_MAX_TILES];
+
+/* false until the signatures match the LCD content */
+static bool signatures_valid = false;
+
+/* true when the whole tile has been sent to the LCD since the signatures are valid */
+static bool tiles_known[DISPLAY_DIRTY_REGIONS_MAX_TILES][DISPLAY_DIRTY_REGIONS_MAX_TILES];
+
+/* Next tile to refresh whatever its signature */
+static uint32_t refresh_index = 0;
+
+static display_dirty_regions_stats_t stats;
+
+/* Private functions ---------------------------------------------------------*/
+
+static inline uint32_t rect_bytes(const display_rect_t* rect) {
+    return (uint32_t)(rect->x2 - rect->x1 + 1) * (uint32_t)(rect->y2 - rect->y1 + 1) * BYTES_PER_PIXEL;
+}
+
+static inline display_rect_t rect_union(const display_rect_t* a, const display_rect_t* b) {
+    display_rect_t u;
+    u.x1 = (a->x1 < b->x1) ? a->x1 : b->x1;
+    u.y1 = (a->y1 < b->y1) ? a->y1 : b->y1;
+    u.x2 = (a->x2 > b->x2) ? a->x2 : b->x2;
+    u.y2 = (a->y2 > b->y2) ? a->y2 : b->y2;
+    return u;
+}
+
+/*
+ * Extra cost in bytes of sending the union of two rectangles instead of each of them.
+ * A negative value means the union is cheaper (the rectangles overlap).
+ */
+static inline int32_t merge_cost(const display_rect_t* a, const display_rect_t* b) {
+    display_rect_t u = rect_union(a, b);
+    return (int32_t)rect_bytes(&u) - (int32_t)rect_bytes(a) - (int32_t)rect_bytes(b);
+}
+
+static inline void remove_rect(display_dirty_regions_t* regions, uint32_t index) {
+    regions->count--;
+    regions->rects[index] = regions->rects[regions->count];
+}
+
+static inline uint32_t rotl32(uint32_t x, uint32_t r) {
+    return (x << r) | (x >> (32 - r));
+}
+
+/*
+ * Mix a word into the signature (MurmurHash3 block). The multiplications and rotations spread
+ * every bit of the word over the whole signature: unlike a xor-multiply hash (FNV-1a on words),
+ * two changes of the same bit in two words never cancel each other out.
+ */
+static inline uint32_t signature_mix(uint32_t signature, uint32_t word) {
+    word *= SIGNATURE_C1;
+    word = rotl32(word, 15);
+    word *= SIGNATURE_C2;
+    signature ^= word;
+    signature = rotl32(signature, 13);
+    return (signature * 5) + 0xE6546B64u;
+}
+
+/*
+ * Signature of the pixels of the given rectangle (MurmurHash3 of its rows). Rows are read word
+ * by word: the tile size and the screen width keep the rows word-aligned.
+ */
+static uint32_t tile_signature(const uint8_t* buffer, uint32_t width, uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2) {
+    uint32_t signature = SIGNATURE_SEED;
+    uint32_t row_bytes = (x2 - x1 + 1) * BYTES_PER_PIXEL;
+    uint32_t row_words = row_bytes / sizeof(uint32_t);
+
+    for (uint32_t y = y1; y <= y2; y++) {
+        const uint8_t* row = buffer + (((y * width) + x1) * BYTES_PER_PIXEL);
+        const uint32_t* words = (const uint32_t*)row;
+        for (uint32_t i = 0; i < row_words; i++) {
+            signature = signature_mix(signature, words[i]);
+        }
+        for (uint32_t i = row_words * sizeof(uint32_t); i < row_bytes; i++) {
+            signature = signature_mix(signature, row[i]);
+        }
+    }
+
+    /* Final avalanche (MurmurHash3 fmix32) */
+    signature ^= signature >> 16;
+    signature *= 0x85EBCA6Bu;
+    signature ^= signature >> 13;
+    signature *= 0xC2B2AE35u;
+    signature ^= signature >> 16;
+    return signature;
+}
+
+/*
+ * A signature collision hides a change of a tile, which then stays stale on the LCD. To bound
+ * the time a stale tile can stay on the LCD, LLUI_DISPLAY_DIRTY_REGIONS_REFRESH_TILES tiles of
+ * the screen are sent on each flush whatever their signatures, in turn. The frame buffer holds
+ * the whole frame, so these tiles may lie outside the flush bounding box.
+ */
+static void refresh_tiles(display_dirty_regions_t* regions, const uint8_t* buffer, uint32_t width, uint32_t height) {
+    uint32_t tiles_x = (width + LLUI_DISPLAY_DIRTY_TILE_SIZE - 1) / LLUI_DISPLAY_DIRTY_TILE_SIZE;
+    uint32_t tiles_count = tiles_x * ((height + LLUI_DISPLAY_DIRTY_TILE_SIZE - 1) / LLUI_DISPLAY_DIRTY_TILE_SIZE);
+
+    for (uint32_t i = 0; i < LLUI_DISPLAY_DIRTY_REGIONS_REFRESH_TILES; i++) {
+        uint32_t tile = refresh_index % tiles_count; // the screen size changes with the orientation
+        uint32_t tx = tile % tiles_x;
+        uint32_t ty = tile / tiles_x;
+        uint32_t x1 = tx * LLUI_DISPLAY_DIRTY_TILE_SIZE;
+        uint32_t y1 = ty * LLUI_DISPLAY_DIRTY_TILE_SIZE;
+        uint32_t x2 = x1 + LLUI_DISPLAY_DIRTY_TILE_SIZE - 1;
+        uint32_t y2 = y1 + LLUI_DISPLAY_DIRTY_TILE_SIZE - 1;
+
+        if (x2 >= width) {
+            x2 = width - 1;
+        }
+        if (y2 >= height) {
+            y2 = height - 1;
+        }
+
+        /* The whole tile is sent: its signature now matches the LCD content */
+        signatures[ty][tx] = tile_signature(buffer, width, x1, y1, x2, y2);
+        tiles_known[ty][tx] = true;
+        DISPLAY_DIRTY_REGIONS_add(regions, x1, y1, x2, y2);
+        refresh_index = tile + 1;
+    }
+}
+
+/* API -----------------------------------------------------------------------*/
+
+void DISPLAY_DIRTY_REGIONS_clear(display_dirty_regions_t* regions) {
+    regions->count = 0;
+}
+
+void DISPLAY_DIRTY_REGIONS_add(display_dirty_regions_t* regions, uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2) {
+    display_rect_t rect = { (uint16_t)x1, (uint16_t)y1, (uint16_t)x2, (uint16_t)y2 };
+    bool merged;
+
+    /* Merge with the existing rectangles while it is worth it; a merge may enable another one */
+    do {
+        merged = false;
+        for (uint32_t i = 0; i < regions->count; i++) {
+            if (merge_cost(&rect, &regions->rects[i]) <= LLUI_DISPLAY_DIRTY_REGIONS_SETUP_COST) {
+                rect = rect_union(&rect, &regions->rects[i]);
+                remove_rect(regions, i);
+                merged = true;
+                break;
+            }
+        }
+    } while (merged);
+
+    if (regions->count < LLUI_DISPLAY_DIRTY_REGIONS_MAX) {
+        regions->rects[regions->count] = rect;
+        regions->count++;
+    } else {
+        /* Queue is full: merge the cheapest pair, the new rectangle included (index count) */
+        int32_t best_cost = INT32_MAX;
+        uint32_t best_i = 0;
+        uint32_t best_j = 0;
+        regions->rects[regions->count] = rect;
+        for (uint32_t i = 0; i < regions->count; i++) {
+            for (uint32_t j = i + 1; j <= regions->count; j++) {
+                int32_t cost = merge_cost(&regions->rects[i], &regions->rects[j]);
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_i = i;
+                    best_j = j;
+                }
+            }
+        }
+        regions->rects[best_i] = rect_union(&regions->rects[best_i], &regions->rects[best_j]);
+        regions->rects[best_j] = regions->rects[regions->count];
+    }
+}
+
+uint32_t DISPLAY_DIRTY_REGIONS_get_bytes(display_dirty_regions_t* regions) {
+    uint32_t bytes = 0;
+    for (uint32_t i = 0; i < regions->count; i++) {
+        bytes += rect_bytes(&regions->rects[i]);
+    }
+    return bytes;
+}
+
+void DISPLAY_DIRTY_REGIONS_invalidate(void) {
+    signatures_valid = false;
+}
+
+void DISPLAY_DIRTY_REGIONS_detect(display_dirty_regions_t* regions, const uint8_t* buffer, uint32_t width, uint32_t height, uint32_t xmin, uint32_t ymin, uint32_t xmax, uint32_t ymax) {
+    DISPLAY_DIRTY_REGIONS_clear(regions);
+
+    if (!signatures_valid) {
+        memset(tiles_known, 0, sizeof(tiles_known));
+    }
+
+    for (uint32_t ty = ymin / LLUI_DISPLAY_DIRTY_TILE_SIZE; ty <= ymax / LLUI_DISPLAY_DIRTY_TILE_SIZE; ty++) {
+        uint32_t y1 = ty * LLUI_DISPLAY_DIRTY_TILE_SIZE;
+        uint32_t y2 = y1 + LLUI_DISPLAY_DIRTY_TILE_SIZE - 1;
+        int32_t run_start = -1;
+
+        if (y2 >= height) {
+            y2 = height - 1;
+        }
+
+        for (uint32_t tx = xmin / LLUI_DISPLAY_DIRTY_TILE_SIZE; tx <= xmax / LLUI_DISPLAY_DIRTY_TILE_SIZE; tx++) {
+            uint32_t x1 = tx * LLUI_DISPLAY_DIRTY_TILE_SIZE;
+            uint32_t x2 = x1 + LLUI_DISPLAY_DIRTY_TILE_SIZE - 1;
+            uint32_t signature;
+
+            if (x2 >= width) {
+                x2 = width - 1;
+            }
+
+            signature = tile_signature(buffer, width, x1, y1, x2, y2);
+            if (!tiles_known[ty][tx] || (signature != signatures[ty][tx])) {
+                /*
+                 * Only the part of the tile inside the bounding box is sent. Outside the box, the
+                 * LCD shows the frame buffer content, unless its content is still unknown: the tile
+                 * is then only known once it has been sent whole.
+                 */
+                signatures[ty][tx] = signature;
+                tiles_known[ty][tx] = tiles_known[ty][tx] || ((x1 >= xmin) && (x2 <= xmax) && (y1 >= ymin) && (y2 <= ymax));
+                if (run_start < 0) {
+                    run_start = (int32_t)tx;
+                }
+            } else if (run_start >= 0) {
+                /* End of a run of dirty tiles: only the part inside the bounding box has changed */
+                DISPLAY_DIRTY_REGIONS_add(regions,
+                        ((uint32_t)run_start * LLUI_DISPLAY_DIRTY_TILE_SIZE > xmin) ? ((uint32_t)run_start * LLUI_DISPLAY_DIRTY_TILE_SIZE) : xmin,
+                        (y1 > ymin) ? y1 : ymin,
+                        x1 - 1,
+                        (y2 < ymax) ? y2 : ymax);
+                run_start = -1;
+            }
+        }
+
+        if (run_start >= 0) {
+            DISPLAY_DIRTY_REGIONS_add(regions,
+                    ((uint32_t)run_start * LLUI_DISPLAY_DIRTY_TILE_SIZE > xmin) ? ((uint32_t)run_start * LLUI_DISPLAY_DIRTY_TILE_SIZE) : xmin,
+                    (y1 > ymin) ? y1 : ymin,
+                    xmax,
+                    (y2 < ymax) ? y2 : ymax);
+        }
+    }
+
+    if (!signatures_valid) {
+        /* The LCD content is unknown: send the whole bounding box */
+        DISPLAY_DIRTY_REGIONS_clear(regions);
+        DISPLAY_DIRTY_REGIONS_add(regions, xmin, ymin, xmax, ymax);
+        signatures_valid = true;
+    } else {
+        refresh_tiles(regions, buffer, width, height);
+    }
+
+    stats.flush_count++;
+    stats.rect_count += regions->count;
+    stats.bbox_bytes += (uint64_t)(xmax - xmin + 1) * (ymax - ymin + 1) * BYTES_PER_PIXEL;
+    stats.transferred_bytes += DISPLAY_DIRTY_REGIONS_get_bytes(regions);
+}
+
+void DISPLAY_DIRTY_REGIONS_get_stats(display_dirty_regions_stats_t* stats_out) {
+    *stats_out = stats;
+}
+
+void DISPLAY_DIRTY_REGIONS_reset_stats(void) {
+    stats.flush_count = 0;
+    stats.rect_count = 0;
+    stats.bbox_bytes = 0;
+    stats.transferred_bytes = 0;
+}
+
+void DISPLAY_DIRTY_REGIONS_dump_stats(void) {
+    display_dirty_regions_stats_t s = stats;
+    printf("DIRTY_REGIONS: flushes %u rects %u bbox_bytes %llu transferred_bytes %llu saved %u%%\n",
+            (unsigned int)s.flush_count, (unsigned int)s.rect_count,
+            (unsigned long long)s.bbox_bytes, (unsigned long long)s.transferred_bytes,
+            (s.bbox_bytes > s.transferred_bytes) ? (unsigned int)(((s.bbox_bytes - s.transferred_bytes) * 100) / s.bbox_bytes) : 0u);
+}
+
+#endif // LLUI_DISPLAY_DIRTY_REGIONS_ENABLED
+
+/* Java API ------------------------------------------------------------------*/
+
+void javaDisplayDirtyRegionsDump(void) {
+#ifdef LLUI_DISPLAY_DIRTY_REGIONS_ENABLED
+    DISPLAY_DIRTY_REGIONS_dump_stats();
+    DISPLAY_DIRTY_REGIONS_reset_stats();
+#endif
+}
+
+void javaDisplayDirtyRegionsReset(void) {
+#ifdef LLUI_DISPLAY_DIRTY_REGIONS_ENABLED
+    DISPLAY_DIRTY_REGIONS_reset_stats();
+#endif
+}
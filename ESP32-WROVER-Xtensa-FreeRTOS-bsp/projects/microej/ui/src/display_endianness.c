@@ -0,0 +1,105 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * RGB565 endianness conversion for the LCD transfer.
+ *
+ * The pixels are processed two at a time, as 32-bit words: one load, three logic operations
+ * and one store for two pixels. The CPU is little-endian and does not allow unaligned word
+ * accesses, so a misaligned head pixel is handled alone and a source misaligned with the
+ * destination is read as aligned words recombined by shifts.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "display_endianness.h"
+#include "esp_attr.h"
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Number of 32-bit words processed by each iteration of the unrolled loops */
+#define UNROLL 4
+
+/* Private functions ---------------------------------------------------------*/
+
+static inline uint16_t swap_pixel(uint16_t pixel) {
+    return (uint16_t)((pixel << 8) | (pixel >> 8));
+}
+
+/* Swap the bytes of the two pixels of a word */
+static inline uint32_t swap_pixels(uint32_t pixels) {
+    return ((pixels & 0x00FF00FFu) << 8) | ((pixels >> 8) & 0x00FF00FFu);
+}
+
+static inline uint32_t is_word_aligned(const void* address) {
+    return ((uintptr_t)address & (sizeof(uint32_t) - 1)) == 0;
+}
+
+/* API -----------------------------------------------------------------------*/
+
+void IRAM_ATTR DISPLAY_ENDIANNESS_copy_swap(uint8_t* dst, const uint8_t* src, uint32_t length) {
+    uint16_t* dst_pixel = (uint16_t*)dst;
+    const uint16_t* src_pixel = (const uint16_t*)src;
+    uint32_t pixels = length / sizeof(uint16_t);
+    uint32_t* dst_words;
+    uint32_t count;
+
+    if ((pixels > 0) && !is_word_aligned(dst_pixel)) {
+        *dst_pixel++ = swap_pixel(*src_pixel++);
+        pixels--;
+    }
+
+    dst_words = (uint32_t*)dst_pixel;
+    count = pixels / 2;
+    if (is_word_aligned(src_pixel)) {
+        const uint32_t* src_words = (const uint32_t*)src_pixel;
+        for (; count >= UNROLL; count -= UNROLL) {
+            dst_words[0] = swap_pixels(src_words[0]);
+            dst_words[1] = swap_pixels(src_words[1]);
+            dst_words[2] = swap_pixels(src_words[2]);
+            dst_words[3] = swap_pixels(src_words[3]);
+            dst_words += UNROLL;
+            src_words += UNROLL;
+        }
+        while (count-- > 0) {
+            *dst_words++ = swap_pixels(*src_words++);
+        }
+        src_pixel = (const uint16_t*)src_words;
+    } else if (count > 0) {
+        /*
+         * The source is one pixel off the word boundary: each destination word is made of the
+         * upper half of a source word and the lower half of the next one. The first word read
+         * starts one pixel before the source and the last one may end one pixel after the
+         * copied pixels; both stay inside words which hold copied pixels.
+         */
+        const uint32_t* src_words = (const uint32_t*)(src_pixel - 1);
+        uint32_t previous = *src_words++;
+        for (; count >= UNROLL; count -= UNROLL) {
+            uint32_t w0 = src_words[0];
+            uint32_t w1 = src_words[1];
+            uint32_t w2 = src_words[2];
+            uint32_t w3 = src_words[3];
+            dst_words[0] = swap_pixels((previous >> 16) | (w0 << 16));
+            dst_words[1] = swap_pixels((w0 >> 16) | (w1 << 16));
+            dst_words[2] = swap_pixels((w1 >> 16) | (w2 << 16));
+            dst_words[3] = swap_pixels((w2 >> 16) | (w3 << 16));
+            previous = w3;
+            dst_words += UNROLL;
+            src_words += UNROLL;
+        }
+        while (count-- > 0) {
+            uint32_t w0 = *src_words++;
+            *dst_words++ = swap_pixels((previous >> 16) | (w0 << 16));
+            previous = w0;
+        }
+        src_pixel = (const uint16_t*)src_words - 1;
+    }
+
+    if ((pixels & 1) != 0) {
+        *(uint16_t*)dst_words = swap_pixel(*src_pixel);
+    }
+}
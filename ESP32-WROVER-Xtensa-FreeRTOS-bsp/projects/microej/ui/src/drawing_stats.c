@@ -0,0 +1,327 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Drawing statistics, see drawing_stats.h.
+ *
+ * The drawings are timed with the CPU cycle counter. The drawings are performed by the
+ * MicroUI thread: the statistics are not protected against concurrent accesses.
+ * @author MicroEJ Developer Team
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "drawing_stats.h"
+#include "LLDW_PAINTER_impl.h"
+#include "freertos/FreeRTOS.h"
+#include "xtensa/hal.h"
+#include "esp32/clk.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------------------------------------------------------------------------
+// Macros and Defines
+// --------------------------------------------------------------------------------
+
+/*
+ * Statistics slots: LOG_DRAW identifiers 0 to 19 (LLUI_PAINTER_impl.c), 100 to 108 and
+ * 200 to 204 (LLDW_PAINTER_impl.c).
+ */
+#define STATS_SLOTS (20 + 9 + 5)
+
+// --------------------------------------------------------------------------------
+// Global variables
+// --------------------------------------------------------------------------------
+
+#ifdef DRAWING_STATS_ENABLED
+
+static DRAWING_STATS_entry_t stats[STATS_SLOTS];
+static uint32_t untimed_drawings;
+
+// current drawing
+static uint32_t start_cycles;
+static uint32_t start_core;
+static uint64_t current_pixels;
+
+#endif // DRAWING_STATS_ENABLED
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+#ifdef DRAWING_STATS_ENABLED
+
+static inline int32_t _get_slot(uint8_t id)
+{
+	int32_t slot = -1;
+	if (id < 20)
+	{
+		slot = id;
+	}
+	else if ((id >= 100) && (id <= 108))
+	{
+		slot = id - 100 + 20;
+	}
+	else if ((id >= 200) && (id <= 204))
+	{
+		slot = id - 200 + 29;
+	}
+	return slot;
+}
+
+#endif // DRAWING_STATS_ENABLED
+
+// --------------------------------------------------------------------------------
+// drawing_stats.h functions
+// --------------------------------------------------------------------------------
+
+void DRAWING_STATS_start(void)
+{
+#ifdef DRAWING_STATS_ENABLED
+	current_pixels = 0;
+	start_core = (uint32_t)xPortGetCoreID();
+	start_cycles = xthal_get_ccount();
+#endif
+}
+
+void DRAWING_STATS_region(MICROUI_GraphicsContext* gc, jint x1, jint y1, jint x2, jint y2)
+{
+#ifdef DRAWING_STATS_ENABLED
+	jint tmp;
+	if (x1 > x2)
+	{
+		tmp = x1;
+		x1 = x2;
+		x2 = tmp;
+	}
+	if (y1 > y2)
+	{
+		tmp = y1;
+		y1 = y2;
+		y2 = tmp;
+	}
+	x1 = (x1 < gc->clip_x1) ? gc->clip_x1 : x1;
+	y1 = (y1 < gc->clip_y1) ? gc->clip_y1 : y1;
+	x2 = (x2 > gc->clip_x2) ? gc->clip_x2 : x2;
+	y2 = (y2 > gc->clip_y2) ? gc->clip_y2 : y2;
+	if ((x1 <= x2) && (y1 <= y2))
+	{
+		current_pixels += (uint64_t)(uint32_t)(x2 - x1 + 1) * (uint32_t)(y2 - y1 + 1);
+	}
+#else
+	(void)gc;
+	(void)x1;
+	(void)y1;
+	(void)x2;
+	(void)y2;
+#endif
+}
+
+void DRAWING_STATS_line_region(MICROUI_GraphicsContext* gc, jint x1, jint y1, jint x2, jint y2, jint margin)
+{
+#ifdef DRAWING_STATS_ENABLED
+	jint xmin = (x1 < x2) ? x1 : x2;
+	jint ymin = (y1 < y2) ? y1 : y2;
+	jint xmax = (x1 < x2) ? x2 : x1;
+	jint ymax = (y1 < y2) ? y2 : y1;
+	DRAWING_STATS_region(gc, xmin - margin, ymin - margin, xmax + margin, ymax + margin);
+#else
+	(void)gc;
+	(void)x1;
+	(void)y1;
+	(void)x2;
+	(void)y2;
+	(void)margin;
+#endif
+}
+
+void DRAWING_STATS_flipped_image_region(MICROUI_GraphicsContext* gc, jint x, jint y, jint width, jint height, jint flip)
+{
+#ifdef DRAWING_STATS_ENABLED
+	if ((DRAWING_FLIP_90 == flip) || (DRAWING_FLIP_270 == flip) || (DRAWING_FLIP_MIRROR_90 == flip) || (DRAWING_FLIP_MIRROR_270 == flip))
+	{
+		// the region is drawn rotated by a quarter turn
+		jint tmp = width;
+		width = height;
+		height = tmp;
+	}
+	DRAWING_STATS_region(gc, x, y, x + width - 1, y + height - 1);
+#else
+	(void)gc;
+	(void)x;
+	(void)y;
+	(void)width;
+	(void)height;
+	(void)flip;
+#endif
+}
+
+void DRAWING_STATS_rotated_image_region(MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jint rotationX, jint rotationY, jfloat angle)
+{
+#ifdef DRAWING_STATS_ENABLED
+	// corners of the image relatively to the rotation center, rotated counterclockwise
+	float radians = angle * (float)(M_PI / 180.0);
+	float cos_angle = cosf(radians);
+	float sin_angle = sinf(radians);
+	float left = (float)(x - rotationX);
+	float top = (float)(y - rotationY);
+	float right = left + (float)img->width;
+	float bottom = top + (float)img->height;
+	float corners_x[4] = { left, right, left, right };
+	float corners_y[4] = { top, top, bottom, bottom };
+	float xmin = 0.0f;
+	float ymin = 0.0f;
+	float xmax = 0.0f;
+	float ymax = 0.0f;
+
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		float rotated_x = (corners_x[i] * cos_angle) + (corners_y[i] * sin_angle);
+		float rotated_y = (corners_y[i] * cos_angle) - (corners_x[i] * sin_angle);
+		xmin = ((0 == i) || (rotated_x < xmin)) ? rotated_x : xmin;
+		ymin = ((0 == i) || (rotated_y < ymin)) ? rotated_y : ymin;
+		xmax = ((0 == i) || (rotated_x > xmax)) ? rotated_x : xmax;
+		ymax = ((0 == i) || (rotated_y > ymax)) ? rotated_y : ymax;
+	}
+	DRAWING_STATS_region(gc, rotationX + (jint)floorf(xmin + 0.5f), rotationY + (jint)floorf(ymin + 0.5f), rotationX + (jint)floorf(xmax + 0.5f) - 1, rotationY + (jint)floorf(ymax + 0.5f) - 1);
+#else
+	(void)gc;
+	(void)img;
+	(void)x;
+	(void)y;
+	(void)rotationX;
+	(void)rotationY;
+	(void)angle;
+#endif
+}
+
+void DRAWING_STATS_end(uint8_t id)
+{
+#ifdef DRAWING_STATS_ENABLED
+	uint32_t cycles = xthal_get_ccount() - start_cycles;
+	int32_t slot = _get_slot(id);
+
+	if (slot >= 0)
+	{
+		DRAWING_STATS_entry_t* entry = &stats[slot];
+		entry->calls++;
+		entry->pixels += current_pixels;
+
+		if ((uint32_t)xPortGetCoreID() == start_core)
+		{
+			uint32_t bucket = 0;
+			if ((cycles >> DRAWING_STATS_HISTOGRAM_SHIFT) != 0)
+			{
+				// class of the highest bit set
+				bucket = (31 - __builtin_clz(cycles)) - DRAWING_STATS_HISTOGRAM_SHIFT + 1;
+				bucket = (bucket >= DRAWING_STATS_HISTOGRAM_SIZE) ? (DRAWING_STATS_HISTOGRAM_SIZE - 1) : bucket;
+			}
+			entry->histogram[bucket]++;
+			entry->cycles += cycles;
+			entry->max_cycles = (cycles > entry->max_cycles) ? cycles : entry->max_cycles;
+		}
+		else
+		{
+			untimed_drawings++;
+		}
+	}
+#else
+	(void)id;
+#endif
+}
+
+const DRAWING_STATS_entry_t* DRAWING_STATS_get(uint8_t id)
+{
+#ifdef DRAWING_STATS_ENABLED
+	int32_t slot = _get_slot(id);
+	return (slot >= 0) ? &stats[slot] : NULL;
+#else
+	(void)id;
+	return NULL;
+#endif
+}
+
+uint32_t DRAWING_STATS_get_untimed(void)
+{
+#ifdef DRAWING_STATS_ENABLED
+	return untimed_drawings;
+#else
+	return 0;
+#endif
+}
+
+void DRAWING_STATS_reset(void)
+{
+#ifdef DRAWING_STATS_ENABLED
+	memset(stats, 0, sizeof(stats));
+	untimed_drawings = 0;
+#endif
+}
+
+void DRAWING_STATS_dump(void)
+{
+	uint32_t cycles_per_us = (uint32_t)esp_clk_cpu_freq() / 1000000;
+
+	printf("DRAWING_STATS: id calls pixels total_us mean_ns max_us histogram (class 0 < %u cycles, x2 per class)\n", 1u << DRAWING_STATS_HISTOGRAM_SHIFT);
+	for (uint32_t id = 0; id < 256; id++)
+	{
+		const DRAWING_STATS_entry_t* entry = DRAWING_STATS_get((uint8_t)id);
+		if ((NULL != entry) && (entry->calls > 0))
+		{
+			uint32_t timed = 0;
+			for (uint32_t i = 0; i < DRAWING_STATS_HISTOGRAM_SIZE; i++)
+			{
+				timed += entry->histogram[i];
+			}
+			timed = (0 == timed) ? 1 : timed;
+			printf("DRAWING_STATS: %u %u %llu %llu %llu %u", (unsigned int)id, (unsigned int)entry->calls, (unsigned long long)entry->pixels,
+					(unsigned long long)(entry->cycles / cycles_per_us), (unsigned long long)((entry->cycles * 1000) / cycles_per_us / timed),
+					(unsigned int)(entry->max_cycles / cycles_per_us));
+			for (uint32_t i = 0; i < DRAWING_STATS_HISTOGRAM_SIZE; i++)
+			{
+				printf(" %u", (unsigned int)entry->histogram[i]);
+			}
+			printf("\n");
+		}
+	}
+	printf("DRAWING_STATS: %u untimed\n", (unsigned int)DRAWING_STATS_get_untimed());
+}
+
+// --------------------------------------------------------------------------------
+// Java API
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Prints the statistics (see DRAWING_STATS_dump) and clears them.
+ */
+void javaDrawingStatsDump(void)
+{
+	DRAWING_STATS_dump();
+	DRAWING_STATS_reset();
+}
+
+void javaDrawingStatsReset(void)
+{
+	DRAWING_STATS_reset();
+}
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
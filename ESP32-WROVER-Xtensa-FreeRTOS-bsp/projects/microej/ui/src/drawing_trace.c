@@ -0,0 +1,296 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Drawing trace recorder, see drawing_trace.h.
+ *
+ * The drawings and the flushes are performed by the MicroUI thread: the log is not
+ * protected against concurrent accesses.
+ * @author MicroEJ Developer Team
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+
+#include "drawing_trace.h"
+#include "LLUI_DISPLAY.h"
+#include "esp_attr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------------------------------------------------------------------------
+// Macros and Defines
+// --------------------------------------------------------------------------------
+
+// maximum size of a value: 32 bits, 7 bits per byte
+#define TRACE_VALUE_MAX_SIZE (5)
+
+// maximum size of a record: tag, identifier, count and values
+#define TRACE_RECORD_MAX_SIZE (3 + (DRAWING_TRACE_MAX_ARGUMENTS * TRACE_VALUE_MAX_SIZE))
+
+// number of bytes per line of the dump
+#define TRACE_DUMP_LINE_SIZE (32)
+
+#ifdef DRAWING_TRACE_IN_EXTERNAL_RAM
+#define TRACE_SECTION EXT_RAM_ATTR
+#else
+#define TRACE_SECTION
+#endif
+
+// --------------------------------------------------------------------------------
+// Global variables
+// --------------------------------------------------------------------------------
+
+#ifdef DRAWING_TRACE_ENABLED
+
+static uint8_t TRACE_SECTION trace_log[DRAWING_TRACE_BUFFER_SIZE];
+
+// length of the log in bytes
+static uint32_t trace_length = 0;
+
+static bool trace_recording = false;
+static bool trace_truncated = false;
+
+// last recorded target and state: a record is added when they change
+static uintptr_t trace_target;
+static int32_t trace_target_width;
+static int32_t trace_target_height;
+static int32_t trace_target_format;
+static int32_t trace_state[6];
+
+#endif // DRAWING_TRACE_ENABLED
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+#ifdef DRAWING_TRACE_ENABLED
+
+/*
+ * @brief Appends a zigzag LEB128 value to the log. The caller has checked the room.
+ */
+static void _put_value(int32_t value)
+{
+	uint32_t zigzag = ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+	while (zigzag >= 0x80u)
+	{
+		trace_log[trace_length++] = (uint8_t)(zigzag | 0x80u);
+		zigzag >>= 7;
+	}
+	trace_log[trace_length++] = (uint8_t)zigzag;
+}
+
+/*
+ * @brief Checks that a record of the given maximum size fits in the log; stops the
+ * recording otherwise.
+ */
+static bool _reserve(uint32_t size)
+{
+	if ((trace_length + size) > DRAWING_TRACE_BUFFER_SIZE)
+	{
+		trace_recording = false;
+		trace_truncated = true;
+	}
+	return trace_recording;
+}
+
+/*
+ * @brief Records the destination and the state of the graphics context when they differ
+ * from the ones of the previous drawing.
+ */
+static bool _record_context(MICROUI_GraphicsContext* gc)
+{
+	bool ret = true;
+	int32_t state[6];
+
+	if (((uintptr_t)&gc->image != trace_target) || (gc->image.width != trace_target_width) || (gc->image.height != trace_target_height) || (gc->image.format != trace_target_format))
+	{
+		ret = _reserve(1 + (4 * TRACE_VALUE_MAX_SIZE));
+		if (ret)
+		{
+			trace_target = (uintptr_t)&gc->image;
+			trace_target_width = gc->image.width;
+			trace_target_height = gc->image.height;
+			trace_target_format = gc->image.format;
+			trace_log[trace_length++] = DRAWING_TRACE_TAG_TARGET;
+			_put_value((int32_t)trace_target);
+			_put_value(trace_target_width);
+			_put_value(trace_target_height);
+			_put_value(trace_target_format);
+		}
+	}
+
+	state[0] = gc->foreground_color;
+	state[1] = LLUI_DISPLAY_isClipEnabled(gc) ? 1 : 0;
+	state[2] = gc->clip_x1;
+	state[3] = gc->clip_y1;
+	state[4] = gc->clip_x2;
+	state[5] = gc->clip_y2;
+	if (ret && (0 != memcmp(state, trace_state, sizeof(state))))
+	{
+		ret = _reserve(1 + (6 * TRACE_VALUE_MAX_SIZE));
+		if (ret)
+		{
+			memcpy(trace_state, state, sizeof(state));
+			trace_log[trace_length++] = DRAWING_TRACE_TAG_STATE;
+			for (uint32_t i = 0; i < 6; i++)
+			{
+				_put_value(state[i]);
+			}
+		}
+	}
+	return ret;
+}
+
+#endif // DRAWING_TRACE_ENABLED
+
+// --------------------------------------------------------------------------------
+// drawing_trace.h functions
+// --------------------------------------------------------------------------------
+
+void DRAWING_TRACE_start(void)
+{
+#ifdef DRAWING_TRACE_ENABLED
+	trace_recording = false;
+	memcpy(trace_log, DRAWING_TRACE_MAGIC, 4);
+	trace_length = 4;
+	trace_truncated = false;
+	// force the recording of the first target and state
+	trace_target = 0;
+	trace_state[0] = 0;
+	trace_state[1] = -1;
+	trace_recording = true;
+#endif
+}
+
+void DRAWING_TRACE_stop(void)
+{
+#ifdef DRAWING_TRACE_ENABLED
+	trace_recording = false;
+#endif
+}
+
+uint32_t DRAWING_TRACE_get_log(const uint8_t** log)
+{
+#ifdef DRAWING_TRACE_ENABLED
+	*log = trace_log;
+	return trace_length;
+#else
+	*log = NULL;
+	return 0;
+#endif
+}
+
+bool DRAWING_TRACE_is_truncated(void)
+{
+#ifdef DRAWING_TRACE_ENABLED
+	return trace_truncated;
+#else
+	return false;
+#endif
+}
+
+void DRAWING_TRACE_dump(void)
+{
+	const uint8_t* log;
+	uint32_t length = DRAWING_TRACE_get_log(&log);
+
+	printf("DRAWING_TRACE: begin %u bytes%s\n", (unsigned int)length, DRAWING_TRACE_is_truncated() ? " (truncated)" : "");
+	for (uint32_t offset = 0; offset < length; offset += TRACE_DUMP_LINE_SIZE)
+	{
+		uint32_t end = offset + TRACE_DUMP_LINE_SIZE;
+		end = (end > length) ? length : end;
+		printf("DRAWING_TRACE:");
+		for (uint32_t i = offset; i < end; i++)
+		{
+			printf("%02x", log[i]);
+		}
+		printf("\n");
+	}
+	printf("DRAWING_TRACE: end\n");
+}
+
+void DRAWING_TRACE_draw(MICROUI_GraphicsContext* gc, uint8_t id, const int32_t* args, uint32_t count)
+{
+#ifdef DRAWING_TRACE_ENABLED
+	if (trace_recording && _record_context(gc) && _reserve(TRACE_RECORD_MAX_SIZE))
+	{
+		count = (count > DRAWING_TRACE_MAX_ARGUMENTS) ? DRAWING_TRACE_MAX_ARGUMENTS : count;
+		trace_log[trace_length++] = DRAWING_TRACE_TAG_DRAW;
+		trace_log[trace_length++] = id;
+		trace_log[trace_length++] = (uint8_t)count;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			_put_value(args[i]);
+		}
+	}
+#else
+	(void)gc;
+	(void)id;
+	(void)args;
+	(void)count;
+#endif
+}
+
+void DRAWING_TRACE_flush(uint32_t xmin, uint32_t ymin, uint32_t xmax, uint32_t ymax)
+{
+#ifdef DRAWING_TRACE_ENABLED
+	if (trace_recording && _reserve(1 + (4 * TRACE_VALUE_MAX_SIZE)))
+	{
+		trace_log[trace_length++] = DRAWING_TRACE_TAG_FLUSH;
+		_put_value((int32_t)xmin);
+		_put_value((int32_t)ymin);
+		_put_value((int32_t)xmax);
+		_put_value((int32_t)ymax);
+	}
+#else
+	(void)xmin;
+	(void)ymin;
+	(void)xmax;
+	(void)ymax;
+#endif
+}
+
+// --------------------------------------------------------------------------------
+// Java API
+// --------------------------------------------------------------------------------
+
+void javaDrawingTraceStart(void)
+{
+	DRAWING_TRACE_start();
+}
+
+void javaDrawingTraceStop(void)
+{
+	DRAWING_TRACE_stop();
+}
+
+/*
+ * @brief Stops the recording, prints the log (see DRAWING_TRACE_dump) and returns its
+ * length in bytes.
+ */
+uint32_t javaDrawingTraceDump(void)
+{
+	const uint8_t* log;
+	DRAWING_TRACE_stop();
+	DRAWING_TRACE_dump();
+	return DRAWING_TRACE_get_log(&log);
+}
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,705 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Replay of a drawing trace (see drawing_trace.h), for a Linux host.
+ *
+ * The drawings of the trace are performed again by the UI_DRAWING_* and DW_DRAWING_*
+ * functions linked with this file, in off-screen buffers, and timed. This file provides the
+ * Graphics Engine services used by these functions. The drawing functions which are not
+ * linked (the software algorithms of the Graphics Engine are only delivered for the target)
+ * are replaced by weak functions which only count the drawing as not replayed.
+ *
+ * The images drawn by the trace are not recorded: they are replaced by images of the same
+ * size and format filled with pseudo-random pixels (always the same ones for a given trace).
+ *
+ * Build, from the projects/unit_tests/host directory (see its Makefile):
+ *     make replay
+ * or from the microej directory:
+ *     gcc -O2 -Iui/inc -Iplatform/inc -o drawing_trace_replay ui/src/drawing_trace_replay.c ui/src/ui_drawing_rgb565.c ui/src/dw_drawing_rgb565.c -lm
+ *
+ * Usage:
+ *     drawing_trace_replay [-r repeat] [-c] <trace>
+ *
+ * The trace is the binary log or the console output of DRAWING_TRACE_dump(). The drawings are
+ * replayed "repeat" times and the best time of each kind of drawing is reported. With -c, the
+ * CRC32 of the display buffer is printed at each flush: two implementations of the drawings
+ * which render the same pixels print the same checksums.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "LLUI_DISPLAY_configuration.h"
+#include "LLUI_DISPLAY.h"
+#include "ui_drawing.h"
+#include "ui_drawing_soft.h"
+#include "dw_drawing.h"
+#include "dw_drawing_soft.h"
+#include "drawing_trace.h"
+
+/* Defines -------------------------------------------------------------------*/
+
+/* LOG_DRAW identifiers of LLUI_PAINTER_impl.c */
+#define ID_writePixel 1
+#define ID_drawLine 2
+#define ID_drawHorizontalLine 3
+#define ID_drawVerticalLine 4
+#define ID_drawRectangle 5
+#define ID_fillRectangle 6
+#define ID_drawRoundedRectangle 8
+#define ID_fillRoundedRectangle 9
+#define ID_drawCircleArc 10
+#define ID_fillCircleArc 11
+#define ID_drawEllipseArc 12
+#define ID_fillEllipseArc 13
+#define ID_drawEllipse 14
+#define ID_fillEllipse 15
+#define ID_drawCircle 16
+#define ID_fillCircle 17
+#define ID_drawImage 19
+
+/* LOG_DRAW identifiers of LLDW_PAINTER_impl.c */
+#define ID_drawThickFadedPoint 100
+#define ID_drawThickFadedLine 101
+#define ID_drawThickFadedCircle 102
+#define ID_drawThickFadedCircleArc 103
+#define ID_drawThickFadedEllipse 104
+#define ID_drawThickLine 105
+#define ID_drawThickCircle 106
+#define ID_drawThickEllipse 107
+#define ID_drawThickCircleArc 108
+#define ID_drawFlippedImage 200
+#define ID_drawRotatedImageNearestNeighbor 201
+#define ID_drawRotatedImageBilinear 202
+#define ID_drawScaledImageNearestNeighbor 203
+#define ID_drawScaledImageBilinear 204
+
+#define REPLAY_MAX_IDS 256
+#define REPLAY_MAX_SURFACES 64
+
+/* Types ---------------------------------------------------------------------*/
+
+/* An off-screen buffer: a drawing target, a drawn image or both */
+typedef struct {
+    MICROUI_GraphicsContext gc;    /* first: the surface is retrieved from its image */
+    uint32_t id;
+    uint8_t* pixels;
+    uint32_t bytes_per_pixel;
+    bool clip_enabled;
+} replay_surface_t;
+
+typedef struct {
+    uint32_t calls;
+    uint32_t not_replayed;
+    uint64_t pixels;
+    uint64_t time_ns;
+    uint64_t best_time_ns;
+} replay_stats_t;
+
+/* Globals -------------------------------------------------------------------*/
+
+static replay_surface_t surfaces[REPLAY_MAX_SURFACES];
+static uint32_t surfaces_count = 0;
+
+/* The display buffer: the first target in the LCD format */
+static replay_surface_t* display = NULL;
+
+static replay_stats_t stats[REPLAY_MAX_IDS];
+
+/* Set by the weak drawing functions, area of the drawing limits */
+static bool drawing_not_replayed;
+static uint64_t drawing_pixels;
+
+static uint32_t malformed_records = 0;
+
+/* Private functions ---------------------------------------------------------*/
+
+static uint64_t replay_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+static uint32_t replay_crc32(const uint8_t* data, uint32_t length) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+static uint32_t replay_bytes_per_pixel(uint32_t format) {
+    switch (format) {
+    case MICROUI_IMAGE_FORMAT_LCD:
+        return (LLUI_DISPLAY_BPP + 7) / 8;
+    case MICROUI_IMAGE_FORMAT_ARGB8888:
+    case MICROUI_IMAGE_FORMAT_LARGB8888:
+        return 4;
+    case MICROUI_IMAGE_FORMAT_RGB888:
+    case MICROUI_IMAGE_FORMAT_LRGB888:
+        return 3;
+    case MICROUI_IMAGE_FORMAT_RGB565:
+    case MICROUI_IMAGE_FORMAT_ARGB1555:
+    case MICROUI_IMAGE_FORMAT_ARGB4444:
+        return 2;
+    default:
+        /* smaller formats: one byte is enough */
+        return 1;
+    }
+}
+
+/*
+ * Return the surface of the given identifier, created with the given size and format the
+ * first time. The new images are filled with pseudo-random pixels, the new targets are black.
+ */
+static replay_surface_t* replay_surface(uint32_t id, int32_t width, int32_t height, int32_t format, bool target) {
+    replay_surface_t* surface;
+
+    for (uint32_t i = 0; i < surfaces_count; i++) {
+        surface = &surfaces[i];
+        if ((surface->id == id) && (surface->gc.image.width == width) && (surface->gc.image.height == height) && (surface->gc.image.format == format)) {
+            return surface;
+        }
+    }
+    if ((surfaces_count == REPLAY_MAX_SURFACES) || (width <= 0) || (height <= 0)) {
+        return NULL;
+    }
+
+    surface = &surfaces[surfaces_count++];
+    memset(surface, 0, sizeof(*surface));
+    surface->id = id;
+    surface->gc.image.width = (jchar)width;
+    surface->gc.image.height = (jchar)height;
+    surface->gc.image.format = (jbyte)format;
+    surface->gc.clip_x2 = (jshort)(width - 1);
+    surface->gc.clip_y2 = (jshort)(height - 1);
+    surface->bytes_per_pixel = replay_bytes_per_pixel((uint32_t)format);
+    surface->pixels = (uint8_t*)calloc((size_t)width * (size_t)height, surface->bytes_per_pixel);
+    if (surface->pixels == NULL) {
+        surfaces_count--;
+        return NULL;
+    }
+
+    if (!target) {
+        uint32_t seed = id | 1u;
+        for (size_t i = 0; i < ((size_t)width * (size_t)height * surface->bytes_per_pixel); i++) {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            surface->pixels[i] = (uint8_t)seed;
+        }
+    }
+    return surface;
+}
+
+static replay_surface_t* replay_surface_of(MICROUI_Image* image) {
+    return (replay_surface_t*)(void*)image;
+}
+
+static jfloat replay_float(int32_t bits) {
+    jfloat f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+/*
+ * Decode the zigzag LEB128 value at the given position.
+ */
+static bool replay_read_value(const uint8_t* log, uint32_t length, uint32_t* position, int32_t* value) {
+    uint32_t zigzag = 0;
+    uint32_t shift = 0;
+    uint8_t byte;
+
+    do {
+        if ((*position >= length) || (shift > 28)) {
+            return false;
+        }
+        byte = log[(*position)++];
+        zigzag |= (uint32_t)(byte & 0x7Fu) << shift;
+        shift += 7;
+    } while ((byte & 0x80u) != 0);
+
+    *value = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1u);
+    return true;
+}
+
+static bool replay_read_values(const uint8_t* log, uint32_t length, uint32_t* position, int32_t* values, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (!replay_read_value(log, length, position, &values[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Perform a drawing with the arguments of its record; return false when the record does not
+ * match the drawing.
+ */
+static bool replay_draw(MICROUI_GraphicsContext* gc, uint32_t id, const int32_t* a, uint32_t count) {
+    static const uint8_t counts[REPLAY_MAX_IDS] = {
+        [ID_writePixel] = 2, [ID_drawLine] = 4, [ID_drawHorizontalLine] = 3, [ID_drawVerticalLine] = 3,
+        [ID_drawRectangle] = 4, [ID_fillRectangle] = 4, [ID_drawRoundedRectangle] = 6, [ID_fillRoundedRectangle] = 6,
+        [ID_drawCircleArc] = 5, [ID_fillCircleArc] = 5, [ID_drawEllipseArc] = 6, [ID_fillEllipseArc] = 6,
+        [ID_drawEllipse] = 4, [ID_fillEllipse] = 4, [ID_drawCircle] = 3, [ID_fillCircle] = 3, [ID_drawImage] = 11,
+        [ID_drawThickFadedPoint] = 4, [ID_drawThickFadedLine] = 8, [ID_drawThickFadedCircle] = 5,
+        [ID_drawThickFadedCircleArc] = 9, [ID_drawThickFadedEllipse] = 6, [ID_drawThickLine] = 5,
+        [ID_drawThickCircle] = 4, [ID_drawThickEllipse] = 5, [ID_drawThickCircleArc] = 6,
+        [ID_drawFlippedImage] = 12, [ID_drawRotatedImageNearestNeighbor] = 10, [ID_drawRotatedImageBilinear] = 10,
+        [ID_drawScaledImageNearestNeighbor] = 9, [ID_drawScaledImageBilinear] = 9,
+    };
+    MICROUI_Image* img = NULL;
+
+    if ((id >= REPLAY_MAX_IDS) || (counts[id] == 0) || (counts[id] != count)) {
+        return false;
+    }
+    if ((id == ID_drawImage) || (id >= ID_drawFlippedImage)) {
+        /* the image is the first argument */
+        replay_surface_t* surface = replay_surface((uint32_t)a[0], a[1], a[2], a[3], false);
+        if (surface == NULL) {
+            return false;
+        }
+        img = &surface->gc.image;
+        a += 4;
+    }
+
+    switch (id) {
+    case ID_writePixel: UI_DRAWING_writePixel(gc, a[0], a[1]); break;
+    case ID_drawLine: UI_DRAWING_drawLine(gc, a[0], a[1], a[2], a[3]); break;
+    case ID_drawHorizontalLine: UI_DRAWING_drawHorizontalLine(gc, a[0], a[1], a[2]); break;
+    case ID_drawVerticalLine: UI_DRAWING_drawVerticalLine(gc, a[0], a[1], a[2]); break;
+    case ID_drawRectangle: UI_DRAWING_drawRectangle(gc, a[0], a[1], a[2], a[3]); break;
+    case ID_fillRectangle: UI_DRAWING_fillRectangle(gc, a[0], a[1], a[2], a[3]); break;
+    case ID_drawRoundedRectangle: UI_DRAWING_drawRoundedRectangle(gc, a[0], a[1], a[2], a[3], a[4], a[5]); break;
+    case ID_fillRoundedRectangle: UI_DRAWING_fillRoundedRectangle(gc, a[0], a[1], a[2], a[3], a[4], a[5]); break;
+    case ID_drawCircleArc: UI_DRAWING_drawCircleArc(gc, a[0], a[1], a[2], replay_float(a[3]), replay_float(a[4])); break;
+    case ID_fillCircleArc: UI_DRAWING_fillCircleArc(gc, a[0], a[1], a[2], replay_float(a[3]), replay_float(a[4])); break;
+    case ID_drawEllipseArc: UI_DRAWING_drawEllipseArc(gc, a[0], a[1], a[2], a[3], replay_float(a[4]), replay_float(a[5])); break;
+    case ID_fillEllipseArc: UI_DRAWING_fillEllipseArc(gc, a[0], a[1], a[2], a[3], replay_float(a[4]), replay_float(a[5])); break;
+    case ID_drawEllipse: UI_DRAWING_drawEllipse(gc, a[0], a[1], a[2], a[3]); break;
+    case ID_fillEllipse: UI_DRAWING_fillEllipse(gc, a[0], a[1], a[2], a[3]); break;
+    case ID_drawCircle: UI_DRAWING_drawCircle(gc, a[0], a[1], a[2]); break;
+    case ID_fillCircle: UI_DRAWING_fillCircle(gc, a[0], a[1], a[2]); break;
+    case ID_drawImage: UI_DRAWING_drawImage(gc, img, a[0], a[1], a[2], a[3], a[4], a[5], a[6]); break;
+    case ID_drawThickFadedPoint: DW_DRAWING_drawThickFadedPoint(gc, a[0], a[1], a[2], a[3]); break;
+    case ID_drawThickFadedLine: DW_DRAWING_drawThickFadedLine(gc, a[0], a[1], a[2], a[3], a[4], a[5], (DRAWING_Cap)a[6], (DRAWING_Cap)a[7]); break;
+    case ID_drawThickFadedCircle: DW_DRAWING_drawThickFadedCircle(gc, a[0], a[1], a[2], a[3], a[4]); break;
+    case ID_drawThickFadedCircleArc: DW_DRAWING_drawThickFadedCircleArc(gc, a[0], a[1], a[2], replay_float(a[3]), replay_float(a[4]), a[5], a[6], (DRAWING_Cap)a[7], (DRAWING_Cap)a[8]); break;
+    case ID_drawThickFadedEllipse: DW_DRAWING_drawThickFadedEllipse(gc, a[0], a[1], a[2], a[3], a[4], a[5]); break;
+    case ID_drawThickLine: DW_DRAWING_drawThickLine(gc, a[0], a[1], a[2], a[3], a[4]); break;
+    case ID_drawThickCircle: DW_DRAWING_drawThickCircle(gc, a[0], a[1], a[2], a[3]); break;
+    case ID_drawThickEllipse: DW_DRAWING_drawThickEllipse(gc, a[0], a[1], a[2], a[3], a[4]); break;
+    case ID_drawThickCircleArc: DW_DRAWING_drawThickCircleArc(gc, a[0], a[1], a[2], replay_float(a[3]), replay_float(a[4]), a[5]); break;
+    case ID_drawFlippedImage: DW_DRAWING_drawFlippedImage(gc, img, a[0], a[1], a[2], a[3], a[4], a[5], (DRAWING_Flip)a[6], a[7]); break;
+    case ID_drawRotatedImageNearestNeighbor: DW_DRAWING_drawRotatedImageNearestNeighbor(gc, img, a[0], a[1], a[2], a[3], replay_float(a[4]), a[5]); break;
+    case ID_drawRotatedImageBilinear: DW_DRAWING_drawRotatedImageBilinear(gc, img, a[0], a[1], a[2], a[3], replay_float(a[4]), a[5]); break;
+    case ID_drawScaledImageNearestNeighbor: DW_DRAWING_drawScaledImageNearestNeighbor(gc, img, a[0], a[1], replay_float(a[2]), replay_float(a[3]), a[4]); break;
+    case ID_drawScaledImageBilinear: DW_DRAWING_drawScaledImageBilinear(gc, img, a[0], a[1], replay_float(a[2]), replay_float(a[3]), a[4]); break;
+    default: return false;
+    }
+    return true;
+}
+
+/*
+ * Replay the whole log once. The checksums of the display are printed at each flush when
+ * requested. Return the number of flushes.
+ */
+static uint32_t replay_run(const uint8_t* log, uint32_t length, bool checksums) {
+    replay_surface_t* target = NULL;
+    uint32_t position = 4;
+    uint32_t flushes = 0;
+    int32_t values[DRAWING_TRACE_MAX_ARGUMENTS];
+    uint64_t run_time_ns[REPLAY_MAX_IDS] = { 0 };
+
+    while (position < length) {
+        uint8_t tag = log[position++];
+        bool valid;
+
+        if (tag == DRAWING_TRACE_TAG_TARGET) {
+            valid = replay_read_values(log, length, &position, values, 4);
+            target = valid ? replay_surface((uint32_t)values[0], values[1], values[2], values[3], true) : NULL;
+            if ((target != NULL) && (target->gc.image.format == MICROUI_IMAGE_FORMAT_LCD) && (display == NULL)) {
+                display = target;
+            }
+        } else if (tag == DRAWING_TRACE_TAG_STATE) {
+            valid = replay_read_values(log, length, &position, values, 6) && (target != NULL);
+            if (valid) {
+                target->gc.foreground_color = values[0];
+                target->clip_enabled = (values[1] != 0);
+                target->gc.clip_x1 = (jshort)values[2];
+                target->gc.clip_y1 = (jshort)values[3];
+                target->gc.clip_x2 = (jshort)values[4];
+                target->gc.clip_y2 = (jshort)values[5];
+            }
+        } else if (tag == DRAWING_TRACE_TAG_DRAW) {
+            uint32_t id;
+            uint32_t count;
+            valid = (position + 2) <= length;
+            if (valid) {
+                id = log[position++];
+                count = log[position++];
+                valid = (count <= DRAWING_TRACE_MAX_ARGUMENTS) && replay_read_values(log, length, &position, values, count) && (target != NULL);
+            }
+            if (valid) {
+                uint64_t start;
+                drawing_not_replayed = false;
+                drawing_pixels = 0;
+                start = replay_now_ns();
+                valid = replay_draw(&target->gc, id, values, count);
+                run_time_ns[id] += replay_now_ns() - start;
+                stats[id].calls++;
+                stats[id].pixels += drawing_pixels;
+                if (drawing_not_replayed) {
+                    stats[id].not_replayed++;
+                }
+            }
+        } else if (tag == DRAWING_TRACE_TAG_FLUSH) {
+            valid = replay_read_values(log, length, &position, values, 4);
+            if (valid && checksums && (display != NULL)) {
+                printf("flush %u: [%d,%d]-[%d,%d] crc32 %08x\n", flushes, values[0], values[1], values[2], values[3],
+                        replay_crc32(display->pixels, (uint32_t)display->gc.image.width * display->gc.image.height * display->bytes_per_pixel));
+            }
+            flushes++;
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            /* the values of an unknown record cannot be skipped */
+            malformed_records++;
+            if ((tag < DRAWING_TRACE_TAG_TARGET) || (tag > DRAWING_TRACE_TAG_FLUSH)) {
+                break;
+            }
+        }
+    }
+
+    for (uint32_t id = 0; id < REPLAY_MAX_IDS; id++) {
+        stats[id].time_ns += run_time_ns[id];
+        if ((stats[id].best_time_ns == 0) || (run_time_ns[id] < stats[id].best_time_ns)) {
+            stats[id].best_time_ns = run_time_ns[id];
+        }
+    }
+    return flushes;
+}
+
+/*
+ * Load the trace: the binary log or the lines "DRAWING_TRACE:<hex>" of the console output.
+ */
+static uint8_t* replay_load(const char* path, uint32_t* length) {
+    FILE* file = fopen(path, "rb");
+    uint8_t* content;
+    long size;
+
+    if (file == NULL) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    content = (uint8_t*)malloc((size_t)size + 1);
+    if ((content == NULL) || (fread(content, 1, (size_t)size, file) != (size_t)size)) {
+        fclose(file);
+        free(content);
+        return NULL;
+    }
+    fclose(file);
+    content[size] = 0;
+
+    if ((size >= 4) && (memcmp(content, DRAWING_TRACE_MAGIC, 4) == 0)) {
+        *length = (uint32_t)size;
+    } else {
+        /* decode the hexadecimal lines in place */
+        const char* prefix = "DRAWING_TRACE:";
+        char* line = (char*)content;
+        uint32_t decoded = 0;
+
+        while ((line = strstr(line, prefix)) != NULL) {
+            char* hex = line + strlen(prefix);
+            while ((hex[0] != 0) && (hex[1] != 0) && (strchr("0123456789abcdef", hex[0]) != NULL) && (strchr("0123456789abcdef", hex[1]) != NULL)) {
+                char byte[3] = { hex[0], hex[1], 0 };
+                content[decoded++] = (uint8_t)strtoul(byte, NULL, 16);
+                hex += 2;
+            }
+            line = hex;
+        }
+        *length = decoded;
+    }
+
+    if ((*length < 4) || (memcmp(content, DRAWING_TRACE_MAGIC, 4) != 0)) {
+        free(content);
+        return NULL;
+    }
+    return content;
+}
+
+/* Graphics Engine services --------------------------------------------------*/
+
+bool LLUI_DISPLAY_isLCD(MICROUI_Image* image) {
+    return image == &display->gc.image;
+}
+
+bool LLUI_DISPLAY_isClosed(MICROUI_Image* image) {
+    (void)image;
+    return false;
+}
+
+void LLUI_DISPLAY_configureClip(MICROUI_GraphicsContext* gc, bool enable) {
+    replay_surface_of(&gc->image)->clip_enabled = enable;
+}
+
+bool LLUI_DISPLAY_isClipEnabled(MICROUI_GraphicsContext* gc) {
+    return replay_surface_of(&gc->image)->clip_enabled;
+}
+
+bool LLUI_DISPLAY_isPixelInClip(MICROUI_GraphicsContext* gc, jint x, jint y) {
+    return (x >= gc->clip_x1) && (x <= gc->clip_x2) && (y >= gc->clip_y1) && (y <= gc->clip_y2);
+}
+
+bool LLUI_DISPLAY_isRectangleInClip(MICROUI_GraphicsContext* gc, jint x1, jint y1, jint x2, jint y2) {
+    return LLUI_DISPLAY_isPixelInClip(gc, x1, y1) && LLUI_DISPLAY_isPixelInClip(gc, x2, y2);
+}
+
+bool LLUI_DISPLAY_isHorizontalLineInClip(MICROUI_GraphicsContext* gc, jint x1, jint x2, jint y) {
+    return LLUI_DISPLAY_isRectangleInClip(gc, x1, y, x2, y);
+}
+
+bool LLUI_DISPLAY_isVerticalLineInClip(MICROUI_GraphicsContext* gc, jint y1, jint y2, jint x) {
+    return LLUI_DISPLAY_isRectangleInClip(gc, x, y1, x, y2);
+}
+
+bool LLUI_DISPLAY_isRegionInClip(MICROUI_GraphicsContext* gc, jint x, jint y, jint width, jint height) {
+    return LLUI_DISPLAY_isRectangleInClip(gc, x, y, x + width - 1, y + height - 1);
+}
+
+bool LLUI_DISPLAY_clipRectangle(MICROUI_GraphicsContext* gc, jint* x1, jint* y1, jint* x2, jint* y2) {
+    *x1 = (*x1 < gc->clip_x1) ? gc->clip_x1 : *x1;
+    *y1 = (*y1 < gc->clip_y1) ? gc->clip_y1 : *y1;
+    *x2 = (*x2 > gc->clip_x2) ? gc->clip_x2 : *x2;
+    *y2 = (*y2 > gc->clip_y2) ? gc->clip_y2 : *y2;
+    return (*x1 <= *x2) && (*y1 <= *y2);
+}
+
+bool LLUI_DISPLAY_clipHorizontalLine(MICROUI_GraphicsContext* gc, jint* x1, jint* x2, jint y) {
+    jint y1 = y;
+    jint y2 = y;
+    return LLUI_DISPLAY_clipRectangle(gc, x1, &y1, x2, &y2);
+}
+
+bool LLUI_DISPLAY_clipVerticalLine(MICROUI_GraphicsContext* gc, jint* y1, jint* y2, jint x) {
+    jint x1 = x;
+    jint x2 = x;
+    return LLUI_DISPLAY_clipRectangle(gc, &x1, y1, &x2, y2);
+}
+
+bool LLUI_DISPLAY_clipRegion(MICROUI_GraphicsContext* gc, jint* x, jint* y, jint* width, jint* height, jint* destX, jint* destY) {
+    jint delta;
+
+    delta = gc->clip_x1 - *destX;
+    if (delta > 0) {
+        *destX += delta;
+        *x += delta;
+        *width -= delta;
+    }
+    delta = gc->clip_y1 - *destY;
+    if (delta > 0) {
+        *destY += delta;
+        *y += delta;
+        *height -= delta;
+    }
+    delta = *destX + *width - 1 - gc->clip_x2;
+    if (delta > 0) {
+        *width -= delta;
+    }
+    delta = *destY + *height - 1 - gc->clip_y2;
+    if (delta > 0) {
+        *height -= delta;
+    }
+    return (*width > 0) && (*height > 0);
+}
+
+bool LLUI_DISPLAY_regionsOverlap(MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint regionX, jint regionY, jint width, jint height, jint destX, jint destY) {
+    return (img == &gc->image) && (regionX < (destX + width)) && (destX < (regionX + width)) && (regionY < (destY + height)) && (destY < (regionY + height));
+}
+
+uint8_t* LLUI_DISPLAY_getBufferAddress(MICROUI_Image* image) {
+    return replay_surface_of(image)->pixels;
+}
+
+uint32_t LLUI_DISPLAY_getStrideInPixels(MICROUI_Image* image) {
+    return image->width;
+}
+
+uint32_t LLUI_DISPLAY_getStrideInBytes(MICROUI_Image* image) {
+    return image->width * replay_surface_of(image)->bytes_per_pixel;
+}
+
+bool LLUI_DISPLAY_setDrawingLimits(jint xmin, jint ymin, jint xmax, jint ymax) {
+    if ((xmin <= xmax) && (ymin <= ymax)) {
+        drawing_pixels += (uint64_t)(xmax - xmin + 1) * (uint64_t)(ymax - ymin + 1);
+    }
+    return true;
+}
+
+uint32_t LLUI_DISPLAY_convertARGBColorToDisplayColor(uint32_t color) {
+#if LLUI_DISPLAY_BPP == 16
+    return ((color >> 8) & 0xF800) | ((color >> 5) & 0x07E0) | ((color >> 3) & 0x001F);
+#else
+    return color & 0xFFFFFF;
+#endif
+}
+
+uint32_t LLUI_DISPLAY_convertDisplayColorToARGBColor(uint32_t color) {
+#if LLUI_DISPLAY_BPP == 16
+    uint32_t r = (color >> 11) & 0x1F;
+    uint32_t g = (color >> 5) & 0x3F;
+    uint32_t b = color & 0x1F;
+    return 0xFF000000u | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+#else
+    return 0xFF000000u | color;
+#endif
+}
+
+uint32_t LLUI_DISPLAY_blend(uint32_t foreground, uint32_t background, uint32_t alpha) {
+    uint32_t color = 0xFF000000u;
+    for (uint32_t shift = 0; shift < 24; shift += 8) {
+        uint32_t channel = ((((foreground >> shift) & 0xFF) * alpha) + (((background >> shift) & 0xFF) * (255 - alpha)) + 127) / 255;
+        color |= channel << shift;
+    }
+    return color;
+}
+
+/* Drawings not linked -------------------------------------------------------*/
+
+/*
+ * Weak drawing function: the parameters are given in parentheses, followed by the statements
+ * which mark them as unused.
+ */
+#define REPLAY_NOT_LINKED(function, parameters, unused) \
+    __attribute__((weak)) DRAWING_Status function parameters { \
+        unused \
+        drawing_not_replayed = true; \
+        return DRAWING_DONE; \
+    }
+
+#define REPLAY_NOT_LINKED_SOFT(function, parameters, unused) \
+    __attribute__((weak)) void function parameters { \
+        unused \
+        drawing_not_replayed = true; \
+    }
+
+REPLAY_NOT_LINKED(UI_DRAWING_writePixel, (MICROUI_GraphicsContext* gc, jint x, jint y), (void)gc; (void)x; (void)y;)
+REPLAY_NOT_LINKED(UI_DRAWING_drawLine, (MICROUI_GraphicsContext* gc, jint startX, jint startY, jint endX, jint endY), (void)gc; (void)startX; (void)startY; (void)endX; (void)endY;)
+REPLAY_NOT_LINKED(UI_DRAWING_drawHorizontalLine, (MICROUI_GraphicsContext* gc, jint x1, jint x2, jint y), (void)gc; (void)x1; (void)x2; (void)y;)
+REPLAY_NOT_LINKED(UI_DRAWING_drawVerticalLine, (MICROUI_GraphicsContext* gc, jint x, jint y1, jint y2), (void)gc; (void)x; (void)y1; (void)y2;)
+REPLAY_NOT_LINKED(UI_DRAWING_drawRectangle, (MICROUI_GraphicsContext* gc, jint x1, jint y1, jint x2, jint y2), (void)gc; (void)x1; (void)y1; (void)x2; (void)y2;)
+REPLAY_NOT_LINKED(UI_DRAWING_fillRectangle, (MICROUI_GraphicsContext* gc, jint x1, jint y1, jint x2, jint y2), (void)gc; (void)x1; (void)y1; (void)x2; (void)y2;)
+REPLAY_NOT_LINKED(UI_DRAWING_drawRoundedRectangle, (MICROUI_GraphicsContext* gc, jint x, jint y, jint width, jint height, jint cornerEllipseWidth, jint cornerEllipseHeight), (void)gc; (void)x; (void)y; (void)width; (void)height; (void)cornerEllipseWidth; (void)cornerEllipseHeight;)
+REPLAY_NOT_LINKED(UI_DRAWING_fillRoundedRectangle, (MICROUI_GraphicsContext* gc, jint x, jint y, jint width, jint height, jint cornerEllipseWidth, jint cornerEllipseHeight), (void)gc; (void)x; (void)y; (void)width; (void)height; (void)cornerEllipseWidth; (void)cornerEllipseHeight;)
+REPLAY_NOT_LINKED(UI_DRAWING_drawCircleArc, (MICROUI_GraphicsContext* gc, jint x, jint y, jint diameter, jfloat startAngle, jfloat arcAngle), (void)gc; (void)x; (void)y; (void)diameter; (void)startAngle; (void)arcAngle;)
+REPLAY_NOT_LINKED(UI_DRAWING_drawEllipseArc, (MICROUI_GraphicsContext* gc, jint x, jint y, jint width, jint height, jfloat startAngle, jfloat arcAngle), (void)gc; (void)x; (void)y; (void)width; (void)height; (void)startAngle; (void)arcAngle;)
+REPLAY_NOT_LINKED(UI_DRAWING_fillCircleArc, (MICROUI_GraphicsContext* gc, jint x, jint y, jint diameter, jfloat startAngle, jfloat arcAngle), (void)gc; (void)x; (void)y; (void)diameter; (void)startAngle; (void)arcAngle;)
+REPLAY_NOT_LINKED(UI_DRAWING_fillEllipseArc, (MICROUI_GraphicsContext* gc, jint x, jint y, jint width, jint height, jfloat startAngle, jfloat arcAngle), (void)gc; (void)x; (void)y; (void)width; (void)height; (void)startAngle; (void)arcAngle;)
+REPLAY_NOT_LINKED(UI_DRAWING_drawEllipse, (MICROUI_GraphicsContext* gc, jint x, jint y, jint width, jint height), (void)gc; (void)x; (void)y; (void)width; (void)height;)
+REPLAY_NOT_LINKED(UI_DRAWING_fillEllipse, (MICROUI_GraphicsContext* gc, jint x, jint y, jint width, jint height), (void)gc; (void)x; (void)y; (void)width; (void)height;)
+REPLAY_NOT_LINKED(UI_DRAWING_drawCircle, (MICROUI_GraphicsContext* gc, jint x, jint y, jint diameter), (void)gc; (void)x; (void)y; (void)diameter;)
+REPLAY_NOT_LINKED(UI_DRAWING_fillCircle, (MICROUI_GraphicsContext* gc, jint x, jint y, jint diameter), (void)gc; (void)x; (void)y; (void)diameter;)
+REPLAY_NOT_LINKED(UI_DRAWING_drawImage, (MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint regionX, jint regionY, jint width, jint height, jint x, jint y, jint alpha), (void)gc; (void)img; (void)regionX; (void)regionY; (void)width; (void)height; (void)x; (void)y; (void)alpha;)
+REPLAY_NOT_LINKED(DW_DRAWING_drawThickFadedPoint, (MICROUI_GraphicsContext* gc, jint x, jint y, jint thickness, jint fade), (void)gc; (void)x; (void)y; (void)thickness; (void)fade;)
+REPLAY_NOT_LINKED(DW_DRAWING_drawThickFadedLine, (MICROUI_GraphicsContext* gc, jint startX, jint startY, jint endX, jint endY, jint thickness, jint fade, DRAWING_Cap startCap, DRAWING_Cap endCap), (void)gc; (void)startX; (void)startY; (void)endX; (void)endY; (void)thickness; (void)fade; (void)startCap; (void)endCap;)
+REPLAY_NOT_LINKED(DW_DRAWING_drawThickFadedCircle, (MICROUI_GraphicsContext* gc, jint x, jint y, jint diameter, jint thickness, jint fade), (void)gc; (void)x; (void)y; (void)diameter; (void)thickness; (void)fade;)
+REPLAY_NOT_LINKED(DW_DRAWING_drawThickFadedCircleArc, (MICROUI_GraphicsContext* gc, jint x, jint y, jint diameter, jfloat startAngle, jfloat arcAngle, jint thickness, jint fade, DRAWING_Cap start, DRAWING_Cap end), (void)gc; (void)x; (void)y; (void)diameter; (void)startAngle; (void)arcAngle; (void)thickness; (void)fade; (void)start; (void)end;)
+REPLAY_NOT_LINKED(DW_DRAWING_drawThickFadedEllipse, (MICROUI_GraphicsContext* gc, jint x, jint y, jint width, jint height, jint thickness, jint fade), (void)gc; (void)x; (void)y; (void)width; (void)height; (void)thickness; (void)fade;)
+REPLAY_NOT_LINKED(DW_DRAWING_drawThickLine, (MICROUI_GraphicsContext* gc, jint startX, jint startY, jint endX, jint endY, jint thickness), (void)gc; (void)startX; (void)startY; (void)endX; (void)endY; (void)thickness;)
+REPLAY_NOT_LINKED(DW_DRAWING_drawThickCircle, (MICROUI_GraphicsContext* gc, jint x, jint y, jint diameter, jint thickness), (void)gc; (void)x; (void)y; (void)diameter; (void)thickness;)
+REPLAY_NOT_LINKED(DW_DRAWING_drawThickEllipse, (MICROUI_GraphicsContext* gc, jint x, jint y, jint width, jint height, jint thickness), (void)gc; (void)x; (void)y; (void)width; (void)height; (void)thickness;)
+REPLAY_NOT_LINKED(DW_DRAWING_drawThickCircleArc, (MICROUI_GraphicsContext* gc, jint x, jint y, jint diameter, jfloat startAngle, jfloat arcAngle, jint thickness), (void)gc; (void)x; (void)y; (void)diameter; (void)startAngle; (void)arcAngle; (void)thickness;)
+REPLAY_NOT_LINKED(DW_DRAWING_drawFlippedImage, (MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint regionX, jint regionY, jint width, jint height, jint x, jint y, DRAWING_Flip transformation, jint alpha), (void)gc; (void)img; (void)regionX; (void)regionY; (void)width; (void)height; (void)x; (void)y; (void)transformation; (void)alpha;)
+REPLAY_NOT_LINKED(DW_DRAWING_drawRotatedImageNearestNeighbor, (MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jint rotationX, jint rotationY, jfloat angle, jint alpha), (void)gc; (void)img; (void)x; (void)y; (void)rotationX; (void)rotationY; (void)angle; (void)alpha;)
+REPLAY_NOT_LINKED(DW_DRAWING_drawRotatedImageBilinear, (MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jint rotationX, jint rotationY, jfloat angle, jint alpha), (void)gc; (void)img; (void)x; (void)y; (void)rotationX; (void)rotationY; (void)angle; (void)alpha;)
+REPLAY_NOT_LINKED(DW_DRAWING_drawScaledImageNearestNeighbor, (MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jfloat factorX, jfloat factorY, jint alpha), (void)gc; (void)img; (void)x; (void)y; (void)factorX; (void)factorY; (void)alpha;)
+REPLAY_NOT_LINKED(DW_DRAWING_drawScaledImageBilinear, (MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jfloat factorX, jfloat factorY, jint alpha), (void)gc; (void)img; (void)x; (void)y; (void)factorX; (void)factorY; (void)alpha;)
+
+/* Fallbacks of ui_drawing_rgb565.c */
+REPLAY_NOT_LINKED_SOFT(UI_DRAWING_SOFT_drawHorizontalLine, (MICROUI_GraphicsContext* gc, jint x1, jint x2, jint y), (void)gc; (void)x1; (void)x2; (void)y;)
+REPLAY_NOT_LINKED_SOFT(UI_DRAWING_SOFT_fillRectangle, (MICROUI_GraphicsContext* gc, jint x1, jint y1, jint x2, jint y2), (void)gc; (void)x1; (void)y1; (void)x2; (void)y2;)
+REPLAY_NOT_LINKED_SOFT(UI_DRAWING_SOFT_drawImage, (MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint regionX, jint regionY, jint width, jint height, jint x, jint y, jint alpha), (void)gc; (void)img; (void)regionX; (void)regionY; (void)width; (void)height; (void)x; (void)y; (void)alpha;)
+
+/* Fallbacks of dw_drawing_rgb565.c */
+REPLAY_NOT_LINKED_SOFT(DW_DRAWING_SOFT_drawRotatedImageNearestNeighbor, (MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jint rotationX, jint rotationY, jfloat angle, jint alpha), (void)gc; (void)img; (void)x; (void)y; (void)rotationX; (void)rotationY; (void)angle; (void)alpha;)
+REPLAY_NOT_LINKED_SOFT(DW_DRAWING_SOFT_drawRotatedImageBilinear, (MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jint rotationX, jint rotationY, jfloat angle, jint alpha), (void)gc; (void)img; (void)x; (void)y; (void)rotationX; (void)rotationY; (void)angle; (void)alpha;)
+REPLAY_NOT_LINKED_SOFT(DW_DRAWING_SOFT_drawScaledImageNearestNeighbor, (MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jfloat factorX, jfloat factorY, jint alpha), (void)gc; (void)img; (void)x; (void)y; (void)factorX; (void)factorY; (void)alpha;)
+REPLAY_NOT_LINKED_SOFT(DW_DRAWING_SOFT_drawThickFadedLine, (MICROUI_GraphicsContext* gc, jint startX, jint startY, jint endX, jint endY, jint thickness, jint fade, DRAWING_Cap startCap, DRAWING_Cap endCap), (void)gc; (void)startX; (void)startY; (void)endX; (void)endY; (void)thickness; (void)fade; (void)startCap; (void)endCap;)
+REPLAY_NOT_LINKED_SOFT(DW_DRAWING_SOFT_drawThickFadedCircle, (MICROUI_GraphicsContext* gc, jint x, jint y, jint diameter, jint thickness, jint fade), (void)gc; (void)x; (void)y; (void)diameter; (void)thickness; (void)fade;)
+REPLAY_NOT_LINKED_SOFT(DW_DRAWING_SOFT_drawThickFadedCircleArc, (MICROUI_GraphicsContext* gc, jint x, jint y, jint diameter, jfloat startAngle, jfloat arcAngle, jint thickness, jint fade, DRAWING_Cap start, DRAWING_Cap end), (void)gc; (void)x; (void)y; (void)diameter; (void)startAngle; (void)arcAngle; (void)thickness; (void)fade; (void)start; (void)end;)
+
+/* Main ----------------------------------------------------------------------*/
+
+int main(int argc, char** argv) {
+    uint32_t repeat = 1;
+    bool checksums = false;
+    const char* path = NULL;
+    uint8_t* log;
+    uint32_t length;
+    uint32_t flushes = 0;
+    uint64_t total_best_ns = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "-r") == 0) && ((i + 1) < argc)) {
+            repeat = (uint32_t)strtoul(argv[++i], NULL, 10);
+            repeat = (repeat == 0) ? 1 : repeat;
+        } else if (strcmp(argv[i], "-c") == 0) {
+            checksums = true;
+        } else {
+            path = argv[i];
+        }
+    }
+    if (path == NULL) {
+        fprintf(stderr, "usage: %s [-r repeat] [-c] <trace>\n", argv[0]);
+        return 2;
+    }
+
+    log = replay_load(path, &length);
+    if (log == NULL) {
+        fprintf(stderr, "%s: not a drawing trace\n", path);
+        return 2;
+    }
+
+    for (uint32_t run = 0; run < repeat; run++) {
+        /* each run starts from the same buffers */
+        for (uint32_t i = 0; i < surfaces_count; i++) {
+            free(surfaces[i].pixels);
+        }
+        surfaces_count = 0;
+        display = NULL;
+        malformed_records = 0;
+        flushes = replay_run(log, length, checksums && (run == 0));
+    }
+
+    printf("%u bytes, %u flushes, %u runs, %u malformed records\n", length, flushes, repeat, malformed_records);
+    printf("%4s %8s %8s %12s %12s %12s %10s\n", "id", "calls", "skipped", "pixels", "best us", "mean us", "ns/call");
+    for (uint32_t id = 0; id < REPLAY_MAX_IDS; id++) {
+        replay_stats_t* s = &stats[id];
+        uint32_t calls = s->calls / repeat;
+        if (calls > 0) {
+            printf("%4u %8u %8u %12llu %12.1f %12.1f %10.1f\n", id, calls, s->not_replayed / repeat, (unsigned long long)(s->pixels / repeat),
+                    (double)s->best_time_ns / 1000.0, (double)s->time_ns / repeat / 1000.0, (double)s->best_time_ns / calls);
+            total_best_ns += s->best_time_ns;
+        }
+    }
+    printf("total %.1f us, %.1f us per flush\n", (double)total_best_ns / 1000.0, (flushes > 0) ? ((double)total_best_ns / 1000.0 / flushes) : 0.0);
+
+    free(log);
+    return (malformed_records == 0) ? 0 : 1;
+}
@@ -0,0 +1,1490 @@
+/*
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief This file overrides some dw_drawing.h functions (weak implementations of the
+ * Graphics Engine) with kernels drawing RGB565 and ARGB8888 images on an RGB565 buffer:
+ * - the rotations (nearest neighbor and bilinear): the source position of a destination
+ *   pixel is stepped in 16.16 fixed point along the rows (the trigonometry is computed once
+ *   per drawing). For each destination row, the span of pixels whose source position lies
+ *   in the image is solved once, so the inner loops do not check the bounds. Inside an
+ *   RGB565 image, the bilinear interpolation works on the RGB565 channels spread in a
+ *   32-bit word with 5-bit weights. The rotations by a multiple of 90 degrees (bilinear
+ *   included: the source positions are the pixels centers) step a pointer in the source
+ *   image.
+ * - the scaling (nearest neighbor): the source columns are stepped in fixed point and a
+ *   destination row which uses the same source row as the previous one is copied when the
+ *   image is opaque.
+ * - the thick faded lines, circles and circle arcs: the alpha of a pixel is given by its
+ *   distance to the skeleton of the shape (axis or circle), in 1/32 pixel, through a lookup
+ *   table: opaque up to half the thickness minus half a pixel, then decreasing linearly to
+ *   transparent at the fade plus half a pixel beyond. For each row, the spans known to be
+ *   opaque (filled) or transparent (skipped) are solved once; only the fading edges compute
+ *   a distance, in integers (stepped along the row for the lines, square root from the
+ *   previous pixel one for the circles).
+ *
+ * A destination pixel is drawn with the source pixel under its center, rotated
+ * counterclockwise by the angle around the rotation center (respectively scaled).
+ *
+ * The drawings on a destination which is not a 16-bit buffer, the other images formats, an
+ * image drawn in itself and the faded shapes out of the supported sizes (thickness plus twice
+ * the fade and the diameter over 2042 pixels) are delegated to the software algorithms
+ * (dw_drawing_soft.h).
+ *
+ * @see dw_drawing.h file comment
+ * @author MicroEJ Developer Team
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include "LLUI_DISPLAY_configuration.h"
+
+#if LLUI_DISPLAY_BPP == 16
+
+// implements dw_drawing functions
+#include "dw_drawing.h"
+
+// calls the software algorithms when the destination or the image is not supported
+#include "dw_drawing_soft.h"
+
+// uses the graphics engine functions to retrieve the buffers and the clip
+#include "LLUI_DISPLAY.h"
+
+// RGB565 pixels conversions, blending and fills
+#include "ui_rgb565.h"
+
+#include <math.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------------------------------------------------------------------------
+// Macros and Defines
+// --------------------------------------------------------------------------------
+
+#define FIXED_SHIFT 16
+#define FIXED_ONE (1 << FIXED_SHIFT)
+#define FIXED_HALF (1 << (FIXED_SHIFT - 1))
+
+// faded shapes: the distances are computed in subpixels
+#define SUBPIXEL_SHIFT 5
+#define SUBPIXEL_ONE (1 << SUBPIXEL_SHIFT)
+#define SUBPIXEL_HALF (1 << (SUBPIXEL_SHIFT - 1))
+
+// faded shapes: the directions of the arc ends are in fixed point
+#define DIRECTION_SHIFT 14
+#define DIRECTION_HALF (1 << (DIRECTION_SHIFT - 1))
+
+// faded lines: the distances are stepped along the rows in fixed point subpixels
+#define LINE_STEP_SHIFT 12
+#define LINE_STEP_HALF (1 << (LINE_STEP_SHIFT - 1))
+
+// faded shapes: the spans known to be opaque or transparent are reduced by this distance (in
+// subpixels) to absorb the difference between their floating point computation and the
+// integer computation of the pixels
+#define SPAN_TOLERANCE 4
+
+#define FADE_LUT_SIZE 256
+#define FADED_MAX_SPANS 8
+
+// faded shapes: largest distance (in subpixels) from a drawn pixel to the skeleton of a line,
+// or to the center of a circle and to the ends of an arc, so that the sum of two squared
+// distances fits the 32-bit computations; larger shapes are delegated to the software
+// algorithms
+#define FADED_MAX_REACH 32767
+#define FADED_MAX_COORDINATE 2048
+
+// --------------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Source image of a transformation.
+ */
+typedef struct
+{
+	uint8_t* pixels;
+	int32_t stride; // in pixels
+	int32_t width;
+	int32_t height;
+	bool rgb565; // ARGB8888 otherwise
+} source_t;
+
+/*
+ * @brief Fade of a faded shape: the alpha of a pixel depends on its distance to the skeleton
+ * of the shape (its axis or its circle).
+ */
+typedef struct
+{
+	uint16_t* pixels;
+	uint32_t stride; // in pixels
+	uint32_t color; // RGB888
+	uint32_t color_pair; // RGB565 in both halves
+	// distances in subpixels: half the thickness, the pixels which are opaque and transparent
+	int32_t half;
+	int32_t opaque;
+	int32_t transparent;
+	// alpha of the distances between opaque and transparent, by steps of 2^lut_shift
+	uint32_t lut_shift;
+	uint8_t lut[FADE_LUT_SIZE];
+} fade_t;
+
+/*
+ * @brief Span of a row of a faded shape known to be opaque or transparent.
+ */
+typedef struct
+{
+	jint x1;
+	jint x2;
+	bool opaque;
+} faded_span_t;
+
+/*
+ * @brief Draws the pixels [x1, x2] of a row of a faded shape computing their distance.
+ */
+typedef void (*faded_band_t)(const void* shape, uint16_t* row, jint x1, jint x2, jint y);
+
+typedef struct
+{
+	fade_t fade;
+	// start of the line and direction from the start to the end
+	jint x;
+	jint y;
+	float direction_x;
+	float direction_y;
+	int32_t length; // in subpixels
+	// steps of the position along the line and of the distance across it from a column to
+	// the next one (in fixed point subpixels)
+	int32_t along_step;
+	int32_t across_step;
+	DRAWING_Cap start_cap;
+	DRAWING_Cap end_cap;
+} faded_line_t;
+
+/*
+ * @brief Faded circle or arc. The positions are relative to the center, in subpixels, the y
+ * axis downwards.
+ */
+typedef struct
+{
+	fade_t fade;
+	int32_t radius;
+	// position of the center of the pixel (0, 0)
+	int32_t column;
+	int32_t row;
+	bool arc; // full circle otherwise
+	bool wide; // arc larger than a half circle
+	// directions of the arc ends, in floating point and in fixed point
+	float start_dir_x;
+	float start_dir_y;
+	float end_dir_x;
+	float end_dir_y;
+	int32_t start_cos;
+	int32_t start_sin;
+	int32_t end_cos;
+	int32_t end_sin;
+	// ends of the arc
+	int32_t start_x;
+	int32_t start_y;
+	int32_t end_x;
+	int32_t end_y;
+	DRAWING_Cap start_cap;
+	DRAWING_Cap end_cap;
+} faded_ring_t;
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Tells if the image can be drawn by this file kernels in the graphics context.
+ */
+static bool _is_supported(MICROUI_GraphicsContext* gc, MICROUI_Image* img)
+{
+	return UI_RGB565_is_destination(gc) && (UI_RGB565_is_image(img) || (MICROUI_IMAGE_FORMAT_ARGB8888 == img->format))
+			&& (LLUI_DISPLAY_getBufferAddress(img) != LLUI_DISPLAY_getBufferAddress(&gc->image));
+}
+
+static void _get_source(MICROUI_Image* img, source_t* source)
+{
+	source->pixels = LLUI_DISPLAY_getBufferAddress(img);
+	source->stride = (int32_t)LLUI_DISPLAY_getStrideInPixels(img);
+	source->width = img->width;
+	source->height = img->height;
+	source->rgb565 = UI_RGB565_is_image(img);
+}
+
+/*
+ * @brief Clips the given rectangle by the graphics context clip and destination bounds.
+ *
+ * @return false when the rectangle is out of the clip.
+ */
+static bool _clip(MICROUI_GraphicsContext* gc, jint* x1, jint* y1, jint* x2, jint* y2)
+{
+	*x1 = (*x1 < 0) ? 0 : *x1;
+	*y1 = (*y1 < 0) ? 0 : *y1;
+	*x2 = (*x2 >= gc->image.width) ? (gc->image.width - 1) : *x2;
+	*y2 = (*y2 >= gc->image.height) ? (gc->image.height - 1) : *y2;
+	return (*x1 <= *x2) && (*y1 <= *y2) && (!LLUI_DISPLAY_isClipEnabled(gc) || LLUI_DISPLAY_clipRectangle(gc, x1, y1, x2, y2));
+}
+
+/*
+ * @brief Returns the source pixel at the given position as an ARGB8888 color.
+ */
+static inline uint32_t _read(const source_t* source, int32_t x, int32_t y)
+{
+	int32_t index = (y * source->stride) + x;
+	return source->rgb565 ? (0xff000000u | UI_RGB565_to_rgb888(((uint16_t*)source->pixels)[index])) : ((uint32_t*)source->pixels)[index];
+}
+
+/*
+ * @brief Same as _read() but returns a transparent color for a position out of the image.
+ */
+static inline uint32_t _read_or_transparent(const source_t* source, int32_t x, int32_t y)
+{
+	return ((x >= 0) && (y >= 0) && (x < source->width) && (y < source->height)) ? _read(source, x, y) : 0;
+}
+
+/*
+ * @brief Divides by a positive divisor, rounding down. The operands usually fit in 32 bits: a
+ * 64-bit division is a library call on the target.
+ */
+static inline int64_t _floor_div(int64_t value, int64_t divisor)
+{
+	if ((value == (int32_t)value) && (divisor == (int32_t)divisor))
+	{
+		int32_t quotient = (int32_t)value / (int32_t)divisor;
+		return (((int32_t)value % (int32_t)divisor) < 0) ? (quotient - 1) : quotient;
+	}
+	int64_t quotient = value / divisor;
+	return ((value % divisor) < 0) ? (quotient - 1) : quotient;
+}
+
+static inline int64_t _ceil_div(int64_t value, int64_t divisor)
+{
+	return -_floor_div(-value, divisor);
+}
+
+/*
+ * @brief Reduces the span [first, last] of steps t to the steps where the linear function
+ * start + (step * t) lies in [min, max[ (the function is evaluated exactly in fixed point).
+ */
+static void _clip_span(int32_t start, int32_t step, int32_t min, int32_t max, int32_t* first, int32_t* last)
+{
+	int64_t lower;
+	int64_t upper;
+
+	if (step > 0)
+	{
+		lower = _ceil_div((int64_t)min - start, step);
+		upper = _floor_div((int64_t)max - 1 - start, step);
+	}
+	else if (step < 0)
+	{
+		lower = _ceil_div((int64_t)start - max + 1, -(int64_t)step);
+		upper = _floor_div((int64_t)start - min, -(int64_t)step);
+	}
+	else
+	{
+		bool inside = (start >= min) && (start < max);
+		lower = inside ? *first : 1;
+		upper = inside ? *last : 0;
+	}
+	*first = (lower > *first) ? (int32_t)lower : *first;
+	*last = (upper < *last) ? (int32_t)upper : *last;
+}
+
+/*
+ * @brief Interpolates two RGB888 colors: (a * (256 - weight) + b * weight) / 256 on each
+ * channel, the red and blue channels being computed together.
+ */
+static inline uint32_t _lerp(uint32_t a, uint32_t b, uint32_t weight)
+{
+	uint32_t rb = ((((a & 0xff00ffu) * (256 - weight)) + ((b & 0xff00ffu) * weight)) >> 8) & 0xff00ffu;
+	uint32_t g = ((((a & 0x00ff00u) * (256 - weight)) + ((b & 0x00ff00u) * weight)) >> 8) & 0x00ff00u;
+	return rb | g;
+}
+
+/*
+ * @brief Interpolates the four source pixels around the given position (16.16 fixed point,
+ * relatively to the pixels centers). The pixels out of the image are transparent.
+ */
+static uint32_t _interpolate(const source_t* source, int32_t fx, int32_t fy)
+{
+	int32_t x = fx >> FIXED_SHIFT;
+	int32_t y = fy >> FIXED_SHIFT;
+	uint32_t dx = ((uint32_t)fx >> (FIXED_SHIFT - 8)) & 0xff;
+	uint32_t dy = ((uint32_t)fy >> (FIXED_SHIFT - 8)) & 0xff;
+	uint32_t colors[4];
+	uint32_t result;
+
+	colors[0] = _read_or_transparent(source, x, y);
+	colors[1] = _read_or_transparent(source, x + 1, y);
+	colors[2] = _read_or_transparent(source, x, y + 1);
+	colors[3] = _read_or_transparent(source, x + 1, y + 1);
+	if ((colors[0] & colors[1] & colors[2] & colors[3]) >= 0xff000000u)
+	{
+		// opaque pixels: interpolation along the rows, then between the rows
+		result = 0xff000000u | _lerp(_lerp(colors[0], colors[1], dx), _lerp(colors[2], colors[3], dx), dy);
+	}
+	else
+	{
+		// average of the channels weighted by the pixels alpha, to not darken the edges
+		uint32_t weights[4];
+		uint32_t sums[4] = { 0, 0, 0, 0 };
+
+		// the weights sum is 65536
+		weights[0] = (256 - dx) * (256 - dy);
+		weights[1] = dx * (256 - dy);
+		weights[2] = (256 - dx) * dy;
+		weights[3] = dx * dy;
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			uint32_t weight = (weights[i] * (colors[i] >> 24)) >> 8;
+			sums[3] += weight;
+			sums[0] += weight * ((colors[i] >> 16) & 0xff);
+			sums[1] += weight * ((colors[i] >> 8) & 0xff);
+			sums[2] += weight * (colors[i] & 0xff);
+		}
+		result = 0;
+		if (0 != sums[3])
+		{
+			uint32_t half = sums[3] / 2;
+			result = (((sums[3] + 0x80) >> 8) << 24) | (((sums[0] + half) / sums[3]) << 16) | (((sums[1] + half) / sums[3]) << 8) | ((sums[2] + half) / sums[3]);
+		}
+	}
+	return result;
+}
+
+/*
+ * @brief Spreads the channels of an RGB565 pixel in a 32-bit word (green in the high half)
+ * so that they can be multiplied by a 5-bit weight without overlapping.
+ */
+static inline uint32_t _spread_rgb565(uint16_t pixel)
+{
+	return ((uint32_t)pixel | ((uint32_t)pixel << 16)) & 0x07e0f81fu;
+}
+
+/*
+ * @brief Interpolates the four RGB565 pixels around the given position, which are in the
+ * image, with 5-bit weights (the precision of the RGB565 channels).
+ */
+static inline uint16_t _interpolate_rgb565(const uint16_t* pixels, int32_t stride, int32_t fx, int32_t fy)
+{
+	const uint16_t* around = pixels + (((fy >> FIXED_SHIFT) * stride) + (fx >> FIXED_SHIFT));
+	uint32_t dx = ((uint32_t)fx >> (FIXED_SHIFT - 5)) & 0x1f;
+	uint32_t dy = ((uint32_t)fy >> (FIXED_SHIFT - 5)) & 0x1f;
+	uint32_t top = _spread_rgb565(around[0]);
+	uint32_t bottom = _spread_rgb565(around[stride]);
+
+	top = (((top * (32 - dx)) + (_spread_rgb565(around[1]) * dx)) >> 5) & 0x07e0f81fu;
+	bottom = (((bottom * (32 - dx)) + (_spread_rgb565(around[stride + 1]) * dx)) >> 5) & 0x07e0f81fu;
+	top = (((top * (32 - dy)) + (bottom * dy)) >> 5) & 0x07e0f81fu;
+	return (uint16_t)(top | (top >> 16));
+}
+
+/*
+ * @brief Draws the pixels of a bilinear rotation row whose four source pixels are in an
+ * RGB565 image. The source is given by value: the compiler does not know that the
+ * destination does not overlap a source descriptor, it would read it again after each
+ * written pixel.
+ */
+static void _draw_span_bilinear_rgb565(const uint16_t* pixels, int32_t stride, int32_t fx, int32_t fy, int32_t cosine, int32_t sine, uint16_t* dst, int32_t length, uint32_t alpha)
+{
+	if (255 == alpha)
+	{
+		for (int32_t i = 0; i < length; i++)
+		{
+			dst[i] = _interpolate_rgb565(pixels, stride, fx, fy);
+			fx += cosine;
+			fy += sine;
+		}
+	}
+	else
+	{
+		for (int32_t i = 0; i < length; i++)
+		{
+			dst[i] = UI_RGB565_blend_rgb565(_interpolate_rgb565(pixels, stride, fx, fy), dst[i], alpha);
+			fx += cosine;
+			fy += sine;
+		}
+	}
+}
+
+/*
+ * @brief Draws a row of a rotation by a multiple of 90 degrees: the source pixel of the
+ * next destination pixel is at a constant offset.
+ */
+static void _draw_row_quarter(const source_t* source, int32_t index, int32_t step, uint16_t* dst, int32_t length, uint32_t alpha)
+{
+	if (source->rgb565)
+	{
+		uint16_t* src = (uint16_t*)source->pixels + index;
+		if (255 == alpha)
+		{
+			for (int32_t i = 0; i < length; i++)
+			{
+				dst[i] = *src;
+				src += step;
+			}
+		}
+		else
+		{
+			for (int32_t i = 0; i < length; i++)
+			{
+				dst[i] = UI_RGB565_blend_rgb565(*src, dst[i], alpha);
+				src += step;
+			}
+		}
+	}
+	else
+	{
+		uint32_t* src = (uint32_t*)source->pixels + index;
+		for (int32_t i = 0; i < length; i++)
+		{
+			UI_RGB565_draw_argb8888(&dst[i], *src, alpha);
+			src += step;
+		}
+	}
+}
+
+/*
+ * @brief Draws a row of a free rotation with the nearest neighbor algorithm. The source
+ * positions of the row pixels are in the image.
+ */
+static void _draw_row_nearest(const source_t* source, int32_t fx, int32_t fy, int32_t cosine, int32_t sine, uint16_t* dst, int32_t length, uint32_t alpha)
+{
+	if (source->rgb565 && (255 == alpha))
+	{
+		uint16_t* src = (uint16_t*)source->pixels;
+		for (int32_t i = 0; i < length; i++)
+		{
+			dst[i] = src[((fy >> FIXED_SHIFT) * source->stride) + (fx >> FIXED_SHIFT)];
+			fx += cosine;
+			fy += sine;
+		}
+	}
+	else
+	{
+		for (int32_t i = 0; i < length; i++)
+		{
+			UI_RGB565_draw_argb8888(&dst[i], _read(source, fx >> FIXED_SHIFT, fy >> FIXED_SHIFT), alpha);
+			fx += cosine;
+			fy += sine;
+		}
+	}
+}
+
+/*
+ * @brief Draws a row of a free rotation with the bilinear algorithm. The pixels of the
+ * row edges interpolate some pixels out of the image; the pixels of the row middle only
+ * interpolate pixels in the image, which is faster for an RGB565 image.
+ */
+static void _draw_row_bilinear(const source_t* source, int32_t fx, int32_t fy, int32_t cosine, int32_t sine, uint16_t* dst, int32_t length, uint32_t alpha)
+{
+	int32_t first = 0;
+	int32_t last = length - 1;
+	int32_t i = 0;
+
+	if (source->rgb565)
+	{
+		_clip_span(fx, cosine, 0, (source->width - 1) << FIXED_SHIFT, &first, &last);
+		_clip_span(fy, sine, 0, (source->height - 1) << FIXED_SHIFT, &first, &last);
+	}
+	if (!source->rgb565 || (first > last))
+	{
+		first = length;
+	}
+
+	for (; i < first; i++)
+	{
+		UI_RGB565_draw_argb8888(&dst[i], _interpolate(source, fx, fy), alpha);
+		fx += cosine;
+		fy += sine;
+	}
+	if (i <= last)
+	{
+		_draw_span_bilinear_rgb565((const uint16_t*)source->pixels, source->stride, fx, fy, cosine, sine, dst + i, last - i + 1, alpha);
+		fx += (last - i + 1) * cosine;
+		fy += (last - i + 1) * sine;
+		i = last + 1;
+	}
+	for (; i < length; i++)
+	{
+		UI_RGB565_draw_argb8888(&dst[i], _interpolate(source, fx, fy), alpha);
+		fx += cosine;
+		fy += sine;
+	}
+}
+
+/*
+ * @brief Draws a rotated image. The image and the destination are supported (see
+ * _is_supported()).
+ */
+static void _draw_rotated_image(MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jint rotationX, jint rotationY, jfloat angle, jint alpha, bool bilinear)
+{
+	source_t source;
+	float degrees = fmodf(angle, 360.0f);
+	bool quarter;
+	int32_t cosine;
+	int32_t sine;
+	jint x1 = INT32_MAX;
+	jint y1 = INT32_MAX;
+	jint x2 = INT32_MIN;
+	jint y2 = INT32_MIN;
+
+	degrees = (degrees < 0.0f) ? (degrees + 360.0f) : degrees;
+	degrees = (degrees >= 360.0f) ? 0.0f : degrees;
+	quarter = (0.0f == fmodf(degrees, 90.0f));
+	if (quarter)
+	{
+		static const int8_t cosines[4] = { 1, 0, -1, 0 };
+		uint32_t turns = (uint32_t)degrees / 90;
+		cosine = cosines[turns] * FIXED_ONE;
+		sine = cosines[(turns + 3) % 4] * FIXED_ONE;
+		// the source positions are the pixels centers: a bilinear interpolation would give the pixels
+		bilinear = false;
+	}
+	else
+	{
+		float radians = degrees * (float)(M_PI / 180.0);
+		cosine = (int32_t)lroundf(cosf(radians) * FIXED_ONE);
+		sine = (int32_t)lroundf(sinf(radians) * FIXED_ONE);
+	}
+
+	// bounding box of the image corners rotated counterclockwise around the rotation center
+	{
+		int32_t corners_x[2] = { x - rotationX, x - rotationX + img->width };
+		int32_t corners_y[2] = { y - rotationY, y - rotationY + img->height };
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			int64_t cx = corners_x[i & 1];
+			int64_t cy = corners_y[i >> 1];
+			jint rx = (jint)(((cx * cosine) + (cy * sine)) >> FIXED_SHIFT);
+			jint ry = (jint)(((cy * cosine) - (cx * sine)) >> FIXED_SHIFT);
+			x1 = (rx < x1) ? rx : x1;
+			y1 = (ry < y1) ? ry : y1;
+			x2 = (rx > x2) ? rx : x2;
+			y2 = (ry > y2) ? ry : y2;
+		}
+		// one more pixel on each side for the rounding and the bilinear edges
+		x1 += rotationX - 1;
+		y1 += rotationY - 1;
+		x2 += rotationX + 1;
+		y2 += rotationY + 1;
+	}
+
+	if (!_clip(gc, &x1, &y1, &x2, &y2))
+	{
+		// out of clip: nothing to draw
+		return;
+	}
+
+	_get_source(img, &source);
+
+	uint32_t dst_stride = LLUI_DISPLAY_getStrideInPixels(&gc->image);
+	uint16_t* dst = (uint16_t*)LLUI_DISPLAY_getBufferAddress(&gc->image) + ((uint32_t)y1 * dst_stride) + (uint32_t)x1;
+	// source position of the center of the pixel (x1, y1), rotated clockwise back to the image
+	int64_t u = ((int64_t)(x1 - rotationX) * FIXED_ONE) + FIXED_HALF;
+	int64_t v = ((int64_t)(y1 - rotationY) * FIXED_ONE) + FIXED_HALF;
+	int32_t row_fx = (int32_t)((((u * cosine) - (v * sine)) >> FIXED_SHIFT) + ((int64_t)(rotationX - x) * FIXED_ONE));
+	int32_t row_fy = (int32_t)((((u * sine) + (v * cosine)) >> FIXED_SHIFT) + ((int64_t)(rotationY - y) * FIXED_ONE));
+	// the bilinear algorithm interpolates the pixels around the position (one pixel out of the image at most)
+	int32_t min = bilinear ? -FIXED_ONE : 0;
+	int32_t max_x = source.width << FIXED_SHIFT;
+	int32_t max_y = source.height << FIXED_SHIFT;
+	jint drawn_x1 = INT32_MAX;
+	jint drawn_y1 = INT32_MAX;
+	jint drawn_x2 = INT32_MIN;
+	jint drawn_y2 = INT32_MIN;
+
+	if (bilinear)
+	{
+		row_fx -= FIXED_HALF;
+		row_fy -= FIXED_HALF;
+	}
+
+	for (jint row = y1; row <= y2; row++)
+	{
+		int32_t first = 0;
+		int32_t last = x2 - x1;
+
+		_clip_span(row_fx, cosine, min, max_x, &first, &last);
+		_clip_span(row_fy, sine, min, max_y, &first, &last);
+		if (first <= last)
+		{
+			int32_t fx = row_fx + (first * cosine);
+			int32_t fy = row_fy + (first * sine);
+			int32_t length = last - first + 1;
+
+			if (quarter)
+			{
+				int32_t index = ((fy >> FIXED_SHIFT) * source.stride) + (fx >> FIXED_SHIFT);
+				int32_t step = (cosine >> FIXED_SHIFT) + ((sine >> FIXED_SHIFT) * source.stride);
+				_draw_row_quarter(&source, index, step, dst + first, length, (uint32_t)alpha);
+			}
+			else if (bilinear)
+			{
+				_draw_row_bilinear(&source, fx, fy, cosine, sine, dst + first, length, (uint32_t)alpha);
+			}
+			else
+			{
+				_draw_row_nearest(&source, fx, fy, cosine, sine, dst + first, length, (uint32_t)alpha);
+			}
+
+			drawn_x1 = ((x1 + first) < drawn_x1) ? (x1 + first) : drawn_x1;
+			drawn_x2 = ((x1 + last) > drawn_x2) ? (x1 + last) : drawn_x2;
+			drawn_y1 = (row < drawn_y1) ? row : drawn_y1;
+			drawn_y2 = row;
+		}
+
+		// next row: the source position moves along the rotated vertical axis
+		row_fx -= sine;
+		row_fy += cosine;
+		dst += dst_stride;
+	}
+
+	if (drawn_x1 <= drawn_x2)
+	{
+		LLUI_DISPLAY_setDrawingLimits(drawn_x1, drawn_y1, drawn_x2, drawn_y2);
+	}
+}
+
+/*
+ * @brief Returns the fixed point step in the source of a scaling factor. It is rounded up,
+ * so that a destination pixel center which falls on the edge of two source pixels (common
+ * with the simple factors) selects the same pixel as an exact computation, unless the last
+ * destination pixel would step out of the image.
+ */
+static int32_t _get_scale_step(jfloat factor, int32_t source_size, int32_t destination_size)
+{
+	float step = (float)FIXED_ONE / factor;
+	int32_t step_up = (int32_t)ceilf(step);
+	int64_t last = ((int64_t)(destination_size - 1) * step_up) + (step_up / 2);
+	return (last < ((int64_t)source_size << FIXED_SHIFT)) ? step_up : (int32_t)step;
+}
+
+/*
+ * @brief Initializes the fade of a faded shape drawn with the foreground color.
+ */
+static void _init_fade(MICROUI_GraphicsContext* gc, fade_t* fade, jint thickness, jint fade_width)
+{
+	int32_t ramp;
+
+	fade->pixels = (uint16_t*)LLUI_DISPLAY_getBufferAddress(&gc->image);
+	fade->stride = LLUI_DISPLAY_getStrideInPixels(&gc->image);
+	fade->color = (uint32_t)gc->foreground_color & 0xffffff;
+	fade->color_pair = LLUI_DISPLAY_convertARGBColorToDisplayColor((uint32_t)gc->foreground_color) & 0xffff;
+	fade->color_pair |= fade->color_pair << 16;
+
+	// the alpha decreases linearly from half a pixel inside the edge of the thickness to fade
+	// pixels and a half outside
+	fade->half = thickness * SUBPIXEL_HALF;
+	fade->opaque = fade->half - SUBPIXEL_HALF;
+	fade->transparent = fade->half + (fade_width * SUBPIXEL_ONE) + SUBPIXEL_HALF;
+	ramp = fade->transparent - fade->opaque;
+
+	fade->lut_shift = 0;
+	while ((ramp >> fade->lut_shift) > FADE_LUT_SIZE)
+	{
+		fade->lut_shift++;
+	}
+	for (int32_t i = 0; i < FADE_LUT_SIZE; i++)
+	{
+		// alpha at the middle of the distances of the entry
+		int32_t distance = (i << fade->lut_shift) + ((1 << fade->lut_shift) >> 1);
+		fade->lut[i] = (distance < ramp) ? (uint8_t)((((ramp - distance) * 255) + (ramp / 2)) / ramp) : 0;
+	}
+}
+
+/*
+ * @brief Returns the alpha of a pixel at the given distance (in subpixels) from the skeleton
+ * of a faded shape.
+ */
+static inline uint32_t _get_fade_alpha(const fade_t* fade, int32_t distance)
+{
+	uint32_t alpha = 0;
+	if (distance <= fade->opaque)
+	{
+		alpha = 255;
+	}
+	else if (distance < fade->transparent)
+	{
+		alpha = fade->lut[(uint32_t)(distance - fade->opaque) >> fade->lut_shift];
+	}
+	return alpha;
+}
+
+static inline void _draw_faded_pixel(const fade_t* fade, uint16_t* pixel, uint32_t alpha)
+{
+	if (255 == alpha)
+	{
+		*pixel = (uint16_t)fade->color_pair;
+	}
+	else if (0 != alpha)
+	{
+		*pixel = UI_RGB565_blend(fade->color, *pixel, alpha);
+	}
+	// else: transparent pixel
+}
+
+/*
+ * @brief Returns floor(sqrt(value)) with Newton iterations from an estimate of the result:
+ * the distance of the previous pixel is a close estimate, one or two divisions are enough.
+ */
+static inline int32_t _sqrt_from(uint32_t value, int32_t estimate)
+{
+	uint32_t root = (estimate > 0) ? (uint32_t)estimate : 1;
+	uint32_t quotient;
+
+	if (0 == value)
+	{
+		return 0;
+	}
+
+	// the first iteration gives a value which is not lower than the result
+	root = (root + (value / root)) >> 1;
+	quotient = value / root;
+	while (root > quotient)
+	{
+		root = (root + quotient) >> 1;
+		quotient = value / root;
+	}
+	return (int32_t)root;
+}
+
+/*
+ * @brief Reduces the span [first, last] of columns to the columns where the linear function
+ * start + (step * column) lies in [min, max] (computed once per row).
+ */
+static void _clip_linear(float start, float step, float min, float max, jint* first, jint* last)
+{
+	if (0.0f == step)
+	{
+		if ((start < min) || (start > max))
+		{
+			*last = *first - 1;
+		}
+	}
+	else
+	{
+		float lower = (((step > 0.0f) ? min : max) - start) / step;
+		float upper = (((step > 0.0f) ? max : min) - start) / step;
+
+		if (lower > (float)*first)
+		{
+			*first = (jint)ceilf(fminf(lower, (float)*last + 1.0f));
+		}
+		if (upper < (float)*last)
+		{
+			*last = (jint)floorf(fmaxf(upper, (float)*first - 1.0f));
+		}
+	}
+}
+
+/*
+ * @brief Adds a span to the spans of a row of a faded shape if it is not empty.
+ */
+static inline void _add_span(faded_span_t* spans, uint32_t* count, jint x1, jint x2, bool opaque)
+{
+	if (x1 <= x2)
+	{
+		spans[*count].x1 = x1;
+		spans[*count].x2 = x2;
+		spans[*count].opaque = opaque;
+		(*count)++;
+	}
+}
+
+/*
+ * @brief Draws the columns [x1, x2] of a row of a faded shape: the spans known to be opaque
+ * are filled, the spans known to be transparent are skipped and the alpha of the other pixels
+ * is computed by the shape.
+ */
+static void _draw_faded_row(const fade_t* fade, const void* shape, faded_band_t band, jint y, jint x1, jint x2, faded_span_t* spans, uint32_t count)
+{
+	uint16_t* row = fade->pixels + ((uint32_t)y * fade->stride);
+
+	// sort the spans by their first column (a few spans)
+	for (uint32_t i = 1; i < count; i++)
+	{
+		faded_span_t span = spans[i];
+		uint32_t j = i;
+		while ((j > 0) && (spans[j - 1].x1 > span.x1))
+		{
+			spans[j] = spans[j - 1];
+			j--;
+		}
+		spans[j] = span;
+	}
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		// the spans may overlap
+		jint span_x1 = (spans[i].x1 < x1) ? x1 : spans[i].x1;
+		jint span_x2 = (spans[i].x2 > x2) ? x2 : spans[i].x2;
+		if (span_x1 <= span_x2)
+		{
+			if (span_x1 > x1)
+			{
+				band(shape, row, x1, span_x1 - 1, y);
+			}
+			if (spans[i].opaque)
+			{
+				UI_RGB565_fill_span(row + span_x1, (uint32_t)(span_x2 - span_x1 + 1), fade->color_pair);
+			}
+			x1 = span_x2 + 1;
+		}
+	}
+	if (x1 <= x2)
+	{
+		band(shape, row, x1, x2, y);
+	}
+}
+
+/*
+ * @brief Returns the distance of a pixel to the axis of a line, combined with the caps: the
+ * position along the line and the distance across it are in subpixels.
+ */
+static inline int32_t _get_line_distance(const faded_line_t* line, int32_t along, int32_t across)
+{
+	int32_t distance = (across < 0) ? -across : across;
+	int32_t beyond = 0;
+	DRAWING_Cap cap = DRAWING_ENDOFLINE_NONE;
+
+	if (along < 0)
+	{
+		beyond = -along;
+		cap = line->start_cap;
+	}
+	else if (along > line->length)
+	{
+		beyond = along - line->length;
+		cap = line->end_cap;
+	}
+
+	if (beyond > 0)
+	{
+		if (DRAWING_ENDOFLINE_ROUNDED == cap)
+		{
+			distance = _sqrt_from((uint32_t)((distance * distance) + (beyond * beyond)), (distance > beyond) ? distance : beyond);
+		}
+		else if (DRAWING_ENDOFLINE_NONE == cap)
+		{
+			// the line is cut at its end
+			distance = line->fade.transparent;
+		}
+		// else: perpendicular cap, see below
+	}
+
+	// a perpendicular cap fades along the line like the line edges across it
+	if (DRAWING_ENDOFLINE_PERPENDICULAR == line->start_cap)
+	{
+		distance = ((line->fade.half - along) > distance) ? (line->fade.half - along) : distance;
+	}
+	if (DRAWING_ENDOFLINE_PERPENDICULAR == line->end_cap)
+	{
+		distance = ((line->fade.half - (line->length - along)) > distance) ? (line->fade.half - (line->length - along)) : distance;
+	}
+	return distance;
+}
+
+/*
+ * @brief Draws the pixels [x1, x2] of a row of a thick faded line, computing their distance
+ * to the line.
+ */
+static void _draw_line_band(const void* shape, uint16_t* row, jint x1, jint x2, jint y)
+{
+	const faded_line_t* line = (const faded_line_t*)shape;
+	float dx = (float)(x1 - line->x);
+	float dy = (float)(y - line->y);
+	// position along the line and distance across it, stepped in fixed point subpixels
+	int32_t along = (int32_t)lroundf(((dx * line->direction_x) + (dy * line->direction_y)) * (SUBPIXEL_ONE << LINE_STEP_SHIFT));
+	int32_t across = (int32_t)lroundf(((dy * line->direction_x) - (dx * line->direction_y)) * (SUBPIXEL_ONE << LINE_STEP_SHIFT));
+
+	for (jint x = x1; x <= x2; x++)
+	{
+		int32_t distance = _get_line_distance(line, (along + LINE_STEP_HALF) >> LINE_STEP_SHIFT, (across + LINE_STEP_HALF) >> LINE_STEP_SHIFT);
+		_draw_faded_pixel(&line->fade, &row[x], _get_fade_alpha(&line->fade, distance));
+		along += line->along_step;
+		across += line->across_step;
+	}
+}
+
+/*
+ * @brief Draws a thick faded line. The line and the destination are supported (see
+ * DW_DRAWING_drawThickFadedLine()).
+ */
+static void _draw_thick_faded_line(MICROUI_GraphicsContext* gc, jint startX, jint startY, jint endX, jint endY, jint thickness, jint fade, DRAWING_Cap startCap, DRAWING_Cap endCap)
+{
+	faded_line_t line;
+	float length = sqrtf((float)(((endX - startX) * (endX - startX)) + ((endY - startY) * (endY - startY))));
+	// the ends of the line fade unless it is cut (no cap)
+	float start_min;
+	float end_max;
+	float transparent;
+	float opaque;
+	float start_opaque;
+	float end_opaque;
+	jint margin;
+	jint x1;
+	jint y1;
+	jint x2;
+	jint y2;
+
+	_init_fade(gc, &line.fade, thickness, fade);
+	line.x = startX;
+	line.y = startY;
+	line.direction_x = (float)(endX - startX) / length;
+	line.direction_y = (float)(endY - startY) / length;
+	line.length = (int32_t)lroundf(length * SUBPIXEL_ONE);
+	line.start_cap = startCap;
+	line.end_cap = endCap;
+	line.along_step = (int32_t)lroundf(line.direction_x * (SUBPIXEL_ONE << LINE_STEP_SHIFT));
+	line.across_step = (int32_t)lroundf(-line.direction_y * (SUBPIXEL_ONE << LINE_STEP_SHIFT));
+
+	// bounding box of the pixels which can be drawn (the corners of a perpendicular cap are
+	// farther than the fade from the end, up to sqrt(2) times)
+	margin = line.fade.transparent;
+	if ((DRAWING_ENDOFLINE_PERPENDICULAR == startCap) || (DRAWING_ENDOFLINE_PERPENDICULAR == endCap))
+	{
+		margin = (margin * 3) / 2;
+	}
+	margin = (margin >> SUBPIXEL_SHIFT) + 1;
+	x1 = ((startX < endX) ? startX : endX) - margin;
+	y1 = ((startY < endY) ? startY : endY) - margin;
+	x2 = ((startX > endX) ? startX : endX) + margin;
+	y2 = ((startY > endY) ? startY : endY) + margin;
+	if (!_clip(gc, &x1, &y1, &x2, &y2))
+	{
+		// out of clip: nothing to draw
+		return;
+	}
+
+	// bounds of the pixels which can be drawn and of the opaque ones, in subpixels (the
+	// opaque bounds are inside by the rounding of the fixed point steps)
+	transparent = (float)line.fade.transparent;
+	opaque = (float)(line.fade.opaque - SPAN_TOLERANCE);
+	start_min = -((DRAWING_ENDOFLINE_NONE == startCap) ? (float)SPAN_TOLERANCE : transparent);
+	end_max = (float)line.length + ((DRAWING_ENDOFLINE_NONE == endCap) ? (float)SPAN_TOLERANCE : transparent);
+	start_opaque = (float)(((DRAWING_ENDOFLINE_PERPENDICULAR == startCap) ? (line.fade.half - line.fade.opaque) : 0) + SPAN_TOLERANCE);
+	end_opaque = (float)line.length - (float)(((DRAWING_ENDOFLINE_PERPENDICULAR == endCap) ? (line.fade.half - line.fade.opaque) : 0) + SPAN_TOLERANCE);
+
+	for (jint y = y1; y <= y2; y++)
+	{
+		// the position along the line and the distance across it are linear along a row
+		float dy = (float)(y - startY);
+		float along = (((float)-startX * line.direction_x) + (dy * line.direction_y)) * SUBPIXEL_ONE;
+		float across = ((dy * line.direction_x) + ((float)startX * line.direction_y)) * SUBPIXEL_ONE;
+		float along_step = line.direction_x * SUBPIXEL_ONE;
+		float across_step = -line.direction_y * SUBPIXEL_ONE;
+		jint first = x1;
+		jint last = x2;
+		faded_span_t span;
+		uint32_t count = 0;
+
+		_clip_linear(along, along_step, start_min, end_max, &first, &last);
+		_clip_linear(across, across_step, -transparent, transparent, &first, &last);
+		if (first <= last)
+		{
+			jint opaque_first = first;
+			jint opaque_last = last;
+			_clip_linear(along, along_step, start_opaque, end_opaque, &opaque_first, &opaque_last);
+			_clip_linear(across, across_step, -opaque, opaque, &opaque_first, &opaque_last);
+			_add_span(&span, &count, opaque_first, opaque_last, true);
+			_draw_faded_row(&line.fade, &line, _draw_line_band, y, first, last, &span, count);
+		}
+	}
+
+	LLUI_DISPLAY_setDrawingLimits(x1, y1, x2, y2);
+}
+
+/*
+ * @brief Tells if a pixel is in the angular sector of an arc: the signed distances to the
+ * lines of the arc ends are positive on the side of the arc.
+ */
+static inline bool _is_in_sector(const faded_ring_t* ring, int32_t start_side, int32_t end_side)
+{
+	return ring->wide ? ((start_side >= 0) || (end_side >= 0)) : ((start_side >= 0) && (end_side >= 0));
+}
+
+/*
+ * @brief Returns the distance of a pixel out of the sector of an arc to the cap of an end,
+ * given the position relatively to the end, whether the pixel is on the side of the end
+ * (rather than on the opposite side of the center), the signed distance to the line of the
+ * end and the distance to the whole circle (in subpixels).
+ */
+static int32_t _get_cap_distance(const faded_ring_t* ring, DRAWING_Cap cap, int32_t x, int32_t y, bool ahead, int32_t side, int32_t distance)
+{
+	if (DRAWING_ENDOFLINE_ROUNDED == cap)
+	{
+		distance = _sqrt_from((uint32_t)((x * x) + (y * y)), ring->fade.half);
+	}
+	else if ((DRAWING_ENDOFLINE_PERPENDICULAR == cap) && ahead && (side < 0))
+	{
+		distance = ((ring->fade.half - side) > distance) ? (ring->fade.half - side) : distance;
+	}
+	else
+	{
+		// the arc is cut at its end (or the pixel is beyond the other end)
+		distance = ring->fade.transparent;
+	}
+	return distance;
+}
+
+/*
+ * @brief Returns the distance of a pixel to an arc, combined with the caps. The distance to
+ * the whole circle and the signed distances to the lines of the arc ends are in subpixels.
+ */
+static int32_t _get_arc_distance(const faded_ring_t* ring, int32_t column, int32_t row, int32_t distance, int32_t start_side, int32_t end_side)
+{
+	int32_t half = ring->fade.half;
+
+	if (_is_in_sector(ring, start_side, end_side))
+	{
+		// a perpendicular cap fades along the arc like the arc edges across it: only on the
+		// side of its end (the line of the end goes through the center) and on the side of
+		// the arc (a wide arc is also beyond the line of an end near its other end)
+		if ((DRAWING_ENDOFLINE_PERPENDICULAR == ring->start_cap) && (start_side >= 0) && (((column * ring->start_cos) + (row * ring->start_sin)) > 0) && ((half - start_side) > distance))
+		{
+			distance = half - start_side;
+		}
+		if ((DRAWING_ENDOFLINE_PERPENDICULAR == ring->end_cap) && (end_side >= 0) && (((column * ring->end_cos) + (row * ring->end_sin)) > 0) && ((half - end_side) > distance))
+		{
+			distance = half - end_side;
+		}
+	}
+	else
+	{
+		// beyond the ends of the arc: distance to the nearest cap
+		int32_t start_distance = _get_cap_distance(ring, ring->start_cap, column - ring->start_x, row - ring->start_y, ((column * ring->start_cos) + (row * ring->start_sin)) > 0, start_side, distance);
+		int32_t end_distance = _get_cap_distance(ring, ring->end_cap, column - ring->end_x, row - ring->end_y, ((column * ring->end_cos) + (row * ring->end_sin)) > 0, end_side, distance);
+		distance = (start_distance < end_distance) ? start_distance : end_distance;
+	}
+	return distance;
+}
+
+/*
+ * @brief Draws the pixels [x1, x2] of a row of a thick faded circle or arc, computing their
+ * distance to the circle.
+ */
+static void _draw_ring_band(const void* shape, uint16_t* row, jint x1, jint x2, jint y)
+{
+	const faded_ring_t* ring = (const faded_ring_t*)shape;
+	// position relatively to the center, in subpixels
+	int32_t column = ring->column + (x1 << SUBPIXEL_SHIFT);
+	int32_t line = ring->row + (y << SUBPIXEL_SHIFT);
+	uint32_t line_squared = (uint32_t)(line * line);
+	int32_t root = ring->radius;
+	// signed distances to the lines of the arc ends, in fixed point subpixels
+	int32_t start_side = 0;
+	int32_t end_side = 0;
+
+	if (ring->arc)
+	{
+		start_side = (column * ring->start_sin) - (line * ring->start_cos);
+		end_side = (line * ring->end_cos) - (column * ring->end_sin);
+	}
+
+	for (jint x = x1; x <= x2; x++)
+	{
+		int32_t distance;
+
+		root = _sqrt_from((uint32_t)(column * column) + line_squared, root);
+		distance = (root > ring->radius) ? (root - ring->radius) : (ring->radius - root);
+		if (ring->arc)
+		{
+			distance = _get_arc_distance(ring, column, line, distance, (start_side + DIRECTION_HALF) >> DIRECTION_SHIFT, (end_side + DIRECTION_HALF) >> DIRECTION_SHIFT);
+			start_side += ring->start_sin * SUBPIXEL_ONE;
+			end_side -= ring->end_sin * SUBPIXEL_ONE;
+		}
+		_draw_faded_pixel(&ring->fade, &row[x], _get_fade_alpha(&ring->fade, distance));
+		column += SUBPIXEL_ONE;
+	}
+}
+
+/*
+ * @brief Clips the span of columns where the signed distance to the line of an arc end (given
+ * by its direction, in subpixels) lies in [min, max].
+ */
+static inline void _clip_side(float direction_x, float direction_y, bool start, float column, float row, float min, float max, jint* first, jint* last)
+{
+	// start line: column * direction_y - row * direction_x, end line: the opposite
+	float sign = start ? 1.0f : -1.0f;
+	_clip_linear(sign * ((column * direction_y) - (row * direction_x)), sign * direction_y * SUBPIXEL_ONE, min, max, first, last);
+}
+
+/*
+ * @brief Draws a thick faded circle or arc. The shape and the destination are supported (see
+ * DW_DRAWING_drawThickFadedCircle()).
+ */
+static void _draw_thick_faded_ring(MICROUI_GraphicsContext* gc, faded_ring_t* ring, jint x, jint y, jint diameter, jint thickness, jint fade)
+{
+	float outer;
+	float opaque_outer;
+	float opaque_inner;
+	float hole;
+	// an arc end influences the pixels up to this distance of its line
+	float margin;
+	jint extent;
+	jint x1;
+	jint y1;
+	jint x2;
+	jint y2;
+
+	_init_fade(gc, &ring->fade, thickness, fade);
+	ring->radius = diameter * SUBPIXEL_HALF;
+	// the pixels centers relatively to the circle center
+	ring->column = (1 - (2 * x) - diameter) * SUBPIXEL_HALF;
+	ring->row = (1 - (2 * y) - diameter) * SUBPIXEL_HALF;
+
+	extent = (ring->fade.transparent >> SUBPIXEL_SHIFT) + 1;
+	x1 = x - extent;
+	y1 = y - extent;
+	x2 = x + diameter - 1 + extent;
+	y2 = y + diameter - 1 + extent;
+	if (!_clip(gc, &x1, &y1, &x2, &y2))
+	{
+		// out of clip: nothing to draw
+		return;
+	}
+
+	// radii of the pixels which can be drawn, of the opaque ones and of the transparent hole
+	// (the spans are computed in floating point, the pixels in integers: the spans known to be
+	// opaque or transparent are reduced by a tolerance)
+	outer = (float)(ring->radius + ring->fade.transparent);
+	opaque_outer = (float)(ring->radius + ring->fade.opaque - SPAN_TOLERANCE);
+	opaque_inner = (float)(ring->radius - ring->fade.opaque + SPAN_TOLERANCE);
+	hole = (float)(ring->radius - ring->fade.transparent - SPAN_TOLERANCE);
+	margin = (float)(ring->fade.half - ring->fade.opaque + SPAN_TOLERANCE);
+
+	for (jint row = y1; row <= y2; row++)
+	{
+		float line = (float)(ring->row + (row << SUBPIXEL_SHIFT));
+		float line_squared = line * line;
+		float column = (float)ring->column;
+		faded_span_t spans[FADED_MAX_SPANS];
+		uint32_t count = 0;
+		jint first = x1;
+		jint last = x2;
+		float extent_x;
+
+		if (line_squared >= (outer * outer))
+		{
+			continue;
+		}
+		extent_x = sqrtf((outer * outer) - line_squared);
+		_clip_linear(column, SUBPIXEL_ONE, -extent_x, extent_x, &first, &last);
+		if (first > last)
+		{
+			continue;
+		}
+
+		// opaque columns: one span or two spans around the inner radius
+		jint opaque_spans[2][2] = { { first, last }, { first, last } };
+		uint32_t opaque_count = 0;
+		if (line_squared <= (opaque_outer * opaque_outer))
+		{
+			float outer_x = sqrtf((opaque_outer * opaque_outer) - line_squared);
+			if ((opaque_inner <= 0.0f) || (line_squared >= (opaque_inner * opaque_inner)))
+			{
+				_clip_linear(column, SUBPIXEL_ONE, -outer_x, outer_x, &opaque_spans[0][0], &opaque_spans[0][1]);
+				opaque_count = 1;
+			}
+			else
+			{
+				float inner_x = sqrtf((opaque_inner * opaque_inner) - line_squared);
+				_clip_linear(column, SUBPIXEL_ONE, -outer_x, -inner_x, &opaque_spans[0][0], &opaque_spans[0][1]);
+				_clip_linear(column, SUBPIXEL_ONE, inner_x, outer_x, &opaque_spans[1][0], &opaque_spans[1][1]);
+				opaque_count = 2;
+			}
+		}
+
+		if (!ring->arc)
+		{
+			for (uint32_t i = 0; i < opaque_count; i++)
+			{
+				_add_span(spans, &count, opaque_spans[i][0], opaque_spans[i][1], true);
+			}
+		}
+		else
+		{
+			// columns surely in the sector, at a distance of the lines of the arc ends where
+			// the caps do not apply: in both half planes or, for a wide arc, in one half plane
+			// and surely out of the other one
+			jint sector[3][2] = { { first, last }, { first, last }, { first, last } };
+			uint32_t sector_count = ring->wide ? 3 : 1;
+			float tolerance = -(float)SPAN_TOLERANCE;
+			// columns surely beyond both lines, where the caps are transparent
+			jint outside_first = first;
+			jint outside_last = last;
+			float outside = -(float)(ring->fade.transparent + SUBPIXEL_ONE);
+
+			_clip_side(ring->start_dir_x, ring->start_dir_y, true, column, line, margin, INFINITY, &sector[0][0], &sector[0][1]);
+			_clip_side(ring->end_dir_x, ring->end_dir_y, false, column, line, margin, INFINITY, &sector[0][0], &sector[0][1]);
+			if (ring->wide)
+			{
+				_clip_side(ring->start_dir_x, ring->start_dir_y, true, column, line, margin, INFINITY, &sector[1][0], &sector[1][1]);
+				_clip_side(ring->end_dir_x, ring->end_dir_y, false, column, line, -INFINITY, tolerance, &sector[1][0], &sector[1][1]);
+				_clip_side(ring->start_dir_x, ring->start_dir_y, true, column, line, -INFINITY, tolerance, &sector[2][0], &sector[2][1]);
+				_clip_side(ring->end_dir_x, ring->end_dir_y, false, column, line, margin, INFINITY, &sector[2][0], &sector[2][1]);
+			}
+			for (uint32_t i = 0; i < opaque_count; i++)
+			{
+				for (uint32_t j = 0; j < sector_count; j++)
+				{
+					jint span_x1 = (sector[j][0] > opaque_spans[i][0]) ? sector[j][0] : opaque_spans[i][0];
+					jint span_x2 = (sector[j][1] < opaque_spans[i][1]) ? sector[j][1] : opaque_spans[i][1];
+					_add_span(spans, &count, span_x1, span_x2, true);
+				}
+			}
+
+			_clip_side(ring->start_dir_x, ring->start_dir_y, true, column, line, -INFINITY, outside, &outside_first, &outside_last);
+			_clip_side(ring->end_dir_x, ring->end_dir_y, false, column, line, -INFINITY, outside, &outside_first, &outside_last);
+			_add_span(spans, &count, outside_first, outside_last, false);
+		}
+
+		if ((hole > 0.0f) && (line_squared < (hole * hole)))
+		{
+			float hole_x = sqrtf((hole * hole) - line_squared);
+			jint hole_first = first;
+			jint hole_last = last;
+			_clip_linear(column, SUBPIXEL_ONE, -hole_x, hole_x, &hole_first, &hole_last);
+			_add_span(spans, &count, hole_first, hole_last, false);
+		}
+
+		_draw_faded_row(&ring->fade, ring, _draw_ring_band, row, first, last, spans, count);
+	}
+
+	LLUI_DISPLAY_setDrawingLimits(x1, y1, x2, y2);
+}
+
+/*
+ * @brief Initializes the ends of a faded arc. The arc is drawn counterclockwise from the start
+ * end to the end one.
+ */
+static void _init_arc(faded_ring_t* ring, jint diameter, jfloat startAngle, jfloat arcAngle, DRAWING_Cap start, DRAWING_Cap end)
+{
+	int32_t radius = diameter * SUBPIXEL_HALF;
+	float start_radians;
+	float end_radians;
+
+	if (arcAngle < 0.0f)
+	{
+		// same arc drawn counterclockwise
+		startAngle += arcAngle;
+		arcAngle = -arcAngle;
+		ring->start_cap = end;
+		ring->end_cap = start;
+	}
+	else
+	{
+		ring->start_cap = start;
+		ring->end_cap = end;
+	}
+
+	ring->arc = arcAngle < 360.0f;
+	ring->wide = arcAngle > 180.0f;
+	start_radians = startAngle * (float)M_PI / 180.0f;
+	end_radians = (startAngle + arcAngle) * (float)M_PI / 180.0f;
+	// the angles are counterclockwise, the y axis is downwards
+	ring->start_dir_x = cosf(start_radians);
+	ring->start_dir_y = -sinf(start_radians);
+	ring->end_dir_x = cosf(end_radians);
+	ring->end_dir_y = -sinf(end_radians);
+	ring->start_cos = (int32_t)lroundf(ring->start_dir_x * (1 << DIRECTION_SHIFT));
+	ring->start_sin = (int32_t)lroundf(ring->start_dir_y * (1 << DIRECTION_SHIFT));
+	ring->end_cos = (int32_t)lroundf(ring->end_dir_x * (1 << DIRECTION_SHIFT));
+	ring->end_sin = (int32_t)lroundf(ring->end_dir_y * (1 << DIRECTION_SHIFT));
+	ring->start_x = (int32_t)lroundf(ring->start_dir_x * (float)radius);
+	ring->start_y = (int32_t)lroundf(ring->start_dir_y * (float)radius);
+	ring->end_x = (int32_t)lroundf(ring->end_dir_x * (float)radius);
+	ring->end_y = (int32_t)lroundf(ring->end_dir_y * (float)radius);
+}
+
+/*
+ * @brief Tells if a faded shape can be drawn by this file kernels in the graphics context. The
+ * pixels are drawn up to the fade plus half a pixel beyond half the thickness, plus the
+ * diameter for the distances to the ends of an arc (0 for a line), plus the pixels rounding.
+ */
+static bool _is_faded_supported(MICROUI_GraphicsContext* gc, jint thickness, jint fade, jint diameter)
+{
+	return UI_RGB565_is_destination(gc) && (thickness > 0) && (fade >= 0)
+			&& (((((int64_t)diameter + fade + 2) * SUBPIXEL_ONE) + ((int64_t)thickness * SUBPIXEL_HALF) + SUBPIXEL_HALF) <= FADED_MAX_REACH);
+}
+
+static inline bool _is_faded_coordinate(jint coordinate)
+{
+	return (coordinate >= -FADED_MAX_COORDINATE) && (coordinate <= FADED_MAX_COORDINATE);
+}
+
+// --------------------------------------------------------------------------------
+// dw_drawing.h functions
+// --------------------------------------------------------------------------------
+
+DRAWING_Status DW_DRAWING_drawRotatedImageNearestNeighbor(MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jint rotationX, jint rotationY, jfloat angle, jint alpha)
+{
+	if (_is_supported(gc, img))
+	{
+		_draw_rotated_image(gc, img, x, y, rotationX, rotationY, angle, alpha, false);
+	}
+	else
+	{
+		DW_DRAWING_SOFT_drawRotatedImageNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle, alpha);
+	}
+	return DRAWING_DONE;
+}
+
+DRAWING_Status DW_DRAWING_drawRotatedImageBilinear(MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jint rotationX, jint rotationY, jfloat angle, jint alpha)
+{
+	if (_is_supported(gc, img))
+	{
+		_draw_rotated_image(gc, img, x, y, rotationX, rotationY, angle, alpha, true);
+	}
+	else
+	{
+		DW_DRAWING_SOFT_drawRotatedImageBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha);
+	}
+	return DRAWING_DONE;
+}
+
+DRAWING_Status DW_DRAWING_drawScaledImageNearestNeighbor(MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jfloat factorX, jfloat factorY, jint alpha)
+{
+	if (!_is_supported(gc, img))
+	{
+		DW_DRAWING_SOFT_drawScaledImageNearestNeighbor(gc, img, x, y, factorX, factorY, alpha);
+		return DRAWING_DONE;
+	}
+
+	jint x1 = x;
+	jint y1 = y;
+	jint x2 = x + (jint)(img->width * factorX) - 1;
+	jint y2 = y + (jint)(img->height * factorY) - 1;
+
+	if ((x2 < x1) || (y2 < y1) || !_clip(gc, &x1, &y1, &x2, &y2))
+	{
+		// empty or out of clip: nothing to draw
+		return DRAWING_DONE;
+	}
+
+	source_t source;
+	_get_source(img, &source);
+
+	int32_t step_x = _get_scale_step(factorX, source.width, (jint)(img->width * factorX));
+	int32_t step_y = _get_scale_step(factorY, source.height, (jint)(img->height * factorY));
+	int32_t length = x2 - x1 + 1;
+	uint32_t dst_stride = LLUI_DISPLAY_getStrideInPixels(&gc->image);
+	uint16_t* dst = (uint16_t*)LLUI_DISPLAY_getBufferAddress(&gc->image) + ((uint32_t)y1 * dst_stride) + (uint32_t)x1;
+	// source position of the center of the first pixel of the first row and column
+	int32_t start_fx = ((x1 - x) * step_x) + (step_x / 2);
+	int32_t fy = ((y1 - y) * step_y) + (step_y / 2);
+	int32_t previous_row = -1;
+	// a destination row only depends on its source row when the source pixels replace the destination ones
+	bool opaque = source.rgb565 && (255 == alpha);
+
+	for (jint row = y1; row <= y2; row++)
+	{
+		int32_t source_row = fy >> FIXED_SHIFT;
+
+		if (opaque && (source_row == previous_row))
+		{
+			memcpy(dst, dst - dst_stride, (uint32_t)length * sizeof(uint16_t));
+		}
+		else if (opaque)
+		{
+			uint16_t* src = (uint16_t*)source.pixels + (source_row * source.stride);
+			int32_t fx = start_fx;
+			for (int32_t i = 0; i < length; i++)
+			{
+				dst[i] = src[fx >> FIXED_SHIFT];
+				fx += step_x;
+			}
+		}
+		else
+		{
+			int32_t fx = start_fx;
+			for (int32_t i = 0; i < length; i++)
+			{
+				UI_RGB565_draw_argb8888(&dst[i], _read(&source, fx >> FIXED_SHIFT, source_row), (uint32_t)alpha);
+				fx += step_x;
+			}
+		}
+
+		previous_row = source_row;
+		fy += step_y;
+		dst += dst_stride;
+	}
+
+	LLUI_DISPLAY_setDrawingLimits(x1, y1, x2, y2);
+	return DRAWING_DONE;
+}
+
+DRAWING_Status DW_DRAWING_drawThickFadedLine(MICROUI_GraphicsContext* gc, jint startX, jint startY, jint endX, jint endY, jint thickness, jint fade, DRAWING_Cap startCap, DRAWING_Cap endCap)
+{
+	if (_is_faded_supported(gc, thickness, fade, 0) && ((startX != endX) || (startY != endY)) && _is_faded_coordinate(startX)
+			&& _is_faded_coordinate(startY) && _is_faded_coordinate(endX) && _is_faded_coordinate(endY))
+	{
+		_draw_thick_faded_line(gc, startX, startY, endX, endY, thickness, fade, startCap, endCap);
+	}
+	else
+	{
+		DW_DRAWING_SOFT_drawThickFadedLine(gc, startX, startY, endX, endY, thickness, fade, startCap, endCap);
+	}
+	return DRAWING_DONE;
+}
+
+DRAWING_Status DW_DRAWING_drawThickFadedCircle(MICROUI_GraphicsContext* gc, jint x, jint y, jint diameter, jint thickness, jint fade)
+{
+	if (diameter <= 0)
+	{
+		// nothing to draw
+	}
+	else if (_is_faded_supported(gc, thickness, fade, diameter) && _is_faded_coordinate(x) && _is_faded_coordinate(y))
+	{
+		faded_ring_t ring;
+		ring.arc = false;
+		_draw_thick_faded_ring(gc, &ring, x, y, diameter, thickness, fade);
+	}
+	else
+	{
+		DW_DRAWING_SOFT_drawThickFadedCircle(gc, x, y, diameter, thickness, fade);
+	}
+	return DRAWING_DONE;
+}
+
+DRAWING_Status DW_DRAWING_drawThickFadedCircleArc(MICROUI_GraphicsContext* gc, jint x, jint y, jint diameter, jfloat startAngle, jfloat arcAngle, jint thickness, jint fade, DRAWING_Cap start, DRAWING_Cap end)
+{
+	if (diameter <= 0)
+	{
+		// nothing to draw
+	}
+	else if (_is_faded_supported(gc, thickness, fade, diameter) && _is_faded_coordinate(x) && _is_faded_coordinate(y)
+			&& (0.0f != arcAngle) && isfinite(startAngle) && isfinite(arcAngle))
+	{
+		faded_ring_t ring;
+		_init_arc(&ring, diameter, startAngle, arcAngle, start, end);
+		_draw_thick_faded_ring(gc, &ring, x, y, diameter, thickness, fade);
+	}
+	else
+	{
+		DW_DRAWING_SOFT_drawThickFadedCircleArc(gc, x, y, diameter, startAngle, arcAngle, thickness, fade, start, end);
+	}
+	return DRAWING_DONE;
+}
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLUI_DISPLAY_BPP == 16
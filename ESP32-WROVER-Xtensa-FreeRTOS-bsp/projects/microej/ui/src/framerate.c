@@ -9,14 +9,129 @@
  
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include "framerate_impl.h"
 
+/* Defines -------------------------------------------------------------------*/
+
+/*
+ * Durations histograms: FRAMERATE_HISTOGRAM_SUB_BUCKETS buckets per power of two of
+ * microseconds (the error of a percentile is lower than 1/32), up to 2^24 us (16.7 s)
+ */
+#define FRAMERATE_HISTOGRAM_SUB_BITS 4
+#define FRAMERATE_HISTOGRAM_SUB_BUCKETS (1u << FRAMERATE_HISTOGRAM_SUB_BITS)
+#define FRAMERATE_HISTOGRAM_MAX_BITS 24
+#define FRAMERATE_HISTOGRAM_SIZE ((FRAMERATE_HISTOGRAM_MAX_BITS - FRAMERATE_HISTOGRAM_SUB_BITS + 1) * FRAMERATE_HISTOGRAM_SUB_BUCKETS)
+
+/* Types ---------------------------------------------------------------------*/
+
+typedef struct
+{
+	uint16_t counts[FRAMERATE_HISTOGRAM_SIZE];
+	uint32_t total;
+} framerate_histogram_t;
+
 /* Globals -------------------------------------------------------------------*/
 
 #ifdef FRAMERATE_ENABLED
 static uint32_t framerate_schedule_time = 0;	// means "not initialised"
 static uint32_t framerate_counter;
 static uint32_t framerate_last;
+static uint32_t framerate_flush_time_sum;
+static uint32_t framerate_flush_time_count;
+static uint32_t framerate_flush_time_max;
+static uint32_t framerate_flush_time_last;
+static uint32_t framerate_flush_time_max_last;
+
+// intervals between two flushes and durations from a flush to its end: current and last periods
+static framerate_histogram_t framerate_frame_times;
+static framerate_histogram_t framerate_frame_times_last;
+static framerate_histogram_t framerate_flush_latencies;
+static framerate_histogram_t framerate_flush_latencies_last;
+static uint32_t framerate_dropped_frames;
+static uint32_t framerate_dropped_frames_last;
+
+// timestamp of the last flush, valid when framerate_flush_count is not 0
+static uint32_t framerate_flush_timestamp;
+static uint32_t framerate_flush_count;
+static uint32_t framerate_flush_pending;
+#endif
+
+/* Private API ---------------------------------------------------------------*/
+
+#ifdef FRAMERATE_ENABLED
+
+static uint32_t framerate_histogram_bucket(uint32_t duration_us)
+{
+	uint32_t bucket;
+	if (duration_us >= (1u << FRAMERATE_HISTOGRAM_MAX_BITS))
+	{
+		duration_us = (1u << FRAMERATE_HISTOGRAM_MAX_BITS) - 1;
+	}
+	if (duration_us < FRAMERATE_HISTOGRAM_SUB_BUCKETS)
+	{
+		bucket = duration_us;
+	}
+	else
+	{
+		// the highest bit gives the power of two, the next bits the sub bucket
+		uint32_t shift = (31 - __builtin_clz(duration_us)) - FRAMERATE_HISTOGRAM_SUB_BITS;
+		bucket = ((shift + 1) * FRAMERATE_HISTOGRAM_SUB_BUCKETS) + ((duration_us >> shift) - FRAMERATE_HISTOGRAM_SUB_BUCKETS);
+	}
+	return bucket;
+}
+
+/*
+ * Return the middle of the durations of a bucket
+ */
+static uint32_t framerate_histogram_value(uint32_t bucket)
+{
+	uint32_t value;
+	if (bucket < FRAMERATE_HISTOGRAM_SUB_BUCKETS)
+	{
+		value = bucket;
+	}
+	else
+	{
+		uint32_t shift = (bucket / FRAMERATE_HISTOGRAM_SUB_BUCKETS) - 1;
+		uint32_t mantissa = (bucket % FRAMERATE_HISTOGRAM_SUB_BUCKETS) + FRAMERATE_HISTOGRAM_SUB_BUCKETS;
+		value = (mantissa << shift) + ((1u << shift) >> 1);
+	}
+	return value;
+}
+
+static void framerate_histogram_add(framerate_histogram_t* histogram, uint32_t duration_us)
+{
+	uint16_t* count = &histogram->counts[framerate_histogram_bucket(duration_us)];
+	if (*count != UINT16_MAX)
+	{
+		(*count)++;
+		histogram->total++;
+	}
+}
+
+static uint32_t framerate_histogram_percentile(const framerate_histogram_t* histogram, uint32_t percentile)
+{
+	uint32_t value = 0;
+	if (histogram->total > 0)
+	{
+		// rank of the sample of the percentile, from 1 to total
+		uint32_t rank = (uint32_t)((((uint64_t)histogram->total * (percentile > 100 ? 100 : percentile)) + 99) / 100);
+		uint32_t cumulated = 0;
+		rank = rank == 0 ? 1 : rank;
+		for (uint32_t bucket = 0; bucket < FRAMERATE_HISTOGRAM_SIZE; bucket++)
+		{
+			cumulated += histogram->counts[bucket];
+			if (cumulated >= rank)
+			{
+				value = framerate_histogram_value(bucket);
+				break;
+			}
+		}
+	}
+	return value;
+}
+
 #endif
 
 /* API -----------------------------------------------------------------------*/
@@ -31,6 +146,17 @@ int32_t framerate_init(int32_t schedule_time)
 		framerate_schedule_time = schedule_time;
 		framerate_counter = 0;
 		framerate_last = 0;
+		framerate_flush_time_sum = 0;
+		framerate_flush_time_count = 0;
+		framerate_flush_time_max = 0;
+		framerate_flush_time_last = 0;
+		framerate_flush_time_max_last = 0;
+		memset(&framerate_frame_times, 0, sizeof(framerate_frame_times));
+		memset(&framerate_frame_times_last, 0, sizeof(framerate_frame_times_last));
+		memset(&framerate_flush_latencies, 0, sizeof(framerate_flush_latencies));
+		memset(&framerate_flush_latencies_last, 0, sizeof(framerate_flush_latencies_last));
+		framerate_dropped_frames = 0;
+		framerate_dropped_frames_last = 0;
 
 		int32_t ret = framerate_impl_start_task();
 		if (ret != FRAMERATE_OK)
@@ -64,6 +190,102 @@ uint32_t framerate_get(void)
 #endif
 }
 
+void framerate_add_flush_time(uint32_t time_us)
+{
+#ifdef FRAMERATE_ENABLED
+	framerate_flush_time_sum += time_us;
+	framerate_flush_time_count++;
+	if (time_us > framerate_flush_time_max)
+	{
+		framerate_flush_time_max = time_us;
+	}
+#endif
+}
+
+uint32_t framerate_get_flush_time(void)
+{
+#ifdef FRAMERATE_ENABLED
+	return framerate_flush_time_last;
+#else
+	return 0;
+#endif
+}
+
+uint32_t framerate_get_flush_time_max(void)
+{
+#ifdef FRAMERATE_ENABLED
+	return framerate_flush_time_max_last;
+#else
+	return 0;
+#endif
+}
+
+void framerate_add_flush(uint32_t timestamp_us)
+{
+#ifdef FRAMERATE_ENABLED
+	if (framerate_flush_count != 0)
+	{
+		uint32_t interval = timestamp_us - framerate_flush_timestamp;
+		if (interval <= FRAMERATE_IDLE_INTERVAL_US)
+		{
+			// number of frame periods elapsed since the last flush, rounded
+			uint32_t periods = (interval + (FRAMERATE_FRAME_PERIOD_US / 2)) / FRAMERATE_FRAME_PERIOD_US;
+			framerate_histogram_add(&framerate_frame_times, interval);
+			if (periods > 1)
+			{
+				framerate_dropped_frames += periods - 1;
+			}
+		}
+		// else: the application was idle
+	}
+	framerate_flush_timestamp = timestamp_us;
+	framerate_flush_count++;
+	framerate_flush_pending = 1;
+#else
+	(void)timestamp_us;
+#endif
+}
+
+void framerate_add_flush_done(uint32_t timestamp_us)
+{
+#ifdef FRAMERATE_ENABLED
+	if (framerate_flush_pending != 0)
+	{
+		framerate_histogram_add(&framerate_flush_latencies, timestamp_us - framerate_flush_timestamp);
+		framerate_flush_pending = 0;
+	}
+#else
+	(void)timestamp_us;
+#endif
+}
+
+uint32_t framerate_get_frame_time(uint32_t percentile)
+{
+#ifdef FRAMERATE_ENABLED
+	return framerate_histogram_percentile(&framerate_frame_times_last, percentile);
+#else
+	return 0;
+#endif
+}
+
+uint32_t framerate_get_flush_latency(uint32_t percentile)
+{
+#ifdef FRAMERATE_ENABLED
+	return framerate_histogram_percentile(&framerate_flush_latencies_last, percentile);
+#else
+	return 0;
+#endif
+}
+
+uint32_t framerate_get_dropped_frames(void)
+{
+#ifdef FRAMERATE_ENABLED
+	return framerate_dropped_frames_last;
+#else
+	return 0;
+#endif
+}
+
 void framerate_task_work(void)
 {
 #ifdef FRAMERATE_ENABLED
@@ -77,6 +299,23 @@ void framerate_task_work(void)
 
 		// reset framerate counter
 		framerate_counter = 0;
+
+		// update flush durations
+		framerate_flush_time_last = framerate_flush_time_count == 0 ? 0 : (framerate_flush_time_sum / framerate_flush_time_count);
+		framerate_flush_time_max_last = framerate_flush_time_max;
+
+		// reset flush durations
+		framerate_flush_time_sum = 0;
+		framerate_flush_time_count = 0;
+		framerate_flush_time_max = 0;
+
+		// update and reset frame intervals and flush latencies
+		framerate_frame_times_last = framerate_frame_times;
+		memset(&framerate_frame_times, 0, sizeof(framerate_frame_times));
+		framerate_flush_latencies_last = framerate_flush_latencies;
+		memset(&framerate_flush_latencies, 0, sizeof(framerate_flush_latencies));
+		framerate_dropped_frames_last = framerate_dropped_frames;
+		framerate_dropped_frames = 0;
 	}
 #endif
 }
@@ -92,3 +331,28 @@ uint32_t javaFramerateGet(void)
 {
 	return framerate_get();
 }
+
+uint32_t javaFramerateGetFlushTime(void)
+{
+	return framerate_get_flush_time();
+}
+
+uint32_t javaFramerateGetFlushTimeMax(void)
+{
+	return framerate_get_flush_time_max();
+}
+
+uint32_t javaFramerateGetFrameTime(int32_t percentile)
+{
+	return framerate_get_frame_time(percentile < 0 ? 0 : (uint32_t)percentile);
+}
+
+uint32_t javaFramerateGetFlushLatency(int32_t percentile)
+{
+	return framerate_get_flush_latency(percentile < 0 ? 0 : (uint32_t)percentile);
+}
+
+uint32_t javaFramerateGetDroppedFrames(void)
+{
+	return framerate_get_dropped_frames();
+}
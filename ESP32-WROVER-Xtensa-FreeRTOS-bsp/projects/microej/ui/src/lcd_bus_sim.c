@@ -0,0 +1,382 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * LCD bus implementation which simulates the LCD in memory, for a Linux host.
+ *
+ * The LCD controller is reduced to its memory window commands (column/row address set,
+ * memory write and memory write continue): the pixels land in an in-memory GRAM. The bus
+ * time of each transaction is modelled from the bus clock and a fixed per-transaction
+ * overhead. The commands and their first parameters are logged.
+ *
+ * As on the SPI bus, a queued transaction is only complete once it has been waited: the data
+ * of a queued transaction is read from its buffer when it is waited, so that a buffer refilled
+ * while its transaction is in flight shows up in the GRAM. Only the buffers allocated by
+ * LCD_BUS_allocate_dma() and the range given to LCD_BUS_SIM_set_dma_capable() are DMA capable.
+ *
+ * The display driver is run on this simulator by the host unit tests (projects/unit_tests/host).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "lcd_bus_sim.h"
+
+#ifdef LCD_BUS_SIM_REALTIME
+#include <time.h>
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Memory window commands (MIPI DCS) */
+#define SIM_CMD_RDDID  0x04
+#define SIM_CMD_CASET  0x2A
+#define SIM_CMD_RASET  0x2B
+#define SIM_CMD_RAMWR  0x2C
+#define SIM_CMD_WRMEMC 0x3C
+
+/* Clock used before LCD_BUS_set_high_speed() */
+#define SIM_INIT_CLOCK 26000000
+
+/* Identifier returned by the read display ID command (ST7789V) */
+#define SIM_DISPLAY_ID { 0x85, 0x85, 0x52 }
+
+#define SIM_BYTES_PER_PIXEL 2
+
+/* Globals -------------------------------------------------------------------*/
+
+static uint8_t gram[LCD_BUS_SIM_GRAM_SIDE * LCD_BUS_SIM_GRAM_SIDE * SIM_BYTES_PER_PIXEL];
+
+static uint32_t clock_hz = SIM_INIT_CLOCK;
+
+/* Last command, the data which follows are its parameters */
+static uint8_t current_cmd = 0;
+
+/* Memory window and write position */
+static uint32_t window_x1 = 0;
+static uint32_t window_y1 = 0;
+static uint32_t window_x2 = LCD_BUS_SIM_GRAM_SIDE - 1;
+static uint32_t window_y2 = LCD_BUS_SIM_GRAM_SIDE - 1;
+static uint32_t write_x = 0;
+static uint32_t write_y = 0;
+
+/* Position of the next byte to write in the current pixel (0 or 1) */
+static uint32_t write_byte = 0;
+
+/*
+ * Queued transaction: a command, or data sent from its buffer (copied when it fits in the
+ * transaction descriptor, like the SPI driver does).
+ */
+typedef struct {
+    bool command;
+    uint8_t cmd;
+    uint8_t small_data[4];
+    const uint8_t* data;
+    uint32_t length;
+    uint32_t duration_ns;
+} sim_transaction_t;
+
+/* Queued transactions, in order */
+static sim_transaction_t queue[LCD_BUS_QUEUE_SIZE];
+static uint32_t queue_first = 0;
+static uint32_t queue_count = 0;
+
+/* Buffers allocated by LCD_BUS_allocate_dma() */
+static const uint8_t* dma_buffers[LCD_BUS_SIM_DMA_BUFFERS];
+static uint32_t dma_buffers_size[LCD_BUS_SIM_DMA_BUFFERS];
+static uint32_t dma_buffers_count = 0;
+
+/* Range given to LCD_BUS_SIM_set_dma_capable() */
+static const uint8_t* dma_range = NULL;
+static uint32_t dma_range_size = 0;
+
+/* Data transactions queued from a buffer which is not DMA capable, and from the DMA range */
+static uint32_t non_dma_transactions = 0;
+static uint32_t dma_range_transactions = 0;
+
+static lcd_bus_stats_t stats;
+
+/* Commands log, the last entry receives the data of the current command when it is logged */
+static lcd_bus_sim_command_t commands_log[LCD_BUS_SIM_COMMANDS_LOG_SIZE];
+static uint32_t commands_count = 0;
+static bool current_cmd_logged = false;
+
+/* Fractional part of the bus time, below one microsecond */
+static uint32_t busy_time_ns = 0;
+
+/* Private functions ---------------------------------------------------------*/
+
+/*
+ * Account for a transaction of the given number of bytes and return its duration.
+ */
+static uint32_t sim_transaction(uint32_t length) {
+    uint32_t duration_ns = LCD_BUS_SIM_TRANSACTION_OVERHEAD_NS + (uint32_t)(((uint64_t)length * 8 * 1000000000) / clock_hz);
+
+    stats.transactions++;
+    busy_time_ns += duration_ns;
+    stats.busy_time_us += busy_time_ns / 1000;
+    busy_time_ns %= 1000;
+    return duration_ns;
+}
+
+static inline uint32_t sim_read_coordinate(const uint8_t* data) {
+    uint32_t coordinate = ((uint32_t)data[0] << 8) | data[1];
+    return (coordinate < LCD_BUS_SIM_GRAM_SIDE) ? coordinate : (LCD_BUS_SIM_GRAM_SIDE - 1);
+}
+
+static void sim_command(uint8_t cmd) {
+    current_cmd = cmd;
+    stats.commands++;
+
+    current_cmd_logged = commands_count < LCD_BUS_SIM_COMMANDS_LOG_SIZE;
+    if (current_cmd_logged) {
+        memset(&commands_log[commands_count], 0, sizeof(lcd_bus_sim_command_t));
+        commands_log[commands_count].cmd = cmd;
+    }
+    commands_count++;
+
+    if (cmd == SIM_CMD_RAMWR) {
+        write_x = window_x1;
+        write_y = window_y1;
+        write_byte = 0;
+    }
+}
+
+static void sim_log_data(const uint8_t* data, uint32_t length) {
+    lcd_bus_sim_command_t* command = &commands_log[commands_count - 1];
+
+    for (uint32_t i = 0; (i < length) && ((command->length + i) < LCD_BUS_SIM_COMMAND_PARAMS); i++) {
+        command->params[command->length + i] = data[i];
+    }
+    command->length += length;
+}
+
+static void sim_data(const uint8_t* data, uint32_t length) {
+    stats.data_bytes += length;
+
+    if (current_cmd_logged) {
+        sim_log_data(data, length);
+    }
+
+    switch (current_cmd) {
+    case SIM_CMD_CASET:
+        if (length >= 4) {
+            window_x1 = sim_read_coordinate(data);
+            window_x2 = sim_read_coordinate(data + 2);
+        }
+        break;
+    case SIM_CMD_RASET:
+        if (length >= 4) {
+            window_y1 = sim_read_coordinate(data);
+            window_y2 = sim_read_coordinate(data + 2);
+        }
+        break;
+    case SIM_CMD_RAMWR:
+    case SIM_CMD_WRMEMC:
+        /* Fill the window line by line, wrapping to its top left corner at its end */
+        for (uint32_t i = 0; i < length; i++) {
+            gram[(((write_y * LCD_BUS_SIM_GRAM_SIDE) + write_x) * SIM_BYTES_PER_PIXEL) + write_byte] = data[i];
+            if (++write_byte == SIM_BYTES_PER_PIXEL) {
+                write_byte = 0;
+                if (++write_x > window_x2) {
+                    write_x = window_x1;
+                    if (++write_y > window_y2) {
+                        write_y = window_y1;
+                    }
+                }
+            }
+        }
+        break;
+    default:
+        /* Other commands do not change the GRAM */
+        break;
+    }
+}
+
+static bool sim_in_range(const void* address, const uint8_t* start, uint32_t size) {
+    return ((const uint8_t*)address >= start) && ((const uint8_t*)address < (start + size));
+}
+
+/*
+ * Queue a transaction; it is executed when it is waited.
+ */
+static sim_transaction_t* sim_queue(uint32_t duration_ns) {
+    sim_transaction_t* t;
+
+    if (queue_count == LCD_BUS_QUEUE_SIZE) {
+        /* Like the SPI driver, queuing one more transaction waits for the oldest one */
+        LCD_BUS_wait(1);
+    }
+    t = &queue[(queue_first + queue_count) % LCD_BUS_QUEUE_SIZE];
+    queue_count++;
+    memset(t, 0, sizeof(sim_transaction_t));
+    t->duration_ns = duration_ns;
+    return t;
+}
+
+/* API -----------------------------------------------------------------------*/
+
+void LCD_BUS_initialize(void) {
+    clock_hz = SIM_INIT_CLOCK;
+    memset(gram, 0, sizeof(gram));
+    memset(&stats, 0, sizeof(stats));
+    busy_time_ns = 0;
+    non_dma_transactions = 0;
+    dma_range_transactions = 0;
+    queue_first = 0;
+    queue_count = 0;
+    LCD_BUS_SIM_clear_commands();
+}
+
+void LCD_BUS_set_high_speed(uint32_t clock) {
+    clock_hz = clock;
+}
+
+void LCD_BUS_set_reset(bool reset) {
+    (void)reset;
+}
+
+void LCD_BUS_set_backlight(bool on) {
+    (void)on;
+}
+
+void LCD_BUS_command(uint8_t cmd, const uint8_t* data, uint32_t length) {
+    /* The queued transactions are sent first */
+    LCD_BUS_wait(queue_count);
+    sim_transaction(1);
+    sim_command(cmd);
+    if (length > 0) {
+        sim_transaction(length);
+        sim_data(data, length);
+    }
+}
+
+void LCD_BUS_read(uint8_t cmd, uint8_t* data, uint32_t length) {
+    const uint8_t id[] = SIM_DISPLAY_ID;
+
+    if (length == 0) return;
+
+    LCD_BUS_wait(queue_count);
+    sim_transaction(1);
+    sim_command(cmd);
+    sim_transaction(length);
+    memset(data, 0, length);
+    if (cmd == SIM_CMD_RDDID) {
+        memcpy(data, id, (length < sizeof(id)) ? length : sizeof(id));
+    }
+}
+
+void LCD_BUS_queue_command(uint8_t cmd) {
+    sim_transaction_t* t = sim_queue(sim_transaction(1));
+
+    t->command = true;
+    t->cmd = cmd;
+}
+
+void LCD_BUS_queue_data(const uint8_t* data, uint32_t length) {
+    sim_transaction_t* t = sim_queue(sim_transaction(length));
+
+    t->length = length;
+    if (length <= sizeof(t->small_data)) {
+        memcpy(t->small_data, data, length);
+        t->data = t->small_data;
+    } else {
+        t->data = data;
+        if (!LCD_BUS_is_dma_capable(data)) {
+            non_dma_transactions++;
+        } else if (sim_in_range(data, dma_range, dma_range_size)) {
+            dma_range_transactions++;
+        }
+    }
+}
+
+void LCD_BUS_wait(uint32_t count) {
+#ifdef LCD_BUS_SIM_REALTIME
+    uint64_t duration_ns = 0;
+#endif
+
+    /* The transactions reach the LCD when they are waited, in order */
+    while ((count-- > 0) && (queue_count > 0)) {
+        sim_transaction_t* t = &queue[queue_first];
+        if (t->command) {
+            sim_command(t->cmd);
+        } else {
+            sim_data(t->data, t->length);
+        }
+#ifdef LCD_BUS_SIM_REALTIME
+        duration_ns += t->duration_ns;
+#endif
+        queue_first = (queue_first + 1) % LCD_BUS_QUEUE_SIZE;
+        queue_count--;
+    }
+
+#ifdef LCD_BUS_SIM_REALTIME
+    if (duration_ns > 0) {
+        struct timespec delay = { (time_t)(duration_ns / 1000000000), (long)(duration_ns % 1000000000) };
+        nanosleep(&delay, NULL);
+    }
+#endif
+}
+
+uint8_t* LCD_BUS_allocate_dma(uint32_t size) {
+    uint8_t* buffer = (uint8_t*)malloc(size);
+
+    if ((NULL != buffer) && (dma_buffers_count < LCD_BUS_SIM_DMA_BUFFERS)) {
+        dma_buffers[dma_buffers_count] = buffer;
+        dma_buffers_size[dma_buffers_count] = size;
+        dma_buffers_count++;
+    }
+    return buffer;
+}
+
+bool LCD_BUS_is_dma_capable(const void* address) {
+    for (uint32_t i = 0; i < dma_buffers_count; i++) {
+        if (sim_in_range(address, dma_buffers[i], dma_buffers_size[i])) {
+            return true;
+        }
+    }
+    return sim_in_range(address, dma_range, dma_range_size);
+}
+
+void LCD_BUS_get_stats(lcd_bus_stats_t* stats_out) {
+    *stats_out = stats;
+}
+
+const uint8_t* LCD_BUS_SIM_get_gram(void) {
+    return gram;
+}
+
+void LCD_BUS_SIM_reset_stats(void) {
+    memset(&stats, 0, sizeof(stats));
+    busy_time_ns = 0;
+    non_dma_transactions = 0;
+    dma_range_transactions = 0;
+}
+
+void LCD_BUS_SIM_set_dma_capable(const void* start, uint32_t size) {
+    dma_range = (const uint8_t*)start;
+    dma_range_size = size;
+}
+
+uint32_t LCD_BUS_SIM_get_non_dma_transactions(void) {
+    return non_dma_transactions;
+}
+
+uint32_t LCD_BUS_SIM_get_dma_range_transactions(void) {
+    return dma_range_transactions;
+}
+
+uint32_t LCD_BUS_SIM_get_commands(const lcd_bus_sim_command_t** commands) {
+    *commands = commands_log;
+    return commands_count;
+}
+
+void LCD_BUS_SIM_clear_commands(void) {
+    commands_count = 0;
+    current_cmd_logged = false;
+}
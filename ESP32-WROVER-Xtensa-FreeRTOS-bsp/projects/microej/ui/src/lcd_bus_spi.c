@@ -0,0 +1,224 @@
+/*
+ * C
+ *
+ * Copyright 2018-2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * LCD bus implementation for the ESP32 SPI master (ESP-WROVER-KIT LCD connector).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+
+#include <string.h>
+#include "lcd_bus.h"
+
+#include "freertos/FreeRTOS.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "driver/spi_master.h"
+#include "soc/gpio_struct.h"
+#include "driver/gpio.h"
+#include "soc/soc_memory_layout.h"
+
+/* Defines -------------------------------------------------------------------*/
+
+/* LCD pin connection */
+#define PIN_NUM_MISO 25
+#define PIN_NUM_MOSI 23
+#define PIN_NUM_CLK  19
+#define PIN_NUM_CS   22
+#define PIN_NUM_DC   21
+#define PIN_NUM_RST  18
+#define PIN_NUM_BCKL  5
+
+/* Backlight pin settings */
+#define PIN_BCKL_ON   0
+#define PIN_BCKL_OFF  1
+
+/* Clock used for the LCD initialization */
+#define LCD_INIT_SPI_CLOCK 26000000
+
+/* Largest transfer: a full frame of 320 * 240 16-bit pixels */
+#define LCD_MAX_TRANSFER_SIZE (320 * 240 * 2)
+
+/* Globals -------------------------------------------------------------------*/
+
+/* SPI device handle */
+static spi_device_handle_t spi_handle;
+
+/* Ring of the queued transaction descriptors */
+static spi_transaction_t queue[LCD_BUS_QUEUE_SIZE];
+static uint32_t queue_next = 0;
+
+static lcd_bus_stats_t stats;
+
+/* Private functions ---------------------------------------------------------*/
+
+/*
+ * This function is called (in irq context!) just before a transmission starts.
+ * It will set the D/C line to the value indicated in the user field.
+ */
+static void IRAM_ATTR lcd_spi_pre_transfer_callback(spi_transaction_t *t) {
+    int32_t dc = (int32_t)t->user;
+    gpio_set_level(PIN_NUM_DC, dc);
+}
+
+static spi_device_interface_config_t devcfg = {
+    .command_bits     = 0,                                // No command bits
+    .address_bits     = 0,                                // No address bits
+    .dummy_bits       = 0,                                // No dummy bits
+    .mode             = 0,                                // SPI mode 0
+    .duty_cycle_pos   = 128,                              // 50%/50% duty of the clock
+    .cs_ena_pretrans  = 0,                                // No extra cycles for CS to stay active before the transmission
+    .cs_ena_posttrans = 0,                                // No extra cycles for CS to stay active after the transmission
+    .clock_speed_hz   = LCD_INIT_SPI_CLOCK,               // Low clock for LCD initialization
+    .spics_io_num     = PIN_NUM_CS,                       // CS pin
+    .flags            = 0,                                // Work in full-duplex for LCD initialization
+    .queue_size       = LCD_BUS_QUEUE_SIZE,               // The max number of transactions queued at a certain time
+    .pre_cb           = lcd_spi_pre_transfer_callback,    // Specify pre-transfer callback to handle D/C line
+    .post_cb          = NULL                              // No post-transfer callback
+};
+
+/*
+ * Send a transaction. Uses spi_device_transmit, which waits until the transfer is complete.
+ */
+static void lcd_transmit(const uint8_t *tx, uint8_t *rx, uint32_t length, int32_t dc) {
+    spi_transaction_t t;
+
+    memset(&t, 0, sizeof(t));            // Zero out the transaction
+    t.length = length * 8;               // length is in bytes, transaction length is in bits.
+    t.tx_buffer = tx;                    // Data to send
+    t.rx_buffer = rx;                    // Data to receive
+    t.user = (void *)dc;                 // D/C level
+    spi_device_transmit(spi_handle, &t); // Transmit!
+
+    stats.transactions++;
+}
+
+/*
+ * Get the next descriptor of the ring.
+ */
+static inline spi_transaction_t* lcd_next_transaction(void) {
+    spi_transaction_t *t = &queue[queue_next];
+    queue_next = (queue_next + 1) % LCD_BUS_QUEUE_SIZE;
+    stats.transactions++;
+    return t;
+}
+
+/* API -----------------------------------------------------------------------*/
+
+void LCD_BUS_initialize(void) {
+    spi_bus_config_t buscfg = {
+        .miso_io_num     = PIN_NUM_MISO,
+        .mosi_io_num     = PIN_NUM_MOSI,
+        .sclk_io_num     = PIN_NUM_CLK,
+        .quadwp_io_num   = -1,
+        .quadhd_io_num   = -1,
+        .max_transfer_sz = LCD_MAX_TRANSFER_SIZE,
+        .intr_flags      = ESP_INTR_FLAG_IRAM
+    };
+
+    /* Initialize the SPI bus */
+    spi_bus_initialize(HSPI_HOST, &buscfg, 1);
+
+    /* Attach the LCD to the SPI bus */
+    spi_bus_add_device(HSPI_HOST, &devcfg, &spi_handle);
+
+    /* Set the D/C line low */
+    gpio_set_direction(PIN_NUM_DC, GPIO_MODE_OUTPUT);
+    gpio_set_level(PIN_NUM_DC, 0);
+
+    /* Disable the backlight */
+    gpio_set_direction(PIN_NUM_BCKL, GPIO_MODE_OUTPUT);
+    gpio_set_level(PIN_NUM_BCKL, PIN_BCKL_OFF);
+
+    /* Release the reset line */
+    gpio_set_direction(PIN_NUM_RST, GPIO_MODE_OUTPUT);
+    gpio_set_level(PIN_NUM_RST, 1);
+}
+
+void LCD_BUS_set_high_speed(uint32_t clock_hz) {
+    /* Remove the LCD from the SPI bus */
+    spi_bus_remove_device(spi_handle);
+
+    devcfg.clock_speed_hz = clock_hz;                         // High clock for LCD operation
+    devcfg.flags = SPI_DEVICE_HALFDUPLEX;                     // Work in half-duplex to achieve speed > 26MHz
+
+    /* Attach the LCD to the SPI bus */
+    spi_bus_add_device(HSPI_HOST, &devcfg, &spi_handle);
+}
+
+void LCD_BUS_set_reset(bool reset) {
+    gpio_set_level(PIN_NUM_RST, reset ? 0 : 1);
+}
+
+void LCD_BUS_set_backlight(bool on) {
+    gpio_set_level(PIN_NUM_BCKL, on ? PIN_BCKL_ON : PIN_BCKL_OFF);
+}
+
+void LCD_BUS_command(uint8_t cmd, const uint8_t* data, uint32_t length) {
+    lcd_transmit(&cmd, NULL, 1, 0);
+    stats.commands++;
+    if (length > 0) {
+        lcd_transmit(data, NULL, length, 1);
+        stats.data_bytes += length;
+    }
+}
+
+void LCD_BUS_read(uint8_t cmd, uint8_t* data, uint32_t length) {
+    if (length == 0) return;             // no need to send anything
+
+    lcd_transmit(&cmd, NULL, 1, 0);
+    stats.commands++;
+    lcd_transmit(NULL, data, length, 1);
+}
+
+void IRAM_ATTR LCD_BUS_queue_command(uint8_t cmd) {
+    spi_transaction_t *t = lcd_next_transaction();
+
+    memset(t, 0, sizeof(spi_transaction_t));
+    t->length = 8;                       // Command is 8 bits
+    t->user = (void *)0;                 // D/C needs to be set to 0
+    t->flags = SPI_TRANS_USE_TXDATA;
+    t->tx_data[0] = cmd;
+    spi_device_queue_trans(spi_handle, t, portMAX_DELAY);
+    stats.commands++;
+}
+
+void IRAM_ATTR LCD_BUS_queue_data(const uint8_t* data, uint32_t length) {
+    spi_transaction_t *t = lcd_next_transaction();
+
+    memset(t, 0, sizeof(spi_transaction_t));
+    t->length = length * 8;              // length is in bytes, transaction length is in bits.
+    t->user = (void *)1;                 // D/C needs to be set to 1
+    if (length <= sizeof(t->tx_data)) {
+        t->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t->tx_data, data, length);
+    } else {
+        t->tx_buffer = data;
+    }
+    spi_device_queue_trans(spi_handle, t, portMAX_DELAY);
+    stats.data_bytes += length;
+}
+
+void IRAM_ATTR LCD_BUS_wait(uint32_t count) {
+    spi_transaction_t *rtrans;
+
+    for (uint32_t x = 0; x < count; x++) {
+        spi_device_get_trans_result(spi_handle, &rtrans, portMAX_DELAY);
+    }
+}
+
+uint8_t* LCD_BUS_allocate_dma(uint32_t size) {
+    return (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_DMA);
+}
+
+bool IRAM_ATTR LCD_BUS_is_dma_capable(const void* address) {
+    return esp_ptr_dma_capable(address);
+}
+
+void LCD_BUS_get_stats(lcd_bus_stats_t* stats_out) {
+    *stats_out = stats;
+}
@@ -0,0 +1,273 @@
+/*
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief This file overrides some ui_drawing.h functions (weak implementations of the
+ * Graphics Engine) with RGB565 kernels:
+ * - the solid fills: rectangles and horizontal lines, which are also used by the software
+ *   algorithms of the other shapes (vertical lines, rectangles outlines, etc.). The pixels
+ *   are written by pairs (32-bit words holding two pixels) with a single 16-bit store for
+ *   the unaligned first and last pixels. The rows are filled from top to bottom; a
+ *   rectangle as wide as the buffer is filled as one contiguous span.
+ * - the images drawing: copy of the opaque RGB565 images (one memory copy per row),
+ *   RGB565 images with a global alpha and ARGB8888 images (per-pixel alpha, optional
+ *   global alpha), blended inline with the rounding of LLUI_DISPLAY_blend(): the red and
+ *   blue channels are blended together in the 16-bit lanes of a 32-bit word. A region of
+ *   the destination drawn in itself is copied or blended in the order which reads each
+ *   pixel before overwriting it.
+ *
+ * The drawings on a destination which is not a 16-bit display buffer and the other images
+ * formats are delegated to the software algorithms (ui_drawing_soft.h).
+ *
+ * @see ui_drawing.h file comment
+ * @author MicroEJ Developer Team
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include "LLUI_DISPLAY_configuration.h"
+
+#if LLUI_DISPLAY_BPP == 16
+
+// implements ui_drawing functions
+#include "ui_drawing.h"
+
+// calls the software algorithms when the destination is not supported
+#include "ui_drawing_soft.h"
+
+// uses the graphics engine functions to retrieve the destination and the clip
+#include "LLUI_DISPLAY.h"
+
+// RGB565 pixels conversions, blending and fills
+#include "ui_rgb565.h"
+
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Returns the foreground color as a pair of RGB565 pixels.
+ */
+static inline uint32_t _get_color_pair(MICROUI_GraphicsContext* gc)
+{
+	uint32_t color = LLUI_DISPLAY_convertARGBColorToDisplayColor((uint32_t)gc->foreground_color) & 0xffff;
+	return (color << 16) | color;
+}
+
+/*
+ * @brief Fills the rectangle (already clipped) with the foreground color and updates
+ * the dirty area.
+ */
+static void _fill_rectangle(MICROUI_GraphicsContext* gc, jint x1, jint y1, jint x2, jint y2)
+{
+	uint32_t stride = LLUI_DISPLAY_getStrideInPixels(&gc->image);
+	uint32_t width = (uint32_t)(x2 - x1 + 1);
+	uint32_t height = (uint32_t)(y2 - y1 + 1);
+	uint32_t pair = _get_color_pair(gc);
+	uint16_t* row = (uint16_t*)LLUI_DISPLAY_getBufferAddress(&gc->image) + ((uint32_t)y1 * stride) + (uint32_t)x1;
+
+	if (width == stride)
+	{
+		// contiguous rows
+		UI_RGB565_fill_span(row, width * height, pair);
+	}
+	else
+	{
+		for (uint32_t y = 0; y < height; y++)
+		{
+			UI_RGB565_fill_span(row, width, pair);
+			row += stride;
+		}
+	}
+
+	LLUI_DISPLAY_setDrawingLimits(x1, y1, x2, y2);
+}
+
+/*
+ * @brief Copies the rows of an RGB565 image. The rows are copied from the bottom to the
+ * top when the destination is below the source in the same buffer.
+ */
+static void _copy_rgb565(uint16_t* src, uint32_t src_stride, uint16_t* dst, uint32_t dst_stride, uint32_t width, uint32_t height, bool overlap)
+{
+	if (!overlap)
+	{
+		for (uint32_t y = 0; y < height; y++)
+		{
+			memcpy(dst, src, width * sizeof(uint16_t));
+			src += src_stride;
+			dst += dst_stride;
+		}
+	}
+	else if (dst <= src)
+	{
+		for (uint32_t y = 0; y < height; y++)
+		{
+			memmove(dst, src, width * sizeof(uint16_t));
+			src += src_stride;
+			dst += dst_stride;
+		}
+	}
+	else
+	{
+		src += (height - 1) * src_stride;
+		dst += (height - 1) * dst_stride;
+		for (uint32_t y = 0; y < height; y++)
+		{
+			memmove(dst, src, width * sizeof(uint16_t));
+			src -= src_stride;
+			dst -= dst_stride;
+		}
+	}
+}
+
+/*
+ * @brief Blends the rows of an RGB565 image applying a global alpha. When the destination
+ * is after the source in the same buffer, the pixels are blended from the last one to the
+ * first one: each source pixel is read before being overwritten.
+ */
+static void _blend_rgb565_image(uint16_t* src, uint32_t src_stride, uint16_t* dst, uint32_t dst_stride, uint32_t width, uint32_t height, uint32_t alpha, bool overlap)
+{
+	if (!overlap || (dst <= src))
+	{
+		for (uint32_t y = 0; y < height; y++)
+		{
+			for (uint32_t x = 0; x < width; x++)
+			{
+				dst[x] = UI_RGB565_blend_rgb565(src[x], dst[x], alpha);
+			}
+			src += src_stride;
+			dst += dst_stride;
+		}
+	}
+	else
+	{
+		src += (height - 1) * src_stride;
+		dst += (height - 1) * dst_stride;
+		for (uint32_t y = 0; y < height; y++)
+		{
+			for (uint32_t x = width; x > 0; x--)
+			{
+				dst[x - 1] = UI_RGB565_blend_rgb565(src[x - 1], dst[x - 1], alpha);
+			}
+			src -= src_stride;
+			dst -= dst_stride;
+		}
+	}
+}
+
+/*
+ * @brief Blends the rows of an ARGB8888 image applying its pixels alpha and a global alpha.
+ */
+static void _blend_argb8888_image(uint32_t* src, uint32_t src_stride, uint16_t* dst, uint32_t dst_stride, uint32_t width, uint32_t height, uint32_t alpha)
+{
+	for (uint32_t y = 0; y < height; y++)
+	{
+		for (uint32_t x = 0; x < width; x++)
+		{
+			UI_RGB565_draw_argb8888(&dst[x], src[x], alpha);
+		}
+		src += src_stride;
+		dst += dst_stride;
+	}
+}
+
+// --------------------------------------------------------------------------------
+// ui_drawing.h functions
+// --------------------------------------------------------------------------------
+
+DRAWING_Status UI_DRAWING_drawHorizontalLine(MICROUI_GraphicsContext* gc, jint x1, jint x2, jint y)
+{
+	if (!UI_RGB565_is_destination(gc))
+	{
+		UI_DRAWING_SOFT_drawHorizontalLine(gc, x1, x2, y);
+	}
+	else if (!LLUI_DISPLAY_isClipEnabled(gc) || LLUI_DISPLAY_clipHorizontalLine(gc, &x1, &x2, y))
+	{
+		_fill_rectangle(gc, x1, y, x2, y);
+	}
+	// else: line out of clip: nothing to draw
+
+	return DRAWING_DONE;
+}
+
+DRAWING_Status UI_DRAWING_fillRectangle(MICROUI_GraphicsContext* gc, jint x1, jint y1, jint x2, jint y2)
+{
+	if (!UI_RGB565_is_destination(gc))
+	{
+		UI_DRAWING_SOFT_fillRectangle(gc, x1, y1, x2, y2);
+	}
+	else if (!LLUI_DISPLAY_isClipEnabled(gc) || LLUI_DISPLAY_clipRectangle(gc, &x1, &y1, &x2, &y2))
+	{
+		_fill_rectangle(gc, x1, y1, x2, y2);
+	}
+	// else: rectangle out of clip: nothing to draw
+
+	return DRAWING_DONE;
+}
+
+DRAWING_Status UI_DRAWING_drawImage(MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint regionX, jint regionY, jint width, jint height, jint x, jint y, jint alpha)
+{
+	bool rgb565_source = UI_RGB565_is_image(img);
+	bool overlap;
+
+	if (!UI_RGB565_is_destination(gc) || (!rgb565_source && (MICROUI_IMAGE_FORMAT_ARGB8888 != img->format)))
+	{
+		UI_DRAWING_SOFT_drawImage(gc, img, regionX, regionY, width, height, x, y, alpha);
+		return DRAWING_DONE;
+	}
+
+	if (LLUI_DISPLAY_isClipEnabled(gc) && !LLUI_DISPLAY_clipRegion(gc, &regionX, &regionY, &width, &height, &x, &y))
+	{
+		// region out of clip: nothing to draw
+		return DRAWING_DONE;
+	}
+
+	// only an RGB565 image can be the destination itself
+	overlap = LLUI_DISPLAY_regionsOverlap(gc, img, regionX, regionY, width, height, x, y);
+
+	uint32_t src_stride = LLUI_DISPLAY_getStrideInPixels(img);
+	uint32_t dst_stride = LLUI_DISPLAY_getStrideInPixels(&gc->image);
+	uint16_t* dst = (uint16_t*)LLUI_DISPLAY_getBufferAddress(&gc->image) + ((uint32_t)y * dst_stride) + (uint32_t)x;
+
+	if (rgb565_source)
+	{
+		uint16_t* src = (uint16_t*)LLUI_DISPLAY_getBufferAddress(img) + ((uint32_t)regionY * src_stride) + (uint32_t)regionX;
+		if (255 == alpha)
+		{
+			_copy_rgb565(src, src_stride, dst, dst_stride, (uint32_t)width, (uint32_t)height, overlap);
+		}
+		else
+		{
+			_blend_rgb565_image(src, src_stride, dst, dst_stride, (uint32_t)width, (uint32_t)height, (uint32_t)alpha, overlap);
+		}
+	}
+	else
+	{
+		uint32_t* src = (uint32_t*)LLUI_DISPLAY_getBufferAddress(img) + ((uint32_t)regionY * src_stride) + (uint32_t)regionX;
+		_blend_argb8888_image(src, src_stride, dst, dst_stride, (uint32_t)width, (uint32_t)height, (uint32_t)alpha);
+	}
+
+	LLUI_DISPLAY_setDrawingLimits(x, y, x + width - 1, y + height - 1);
+	return DRAWING_DONE;
+}
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLUI_DISPLAY_BPP == 16
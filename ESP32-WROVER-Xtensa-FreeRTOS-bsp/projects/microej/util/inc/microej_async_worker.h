@@ -20,6 +20,24 @@
  * 		the <code>MICROEJ_ASYNC_WORKER_initialize()</code> function.
  * 		Jobs are allocated using <code>MICROEJ_ASYNC_WORKER_allocate_job()</code> and scheduled with <code>MICROEJ_ASYNC_WORKER_async_exec()</code>.
  * 		<p>
+ * 		A worker executes its jobs in one task, in the order of their submission. A worker declared with
+ * 		<code>MICROEJ_ASYNC_WORKER_worker_declare_tasks()</code> executes its jobs in several tasks which fetch the jobs from the
+ * 		same queue: a long job does not delay the jobs submitted after it while another task is free. The actions of such a
+ * 		worker must then support being executed concurrently.
+ * 		<p>
+ * 		Several jobs can be submitted at once with <code>MICROEJ_ASYNC_WORKER_allocate_batch()</code> and
+ * 		<code>MICROEJ_ASYNC_WORKER_async_exec_batch()</code>: the Java thread is suspended once and resumed when all the
+ * 		jobs of the batch are done.
+ * 		<p>
+ * 		The queued jobs are executed by order of priority: a job takes the priority of the Java thread that allocates it
+ * 		(see <code>MICROEJ_ASYNC_WORKER_priority_t</code>), unless set explicitly with
+ * 		<code>MICROEJ_ASYNC_WORKER_set_job_priority()</code>. A queued job gains one priority level every
+ * 		<code>MICROEJ_ASYNC_WORKER_AGING_PERIOD</code> milliseconds so that low priority jobs are not starved.
+ * 		<p>
+ * 		Each worker measures the time its jobs wait in the queue and the time they are executed, and the high-water
+ * 		marks of its queue and of its waiting list (see <code>MICROEJ_ASYNC_WORKER_get_stats()</code>). These
+ * 		statistics help sizing the number of jobs, tasks and waiting threads of a worker.
+ * 		<p>
  * 		Typical usage consists in declaring:
  * 		- for each SNI function, a structure that contains the parameters of the function,
  * 		- an union of all the previously declared structures,
@@ -122,6 +140,50 @@
 	extern "C" {
 #endif
 
+/**
+ * @brief Delay in milliseconds after which a Java thread retries to allocate a job when it could not be queued
+ * because the waiting list is full, or to allocate a batch when fewer jobs than required are free.
+ */
+#ifndef MICROEJ_ASYNC_WORKER_WAITING_LIST_FULL_RETRY_DELAY
+#define MICROEJ_ASYNC_WORKER_WAITING_LIST_FULL_RETRY_DELAY (10)
+#endif
+
+/**
+ * @brief Delay in milliseconds after which a queued job gains one priority level.
+ */
+#ifndef MICROEJ_ASYNC_WORKER_AGING_PERIOD
+#define MICROEJ_ASYNC_WORKER_AGING_PERIOD (100)
+#endif
+
+/**
+ * @brief Number of classes of the histograms of the wait and execution times of the jobs (see
+ * <code>MICROEJ_ASYNC_WORKER_stats_t</code>).
+ */
+#define MICROEJ_ASYNC_WORKER_HISTOGRAM_SIZE (16)
+
+/**
+ * @brief The first class of the histograms counts the times lower than 2^MICROEJ_ASYNC_WORKER_HISTOGRAM_SHIFT
+ * microseconds, the upper bound of each next class is twice the previous one and the last class counts all the
+ * longer times.
+ */
+#define MICROEJ_ASYNC_WORKER_HISTOGRAM_SHIFT (10)
+
+/** @brief Number of priority levels of the jobs. */
+#define MICROEJ_ASYNC_WORKER_PRIORITY_LEVELS (3)
+
+/**
+ * @brief Priorities of the jobs.
+ *
+ * By default, the priority of a job is given by the priority of the Java thread that allocates it: lower than
+ * <code>Thread.NORM_PRIORITY</code> gives <code>MICROEJ_ASYNC_WORKER_PRIORITY_LOW</code>, higher than
+ * <code>Thread.NORM_PRIORITY</code> gives <code>MICROEJ_ASYNC_WORKER_PRIORITY_HIGH</code>.
+ */
+typedef enum {
+	MICROEJ_ASYNC_WORKER_PRIORITY_LOW,
+	MICROEJ_ASYNC_WORKER_PRIORITY_NORMAL,
+	MICROEJ_ASYNC_WORKER_PRIORITY_HIGH
+} MICROEJ_ASYNC_WORKER_priority_t;
+
 /** @brief Return codes list. */
 typedef enum {
 	MICROEJ_ASYNC_WORKER_OK,
@@ -133,6 +195,31 @@ typedef enum {
 /** @brief See <code>struct MICROEJ_ASYNC_WORKER_job</code>. */
 typedef struct MICROEJ_ASYNC_WORKER_job MICROEJ_ASYNC_WORKER_job_t;
 
+/**
+ * @brief Statistics of an async worker.
+ *
+ * The wait time of a job is the time between its submission and the start of its execution, its service time is the
+ * time of its execution. The times are measured with <code>MICROEJ_ASYNC_WORKER_get_time_us()</code>: their
+ * resolution is the one of this clock.
+ */
+typedef struct {
+	uint32_t executed_jobs; // Number of jobs executed by the worker.
+	uint32_t wait_histogram[MICROEJ_ASYNC_WORKER_HISTOGRAM_SIZE]; // Number of jobs per class of wait time.
+	uint32_t service_histogram[MICROEJ_ASYNC_WORKER_HISTOGRAM_SIZE]; // Number of jobs per class of service time.
+	uint32_t max_wait_time_us; // Longest wait of a job, in microseconds.
+	uint32_t max_service_time_us; // Longest execution of a job, in microseconds.
+	uint32_t max_queued_jobs; // High-water mark of the number of jobs queued and not executed yet.
+	uint32_t max_waiting_threads; // High-water mark of the number of Java threads in the waiting list.
+	uint32_t job_waits; // Number of times a Java thread has been suspended because not enough jobs were free.
+	uint32_t waiting_list_full; // Number of times a Java thread could not be added to the full waiting list.
+} MICROEJ_ASYNC_WORKER_stats_t;
+
+/** @brief See <code>struct MICROEJ_ASYNC_WORKER_handle</code>. */
+typedef struct MICROEJ_ASYNC_WORKER_handle MICROEJ_ASYNC_WORKER_handle_t;
+
+/** @brief See <code>struct MICROEJ_ASYNC_WORKER_task</code>. */
+typedef struct MICROEJ_ASYNC_WORKER_task MICROEJ_ASYNC_WORKER_task_t;
+
 /** @brief Pointer to a function to call asynchronously. */
 typedef void (*MICROEJ_ASYNC_WORKER_action_t)(MICROEJ_ASYNC_WORKER_job_t* job);
 
@@ -154,7 +241,13 @@ struct MICROEJ_ASYNC_WORKER_job{
 	struct {
 		MICROEJ_ASYNC_WORKER_action_t action; // Pointer to the action to execute asynchronously.
 		int32_t thread_id; // Id of the Java thread that is waiting for this job to complete ; SNI_ERROR if no thread is waiting.
-		MICROEJ_ASYNC_WORKER_job_t* next_free_job; // Next in the free jobs linked list.
+		uint32_t next_free_job; // Index+1 of the next job in the free jobs stack ; 0 if this job is the last one.
+		MICROEJ_ASYNC_WORKER_job_t* batch; // First job of the batch of this job ; NULL if this job is not in a batch.
+		MICROEJ_ASYNC_WORKER_job_t* next_batch_job; // Next job in the batch ; NULL if this job is the last one.
+		uint32_t batch_pending_jobs; // In the first job of a batch: number of jobs of the batch not done yet.
+		MICROEJ_ASYNC_WORKER_priority_t priority; // Priority of the job.
+		int64_t queued_time; // Time when the job has been queued, in microseconds.
+		MICROEJ_ASYNC_WORKER_job_t* next_queued_job; // Next job in the queue of the same priority.
 	} _intern;
 };
 
@@ -166,48 +259,104 @@ struct MICROEJ_ASYNC_WORKER_job{
  * <p>
  * All the fields of this structure are internal data and must not be modified.
  */
-typedef struct {
+struct MICROEJ_ASYNC_WORKER_handle {
 	int32_t job_count; // Maximum number of jobs.
-	MICROEJ_ASYNC_WORKER_job_t* free_jobs; // Linked list of free jobs
+	MICROEJ_ASYNC_WORKER_job_t* jobs; // Pointer to jobs array. Length of this array is job_count.
+	uint32_t free_jobs; // Lock-free stack of free jobs: ABA tag in the 16 high bits, index+1 of the top job in the 16 low bits (0: empty stack).
 	void* params; // Pointer to params array. Length of this array is job_count.
 	int32_t params_sizeof; // Size of the params union
 	int32_t waiting_threads_length; // Length of the waiting_threads array
-	int32_t* waiting_threads; // Array of waiting threads (circular list)
-	uint16_t waiting_thread_offset; // Offset of the first waiting thread. If equals to free_waiting_thread_offset: no waiting thread
-	uint16_t free_waiting_thread_offset; // Offset of the first free slot in waiting_threads array
-	OSAL_queue_handle_t jobs_queue; // Linked list of jobs
-	OSAL_task_handle_t task; // The task that executes this worker.
+	int32_t* waiting_threads; // Array of waiting threads (circular list). Protected by the mutex.
+	uint16_t waiting_thread_offset; // Offset of the first waiting thread.
+	uint32_t waiting_thread_count; // Number of waiting threads, read without the mutex by MICROEJ_ASYNC_WORKER_free_job().
+	MICROEJ_ASYNC_WORKER_job_t* queued_jobs[MICROEJ_ASYNC_WORKER_PRIORITY_LEVELS]; // First queued job of each priority. Protected by the mutex.
+	MICROEJ_ASYNC_WORKER_job_t* last_queued_jobs[MICROEJ_ASYNC_WORKER_PRIORITY_LEVELS]; // Last queued job of each priority. Protected by the mutex.
+	OSAL_counter_semaphore_handle_t jobs_semaphore; // Counts the queued jobs.
+	int32_t task_count; // Number of tasks that execute this worker.
+	MICROEJ_ASYNC_WORKER_task_t* tasks; // The tasks that execute this worker. Length of this array is task_count.
 	OSAL_mutex_handle_t mutex; // Mutex used for critical sections.
-} MICROEJ_ASYNC_WORKER_handle_t;
+	uint32_t queued_job_count; // Number of queued jobs. Protected by the mutex.
+	MICROEJ_ASYNC_WORKER_stats_t stats; // Protected by the mutex.
+	uint8_t* name; // Name given to MICROEJ_ASYNC_WORKER_initialize().
+	MICROEJ_ASYNC_WORKER_handle_t* next_worker; // Next initialized worker (see MICROEJ_ASYNC_WORKER_dump_all_stats()).
+};
 
 /**
- * @brief Declares a worker named <code>_name</code>.
+ * @brief Statistics of a task of an async worker.
+ *
+ * The times are measured with <code>MICROEJ_ASYNC_WORKER_get_time_us()</code>: their resolution is the one of this clock.
+ */
+typedef struct {
+	uint32_t executed_jobs; // Number of jobs executed by the task.
+	uint64_t busy_time_us; // Total time spent executing the jobs, in microseconds.
+	uint32_t max_job_time_us; // Longest execution of a job, in microseconds.
+} MICROEJ_ASYNC_WORKER_task_stats_t;
+
+/**
+ * @brief A task of an async worker.
+ *
+ * All the fields of this structure are internal data and must not be modified.
+ */
+struct MICROEJ_ASYNC_WORKER_task {
+	OSAL_task_handle_t handle; // The OS task.
+	MICROEJ_ASYNC_WORKER_handle_t* async_worker; // The worker executed by this task.
+	MICROEJ_ASYNC_WORKER_task_stats_t stats; // Protected by the worker mutex.
+};
+
+/**
+ * @brief Declares a worker named <code>_name</code>, executed by one task.
  *
  * This macro must be used outside of any function so the worker is declared as a global variable.
  *
  * @param _name name of the worker variable.
  * @param _job_count maximum number of jobs that can be allocated for this worker. Must be greater than 0.
  * @param _param_type type of the union of all the parameters structures
- * @param  _waiting_list_size Maximum Java thread that can be suspended on <code>MICROEJ_ASYNC_WORKER_allocate_job()</code> when no job is available. Must be greater than 0.
+ * @param  _waiting_list_size Maximum Java threads that can be queued on <code>MICROEJ_ASYNC_WORKER_allocate_job()</code> when no job is available. Must be greater than 0.
  */
 #define MICROEJ_ASYNC_WORKER_worker_declare(_name, _job_count, _param_type, _waiting_list_size)\
+	MICROEJ_ASYNC_WORKER_worker_declare_tasks(_name, _job_count, _param_type, _waiting_list_size, 1)
+
+/**
+ * @brief Declares a worker named <code>_name</code>, executed by <code>_task_count</code> tasks.
+ *
+ * This macro must be used outside of any function so the worker is declared as a global variable.
+ * <p>
+ * All the tasks are created with the stack given to <code>MICROEJ_ASYNC_WORKER_initialize()</code>: this relies on an
+ * OSAL port where <code>OSAL_task_stack_t</code> is a stack size and each task allocates its own stack, as the FreeRTOS
+ * port (<code>osal_FreeRTOS.c</code>) does. With a port where <code>OSAL_task_stack_declare()</code> declares a memory
+ * area, the tasks would share it: declare such a worker with a single task.
+ *
+ * @param _name name of the worker variable.
+ * @param _job_count maximum number of jobs that can be allocated for this worker. Must be in [1, 65535].
+ * @param _param_type type of the union of all the parameters structures
+ * @param  _waiting_list_size Maximum Java threads that can be queued on <code>MICROEJ_ASYNC_WORKER_allocate_job()</code> when no job is available. Must be greater than 0.
+ * @param _task_count number of tasks that execute the jobs of this worker. Must be greater than 0.
+ */
+#define MICROEJ_ASYNC_WORKER_worker_declare_tasks(_name, _job_count, _param_type, _waiting_list_size, _task_count)\
 	_param_type _name ## _params[_job_count];\
 	MICROEJ_ASYNC_WORKER_job_t _name ## _jobs[_job_count];\
-	int32_t _name ## _waiting_threads[_waiting_list_size+1];\
+	int32_t _name ## _waiting_threads[_waiting_list_size];\
+	MICROEJ_ASYNC_WORKER_task_t _name ## _tasks[_task_count];\
 	MICROEJ_ASYNC_WORKER_handle_t _name = {\
 		.job_count = _job_count,\
-		.free_jobs = _name ## _jobs,\
+		.jobs = _name ## _jobs,\
 		.params = _name ## _params,\
 		.params_sizeof = sizeof(_param_type),\
-		.waiting_threads_length = _waiting_list_size+1,\
+		.waiting_threads_length = _waiting_list_size,\
 		.waiting_threads = _name ## _waiting_threads,\
 		.waiting_thread_offset = 0,\
-		.free_waiting_thread_offset = 0\
+		.waiting_thread_count = 0,\
+		.task_count = _task_count,\
+		.tasks = _name ## _tasks\
 	}
 
 
 /**
- * @brief Initializes and starts a worker previously declared with <code>MICROEJ_ASYNC_WORKER_worker_declare()</code> macro.
+ * @brief Initializes and starts a worker previously declared with <code>MICROEJ_ASYNC_WORKER_worker_declare()</code> or
+ * <code>MICROEJ_ASYNC_WORKER_worker_declare_tasks()</code> macro.
+ *
+ * All the tasks of the worker are created with the given name, stack and priority. The stack is given as is to
+ * <code>OSAL_task_create()</code> for each task (see <code>MICROEJ_ASYNC_WORKER_worker_declare_tasks()</code>).
  *
  * @param[in] async_worker the worker to initialize. Declared with <code>MICROEJ_ASYNC_WORKER_worker_declare()</code> macro.
  * @param[in] name worker name.
@@ -231,8 +380,11 @@ MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_initialize(MICROEJ_ASYNC_WORK
  * Usually the <code>sni_retry_callback</code> function argument is the current SNI function itself (i.e. the function
  * that is currently calling <code>MICROEJ_ASYNC_WORKER_allocate_job()</code>).
  * <p>
- * If the waiting list is full, an SNI exception is thrown using <code>SNI_throwNativeIOException()</code> and
- * <code>NULL</code> is returned. Size of the waiting list is defined when declaring the worker.
+ * If the waiting list is full, the current Java thread is suspended for
+ * <code>MICROEJ_ASYNC_WORKER_WAITING_LIST_FULL_RETRY_DELAY</code> milliseconds, <code>NULL</code> is returned and
+ * <code>sni_retry_callback</code> is called when the delay expires: the thread is not in the waiting list, a job freed
+ * meanwhile does not resume it. Size of the waiting list is defined when declaring the worker: it bounds the threads
+ * resumed as soon as a job is freed, the other ones poll.
  * <p>
  * <code>params</code> field of the returned job is a pointer to a type <code>T</code> where <code>T</code> is
  * the value of the argument <code>_param_type</code> given to the <code>MICROEJ_ASYNC_WORKER_worker_declare()</code>
@@ -247,6 +399,20 @@ MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_initialize(MICROEJ_ASYNC_WORK
  */
 MICROEJ_ASYNC_WORKER_job_t* MICROEJ_ASYNC_WORKER_allocate_job(MICROEJ_ASYNC_WORKER_handle_t* async_worker, SNI_callback sni_retry_callback);
 
+/**
+ * @brief Sets the priority of a job, replacing the priority of the Java thread that allocated it.
+ *
+ * This function must be called before executing the job.
+ *
+ * @param[in] job the job. Must have been allocated with <code>MICROEJ_ASYNC_WORKER_allocate_job()</code> or
+ * <code>MICROEJ_ASYNC_WORKER_allocate_batch()</code>.
+ * @param[in] priority the priority of the job.
+ *
+ * @return <code>MICROEJ_ASYNC_WORKER_OK</code> on success, <code>MICROEJ_ASYNC_WORKER_INVALID_ARGS</code> if the
+ * priority is not one of <code>MICROEJ_ASYNC_WORKER_priority_t</code>.
+ */
+MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_set_job_priority(MICROEJ_ASYNC_WORKER_job_t* job, MICROEJ_ASYNC_WORKER_priority_t priority);
+
 
 /**
  * @brief Frees a job previously allocated with MICROEJ_ASYNC_WORKER_allocate_job().
@@ -255,6 +421,8 @@ MICROEJ_ASYNC_WORKER_job_t* MICROEJ_ASYNC_WORKER_allocate_job(MICROEJ_ASYNC_WORK
  * in the on_done_callback given to MICROEJ_ASYNC_WORKER_async_exec(). After calling this function the given job and its
  * parameters must not be used anymore.
  * <p>
+ * This function does not take the worker mutex unless a Java thread is waiting for a job.
+ * <p>
  * This function must be called within the virtual machine task.
  *
  * @param[in] async_worker the worker used to allocate the given job.
@@ -324,6 +492,143 @@ MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_async_exec_no_wait(MICROEJ_AS
  */
 MICROEJ_ASYNC_WORKER_job_t* MICROEJ_ASYNC_WORKER_get_job_done(void);
 
+/**
+ * @brief Allocates a batch of jobs for the given worker.
+ *
+ * The jobs are allocated all at once: if fewer than <code>job_count</code> jobs are available, none is allocated, the
+ * current Java thread is suspended and <code>NULL</code> is returned. Then the function <code>sni_retry_callback</code>
+ * is called when a job is freed or, if some jobs were free but not enough of them, after
+ * <code>MICROEJ_ASYNC_WORKER_WAITING_LIST_FULL_RETRY_DELAY</code> milliseconds.
+ * <p>
+ * The returned job is the first job of the batch, the next ones are returned by
+ * <code>MICROEJ_ASYNC_WORKER_get_next_batch_job()</code>. Each job has its own parameters.
+ * <p>
+ * If <code>job_count</code> is not in [1, <code>_job_count</code>] (value given when declaring the worker), an SNI
+ * exception is thrown using <code>SNI_throwNativeIOException()</code> and <code>NULL</code> is returned.
+ * <p>
+ * This function must be called within the virtual machine task.
+ *
+ * @param[in] async_worker the worker in which to allocate the jobs.
+ * @param[in] job_count the number of jobs of the batch.
+ * @param[in] sni_retry_callback if the current Java thread has been suspended, this function is called when it is resumed.
+ *
+ * @return the first job of the batch on success or NULL if not enough jobs are available.
+ */
+MICROEJ_ASYNC_WORKER_job_t* MICROEJ_ASYNC_WORKER_allocate_batch(MICROEJ_ASYNC_WORKER_handle_t* async_worker, int32_t job_count, SNI_callback sni_retry_callback);
+
+/**
+ * @brief Returns the job following the given one in its batch.
+ *
+ * @param[in] job a job of a batch allocated with <code>MICROEJ_ASYNC_WORKER_allocate_batch()</code>.
+ *
+ * @return the next job of the batch or <code>NULL</code> if the given job is the last one.
+ */
+MICROEJ_ASYNC_WORKER_job_t* MICROEJ_ASYNC_WORKER_get_next_batch_job(MICROEJ_ASYNC_WORKER_job_t* job);
+
+/**
+ * @brief Executes the jobs of the given batch asynchronously.
+ *
+ * This function does not block and returns immediately but it suspends the execution of the current Java thread
+ * until all the jobs of the batch are finished. The jobs are executed with the same action, possibly concurrently
+ * when the worker has several tasks.
+ * <p>
+ * When all the jobs are finished, the SNI callback <code>on_done_callback</code> is called before going back to Java.
+ * <code>MICROEJ_ASYNC_WORKER_get_job_done()</code> returns the first job of the batch. If the jobs are not used
+ * anymore, the callback must released them explicitly by calling <code>MICROEJ_ASYNC_WORKER_free_batch()</code>.
+ * <p>
+ * If an error happens, an SNI exception is thrown using <code>SNI_throwNativeIOException()</code> and the error
+ * status <code>MICROEJ_ASYNC_WORKER_ERROR</code> is returned. In this case, the SNI callback
+ * <code>on_done_callback</code> is not called and the batch is released by the worker once its already submitted
+ * jobs are finished: it must not be used anymore.
+ * <p>
+ * This function must be called within the virtual machine task.
+ *
+ * @param[in] async_worker the worker used to execute the given batch. Must be the same than the one used to allocate the batch.
+ * @param[in] batch the first job of the batch. Must have been allocated with <code>MICROEJ_ASYNC_WORKER_allocate_batch()</code>.
+ * @param[in] action the function to execute asynchronously for each job.
+ * @param[in] on_done_callback the <code>SNI_callback</code> called when all the jobs are done.
+ *
+ * @return <code>MICROEJ_ASYNC_WORKER_OK</code> on success, otherwise returns the error status
+ * <code>MICROEJ_ASYNC_WORKER_ERROR</code>.
+ */
+MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_async_exec_batch(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_job_t* batch, MICROEJ_ASYNC_WORKER_action_t action, SNI_callback on_done_callback);
+
+/**
+ * @brief Frees a batch previously allocated with <code>MICROEJ_ASYNC_WORKER_allocate_batch()</code>.
+ *
+ * The same rules as <code>MICROEJ_ASYNC_WORKER_free_job()</code> apply to all the jobs of the batch.
+ *
+ * @param[in] async_worker the worker used to allocate the given batch.
+ * @param[in] batch the first job of the batch.
+ *
+ * @return <code>MICROEJ_ASYNC_WORKER_OK</code> on success, otherwise returns the error status
+ * <code>MICROEJ_ASYNC_WORKER_ERROR</code>.
+ */
+MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_free_batch(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_job_t* batch);
+
+/**
+ * @brief Returns the number of tasks that execute the given worker.
+ *
+ * @param[in] async_worker the worker.
+ *
+ * @return the number of tasks given when declaring the worker.
+ */
+int32_t MICROEJ_ASYNC_WORKER_get_task_count(MICROEJ_ASYNC_WORKER_handle_t* async_worker);
+
+/**
+ * @brief Gets the statistics of a task of the given worker since its initialization.
+ *
+ * @param[in] async_worker the worker.
+ * @param[in] task_index index of the task, in [0, <code>MICROEJ_ASYNC_WORKER_get_task_count()</code>[.
+ * @param[out] stats the statistics of the task.
+ *
+ * @return <code>MICROEJ_ASYNC_WORKER_OK</code> on success, <code>MICROEJ_ASYNC_WORKER_INVALID_ARGS</code> if the index
+ * is out of bounds.
+ */
+MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_get_task_stats(MICROEJ_ASYNC_WORKER_handle_t* async_worker, int32_t task_index, MICROEJ_ASYNC_WORKER_task_stats_t* stats);
+
+/**
+ * @brief Gets the statistics of the given worker since its initialization or the last call to
+ * <code>MICROEJ_ASYNC_WORKER_reset_stats()</code>.
+ *
+ * @param[in] async_worker the worker.
+ * @param[out] stats the statistics of the worker.
+ */
+void MICROEJ_ASYNC_WORKER_get_stats(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_stats_t* stats);
+
+/**
+ * @brief Clears the statistics of the given worker. The high-water marks restart from the current number of queued
+ * jobs and waiting threads. The statistics of the tasks are not cleared.
+ *
+ * @param[in] async_worker the worker.
+ */
+void MICROEJ_ASYNC_WORKER_reset_stats(MICROEJ_ASYNC_WORKER_handle_t* async_worker);
+
+/**
+ * @brief Prints the statistics of the given worker: one line for the counters and the high-water marks, one line for
+ * each histogram.
+ *
+ * @param[in] async_worker the worker.
+ */
+void MICROEJ_ASYNC_WORKER_dump_stats(MICROEJ_ASYNC_WORKER_handle_t* async_worker);
+
+/**
+ * @brief Prints the statistics of all the initialized workers (see <code>MICROEJ_ASYNC_WORKER_dump_stats()</code>).
+ */
+void MICROEJ_ASYNC_WORKER_dump_all_stats(void);
+
+/**
+ * @brief Names of the Java natives that print the statistics of all the initialized workers and clear them
+ * (<code>dump()</code>), or only clear them (<code>reset()</code>).
+ */
+#ifndef javaAsyncWorkerStatsDump
+#define javaAsyncWorkerStatsDump Java_com_is2t_debug_AsyncWorkerStats_dump
+#endif
+
+#ifndef javaAsyncWorkerStatsReset
+#define javaAsyncWorkerStatsReset Java_com_is2t_debug_AsyncWorkerStats_reset
+#endif
+
 #ifdef __cplusplus
 	}
 #endif
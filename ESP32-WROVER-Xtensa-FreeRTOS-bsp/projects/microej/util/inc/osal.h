@@ -235,6 +235,7 @@ OSAL_status_t OSAL_binary_semaphore_take(OSAL_binary_semaphore_handle_t* handle,
 /**
  * @brief Give operation on OS binary semaphore. Increase the binary semaphore count value by 1 and unblock the current task if
  * count value equals to 0.
+ * This method may be called from an interrupt.
  *
  * @param[in] handle pointer on the binary semaphore handle
  *
@@ -14,6 +14,8 @@
  */
 
 #include "microej_async_worker.h"
+#include "MJVM_MONITOR.h"
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
@@ -23,9 +25,57 @@
 	extern "C" {
 #endif
 
+#ifndef MICROEJ_ASYNC_WORKER_get_time_us
+#include "microej_time.h"
+/**
+ * Gets the time used to measure the execution of the jobs, in microseconds (int64_t).
+ * May be defined to use a finer clock: the FreeRTOS platform time has a millisecond resolution.
+ */
+#define MICROEJ_ASYNC_WORKER_get_time_us() (microej_time_get_time_nanos() / 1000)
+#endif
+
+// The free jobs stack is a word updated with compare-and-swap: the 16 low bits hold the index+1 of the top job and
+// the 16 high bits a tag incremented by each update, so that a pop preempted between its read of the top job and its
+// compare-and-swap fails if the job has been popped and pushed back meanwhile (ABA).
+#define MICROEJ_ASYNC_WORKER_FREE_JOBS_INDEX_MASK	(0xFFFFu)
+#define MICROEJ_ASYNC_WORKER_FREE_JOBS_TAG_ONE		(0x10000u)
+
+// Java priority of a thread that allocates jobs of normal priority (Thread.NORM_PRIORITY).
+#define MICROEJ_ASYNC_WORKER_JAVA_NORM_PRIORITY	(5)
+
+// The initialized workers, linked by their next_worker field.
+static MICROEJ_ASYNC_WORKER_handle_t* MICROEJ_ASYNC_WORKER_workers = NULL;
+
 // Entry point of the async worker task.
 static void MICROEJ_ASYNC_WORKER_loop(void* args);
 
+// Pops a job from the free jobs stack. Returns NULL if the stack is empty.
+static MICROEJ_ASYNC_WORKER_job_t* MICROEJ_ASYNC_WORKER_pop_free_job(MICROEJ_ASYNC_WORKER_handle_t* async_worker);
+
+// Pushes a job on the free jobs stack.
+static void MICROEJ_ASYNC_WORKER_push_free_job(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_job_t* job);
+
+// Resumes the first thread of the waiting list, if any.
+static void MICROEJ_ASYNC_WORKER_resume_waiting_thread(MICROEJ_ASYNC_WORKER_handle_t* async_worker);
+
+// Suspends the current Java thread until a job is freed.
+static void MICROEJ_ASYNC_WORKER_wait_free_job(MICROEJ_ASYNC_WORKER_handle_t* async_worker, SNI_callback sni_retry_callback);
+
+// Returns the priority of the jobs allocated by the current Java thread.
+static MICROEJ_ASYNC_WORKER_priority_t MICROEJ_ASYNC_WORKER_get_current_thread_priority(void);
+
+// Adds a job in the queue of its priority and signals it to the worker tasks.
+static OSAL_status_t MICROEJ_ASYNC_WORKER_queue_job(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_job_t* job);
+
+// Removes the next job to execute from the queues. Must be called after taking the jobs semaphore.
+static MICROEJ_ASYNC_WORKER_job_t* MICROEJ_ASYNC_WORKER_dequeue_job(MICROEJ_ASYNC_WORKER_handle_t* async_worker);
+
+// Called by a worker task when a job of a batch is done.
+static void MICROEJ_ASYNC_WORKER_batch_job_done(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_job_t* job);
+
+// Returns the class of the given time in the histograms of the statistics.
+static uint32_t MICROEJ_ASYNC_WORKER_histogram_class(uint32_t time_us);
+
 // Generic method for MICROEJ_ASYNC_WORKER_async_exec and MICROEJ_ASYNC_WORKER_async_exec_no_wait
 static MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_async_exec_intern(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_job_t* job, MICROEJ_ASYNC_WORKER_action_t action, SNI_callback on_done_callback, bool wait);
 
@@ -33,25 +83,37 @@ MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_initialize(MICROEJ_ASYNC_WORK
 	// Check configuration
 	int32_t job_count = async_worker->job_count;
 	if(job_count <= 0
-	|| async_worker->waiting_threads_length <= 1 // compare with 1 because '+1' is added when declaring the array
+	|| job_count > (int32_t)MICROEJ_ASYNC_WORKER_FREE_JOBS_INDEX_MASK
+	|| async_worker->waiting_threads_length <= 0
+	|| async_worker->task_count <= 0
 	){
 		return MICROEJ_ASYNC_WORKER_INVALID_ARGS;
 	}
 
-	// Init jobs
-	MICROEJ_ASYNC_WORKER_job_t* jobs = async_worker->free_jobs;
+	// Init jobs: all of them are in the free jobs stack, the first one on top
+	MICROEJ_ASYNC_WORKER_job_t* jobs = async_worker->jobs;
 	void* params = async_worker->params;
 	int32_t params_sizeof = async_worker->params_sizeof;
 	for(int i=0 ; i<job_count-1 ; i++){
-		jobs[i]._intern.next_free_job = &jobs[i+1];
+		jobs[i]._intern.next_free_job = (uint32_t)(i+2);
 		jobs[i].params = params;
-		params = ( void *) ( (int32_t)params + params_sizeof );
+		params = (void*)((uint8_t*)params + params_sizeof);
 	}
-	jobs[job_count-1]._intern.next_free_job = NULL;
+	jobs[job_count-1]._intern.next_free_job = 0;
 	jobs[job_count-1].params = params;
-
-	// Create queue
-	OSAL_status_t res = OSAL_queue_create(name, &async_worker->jobs_queue, async_worker->job_count);
+	async_worker->free_jobs = 1;
+	async_worker->waiting_thread_offset = 0;
+	async_worker->waiting_thread_count = 0;
+	async_worker->queued_job_count = 0;
+	(void)memset(&async_worker->stats, 0, sizeof(async_worker->stats));
+	async_worker->name = name;
+
+	// Create queues: there are never more queued jobs than jobs
+	for(int i=0 ; i<MICROEJ_ASYNC_WORKER_PRIORITY_LEVELS ; i++){
+		async_worker->queued_jobs[i] = NULL;
+		async_worker->last_queued_jobs[i] = NULL;
+	}
+	OSAL_status_t res = OSAL_counter_semaphore_create(name, 0, (uint32_t)job_count, &async_worker->jobs_semaphore);
 	if(res != OSAL_OK){
 		return MICROEJ_ASYNC_WORKER_ERROR;
 	}
@@ -62,78 +124,229 @@ MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_initialize(MICROEJ_ASYNC_WORK
 		return MICROEJ_ASYNC_WORKER_ERROR;
 	}
 
-	// Create task
-	res = OSAL_task_create(MICROEJ_ASYNC_WORKER_loop, name, stack, priority, async_worker, &async_worker->task);
-	if(res != OSAL_OK){
-		return MICROEJ_ASYNC_WORKER_ERROR;
+	// Create tasks: all of them fetch their jobs from the same queue
+	for(int i=0 ; i<async_worker->task_count ; i++){
+		MICROEJ_ASYNC_WORKER_task_t* task = &async_worker->tasks[i];
+		task->async_worker = async_worker;
+		(void)memset(&task->stats, 0, sizeof(task->stats));
+		res = OSAL_task_create(MICROEJ_ASYNC_WORKER_loop, name, stack, priority, task, &task->handle);
+		if(res != OSAL_OK){
+			return MICROEJ_ASYNC_WORKER_ERROR;
+		}
 	}
 
+	// Register the worker for MICROEJ_ASYNC_WORKER_dump_all_stats()
+	MICROEJ_ASYNC_WORKER_handle_t* workers = __atomic_load_n(&MICROEJ_ASYNC_WORKER_workers, __ATOMIC_RELAXED);
+	do {
+		async_worker->next_worker = workers;
+	} while(!__atomic_compare_exchange_n(&MICROEJ_ASYNC_WORKER_workers, &workers, async_worker, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
 	return MICROEJ_ASYNC_WORKER_OK;
 }
 
 
 MICROEJ_ASYNC_WORKER_job_t* MICROEJ_ASYNC_WORKER_allocate_job(MICROEJ_ASYNC_WORKER_handle_t* async_worker, SNI_callback sni_retry_callback){
 
-	MICROEJ_ASYNC_WORKER_job_t* job = NULL;
+	MICROEJ_ASYNC_WORKER_job_t* job = MICROEJ_ASYNC_WORKER_pop_free_job(async_worker);
 
+	if(job != NULL){
+		job->_intern.batch = NULL;
+		job->_intern.next_batch_job = NULL;
+		job->_intern.priority = MICROEJ_ASYNC_WORKER_get_current_thread_priority();
+	}
+	else {
+		MICROEJ_ASYNC_WORKER_wait_free_job(async_worker, sni_retry_callback);
+	}
+
+	return job;
+}
+
+static void MICROEJ_ASYNC_WORKER_wait_free_job(MICROEJ_ASYNC_WORKER_handle_t* async_worker, SNI_callback sni_retry_callback){
+	// No free job available: wait for a free job.
+	// Store the current thread id in the waiting list, if there is a free element in it.
+	bool queued = false;
 	OSAL_mutex_take(&async_worker->mutex, OSAL_INFINITE_TIME);
 	{
-		job = async_worker->free_jobs;
-		if(job != NULL){
-			// Free job found: remove it from the free list
-			async_worker->free_jobs = job->_intern.next_free_job;
-			job->_intern.next_free_job = NULL;
+		uint32_t waiting_thread_count = async_worker->waiting_thread_count;
+		if(waiting_thread_count < (uint32_t)async_worker->waiting_threads_length){
+			uint32_t free_waiting_thread_offset = async_worker->waiting_thread_offset + waiting_thread_count;
+			if(free_waiting_thread_offset >= (uint32_t)async_worker->waiting_threads_length){
+				free_waiting_thread_offset -= (uint32_t)async_worker->waiting_threads_length;
+			}
+			async_worker->waiting_threads[free_waiting_thread_offset] = SNI_getCurrentJavaThreadID();
+			// Sequentially consistent with the check done by MICROEJ_ASYNC_WORKER_free_job() after pushing a job
+			waiting_thread_count = __atomic_add_fetch(&async_worker->waiting_thread_count, 1, __ATOMIC_SEQ_CST);
+			queued = true;
+			if(waiting_thread_count > async_worker->stats.max_waiting_threads){
+				async_worker->stats.max_waiting_threads = waiting_thread_count;
+			}
 		}
+		else {
+			async_worker->stats.waiting_list_full++;
+		}
+		async_worker->stats.job_waits++;
 	}
 	OSAL_mutex_give(&async_worker->mutex);
 
-	if(job == NULL){
-		// No free job available: wait for a free job.
-		// Store the current thread id in the waiting list.
-		// First check if there is a free element in the waiting list.
-		int32_t free_waiting_thread_offset = async_worker->free_waiting_thread_offset;
-		int32_t new_free_waiting_thread_offset = free_waiting_thread_offset + 1;
-		if(new_free_waiting_thread_offset >= async_worker->waiting_threads_length){
-			new_free_waiting_thread_offset = 0;
+	if(queued == true){
+		// A job freed before this thread was queued has not resumed it: resume a waiting thread now (maybe this one,
+		// then its pending resume flag prevents the suspension below).
+		if((__atomic_load_n(&async_worker->free_jobs, __ATOMIC_SEQ_CST) & MICROEJ_ASYNC_WORKER_FREE_JOBS_INDEX_MASK) != 0){
+			MICROEJ_ASYNC_WORKER_resume_waiting_thread(async_worker);
 		}
+		SNI_suspendCurrentJavaThreadWithCallback(0, (SNI_callback) sni_retry_callback, NULL);
+	}
+	else {
+		// The waiting list is full: retry later rather than failing.
+		SNI_suspendCurrentJavaThreadWithCallback(MICROEJ_ASYNC_WORKER_WAITING_LIST_FULL_RETRY_DELAY, (SNI_callback) sni_retry_callback, NULL);
+	}
+}
 
-		if(new_free_waiting_thread_offset == async_worker->waiting_thread_offset){
-			// The waiting list is full.
-			SNI_throwNativeIOException(-1, "MICROEJ_ASYNC_WORKER: thread cannot be suspended, waiting list is full.");
+MICROEJ_ASYNC_WORKER_job_t* MICROEJ_ASYNC_WORKER_allocate_batch(MICROEJ_ASYNC_WORKER_handle_t* async_worker, int32_t job_count, SNI_callback sni_retry_callback){
+	if(job_count <= 0 || job_count > async_worker->job_count){
+		SNI_throwNativeIOException(-1, "MICROEJ_ASYNC_WORKER: invalid batch size.");
+		return NULL;
+	}
+
+	// Pop the jobs one by one, linked in the reverse order
+	MICROEJ_ASYNC_WORKER_job_t* batch = NULL;
+	int32_t allocated_jobs = 0;
+	while(allocated_jobs < job_count){
+		MICROEJ_ASYNC_WORKER_job_t* job = MICROEJ_ASYNC_WORKER_pop_free_job(async_worker);
+		if(job == NULL){
+			break;
+		}
+		job->_intern.next_batch_job = batch;
+		batch = job;
+		allocated_jobs++;
+	}
+
+	if(allocated_jobs < job_count){
+		// Not enough free jobs: give back the allocated ones (this may resume waiting threads)
+		while(batch != NULL){
+			MICROEJ_ASYNC_WORKER_job_t* next_job = batch->_intern.next_batch_job;
+			MICROEJ_ASYNC_WORKER_free_job(async_worker, batch);
+			batch = next_job;
+		}
+
+		if(allocated_jobs == 0){
+			MICROEJ_ASYNC_WORKER_wait_free_job(async_worker, sni_retry_callback);
 		}
 		else {
-			async_worker->free_waiting_thread_offset = (uint16_t)new_free_waiting_thread_offset;
-			int32_t thread_id = SNI_getCurrentJavaThreadID();
-			async_worker->waiting_threads[free_waiting_thread_offset] = thread_id;
-			SNI_suspendCurrentJavaThreadWithCallback(0, (SNI_callback) sni_retry_callback, NULL);
+			// Some jobs are free but not enough: being resumed as soon as one more job is freed would not guarantee
+			// that the batch can be allocated, retry later.
+			OSAL_mutex_take(&async_worker->mutex, OSAL_INFINITE_TIME);
+			{
+				async_worker->stats.job_waits++;
+			}
+			OSAL_mutex_give(&async_worker->mutex);
+			SNI_suspendCurrentJavaThreadWithCallback(MICROEJ_ASYNC_WORKER_WAITING_LIST_FULL_RETRY_DELAY, (SNI_callback) sni_retry_callback, NULL);
 		}
+		return NULL;
 	}
 
-	return job;
+	MICROEJ_ASYNC_WORKER_priority_t priority = MICROEJ_ASYNC_WORKER_get_current_thread_priority();
+	for(MICROEJ_ASYNC_WORKER_job_t* job = batch ; job != NULL ; job = job->_intern.next_batch_job){
+		job->_intern.batch = batch;
+		job->_intern.priority = priority;
+	}
+	return batch;
+}
+
+MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_set_job_priority(MICROEJ_ASYNC_WORKER_job_t* job, MICROEJ_ASYNC_WORKER_priority_t priority){
+	if((int32_t)priority < 0 || (int32_t)priority >= MICROEJ_ASYNC_WORKER_PRIORITY_LEVELS){
+		return MICROEJ_ASYNC_WORKER_INVALID_ARGS;
+	}
+	job->_intern.priority = priority;
+	return MICROEJ_ASYNC_WORKER_OK;
+}
+
+static MICROEJ_ASYNC_WORKER_priority_t MICROEJ_ASYNC_WORKER_get_current_thread_priority(void){
+	MICROEJ_ASYNC_WORKER_priority_t priority = MICROEJ_ASYNC_WORKER_PRIORITY_NORMAL;
+	MJVM_MONITOR_thread_info_t thread_info;
+	if(MJVM_MONITOR_get_thread_info(SNI_getCurrentJavaThreadID(), &thread_info, NULL, 0) == MJVM_MONITOR_OK){
+		if(thread_info.priority < MICROEJ_ASYNC_WORKER_JAVA_NORM_PRIORITY){
+			priority = MICROEJ_ASYNC_WORKER_PRIORITY_LOW;
+		}
+		else if(thread_info.priority > MICROEJ_ASYNC_WORKER_JAVA_NORM_PRIORITY){
+			priority = MICROEJ_ASYNC_WORKER_PRIORITY_HIGH;
+		}
+	}
+	return priority;
+}
+
+MICROEJ_ASYNC_WORKER_job_t* MICROEJ_ASYNC_WORKER_get_next_batch_job(MICROEJ_ASYNC_WORKER_job_t* job){
+	return job->_intern.next_batch_job;
+}
+
+MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_free_batch(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_job_t* batch){
+	while(batch != NULL){
+		MICROEJ_ASYNC_WORKER_job_t* next_job = batch->_intern.next_batch_job;
+		MICROEJ_ASYNC_WORKER_free_job(async_worker, batch);
+		batch = next_job;
+	}
+	return MICROEJ_ASYNC_WORKER_OK;
 }
 
 
 MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_free_job(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_job_t* job) {
+	MICROEJ_ASYNC_WORKER_push_free_job(async_worker, job);
+
+	// Sequentially consistent with the check done by MICROEJ_ASYNC_WORKER_allocate_job() after queuing a thread:
+	// either this function sees the waiting thread or the waiting thread sees this job.
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if(__atomic_load_n(&async_worker->waiting_thread_count, __ATOMIC_RELAXED) != 0){
+		// A thread was waiting for a free job: notify it
+		MICROEJ_ASYNC_WORKER_resume_waiting_thread(async_worker);
+	}
+
+	return MICROEJ_ASYNC_WORKER_OK;
+}
+
+static MICROEJ_ASYNC_WORKER_job_t* MICROEJ_ASYNC_WORKER_pop_free_job(MICROEJ_ASYNC_WORKER_handle_t* async_worker){
+	uint32_t free_jobs = __atomic_load_n(&async_worker->free_jobs, __ATOMIC_ACQUIRE);
+	while(1){
+		uint32_t index = free_jobs & MICROEJ_ASYNC_WORKER_FREE_JOBS_INDEX_MASK;
+		if(index == 0){
+			return NULL;
+		}
+		MICROEJ_ASYNC_WORKER_job_t* job = &async_worker->jobs[index-1];
+		// The job may be popped by another task meanwhile: then its next job is not relevant but the tag has changed.
+		uint32_t next_free_job = __atomic_load_n(&job->_intern.next_free_job, __ATOMIC_RELAXED);
+		uint32_t new_free_jobs = ((free_jobs & ~MICROEJ_ASYNC_WORKER_FREE_JOBS_INDEX_MASK) + MICROEJ_ASYNC_WORKER_FREE_JOBS_TAG_ONE) | next_free_job;
+		if(__atomic_compare_exchange_n(&async_worker->free_jobs, &free_jobs, new_free_jobs, true, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)){
+			return job;
+		}
+		// else: free_jobs has been updated with the current value, retry
+	}
+}
+
+static void MICROEJ_ASYNC_WORKER_push_free_job(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_job_t* job){
+	uint32_t index = (uint32_t)(job - async_worker->jobs) + 1;
+	uint32_t free_jobs = __atomic_load_n(&async_worker->free_jobs, __ATOMIC_RELAXED);
+	uint32_t new_free_jobs;
+	do {
+		__atomic_store_n(&job->_intern.next_free_job, free_jobs & MICROEJ_ASYNC_WORKER_FREE_JOBS_INDEX_MASK, __ATOMIC_RELAXED);
+		new_free_jobs = ((free_jobs & ~MICROEJ_ASYNC_WORKER_FREE_JOBS_INDEX_MASK) + MICROEJ_ASYNC_WORKER_FREE_JOBS_TAG_ONE) | index;
+	} while(!__atomic_compare_exchange_n(&async_worker->free_jobs, &free_jobs, new_free_jobs, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+static void MICROEJ_ASYNC_WORKER_resume_waiting_thread(MICROEJ_ASYNC_WORKER_handle_t* async_worker){
 	OSAL_mutex_take(&async_worker->mutex, OSAL_INFINITE_TIME);
 	{
-		job->_intern.next_free_job = async_worker->free_jobs;
-		async_worker->free_jobs = job;
-
-		int32_t waiting_thread_offset = async_worker->waiting_thread_offset;
-		if(waiting_thread_offset != async_worker->free_waiting_thread_offset){
-			// A thread was waiting for a free job: notify it
+		if(async_worker->waiting_thread_count != 0){
+			int32_t waiting_thread_offset = async_worker->waiting_thread_offset;
 			int32_t thread_id = async_worker->waiting_threads[waiting_thread_offset];
 			int32_t new_waiting_thread_offset = waiting_thread_offset + 1;
 			if(new_waiting_thread_offset >= async_worker->waiting_threads_length){
 				new_waiting_thread_offset = 0;
 			}
-			async_worker->waiting_thread_offset = new_waiting_thread_offset;
+			async_worker->waiting_thread_offset = (uint16_t)new_waiting_thread_offset;
+			(void)__atomic_sub_fetch(&async_worker->waiting_thread_count, 1, __ATOMIC_RELAXED);
 			SNI_resumeJavaThread(thread_id);
 		}
 	}
 	OSAL_mutex_give(&async_worker->mutex);
-
-	return MICROEJ_ASYNC_WORKER_OK;
 }
 
 MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_async_exec(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_job_t* job, MICROEJ_ASYNC_WORKER_action_t action, SNI_callback on_done_callback){
@@ -154,7 +367,7 @@ MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_async_exec_intern(MICROEJ_ASY
 		job->_intern.thread_id = SNI_ERROR;
 	}
 
-	OSAL_status_t res = OSAL_queue_post(&async_worker->jobs_queue, job);
+	OSAL_status_t res = MICROEJ_ASYNC_WORKER_queue_job(async_worker, job);
 	if(res == OSAL_OK){
 		if(wait == true){
 			SNI_suspendCurrentJavaThreadWithCallback(0, (SNI_callback)on_done_callback, job);
@@ -168,23 +381,273 @@ MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_async_exec_intern(MICROEJ_ASY
 }
 
 
+MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_async_exec_batch(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_job_t* batch, MICROEJ_ASYNC_WORKER_action_t action, SNI_callback on_done_callback){
+	uint32_t job_count = 0;
+	for(MICROEJ_ASYNC_WORKER_job_t* job = batch ; job != NULL ; job = job->_intern.next_batch_job){
+		job->_intern.action = action;
+		job->_intern.thread_id = SNI_ERROR;
+		job_count++;
+	}
+	batch->_intern.thread_id = SNI_getCurrentJavaThreadID();
+	batch->_intern.batch_pending_jobs = job_count;
+
+	// The queues can hold all the jobs of the worker: posting fails only on an OS error.
+	uint32_t posted_jobs = 0;
+	for(MICROEJ_ASYNC_WORKER_job_t* job = batch ; job != NULL ; job = job->_intern.next_batch_job){
+		if(MICROEJ_ASYNC_WORKER_queue_job(async_worker, job) != OSAL_OK){
+			break;
+		}
+		posted_jobs++;
+	}
+
+	if(posted_jobs == job_count){
+		SNI_suspendCurrentJavaThreadWithCallback(0, (SNI_callback)on_done_callback, batch);
+		return MICROEJ_ASYNC_WORKER_OK;
+	}
+	else {
+		// The jobs already posted are executed: the last one to finish frees the batch.
+		batch->_intern.thread_id = SNI_ERROR;
+		if(__atomic_sub_fetch(&batch->_intern.batch_pending_jobs, job_count - posted_jobs, __ATOMIC_ACQ_REL) == 0){
+			MICROEJ_ASYNC_WORKER_free_batch(async_worker, batch);
+		}
+		SNI_throwNativeIOException(-1, "MICROEJ_ASYNC_WORKER: Internal error.");
+		return MICROEJ_ASYNC_WORKER_ERROR;
+	}
+}
+
+static OSAL_status_t MICROEJ_ASYNC_WORKER_queue_job(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_job_t* job){
+	job->_intern.queued_time = MICROEJ_ASYNC_WORKER_get_time_us();
+	job->_intern.next_queued_job = NULL;
+
+	OSAL_status_t res;
+	OSAL_mutex_take(&async_worker->mutex, OSAL_INFINITE_TIME);
+	{
+		int32_t priority = (int32_t)job->_intern.priority;
+		MICROEJ_ASYNC_WORKER_job_t* last_queued_job = async_worker->last_queued_jobs[priority];
+		if(last_queued_job == NULL){
+			async_worker->queued_jobs[priority] = job;
+		}
+		else {
+			last_queued_job->_intern.next_queued_job = job;
+		}
+		async_worker->last_queued_jobs[priority] = job;
+
+		res = OSAL_counter_semaphore_give(&async_worker->jobs_semaphore);
+		if(res != OSAL_OK){
+			// Not signaled: remove the job from the queue
+			if(last_queued_job == NULL){
+				async_worker->queued_jobs[priority] = NULL;
+			}
+			else {
+				last_queued_job->_intern.next_queued_job = NULL;
+			}
+			async_worker->last_queued_jobs[priority] = last_queued_job;
+		}
+		else {
+			async_worker->queued_job_count++;
+			if(async_worker->queued_job_count > async_worker->stats.max_queued_jobs){
+				async_worker->stats.max_queued_jobs = async_worker->queued_job_count;
+			}
+		}
+	}
+	OSAL_mutex_give(&async_worker->mutex);
+
+	return res;
+}
+
+static MICROEJ_ASYNC_WORKER_job_t* MICROEJ_ASYNC_WORKER_dequeue_job(MICROEJ_ASYNC_WORKER_handle_t* async_worker){
+	MICROEJ_ASYNC_WORKER_job_t* job = NULL;
+	int64_t now = MICROEJ_ASYNC_WORKER_get_time_us();
+
+	OSAL_mutex_take(&async_worker->mutex, OSAL_INFINITE_TIME);
+	{
+		// The first job of each queue is the oldest one of its priority. Its effective priority is its priority
+		// plus one level per aging period spent in the queue: pick the highest one, the oldest one on equality.
+		int32_t job_priority = 0;
+		int64_t job_effective_priority = -1;
+		for(int32_t priority=0 ; priority<MICROEJ_ASYNC_WORKER_PRIORITY_LEVELS ; priority++){
+			MICROEJ_ASYNC_WORKER_job_t* queued_job = async_worker->queued_jobs[priority];
+			if(queued_job != NULL){
+				int64_t effective_priority = priority + ((now - queued_job->_intern.queued_time) / (MICROEJ_ASYNC_WORKER_AGING_PERIOD * 1000));
+				if(effective_priority > job_effective_priority
+				|| (effective_priority == job_effective_priority && queued_job->_intern.queued_time < job->_intern.queued_time)
+				){
+					job = queued_job;
+					job_priority = priority;
+					job_effective_priority = effective_priority;
+				}
+			}
+		}
+
+		if(job != NULL){
+			async_worker->queued_jobs[job_priority] = job->_intern.next_queued_job;
+			if(job->_intern.next_queued_job == NULL){
+				async_worker->last_queued_jobs[job_priority] = NULL;
+			}
+			async_worker->queued_job_count--;
+		}
+	}
+	OSAL_mutex_give(&async_worker->mutex);
+
+	return job;
+}
+
+static void MICROEJ_ASYNC_WORKER_batch_job_done(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_job_t* job){
+	MICROEJ_ASYNC_WORKER_job_t* batch = job->_intern.batch;
+	if(__atomic_sub_fetch(&batch->_intern.batch_pending_jobs, 1, __ATOMIC_ACQ_REL) == 0){
+		// Last job of the batch
+		if(batch->_intern.thread_id != SNI_ERROR){
+			SNI_resumeJavaThread(batch->_intern.thread_id);
+		}
+		else {
+			MICROEJ_ASYNC_WORKER_free_batch(async_worker, batch);
+		}
+	}
+}
+
 MICROEJ_ASYNC_WORKER_job_t* MICROEJ_ASYNC_WORKER_get_job_done(void){
 	MICROEJ_ASYNC_WORKER_job_t* job = NULL;
 	SNI_getCallbackArgs((void**)&job, NULL);
 	return job;
 }
 
+int32_t MICROEJ_ASYNC_WORKER_get_task_count(MICROEJ_ASYNC_WORKER_handle_t* async_worker){
+	return async_worker->task_count;
+}
+
+MICROEJ_ASYNC_WORKER_status_t MICROEJ_ASYNC_WORKER_get_task_stats(MICROEJ_ASYNC_WORKER_handle_t* async_worker, int32_t task_index, MICROEJ_ASYNC_WORKER_task_stats_t* stats){
+	if(task_index < 0 || task_index >= async_worker->task_count){
+		return MICROEJ_ASYNC_WORKER_INVALID_ARGS;
+	}
+
+	OSAL_mutex_take(&async_worker->mutex, OSAL_INFINITE_TIME);
+	{
+		*stats = async_worker->tasks[task_index].stats;
+	}
+	OSAL_mutex_give(&async_worker->mutex);
+
+	return MICROEJ_ASYNC_WORKER_OK;
+}
+
+void MICROEJ_ASYNC_WORKER_get_stats(MICROEJ_ASYNC_WORKER_handle_t* async_worker, MICROEJ_ASYNC_WORKER_stats_t* stats){
+	OSAL_mutex_take(&async_worker->mutex, OSAL_INFINITE_TIME);
+	{
+		*stats = async_worker->stats;
+	}
+	OSAL_mutex_give(&async_worker->mutex);
+}
+
+void MICROEJ_ASYNC_WORKER_reset_stats(MICROEJ_ASYNC_WORKER_handle_t* async_worker){
+	OSAL_mutex_take(&async_worker->mutex, OSAL_INFINITE_TIME);
+	{
+		(void)memset(&async_worker->stats, 0, sizeof(async_worker->stats));
+		async_worker->stats.max_queued_jobs = async_worker->queued_job_count;
+		async_worker->stats.max_waiting_threads = async_worker->waiting_thread_count;
+	}
+	OSAL_mutex_give(&async_worker->mutex);
+}
+
+void MICROEJ_ASYNC_WORKER_dump_stats(MICROEJ_ASYNC_WORKER_handle_t* async_worker){
+	MICROEJ_ASYNC_WORKER_stats_t stats;
+	MICROEJ_ASYNC_WORKER_get_stats(async_worker, &stats);
+
+	const char* name = (const char*)async_worker->name;
+	printf("MICROEJ_ASYNC_WORKER: %s: %u jobs, max wait %u us, max service %u us, max queued jobs %u/%d, max waiting threads %u/%d, %u job waits, %u waiting list full\n",
+			name, (unsigned int)stats.executed_jobs, (unsigned int)stats.max_wait_time_us, (unsigned int)stats.max_service_time_us,
+			(unsigned int)stats.max_queued_jobs, (int)async_worker->job_count, (unsigned int)stats.max_waiting_threads, (int)async_worker->waiting_threads_length,
+			(unsigned int)stats.job_waits, (unsigned int)stats.waiting_list_full);
+	printf("MICROEJ_ASYNC_WORKER: %s: wait histogram (class 0 < %u us, x2 per class)", name, 1u << MICROEJ_ASYNC_WORKER_HISTOGRAM_SHIFT);
+	for(int i=0 ; i<MICROEJ_ASYNC_WORKER_HISTOGRAM_SIZE ; i++){
+		printf(" %u", (unsigned int)stats.wait_histogram[i]);
+	}
+	printf("\n");
+	printf("MICROEJ_ASYNC_WORKER: %s: service histogram (class 0 < %u us, x2 per class)", name, 1u << MICROEJ_ASYNC_WORKER_HISTOGRAM_SHIFT);
+	for(int i=0 ; i<MICROEJ_ASYNC_WORKER_HISTOGRAM_SIZE ; i++){
+		printf(" %u", (unsigned int)stats.service_histogram[i]);
+	}
+	printf("\n");
+}
+
+void MICROEJ_ASYNC_WORKER_dump_all_stats(void){
+	MICROEJ_ASYNC_WORKER_handle_t* async_worker = __atomic_load_n(&MICROEJ_ASYNC_WORKER_workers, __ATOMIC_ACQUIRE);
+	while(async_worker != NULL){
+		MICROEJ_ASYNC_WORKER_dump_stats(async_worker);
+		async_worker = async_worker->next_worker;
+	}
+}
+
+static uint32_t MICROEJ_ASYNC_WORKER_histogram_class(uint32_t time_us){
+	uint32_t histogram_class = 0;
+	if((time_us >> MICROEJ_ASYNC_WORKER_HISTOGRAM_SHIFT) != 0){
+		// class of the highest bit set
+		histogram_class = (31 - __builtin_clz(time_us)) - MICROEJ_ASYNC_WORKER_HISTOGRAM_SHIFT + 1;
+		if(histogram_class >= MICROEJ_ASYNC_WORKER_HISTOGRAM_SIZE){
+			histogram_class = MICROEJ_ASYNC_WORKER_HISTOGRAM_SIZE - 1;
+		}
+	}
+	return histogram_class;
+}
+
+void javaAsyncWorkerStatsReset(void){
+	MICROEJ_ASYNC_WORKER_handle_t* async_worker = __atomic_load_n(&MICROEJ_ASYNC_WORKER_workers, __ATOMIC_ACQUIRE);
+	while(async_worker != NULL){
+		MICROEJ_ASYNC_WORKER_reset_stats(async_worker);
+		async_worker = async_worker->next_worker;
+	}
+}
+
+/*
+ * @brief Prints the statistics of all the initialized workers (see MICROEJ_ASYNC_WORKER_dump_stats) and clears them.
+ */
+void javaAsyncWorkerStatsDump(void){
+	MICROEJ_ASYNC_WORKER_dump_all_stats();
+	javaAsyncWorkerStatsReset();
+}
+
 static void MICROEJ_ASYNC_WORKER_loop(void* args){
-	MICROEJ_ASYNC_WORKER_handle_t* async_worker = (MICROEJ_ASYNC_WORKER_handle_t*) args;
+	MICROEJ_ASYNC_WORKER_task_t* task = (MICROEJ_ASYNC_WORKER_task_t*) args;
+	MICROEJ_ASYNC_WORKER_handle_t* async_worker = task->async_worker;
 
 	while(1){
-		MICROEJ_ASYNC_WORKER_job_t* job;
-		OSAL_status_t res = OSAL_queue_fetch(&async_worker->jobs_queue, (void**)&job, OSAL_INFINITE_TIME);
-
+		MICROEJ_ASYNC_WORKER_job_t* job = NULL;
+		OSAL_status_t res = OSAL_counter_semaphore_take(&async_worker->jobs_semaphore, OSAL_INFINITE_TIME);
 		if(res == OSAL_OK){
+			job = MICROEJ_ASYNC_WORKER_dequeue_job(async_worker);
+		}
+
+		if(job != NULL){
 			// New job to execute
+			int64_t start_time = MICROEJ_ASYNC_WORKER_get_time_us();
+			int64_t wait_time = start_time - job->_intern.queued_time;
+			uint32_t job_wait_time = (wait_time > (int64_t)UINT32_MAX) ? UINT32_MAX : (uint32_t)wait_time;
 			job->_intern.action(job);
-			if(job->_intern.thread_id != SNI_ERROR){
+			uint32_t job_time = (uint32_t)(MICROEJ_ASYNC_WORKER_get_time_us() - start_time);
+
+			OSAL_mutex_take(&async_worker->mutex, OSAL_INFINITE_TIME);
+			{
+				task->stats.executed_jobs++;
+				task->stats.busy_time_us += job_time;
+				if(job_time > task->stats.max_job_time_us){
+					task->stats.max_job_time_us = job_time;
+				}
+
+				MICROEJ_ASYNC_WORKER_stats_t* stats = &async_worker->stats;
+				stats->executed_jobs++;
+				stats->wait_histogram[MICROEJ_ASYNC_WORKER_histogram_class(job_wait_time)]++;
+				stats->service_histogram[MICROEJ_ASYNC_WORKER_histogram_class(job_time)]++;
+				if(job_wait_time > stats->max_wait_time_us){
+					stats->max_wait_time_us = job_wait_time;
+				}
+				if(job_time > stats->max_service_time_us){
+					stats->max_service_time_us = job_time;
+				}
+			}
+			OSAL_mutex_give(&async_worker->mutex);
+
+			if(job->_intern.batch != NULL){
+				MICROEJ_ASYNC_WORKER_batch_job_done(async_worker, job);
+			}
+			else if(job->_intern.thread_id != SNI_ERROR){
 				SNI_resumeJavaThread(job->_intern.thread_id);
 			}
 			else {
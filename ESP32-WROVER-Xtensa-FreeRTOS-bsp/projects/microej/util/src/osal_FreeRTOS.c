@@ -358,6 +358,7 @@ OSAL_status_t OSAL_binary_semaphore_take(OSAL_binary_semaphore_handle_t* handle,
 /**
  * @brief Give operation on OS binary semaphore. Increase the binary semaphore count value by 1 and unblock the current task if count value.
  * equals to 0.
+ * This method may be called from an interrupt.
  *
  * @param[in] handle pointer on the binary semaphore handle
  *
@@ -370,6 +371,23 @@ OSAL_status_t OSAL_binary_semaphore_give(OSAL_binary_semaphore_handle_t* handle)
         return OSAL_WRONG_ARGS;
     }
 
+    if (xPortInIsrContext())
+    {
+        BaseType_t higher_priority_task_woken = pdFALSE;
+
+        if (xSemaphoreGiveFromISR(*handle, &higher_priority_task_woken) != pdTRUE)
+        {
+            return OSAL_ERROR;
+        }
+
+        if (higher_priority_task_woken != pdFALSE)
+        {
+            portYIELD_FROM_ISR();
+        }
+
+        return OSAL_OK;
+    }
+
     if (xSemaphoreGive(*handle) != pdTRUE)
     {
         return OSAL_ERROR;
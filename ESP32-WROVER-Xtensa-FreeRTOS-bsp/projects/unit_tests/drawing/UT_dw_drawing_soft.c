@@ -0,0 +1,220 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * On-target comparison of the thick faded shapes kernels (dw_drawing_rgb565.c) with the software
+ * algorithms of the Graphics Engine (dw_drawing_soft.h, microejruntime.a).
+ *
+ * Two graphics contexts of the same size are cleared to black; each shape is drawn in white by
+ * the kernel (DW_DRAWING_drawThickFaded*()) on the first one and by the software algorithm
+ * (DW_DRAWING_SOFT_drawThickFaded*()) on the second one, across thicknesses, fades, caps and
+ * clips, small shapes and shapes larger than the former limits of the kernels. On black, each
+ * channel of a pixel gives the alpha of the shape: the channels of the two drawings, expanded to
+ * 8 bits, must not differ by more than FADED_ALPHA_TOLERANCE (the alpha of a distance error of
+ * 1/10 pixel on the shortest fade ramp, one pixel). The largest difference is reported.
+ *
+ * The images buffers are allocated in a local images heap (LLUI_DISPLAY_HEAP_impl.c).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <embUnit/embUnit.h>
+#include "LLUI_DISPLAY.h"
+#include "LLUI_DISPLAY_impl.h"
+#include "dw_drawing.h"
+#include "dw_drawing_soft.h"
+#include "ui_rgb565.h"
+
+/* Graphics contexts: odd sizes */
+#define GC_WIDTH 61
+#define GC_HEIGHT 47
+
+/* Largest difference of a channel (expanded to 8 bits) between the kernel and the software algorithm */
+#define FADED_ALPHA_TOLERANCE 26
+
+/* Images heap of the test: two graphics contexts, with the blocks headers */
+#define HEAP_SIZE ((2 * GC_WIDTH * GC_HEIGHT * 2) + 1024)
+
+typedef struct {
+    jshort x1;
+    jshort y1;
+    jshort x2;
+    jshort y2;
+} clip_t;
+
+/* whole graphics context, inner clip */
+static const clip_t clips[] = { { 0, 0, GC_WIDTH - 1, GC_HEIGHT - 1 }, { 7, 5, 50, 38 } };
+
+static uint8_t heap[HEAP_SIZE] __attribute__((aligned(8)));
+
+static MICROUI_GraphicsContext kernel_gc;
+static MICROUI_GraphicsContext soft_gc;
+
+/* largest difference of a channel over the fixture */
+static uint32_t largest_difference;
+
+static void allocate_gc_f(MICROUI_GraphicsContext* gc)
+{
+    memset(gc, 0, sizeof(MICROUI_GraphicsContext));
+    gc->image.width = GC_WIDTH;
+    gc->image.height = GC_HEIGHT;
+    gc->image.format = MICROUI_IMAGE_FORMAT_RGB565;
+    TEST_ASSERT(LLUI_DISPLAY_allocateImageBuffer(&gc->image, 4));
+    gc->foreground_color = 0xffffff;
+}
+
+static void reset_gc_f(MICROUI_GraphicsContext* gc, const clip_t* clip)
+{
+    memset(LLUI_DISPLAY_getBufferAddress(&gc->image), 0, LLUI_DISPLAY_getStrideInBytes(&gc->image) * GC_HEIGHT);
+    gc->clip_x1 = clip->x1;
+    gc->clip_y1 = clip->y1;
+    gc->clip_x2 = clip->x2;
+    gc->clip_y2 = clip->y2;
+    LLUI_DISPLAY_configureClip(gc, true);
+}
+
+static void reset_gcs_f(const clip_t* clip)
+{
+    reset_gc_f(&kernel_gc, clip);
+    reset_gc_f(&soft_gc, clip);
+}
+
+/*
+ * Compares the drawings of the kernel and of the software algorithm, channel by channel.
+ */
+static void assert_similar_gcs_f(void)
+{
+    uint32_t stride = LLUI_DISPLAY_getStrideInPixels(&kernel_gc.image);
+    uint16_t* kernel_pixels = (uint16_t*)LLUI_DISPLAY_getBufferAddress(&kernel_gc.image);
+    uint16_t* soft_pixels = (uint16_t*)LLUI_DISPLAY_getBufferAddress(&soft_gc.image);
+    uint32_t errors = 0;
+
+    for (uint32_t y = 0; y < GC_HEIGHT; y++)
+    {
+        for (uint32_t x = 0; x < GC_WIDTH; x++)
+        {
+            uint32_t kernel_color = UI_RGB565_to_rgb888(kernel_pixels[(y * stride) + x]);
+            uint32_t soft_color = UI_RGB565_to_rgb888(soft_pixels[(y * stride) + x]);
+
+            for (uint32_t shift = 0; shift < 24; shift += 8)
+            {
+                int32_t difference = (int32_t)((kernel_color >> shift) & 0xff) - (int32_t)((soft_color >> shift) & 0xff);
+                uint32_t absolute = (uint32_t)((difference < 0) ? -difference : difference);
+                largest_difference = (absolute > largest_difference) ? absolute : largest_difference;
+                errors += (absolute > FADED_ALPHA_TOLERANCE) ? 1 : 0;
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(0, errors);
+}
+
+static void report_f(const char* shape)
+{
+    printf("DW_DRAWING_SOFT: faded %s, largest difference with the software algorithm %u / 255\n", shape, (unsigned int)largest_difference);
+}
+
+static void setUp(void)
+{
+    largest_difference = 0;
+    LLUI_DISPLAY_IMPL_image_heap_initialize(heap, heap + HEAP_SIZE);
+    allocate_gc_f(&kernel_gc);
+    allocate_gc_f(&soft_gc);
+}
+
+static void tearDown(void)
+{
+    LLUI_DISPLAY_freeImageBuffer(&soft_gc.image);
+    LLUI_DISPLAY_freeImageBuffer(&kernel_gc.image);
+}
+
+static void dw_drawing_soft_faded_line_f(void)
+{
+    /* start x, start y, end x, end y, thickness, fade: in the graphics context, then larger than 256 + 128 */
+    static const jint lines[][6] = {
+        { 10, 20, 50, 20, 1, 0 }, { 30, 5, 30, 40, 3, 1 }, { 8, 6, 52, 40, 12, 6 }, { 50, 40, 12, 9, 5, 2 }, { -10, 30, 70, 18, 2, 10 },
+        { -200, -100, -200, 200, 300, 150 }, { -700, 23, -650, 23, 1200, 200 },
+    };
+
+    for (uint32_t c = 0; c < (sizeof(clips) / sizeof(clips[0])); c++)
+    {
+        for (uint32_t l = 0; l < (sizeof(lines) / sizeof(lines[0])); l++)
+        {
+            for (uint32_t caps = 0; caps < 9; caps++)
+            {
+                reset_gcs_f(&clips[c]);
+                DW_DRAWING_drawThickFadedLine(&kernel_gc, lines[l][0], lines[l][1], lines[l][2], lines[l][3], lines[l][4], lines[l][5], (DRAWING_Cap)(caps % 3), (DRAWING_Cap)(caps / 3));
+                DW_DRAWING_SOFT_drawThickFadedLine(&soft_gc, lines[l][0], lines[l][1], lines[l][2], lines[l][3], lines[l][4], lines[l][5], (DRAWING_Cap)(caps % 3), (DRAWING_Cap)(caps / 3));
+                assert_similar_gcs_f();
+            }
+        }
+    }
+    report_f("lines");
+}
+
+static void dw_drawing_soft_faded_circle_f(void)
+{
+    /* x, y, diameter, thickness, fade: in the graphics context, thicker than the diameter, then larger than 512, 256 and 128 */
+    static const jint circles[][5] = {
+        { 20, 10, 25, 1, 0 }, { 5, 5, 1, 4, 2 }, { 30, 20, 2, 3, 1 }, { -15, -10, 60, 13, 7 }, { 40, 30, 9, 40, 2 },
+        { -570, -277, 600, 3, 4 }, { -170, 3, 40, 300, 150 }, { -970, -477, 1000, 20, 10 },
+    };
+
+    for (uint32_t c = 0; c < (sizeof(clips) / sizeof(clips[0])); c++)
+    {
+        for (uint32_t i = 0; i < (sizeof(circles) / sizeof(circles[0])); i++)
+        {
+            reset_gcs_f(&clips[c]);
+            DW_DRAWING_drawThickFadedCircle(&kernel_gc, circles[i][0], circles[i][1], circles[i][2], circles[i][3], circles[i][4]);
+            DW_DRAWING_SOFT_drawThickFadedCircle(&soft_gc, circles[i][0], circles[i][1], circles[i][2], circles[i][3], circles[i][4]);
+            assert_similar_gcs_f();
+        }
+    }
+    report_f("circles");
+}
+
+static void dw_drawing_soft_faded_arc_f(void)
+{
+    /* x, y, diameter, thickness, fade */
+    static const jint circles[][5] = { { 14, 6, 33, 3, 0 }, { 40, 30, 12, 10, 3 }, { -970, -477, 1000, 20, 10 } };
+    static const jfloat starts[] = { 0.0f, 30.0f, 200.0f, -45.0f };
+    /* narrow, half, wide, clockwise, almost a circle */
+    static const jfloat arcs[] = { 45.0f, 90.0f, 180.0f, 270.0f, -120.0f, 359.0f };
+
+    for (uint32_t i = 0; i < (sizeof(circles) / sizeof(circles[0])); i++)
+    {
+        for (uint32_t s = 0; s < (sizeof(starts) / sizeof(starts[0])); s++)
+        {
+            for (uint32_t a = 0; a < (sizeof(arcs) / sizeof(arcs[0])); a++)
+            {
+                for (uint32_t caps = 0; caps < 9; caps++)
+                {
+                    reset_gcs_f(&clips[(s + a) % 2]);
+                    DW_DRAWING_drawThickFadedCircleArc(&kernel_gc, circles[i][0], circles[i][1], circles[i][2], starts[s], arcs[a], circles[i][3], circles[i][4],
+                            (DRAWING_Cap)(caps % 3), (DRAWING_Cap)(caps / 3));
+                    DW_DRAWING_SOFT_drawThickFadedCircleArc(&soft_gc, circles[i][0], circles[i][1], circles[i][2], starts[s], arcs[a], circles[i][3], circles[i][4],
+                            (DRAWING_Cap)(caps % 3), (DRAWING_Cap)(caps / 3));
+                    assert_similar_gcs_f();
+                }
+            }
+        }
+    }
+    report_f("arcs");
+}
+
+TestRef dw_drawing_soft_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture("dw_drawing_soft_faded_line_f", dw_drawing_soft_faded_line_f),
+        new_TestFixture("dw_drawing_soft_faded_circle_f", dw_drawing_soft_faded_circle_f),
+        new_TestFixture("dw_drawing_soft_faded_arc_f", dw_drawing_soft_faded_arc_f),
+    };
+
+    EMB_UNIT_TESTCALLER(dwDrawingSoftTest, "dwDrawingSoftTest", setUp, tearDown, fixtures);
+
+    return (TestRef)&dwDrawingSoftTest;
+}
@@ -0,0 +1,242 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * On-target comparison of the RGB565 images drawing (ui_drawing_rgb565.c) with the software
+ * algorithms of the Graphics Engine (ui_drawing_soft.h, microejruntime.a).
+ *
+ * Two graphics contexts of the same size are filled with the same random pattern; each drawing
+ * is done by the kernel (UI_DRAWING_drawImage()) on the first one and by the software algorithm
+ * (UI_DRAWING_SOFT_drawImage()) on the second one, from the same source image or from the
+ * graphics context itself (overlapping regions). The whole buffers must be equal: the kernels
+ * are bit-exact. The blending of the kernels is also compared with LLUI_DISPLAY_blend() for
+ * every global alpha and every RGB565 background pixel.
+ *
+ * The images buffers are allocated in a local images heap (LLUI_DISPLAY_HEAP_impl.c).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <embUnit/embUnit.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "LLUI_DISPLAY.h"
+#include "LLUI_DISPLAY_impl.h"
+#include "ui_drawing.h"
+#include "ui_drawing_soft.h"
+#include "ui_rgb565.h"
+
+/* Graphics contexts: an odd width */
+#define GC_WIDTH 37
+#define GC_HEIGHT 23
+
+/* Source images */
+#define IMAGE_WIDTH 45
+#define IMAGE_HEIGHT 29
+
+/* Number of random drawings per source */
+#define DRAWINGS 400
+
+/* Images heap of the test: two graphics contexts and two images, with the blocks headers */
+#define HEAP_SIZE (((2 * GC_WIDTH * GC_HEIGHT * 2) + (IMAGE_WIDTH * IMAGE_HEIGHT * (2 + 4))) + 1024)
+
+/* Foreground colors of the blending check */
+static const uint32_t BLEND_COLORS[] = { 0x000000, 0xffffff, 0x123456, 0xfedcba, 0x80ff01 };
+
+static uint8_t heap[HEAP_SIZE] __attribute__((aligned(8)));
+
+static MICROUI_GraphicsContext kernel_gc;
+static MICROUI_GraphicsContext soft_gc;
+static MICROUI_Image rgb565_image;
+static MICROUI_Image argb8888_image;
+
+static void allocate_image_f(MICROUI_Image* image, MICROUI_ImageFormat format, uint32_t width, uint32_t height)
+{
+    memset(image, 0, sizeof(MICROUI_Image));
+    image->width = (jchar)width;
+    image->height = (jchar)height;
+    image->format = (jbyte)format;
+    TEST_ASSERT(LLUI_DISPLAY_allocateImageBuffer(image, 4));
+}
+
+static void allocate_gc_f(MICROUI_GraphicsContext* gc)
+{
+    memset(gc, 0, sizeof(MICROUI_GraphicsContext));
+    allocate_image_f(&gc->image, MICROUI_IMAGE_FORMAT_RGB565, GC_WIDTH, GC_HEIGHT);
+}
+
+static void fill_random_f(MICROUI_Image* image, uint32_t bytes_per_pixel)
+{
+    uint8_t* buffer = LLUI_DISPLAY_getBufferAddress(image);
+    uint32_t size = LLUI_DISPLAY_getStrideInBytes(image) * image->height;
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        buffer[i] = (uint8_t)rand();
+    }
+
+    if (4 == bytes_per_pixel)
+    {
+        // make sure the transparent and opaque pixels are represented
+        for (uint32_t i = 3; (i + 4) < size; i += 16)
+        {
+            buffer[i] = 0x00;
+            buffer[i + 4] = 0xff;
+        }
+    }
+}
+
+/*
+ * Fills both graphics contexts with the same pattern and sets the same clip.
+ */
+static void reset_gcs_f(void)
+{
+    uint32_t size = LLUI_DISPLAY_getStrideInBytes(&kernel_gc.image) * GC_HEIGHT;
+    jshort x1 = (jshort)(rand() % GC_WIDTH);
+    jshort y1 = (jshort)(rand() % GC_HEIGHT);
+
+    fill_random_f(&kernel_gc.image, 2);
+    memcpy(LLUI_DISPLAY_getBufferAddress(&soft_gc.image), LLUI_DISPLAY_getBufferAddress(&kernel_gc.image), size);
+
+    kernel_gc.clip_x1 = x1;
+    kernel_gc.clip_y1 = y1;
+    kernel_gc.clip_x2 = (jshort)(x1 + (rand() % (GC_WIDTH - x1)));
+    kernel_gc.clip_y2 = (jshort)(y1 + (rand() % (GC_HEIGHT - y1)));
+    if (0 == (rand() % 4))
+    {
+        // full clip
+        kernel_gc.clip_x1 = 0;
+        kernel_gc.clip_y1 = 0;
+        kernel_gc.clip_x2 = GC_WIDTH - 1;
+        kernel_gc.clip_y2 = GC_HEIGHT - 1;
+    }
+    soft_gc.clip_x1 = kernel_gc.clip_x1;
+    soft_gc.clip_y1 = kernel_gc.clip_y1;
+    soft_gc.clip_x2 = kernel_gc.clip_x2;
+    soft_gc.clip_y2 = kernel_gc.clip_y2;
+    LLUI_DISPLAY_configureClip(&kernel_gc, true);
+    LLUI_DISPLAY_configureClip(&soft_gc, true);
+}
+
+static void assert_same_gcs_f(void)
+{
+    uint32_t size = LLUI_DISPLAY_getStrideInBytes(&kernel_gc.image) * GC_HEIGHT;
+    TEST_ASSERT_EQUAL_INT(0, memcmp(LLUI_DISPLAY_getBufferAddress(&kernel_gc.image), LLUI_DISPLAY_getBufferAddress(&soft_gc.image), size));
+}
+
+static jint random_alpha_f(void)
+{
+    switch (rand() % 4)
+    {
+    case 0:
+        return 255;
+    case 1:
+        return 0;
+    default:
+        return (jint)(rand() % 256);
+    }
+}
+
+/*
+ * Draws random regions of the source (or of the graphics context itself when source is NULL),
+ * partially out of the clip or of the graphics context, with random global alphas.
+ */
+static void draw_images_f(MICROUI_Image* source)
+{
+    for (uint32_t i = 0; i < DRAWINGS; i++)
+    {
+        MICROUI_Image* kernel_image = (NULL == source) ? &kernel_gc.image : source;
+        MICROUI_Image* soft_image = (NULL == source) ? &soft_gc.image : source;
+        jint width = 1 + (rand() % kernel_image->width);
+        jint height = 1 + (rand() % kernel_image->height);
+        jint region_x = rand() % (kernel_image->width - width + 1);
+        jint region_y = rand() % (kernel_image->height - height + 1);
+        jint x = (rand() % (GC_WIDTH + 8)) - 4;
+        jint y = (rand() % (GC_HEIGHT + 8)) - 4;
+        jint alpha = random_alpha_f();
+
+        reset_gcs_f();
+        UI_DRAWING_drawImage(&kernel_gc, kernel_image, region_x, region_y, width, height, x, y, alpha);
+        UI_DRAWING_SOFT_drawImage(&soft_gc, soft_image, region_x, region_y, width, height, x, y, alpha);
+        assert_same_gcs_f();
+    }
+}
+
+static void setUp(void)
+{
+    srand(0x565);
+    LLUI_DISPLAY_IMPL_image_heap_initialize(heap, heap + HEAP_SIZE);
+    allocate_gc_f(&kernel_gc);
+    allocate_gc_f(&soft_gc);
+    allocate_image_f(&rgb565_image, MICROUI_IMAGE_FORMAT_RGB565, IMAGE_WIDTH, IMAGE_HEIGHT);
+    allocate_image_f(&argb8888_image, MICROUI_IMAGE_FORMAT_ARGB8888, IMAGE_WIDTH, IMAGE_HEIGHT);
+    fill_random_f(&rgb565_image, 2);
+    fill_random_f(&argb8888_image, 4);
+}
+
+static void tearDown(void)
+{
+    LLUI_DISPLAY_freeImageBuffer(&argb8888_image);
+    LLUI_DISPLAY_freeImageBuffer(&rgb565_image);
+    LLUI_DISPLAY_freeImageBuffer(&soft_gc.image);
+    LLUI_DISPLAY_freeImageBuffer(&kernel_gc.image);
+}
+
+static void ui_drawing_soft_rgb565_image_f(void)
+{
+    draw_images_f(&rgb565_image);
+}
+
+static void ui_drawing_soft_argb8888_image_f(void)
+{
+    draw_images_f(&argb8888_image);
+}
+
+static void ui_drawing_soft_overlap_f(void)
+{
+    draw_images_f(NULL);
+}
+
+static void ui_drawing_soft_blend_f(void)
+{
+    for (uint32_t c = 0; c < (sizeof(BLEND_COLORS) / sizeof(BLEND_COLORS[0])); c++)
+    {
+        uint32_t foreground = BLEND_COLORS[c];
+        uint32_t foreground565 = UI_RGB565_from_rgb888(foreground);
+        uint32_t foreground565_argb = LLUI_DISPLAY_convertDisplayColorToARGBColor(foreground565);
+
+        for (uint32_t alpha = 0; alpha <= 255; alpha++)
+        {
+            for (uint32_t background = 0; background <= 0xffff; background++)
+            {
+                uint32_t background_argb = LLUI_DISPLAY_convertDisplayColorToARGBColor(background);
+                uint32_t expected = LLUI_DISPLAY_convertARGBColorToDisplayColor(LLUI_DISPLAY_blend(0xff000000 | foreground, background_argb, alpha)) & 0xffff;
+                uint32_t expected565 = LLUI_DISPLAY_convertARGBColorToDisplayColor(LLUI_DISPLAY_blend(foreground565_argb, background_argb, alpha)) & 0xffff;
+
+                TEST_ASSERT_EQUAL_INT(expected, UI_RGB565_blend(foreground, background, alpha));
+                TEST_ASSERT_EQUAL_INT(expected565, UI_RGB565_blend_rgb565(foreground565, background, alpha));
+            }
+            // let the idle task feed the watchdog
+            vTaskDelay(1);
+        }
+    }
+}
+
+TestRef ui_drawing_soft_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture("ui_drawing_soft_rgb565_image_f", ui_drawing_soft_rgb565_image_f),
+        new_TestFixture("ui_drawing_soft_argb8888_image_f", ui_drawing_soft_argb8888_image_f),
+        new_TestFixture("ui_drawing_soft_overlap_f", ui_drawing_soft_overlap_f),
+        new_TestFixture("ui_drawing_soft_blend_f", ui_drawing_soft_blend_f),
+    };
+
+    EMB_UNIT_TESTCALLER(uiDrawingSoftTest, "uiDrawingSoftTest", setUp, tearDown, fixtures);
+
+    return (TestRef)&uiDrawingSoftTest;
+}
@@ -0,0 +1,79 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host runner of the unit tests of the BSP modules which do not depend on the hardware.
+ * See the Makefile of this folder.
+ */
+
+#include <stdio.h>
+#include "Outputter.h"
+#include "TextUIRunner.h"
+#include "TextOutputter.h"
+
+/******************************************************
+ *               External Function Declarations
+ ******************************************************/
+extern TestRef display_dirty_regions_tests(void);
+extern TestRef display_endianness_tests(void);
+extern TestRef llui_display_tests(void);
+extern TestRef framerate_tests(void);
+extern TestRef microui_heap_tests(void);
+extern TestRef webp_decode_tests(void);
+extern TestRef ui_drawing_rgb565_tests(void);
+extern TestRef dw_drawing_rgb565_tests(void);
+extern TestRef drawing_trace_tests(void);
+extern TestRef drawing_stats_tests(void);
+extern TestRef microej_async_worker_tests(void);
+
+/******************************************************
+ *                    Main
+ ******************************************************/
+
+int main(void)
+{
+	TextUIRunner_setOutputter(TextOutputter_outputter());
+
+	TextUIRunner_start();
+
+	printf("\r\nPerform display dirty regions tests.\r\n");
+	TextUIRunner_runTest(display_dirty_regions_tests());
+
+	printf("\r\nPerform display endianness tests.\r\n");
+	TextUIRunner_runTest(display_endianness_tests());
+
+	printf("\r\nPerform display driver tests.\r\n");
+	TextUIRunner_runTest(llui_display_tests());
+
+	printf("\r\nPerform framerate tests.\r\n");
+	TextUIRunner_runTest(framerate_tests());
+
+	printf("\r\nPerform images heap tests.\r\n");
+	TextUIRunner_runTest(microui_heap_tests());
+
+	printf("\r\nPerform WebP decoder tests.\r\n");
+	TextUIRunner_runTest(webp_decode_tests());
+
+	printf("\r\nPerform RGB565 drawing tests.\r\n");
+	TextUIRunner_runTest(ui_drawing_rgb565_tests());
+
+	printf("\r\nPerform RGB565 transformed images and faded shapes tests.\r\n");
+	TextUIRunner_runTest(dw_drawing_rgb565_tests());
+
+	printf("\r\nPerform drawing trace tests.\r\n");
+	TextUIRunner_runTest(drawing_trace_tests());
+
+	printf("\r\nPerform drawing statistics tests.\r\n");
+	TextUIRunner_runTest(drawing_stats_tests());
+
+	printf("\r\nPerform async worker tests.\r\n");
+	TextUIRunner_runTest(microej_async_worker_tests());
+
+	TextUIRunner_end();
+
+	return 0;
+}
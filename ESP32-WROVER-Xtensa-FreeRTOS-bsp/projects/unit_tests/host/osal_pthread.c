@@ -0,0 +1,404 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * OS Abstraction Layer port on POSIX threads, for the host tests.
+ *
+ * The semaphores and the queues count the OSAL tasks blocked on them, so that the tests can
+ * wait for the end of the work given to the tasks (OSAL_PTHREAD_wait_idle()). A give which
+ * unblocks a task reserves its token for the blocked tasks: a task is only counted as running
+ * again once it has a token to consume. The priorities are ignored.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "osal_pthread.h"
+
+/* Minimum stack of the host threads: the stacks sized for the target are too small on the host */
+#define HOST_MIN_STACK_SIZE (256 * 1024)
+
+/* Semaphore or queue */
+typedef struct {
+	pthread_mutex_t lock;
+	pthread_cond_t changed;
+	uint32_t count;        // available tokens or queued items
+	uint32_t max;
+	uint32_t task_waiters; // OSAL tasks blocked, not yet released by a give
+	uint32_t released;     // tokens reserved for the released OSAL tasks
+	void** items;          // queue items, NULL for a semaphore
+	uint32_t first;
+} host_object_t;
+
+typedef struct {
+	OSAL_task_entry_point_t entry_point;
+	void* parameters;
+} host_task_t;
+
+static uint32_t tasks = 0;
+static uint32_t blocked_tasks = 0;
+static __thread bool is_task = false;
+static pthread_mutex_t context_switching_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void* host_task_start(void* args)
+{
+	host_task_t task = *(host_task_t*)args;
+	free(args);
+	is_task = true;
+	task.entry_point(task.parameters);
+	__atomic_sub_fetch(&tasks, 1, __ATOMIC_SEQ_CST);
+	return NULL;
+}
+
+static host_object_t* host_object_create(uint32_t initial_count, uint32_t max, bool queue)
+{
+	host_object_t* object = calloc(1, sizeof(host_object_t));
+	if (object != NULL) {
+		pthread_mutex_init(&object->lock, NULL);
+		pthread_cond_init(&object->changed, NULL);
+		object->count = initial_count;
+		object->max = max;
+		if (queue) {
+			object->items = calloc(max, sizeof(void*));
+		}
+	}
+	return object;
+}
+
+static void host_object_delete(host_object_t* object)
+{
+	pthread_mutex_destroy(&object->lock);
+	pthread_cond_destroy(&object->changed);
+	free(object->items);
+	free(object);
+}
+
+/*
+ * Wait for a token (or an item) of the object and consume it; called with the object locked.
+ */
+static OSAL_status_t host_object_take(host_object_t* object, uint32_t timeout)
+{
+	struct timespec deadline;
+	bool waiting = false;
+
+	if (object->count > object->released) {
+		object->count--;
+		return OSAL_OK;
+	}
+	if (timeout == 0) {
+		return OSAL_ERROR;
+	}
+
+	if (timeout != OSAL_INFINITE_TIME) {
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_sec += timeout / 1000;
+		deadline.tv_nsec += (long)(timeout % 1000) * 1000000;
+		if (deadline.tv_nsec >= 1000000000) {
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000;
+		}
+	}
+
+	if (is_task) {
+		object->task_waiters++;
+		__atomic_add_fetch(&blocked_tasks, 1, __ATOMIC_SEQ_CST);
+	}
+
+	while (1) {
+		int res = (timeout == OSAL_INFINITE_TIME) ? pthread_cond_wait(&object->changed, &object->lock)
+				: pthread_cond_timedwait(&object->changed, &object->lock, &deadline);
+
+		if (is_task && (object->released > 0)) {
+			/* Released by a give, which has already counted this task as running */
+			object->released--;
+			object->count--;
+			return OSAL_OK;
+		}
+		if (!is_task && (object->count > object->released)) {
+			object->count--;
+			return OSAL_OK;
+		}
+		if (res == ETIMEDOUT) {
+			waiting = is_task;
+			break;
+		}
+	}
+
+	if (waiting) {
+		object->task_waiters--;
+		__atomic_sub_fetch(&blocked_tasks, 1, __ATOMIC_SEQ_CST);
+	}
+	return OSAL_ERROR;
+}
+
+/*
+ * Add a token (or an item) to the object; called with the object locked.
+ */
+static OSAL_status_t host_object_give(host_object_t* object)
+{
+	if (object->count == object->max) {
+		return OSAL_ERROR;
+	}
+	object->count++;
+	if (object->task_waiters > 0) {
+		object->task_waiters--;
+		object->released++;
+		__atomic_sub_fetch(&blocked_tasks, 1, __ATOMIC_SEQ_CST);
+	}
+	pthread_cond_broadcast(&object->changed);
+	return OSAL_OK;
+}
+
+void OSAL_PTHREAD_wait_idle(void)
+{
+	while (__atomic_load_n(&blocked_tasks, __ATOMIC_SEQ_CST) != __atomic_load_n(&tasks, __ATOMIC_SEQ_CST)) {
+		usleep(100);
+	}
+}
+
+OSAL_status_t OSAL_task_create(OSAL_task_entry_point_t entry_point, uint8_t* name, OSAL_task_stack_t stack, int32_t priority, void* parameters, OSAL_task_handle_t* handle)
+{
+	pthread_attr_t attributes;
+	pthread_t* thread;
+	host_task_t* task;
+	(void)name;
+	(void)priority;
+
+	if (handle == NULL) {
+		return OSAL_WRONG_ARGS;
+	}
+
+	thread = malloc(sizeof(pthread_t));
+	task = malloc(sizeof(host_task_t));
+	if ((thread == NULL) || (task == NULL)) {
+		free(thread);
+		free(task);
+		return OSAL_NOMEM;
+	}
+	task->entry_point = entry_point;
+	task->parameters = parameters;
+
+	pthread_attr_init(&attributes);
+	pthread_attr_setstacksize(&attributes, (stack < HOST_MIN_STACK_SIZE) ? HOST_MIN_STACK_SIZE : (size_t)stack);
+	pthread_attr_setdetachstate(&attributes, PTHREAD_CREATE_DETACHED);
+	__atomic_add_fetch(&tasks, 1, __ATOMIC_SEQ_CST);
+	if (pthread_create(thread, &attributes, host_task_start, task) != 0) {
+		__atomic_sub_fetch(&tasks, 1, __ATOMIC_SEQ_CST);
+		pthread_attr_destroy(&attributes);
+		free(thread);
+		free(task);
+		return OSAL_ERROR;
+	}
+	pthread_attr_destroy(&attributes);
+	*handle = thread;
+	return OSAL_OK;
+}
+
+OSAL_status_t OSAL_task_delete(OSAL_task_handle_t* handle)
+{
+	(void)handle;
+	return OSAL_NOT_SUPPORTED;
+}
+
+OSAL_status_t OSAL_task_get_current(OSAL_task_handle_t* handle)
+{
+	(void)handle;
+	return OSAL_NOT_SUPPORTED;
+}
+
+OSAL_status_t OSAL_queue_create(uint8_t* name, OSAL_queue_handle_t* handle, OSAL_queue_t queue)
+{
+	(void)name;
+	if ((handle == NULL) || (queue <= 0)) {
+		return OSAL_WRONG_ARGS;
+	}
+	*handle = host_object_create(0, (uint32_t)queue, true);
+	return (*handle == NULL) ? OSAL_NOMEM : OSAL_OK;
+}
+
+OSAL_status_t OSAL_queue_delete(OSAL_queue_handle_t* handle)
+{
+	if (handle == NULL) {
+		return OSAL_WRONG_ARGS;
+	}
+	host_object_delete(*handle);
+	return OSAL_OK;
+}
+
+OSAL_status_t OSAL_queue_post(OSAL_queue_handle_t* handle, void* msg)
+{
+	host_object_t* queue;
+	OSAL_status_t res;
+
+	if (handle == NULL) {
+		return OSAL_WRONG_ARGS;
+	}
+	queue = *handle;
+	pthread_mutex_lock(&queue->lock);
+	if (queue->count == queue->max) {
+		res = OSAL_NOMEM;
+	} else {
+		queue->items[(queue->first + queue->count) % queue->max] = msg;
+		res = host_object_give(queue);
+	}
+	pthread_mutex_unlock(&queue->lock);
+	return res;
+}
+
+OSAL_status_t OSAL_queue_fetch(OSAL_queue_handle_t* handle, void** msg, uint32_t timeout)
+{
+	host_object_t* queue;
+	OSAL_status_t res;
+
+	if ((handle == NULL) || (msg == NULL)) {
+		return OSAL_WRONG_ARGS;
+	}
+	queue = *handle;
+	pthread_mutex_lock(&queue->lock);
+	res = host_object_take(queue, timeout);
+	if (res == OSAL_OK) {
+		*msg = queue->items[queue->first];
+		queue->first = (queue->first + 1) % queue->max;
+	}
+	pthread_mutex_unlock(&queue->lock);
+	return res;
+}
+
+OSAL_status_t OSAL_counter_semaphore_create(uint8_t* name, uint32_t initial_count, uint32_t max_count, OSAL_counter_semaphore_handle_t* handle)
+{
+	(void)name;
+	if ((handle == NULL) || (initial_count > max_count)) {
+		return OSAL_WRONG_ARGS;
+	}
+	*handle = host_object_create(initial_count, max_count, false);
+	return (*handle == NULL) ? OSAL_NOMEM : OSAL_OK;
+}
+
+OSAL_status_t OSAL_counter_semaphore_delete(OSAL_counter_semaphore_handle_t* handle)
+{
+	if (handle == NULL) {
+		return OSAL_WRONG_ARGS;
+	}
+	host_object_delete(*handle);
+	return OSAL_OK;
+}
+
+OSAL_status_t OSAL_counter_semaphore_take(OSAL_counter_semaphore_handle_t* handle, uint32_t timeout)
+{
+	host_object_t* semaphore;
+	OSAL_status_t res;
+
+	if (handle == NULL) {
+		return OSAL_WRONG_ARGS;
+	}
+	semaphore = *handle;
+	pthread_mutex_lock(&semaphore->lock);
+	res = host_object_take(semaphore, timeout);
+	pthread_mutex_unlock(&semaphore->lock);
+	return res;
+}
+
+OSAL_status_t OSAL_counter_semaphore_give(OSAL_counter_semaphore_handle_t* handle)
+{
+	host_object_t* semaphore;
+	OSAL_status_t res;
+
+	if (handle == NULL) {
+		return OSAL_WRONG_ARGS;
+	}
+	semaphore = *handle;
+	pthread_mutex_lock(&semaphore->lock);
+	res = host_object_give(semaphore);
+	pthread_mutex_unlock(&semaphore->lock);
+	return res;
+}
+
+OSAL_status_t OSAL_binary_semaphore_create(uint8_t* name, uint32_t initial_count, OSAL_binary_semaphore_handle_t* handle)
+{
+	return OSAL_counter_semaphore_create(name, (initial_count > 0) ? 1 : 0, 1, handle);
+}
+
+OSAL_status_t OSAL_binary_semaphore_delete(OSAL_binary_semaphore_handle_t* handle)
+{
+	return OSAL_counter_semaphore_delete(handle);
+}
+
+OSAL_status_t OSAL_binary_semaphore_take(OSAL_binary_semaphore_handle_t* handle, uint32_t timeout)
+{
+	return OSAL_counter_semaphore_take(handle, timeout);
+}
+
+OSAL_status_t OSAL_binary_semaphore_give(OSAL_binary_semaphore_handle_t* handle)
+{
+	return OSAL_counter_semaphore_give(handle);
+}
+
+OSAL_status_t OSAL_mutex_create(uint8_t* name, OSAL_mutex_handle_t* handle)
+{
+	pthread_mutex_t* mutex;
+	(void)name;
+
+	if (handle == NULL) {
+		return OSAL_WRONG_ARGS;
+	}
+	mutex = malloc(sizeof(pthread_mutex_t));
+	if (mutex == NULL) {
+		return OSAL_NOMEM;
+	}
+	pthread_mutex_init(mutex, NULL);
+	*handle = mutex;
+	return OSAL_OK;
+}
+
+OSAL_status_t OSAL_mutex_delete(OSAL_mutex_handle_t* handle)
+{
+	if (handle == NULL) {
+		return OSAL_WRONG_ARGS;
+	}
+	pthread_mutex_destroy(*handle);
+	free(*handle);
+	return OSAL_OK;
+}
+
+OSAL_status_t OSAL_mutex_take(OSAL_mutex_handle_t* handle, uint32_t timeout)
+{
+	(void)timeout;
+	if (handle == NULL) {
+		return OSAL_WRONG_ARGS;
+	}
+	return (pthread_mutex_lock(*handle) == 0) ? OSAL_OK : OSAL_ERROR;
+}
+
+OSAL_status_t OSAL_mutex_give(OSAL_mutex_handle_t* handle)
+{
+	if (handle == NULL) {
+		return OSAL_WRONG_ARGS;
+	}
+	return (pthread_mutex_unlock(*handle) == 0) ? OSAL_OK : OSAL_ERROR;
+}
+
+OSAL_status_t OSAL_disable_context_switching(void)
+{
+	pthread_mutex_lock(&context_switching_lock);
+	return OSAL_OK;
+}
+
+OSAL_status_t OSAL_enable_context_switching(void)
+{
+	pthread_mutex_unlock(&context_switching_lock);
+	return OSAL_OK;
+}
+
+OSAL_status_t OSAL_sleep(uint32_t milliseconds)
+{
+	struct timespec delay = { (time_t)(milliseconds / 1000), (long)(milliseconds % 1000) * 1000000 };
+	nanosleep(&delay, NULL);
+	return OSAL_OK;
+}
@@ -0,0 +1,31 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Services of the OS Abstraction Layer port of the host tests (osal_pthread.c).
+ */
+
+#ifndef OSAL_PTHREAD_H
+#define OSAL_PTHREAD_H
+
+#include "osal.h"
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/**
+ * @brief Wait until all the OSAL tasks are blocked on a semaphore or a queue which has nothing
+ * to give them: the work submitted to the tasks is then done.
+ */
+void OSAL_PTHREAD_wait_idle(void);
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif // OSAL_PTHREAD_H
@@ -0,0 +1,168 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host model of the platform best fit allocator (BESTFIT_ALLOCATOR.h), for a single heap.
+ *
+ * The model follows the memory layout that LLUI_DISPLAY_HEAP_impl.c relies on: a main header of
+ * 68 bytes at the start of the heap, then the blocks, each made of a 4-byte header holding the
+ * full block size, the data and a 4-byte footer. The sizes are rounded to 4 bytes: the blocks
+ * are 4-byte aligned. The blocks are kept in an address-sorted table outside of the heap;
+ * the adjacent free blocks are merged. The addresses are given as 32-bit integers: the heap
+ * must be mapped in the low 2 GB of the address space (see LLUI_DISPLAY_STUB_initialize_heap()).
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "BESTFIT_ALLOCATOR_stub.h"
+
+#define STUB_MAIN_HEADER_SIZE 68
+#define STUB_BLOCK_OVERHEAD 8
+#define STUB_MIN_SPLIT 16
+#define STUB_MAX_BLOCKS 16384
+
+typedef struct {
+	uint8_t* start;
+	uint32_t size;
+	bool used;
+} stub_block_t;
+
+static stub_block_t blocks[STUB_MAX_BLOCKS];
+static uint32_t blocks_number;
+static uint32_t lowest_largest_free_block = UINT32_MAX;
+
+static void stub_remove(uint32_t index)
+{
+	blocks_number--;
+	memmove(&blocks[index], &blocks[index + 1], (blocks_number - index) * sizeof(stub_block_t));
+}
+
+static void stub_update_lowest_largest_free_block(void)
+{
+	uint32_t largest;
+	uint32_t total;
+
+	(void)BESTFIT_ALLOCATOR_STUB_get_free_blocks(&largest, &total);
+	lowest_largest_free_block = (largest < lowest_largest_free_block) ? largest : lowest_largest_free_block;
+}
+
+void BESTFIT_ALLOCATOR_new(BESTFIT_ALLOCATOR* env)
+{
+	memset(env, 0, sizeof(BESTFIT_ALLOCATOR));
+}
+
+void BESTFIT_ALLOCATOR_initialize(BESTFIT_ALLOCATOR* env, int32_t startAddress, int32_t endAddress)
+{
+	(void)env;
+	blocks[0].start = (uint8_t*)(intptr_t)startAddress + STUB_MAIN_HEADER_SIZE;
+	blocks[0].size = (uint32_t)(endAddress - startAddress - STUB_MAIN_HEADER_SIZE);
+	blocks[0].used = false;
+	blocks_number = 1;
+}
+
+void* BESTFIT_ALLOCATOR_allocate(BESTFIT_ALLOCATOR* env, int32_t size)
+{
+	uint32_t full_size = (((uint32_t)size + 3u) & ~3u) + STUB_BLOCK_OVERHEAD;
+	uint32_t best = blocks_number;
+	(void)env;
+
+	if (size <= 0) {
+		return NULL;
+	}
+	for (uint32_t i = 0; i < blocks_number; i++) {
+		if (!blocks[i].used && (blocks[i].size >= full_size) && ((best == blocks_number) || (blocks[i].size < blocks[best].size))) {
+			best = i;
+		}
+	}
+	if (best == blocks_number) {
+		return NULL;
+	}
+
+	if (((blocks[best].size - full_size) >= STUB_MIN_SPLIT) && (blocks_number < STUB_MAX_BLOCKS)) {
+		memmove(&blocks[best + 2], &blocks[best + 1], (blocks_number - best - 1) * sizeof(stub_block_t));
+		blocks_number++;
+		blocks[best + 1].start = blocks[best].start + full_size;
+		blocks[best + 1].size = blocks[best].size - full_size;
+		blocks[best + 1].used = false;
+		blocks[best].size = full_size;
+	}
+	blocks[best].used = true;
+	*(uint32_t*)blocks[best].start = blocks[best].size;
+	*(uint32_t*)(blocks[best].start + blocks[best].size - sizeof(uint32_t)) = blocks[best].size;
+	stub_update_lowest_largest_free_block();
+	return blocks[best].start + sizeof(uint32_t);
+}
+
+void BESTFIT_ALLOCATOR_free(BESTFIT_ALLOCATOR* env, void* block)
+{
+	uint8_t* start = (uint8_t*)block - sizeof(uint32_t);
+	uint32_t low = 0;
+	uint32_t high = blocks_number;
+	(void)env;
+
+	while (low < high) {
+		uint32_t middle = (low + high) / 2;
+		if (blocks[middle].start < start) {
+			low = middle + 1;
+		}
+		else {
+			high = middle;
+		}
+	}
+	if ((low == blocks_number) || (blocks[low].start != start) || !blocks[low].used) {
+		return;
+	}
+
+	blocks[low].used = false;
+	if (((low + 1) < blocks_number) && !blocks[low + 1].used) {
+		blocks[low].size += blocks[low + 1].size;
+		stub_remove(low + 1);
+	}
+	if ((low > 0) && !blocks[low - 1].used) {
+		blocks[low - 1].size += blocks[low].size;
+		stub_remove(low);
+	}
+}
+
+uint32_t BESTFIT_ALLOCATOR_STUB_get_free_blocks(uint32_t* largest, uint32_t* total)
+{
+	uint32_t count = 0;
+
+	*largest = 0;
+	*total = 0;
+	for (uint32_t i = 0; i < blocks_number; i++) {
+		if (!blocks[i].used) {
+			count++;
+			*total += blocks[i].size;
+			*largest = (blocks[i].size > *largest) ? blocks[i].size : *largest;
+		}
+	}
+	return count;
+}
+
+uint32_t BESTFIT_ALLOCATOR_STUB_get_allocated_blocks(void)
+{
+	uint32_t count = 0;
+
+	for (uint32_t i = 0; i < blocks_number; i++) {
+		count += blocks[i].used ? 1 : 0;
+	}
+	return count;
+}
+
+uint32_t BESTFIT_ALLOCATOR_STUB_get_lowest_largest_free_block(void)
+{
+	uint32_t largest;
+	uint32_t total;
+	uint32_t lowest = lowest_largest_free_block;
+
+	(void)BESTFIT_ALLOCATOR_STUB_get_free_blocks(&largest, &total);
+	lowest_largest_free_block = largest;
+	return (largest < lowest) ? largest : lowest;
+}
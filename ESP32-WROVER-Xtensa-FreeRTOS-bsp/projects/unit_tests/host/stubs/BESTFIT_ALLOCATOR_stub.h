@@ -0,0 +1,41 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host model of the platform best fit allocator, see BESTFIT_ALLOCATOR_stub.c.
+ */
+
+#ifndef BESTFIT_ALLOCATOR_STUB_H
+#define BESTFIT_ALLOCATOR_STUB_H
+
+#include <stdint.h>
+#include "BESTFIT_ALLOCATOR.h"
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/*
+ * Get the free blocks of the allocator: the size of the largest one and the sum of their sizes.
+ * Return the number of free blocks.
+ */
+uint32_t BESTFIT_ALLOCATOR_STUB_get_free_blocks(uint32_t* largest, uint32_t* total);
+
+/* Number of allocated blocks */
+uint32_t BESTFIT_ALLOCATOR_STUB_get_allocated_blocks(void);
+
+/*
+ * Get the smallest size of the largest free block after each allocation since the last call:
+ * the largest allocation which would have succeeded at any time in between.
+ */
+uint32_t BESTFIT_ALLOCATOR_STUB_get_lowest_largest_free_block(void);
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif // BESTFIT_ALLOCATOR_STUB_H
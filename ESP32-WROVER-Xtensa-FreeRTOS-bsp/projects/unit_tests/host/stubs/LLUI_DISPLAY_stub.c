@@ -0,0 +1,156 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host stub of the Graphics Engine image buffers, see LLUI_DISPLAY_stub.h.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "LLUI_DISPLAY_configuration.h"
+#include "LLUI_DISPLAY_impl.h"
+#include "LLUI_DISPLAY_stub.h"
+
+#define STUB_MAX_IMAGES 256
+
+typedef struct {
+	MICROUI_Image* image;
+	uint8_t* buffer;
+	uint32_t stride;
+	bool allocated;
+} stub_image_t;
+
+static stub_image_t images[STUB_MAX_IMAGES];
+static uint32_t row_padding = 0;
+static llui_display_stub_stats_t stats;
+static uint8_t* heap = NULL;
+
+static stub_image_t* stub_find(MICROUI_Image* image, bool create)
+{
+	stub_image_t* free_slot = NULL;
+	for (uint32_t i = 0; i < STUB_MAX_IMAGES; i++) {
+		if (images[i].image == image) {
+			return &images[i];
+		}
+		if ((NULL == free_slot) && (NULL == images[i].image)) {
+			free_slot = &images[i];
+		}
+	}
+	if (create && (NULL != free_slot)) {
+		free_slot->image = image;
+	}
+	return create ? free_slot : NULL;
+}
+
+static uint32_t stub_bytes_per_pixel(MICROUI_Image* image)
+{
+	switch (image->format) {
+	case MICROUI_IMAGE_FORMAT_LCD:
+		return LLUI_DISPLAY_BPP / 8;
+	case MICROUI_IMAGE_FORMAT_RGB565:
+	case MICROUI_IMAGE_FORMAT_ARGB1555:
+	case MICROUI_IMAGE_FORMAT_ARGB4444:
+		return 2;
+	case MICROUI_IMAGE_FORMAT_RGB888:
+		return 3;
+	default:
+		return 4;
+	}
+}
+
+void LLUI_DISPLAY_STUB_set_row_padding(uint32_t padding)
+{
+	row_padding = padding;
+}
+
+void LLUI_DISPLAY_STUB_set_buffer(MICROUI_Image* image, uint8_t* buffer, uint32_t stride)
+{
+	stub_image_t* slot = stub_find(image, true);
+	slot->buffer = buffer;
+	slot->stride = stride;
+	slot->allocated = false;
+}
+
+void LLUI_DISPLAY_STUB_initialize_heap(uint32_t size)
+{
+	if (NULL == heap) {
+		heap = mmap(NULL, LLUI_DISPLAY_STUB_HEAP_MAX_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+		if (MAP_FAILED == heap) {
+			abort();
+		}
+	}
+	LLUI_DISPLAY_IMPL_image_heap_initialize(heap, heap + ((size < LLUI_DISPLAY_STUB_HEAP_MAX_SIZE) ? size : LLUI_DISPLAY_STUB_HEAP_MAX_SIZE));
+}
+
+void LLUI_DISPLAY_STUB_get_stats(llui_display_stub_stats_t* stats_out)
+{
+	*stats_out = stats;
+}
+
+void LLUI_DISPLAY_STUB_reset_peaks(void)
+{
+	stats.image_bytes_peak = stats.image_bytes;
+}
+
+bool LLUI_DISPLAY_allocateImageBuffer(MICROUI_Image* img, uint8_t rowAlignmentInBytes)
+{
+	stub_image_t* slot = stub_find(img, true);
+	size_t size;
+	(void)rowAlignmentInBytes;
+
+	if (NULL == slot) {
+		return false;
+	}
+	slot->stride = (img->width * stub_bytes_per_pixel(img)) + row_padding;
+	size = (size_t)slot->stride * img->height;
+	slot->buffer = LLUI_DISPLAY_IMPL_image_heap_allocate(size);
+	if (NULL == slot->buffer) {
+		slot->image = NULL;
+		return false;
+	}
+	memset(slot->buffer, LLUI_DISPLAY_STUB_FILL, size);
+	slot->allocated = true;
+
+	stats.image_buffers++;
+	stats.image_bytes += size;
+	if (stats.image_bytes > stats.image_bytes_peak) {
+		stats.image_bytes_peak = stats.image_bytes;
+	}
+	return true;
+}
+
+void LLUI_DISPLAY_freeImageBuffer(MICROUI_Image* img)
+{
+	stub_image_t* slot = stub_find(img, false);
+
+	if ((NULL != slot) && slot->allocated) {
+		stats.image_buffers--;
+		stats.image_bytes -= (size_t)slot->stride * img->height;
+		LLUI_DISPLAY_IMPL_image_heap_free(slot->buffer);
+	}
+	if (NULL != slot) {
+		memset(slot, 0, sizeof(stub_image_t));
+	}
+}
+
+uint8_t* LLUI_DISPLAY_getBufferAddress(MICROUI_Image* image)
+{
+	stub_image_t* slot = stub_find(image, false);
+	return (NULL == slot) ? NULL : slot->buffer;
+}
+
+uint32_t LLUI_DISPLAY_getStrideInBytes(MICROUI_Image* image)
+{
+	stub_image_t* slot = stub_find(image, false);
+	return (NULL == slot) ? 0 : slot->stride;
+}
+
+uint32_t LLUI_DISPLAY_getStrideInPixels(MICROUI_Image* image)
+{
+	return LLUI_DISPLAY_getStrideInBytes(image) / stub_bytes_per_pixel(image);
+}
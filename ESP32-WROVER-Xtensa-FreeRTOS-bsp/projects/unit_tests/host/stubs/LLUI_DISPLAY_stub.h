@@ -0,0 +1,64 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host stub of the Graphics Engine image buffers (LLUI_DISPLAY.h): the buffers are allocated in
+ * the images heap (LLUI_DISPLAY_HEAP_impl.c, on the host model of the best fit allocator) and
+ * accounted.
+ */
+
+#ifndef LLUI_DISPLAY_STUB_H
+#define LLUI_DISPLAY_STUB_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "LLUI_DISPLAY.h"
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/* Value of the bytes of a new image buffer */
+#define LLUI_DISPLAY_STUB_FILL 0xA5
+
+/* Maximum size of the images heap */
+#define LLUI_DISPLAY_STUB_HEAP_MAX_SIZE (8 * 1024 * 1024)
+
+typedef struct {
+	uint32_t image_buffers;  // image buffers currently allocated
+	size_t image_bytes;      // bytes of the image buffers currently allocated
+	size_t image_bytes_peak;
+} llui_display_stub_stats_t;
+
+/*
+ * Initialize the images heap with the given size (at most LLUI_DISPLAY_STUB_HEAP_MAX_SIZE). The
+ * heap is mapped in the low 2 GB of the address space: the best fit allocator takes 32-bit
+ * addresses.
+ */
+void LLUI_DISPLAY_STUB_initialize_heap(uint32_t size);
+
+/*
+ * Set the number of padding bytes at the end of each row of the next image buffers: the
+ * stride of the images is larger than their width.
+ */
+void LLUI_DISPLAY_STUB_set_row_padding(uint32_t padding);
+
+/*
+ * Bind a buffer to an image, for the images not allocated by LLUI_DISPLAY_allocateImageBuffer().
+ */
+void LLUI_DISPLAY_STUB_set_buffer(MICROUI_Image* image, uint8_t* buffer, uint32_t stride);
+
+void LLUI_DISPLAY_STUB_get_stats(llui_display_stub_stats_t* stats);
+
+/* Reset the peak values to the current ones */
+void LLUI_DISPLAY_STUB_reset_peaks(void);
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif // LLUI_DISPLAY_STUB_H
@@ -0,0 +1,35 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host stub of the CPU services of the ESP32, see cpu_stub.h.
+ */
+
+#include "cpu_stub.h"
+
+static uint32_t stub_cycles;
+static int stub_core;
+
+void CPU_STUB_set_cycles(uint32_t cycles)
+{
+	stub_cycles = cycles;
+}
+
+uint32_t CPU_STUB_get_cycles(void)
+{
+	return stub_cycles;
+}
+
+void CPU_STUB_set_core(int core)
+{
+	stub_core = core;
+}
+
+int CPU_STUB_get_core(void)
+{
+	return stub_core;
+}
@@ -0,0 +1,37 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host stub of the CPU services of the ESP32 (cycle counter, core identifier and frequency): the
+ * tests set the values returned by the stubbed services.
+ */
+
+#ifndef CPU_STUB_H
+#define CPU_STUB_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/* CPU frequency returned by esp_clk_cpu_freq() */
+#define CPU_STUB_FREQUENCY (240000000)
+
+/* Set the value of the cycle counter (xthal_get_ccount()) */
+void CPU_STUB_set_cycles(uint32_t cycles);
+uint32_t CPU_STUB_get_cycles(void);
+
+/* Set the core which runs the caller (xPortGetCoreID()) */
+void CPU_STUB_set_core(int core);
+int CPU_STUB_get_core(void);
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif // CPU_STUB_H
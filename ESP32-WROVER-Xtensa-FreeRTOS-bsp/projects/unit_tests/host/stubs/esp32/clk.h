@@ -0,0 +1,22 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host stub of the ESP32 clocks: the CPU frequency, see cpu_stub.h.
+ */
+
+#ifndef _ESP32_CLK_H_
+#define _ESP32_CLK_H_
+
+#include "cpu_stub.h"
+
+static inline int esp_clk_cpu_freq(void)
+{
+	return CPU_STUB_FREQUENCY;
+}
+
+#endif /* _ESP32_CLK_H_ */
@@ -0,0 +1,23 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host stub of the FreeRTOS services used by the hardware independent modules: the core
+ * identifier of the ESP32 port, see cpu_stub.h.
+ */
+
+#ifndef _FREERTOS_H_
+#define _FREERTOS_H_
+
+#include "cpu_stub.h"
+
+static inline int xPortGetCoreID(void)
+{
+	return CPU_STUB_get_core();
+}
+
+#endif /* _FREERTOS_H_ */
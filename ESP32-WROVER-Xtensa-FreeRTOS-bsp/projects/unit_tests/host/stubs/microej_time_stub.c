@@ -0,0 +1,45 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host stub of the platform time, see microej_time_stub.h.
+ */
+
+#include <stdbool.h>
+#include <time.h>
+#include "microej_time.h"
+#include "microej_time_stub.h"
+
+static bool stopped = false;
+static int64_t stopped_time_us;
+
+void MICROEJ_TIME_STUB_set_time_us(int64_t time_us)
+{
+	__atomic_store_n(&stopped_time_us, time_us, __ATOMIC_SEQ_CST);
+	__atomic_store_n(&stopped, true, __ATOMIC_SEQ_CST);
+}
+
+void MICROEJ_TIME_STUB_advance_us(int64_t duration_us)
+{
+	__atomic_add_fetch(&stopped_time_us, duration_us, __ATOMIC_SEQ_CST);
+}
+
+void MICROEJ_TIME_STUB_use_host_clock(void)
+{
+	__atomic_store_n(&stopped, false, __ATOMIC_SEQ_CST);
+}
+
+int64_t microej_time_get_time_nanos(void)
+{
+	struct timespec now;
+
+	if (__atomic_load_n(&stopped, __ATOMIC_SEQ_CST)) {
+		return __atomic_load_n(&stopped_time_us, __ATOMIC_SEQ_CST) * 1000;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((int64_t)now.tv_sec * 1000000000) + now.tv_nsec;
+}
@@ -0,0 +1,35 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host stub of the platform time (microej_time_get_time_nanos()): the host monotonic clock, or a
+ * clock set by the tests.
+ */
+
+#ifndef MICROEJ_TIME_STUB_H
+#define MICROEJ_TIME_STUB_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/* Stop the clock at the given time; it then only changes with MICROEJ_TIME_STUB_advance_us() */
+void MICROEJ_TIME_STUB_set_time_us(int64_t time_us);
+
+/* Advance the stopped clock */
+void MICROEJ_TIME_STUB_advance_us(int64_t duration_us);
+
+/* Go back to the host monotonic clock */
+void MICROEJ_TIME_STUB_use_host_clock(void);
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif // MICROEJ_TIME_STUB_H
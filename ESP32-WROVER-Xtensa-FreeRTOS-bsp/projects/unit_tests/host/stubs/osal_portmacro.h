@@ -0,0 +1,49 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * OS Abstraction Layer port macro of the host tests (osal_pthread.c). This header is included
+ * before the sources so that it takes the place of the FreeRTOS port macro of the BSP.
+ */
+
+#ifndef OSAL_PORTMACRO_H
+#define OSAL_PORTMACRO_H
+
+#include <stdint.h>
+
+/** @brief Custom OS type definitions */
+#define OSAL_CUSTOM_TYPEDEF
+
+/** @brief task function entry point, as in the FreeRTOS port */
+typedef void (*OSAL_task_entry_point_t)(void* args);
+
+/** @brief OS task handle */
+typedef void* OSAL_task_handle_t;
+
+/** @brief OS queue handle */
+typedef void* OSAL_queue_handle_t;
+
+/** @brief OS counter semaphore handle */
+typedef void* OSAL_counter_semaphore_handle_t;
+
+/** @brief OS binary semaphore handle */
+typedef void* OSAL_binary_semaphore_handle_t;
+
+/** @brief OS mutex handle */
+typedef void* OSAL_mutex_handle_t;
+
+/** @brief OS task stack: its size in bytes, as in the FreeRTOS port */
+typedef int32_t OSAL_task_stack_t;
+
+/** @brief OS queue: its number of items */
+typedef int32_t OSAL_queue_t;
+
+#define OSAL_task_stack_declare(_name, _size) OSAL_task_stack_t _name = _size
+
+#define OSAL_queue_declare(_name, _size) OSAL_queue_t _name = _size
+
+#endif // OSAL_PORTMACRO_H
@@ -0,0 +1,222 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host stub of the virtual machine services used by the natives, see sni_stub.h.
+ *
+ * The virtual machine lock serializes the Java threads. The states of the suspensions are
+ * protected by another lock, taken last: SNI_resumeJavaThread() is called by the OSAL tasks,
+ * which must not wait for the virtual machine.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "sni_stub.h"
+#include "MJVM_MONITOR.h"
+
+/* Java priority of the threads which have not set theirs (Thread.NORM_PRIORITY) */
+#define JAVA_NORM_PRIORITY (5)
+
+typedef struct {
+	pthread_cond_t resumed;
+	bool resume_pending;        // protected by the state lock
+	bool suspend_requested;     // the fields below are protected by the virtual machine lock
+	int64_t timeout;
+	SNI_callback callback;
+	void* callback_arg;
+	bool exception;
+	int32_t priority;
+} java_thread_t;
+
+static java_thread_t java_threads[SNI_STUB_MAX_THREADS];
+static uint32_t java_thread_count = 0;
+static __thread java_thread_t* current_java_thread = NULL;
+static pthread_mutex_t vm_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t state_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t suspensions = 0;
+static uint32_t resumes = 0;
+
+/*
+ * Make the current host thread a Java thread, if it is not one yet.
+ */
+static java_thread_t* current_thread(void)
+{
+	if (current_java_thread == NULL) {
+		uint32_t id = __atomic_fetch_add(&java_thread_count, 1, __ATOMIC_SEQ_CST);
+		if (id >= SNI_STUB_MAX_THREADS) {
+			printf("SNI_STUB: more than %d Java threads\n", SNI_STUB_MAX_THREADS);
+			abort();
+		}
+		current_java_thread = &java_threads[id];
+		pthread_cond_init(&current_java_thread->resumed, NULL);
+		current_java_thread->priority = JAVA_NORM_PRIORITY;
+	}
+	return current_java_thread;
+}
+
+static java_thread_t* get_thread(int32_t id)
+{
+	return ((id >= 0) && ((uint32_t)id < __atomic_load_n(&java_thread_count, __ATOMIC_SEQ_CST))) ? &java_threads[id] : NULL;
+}
+
+/*
+ * Suspend the current Java thread until it is resumed or its timeout expires; called without the
+ * virtual machine lock.
+ */
+static void suspend(java_thread_t* thread, int64_t timeout)
+{
+	struct timespec deadline;
+
+	if (timeout > 0) {
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_sec += (time_t)(timeout / 1000);
+		deadline.tv_nsec += (long)(timeout % 1000) * 1000000;
+		if (deadline.tv_nsec >= 1000000000) {
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000;
+		}
+	}
+
+	pthread_mutex_lock(&state_lock);
+	if (!thread->resume_pending) {
+		__atomic_add_fetch(&suspensions, 1, __ATOMIC_SEQ_CST);
+		while (!thread->resume_pending) {
+			int res = (timeout > 0) ? pthread_cond_timedwait(&thread->resumed, &state_lock, &deadline)
+					: pthread_cond_wait(&thread->resumed, &state_lock);
+			if (res == ETIMEDOUT) {
+				break;
+			}
+		}
+	}
+	/* cleared by the suspension or by the actual resume; it is not set when the timeout expires */
+	thread->resume_pending = false;
+	pthread_mutex_unlock(&state_lock);
+}
+
+int32_t SNI_STUB_call(SNI_callback native)
+{
+	java_thread_t* thread = current_thread();
+	SNI_callback next = native;
+	bool exception;
+
+	pthread_mutex_lock(&vm_lock);
+	thread->exception = false;
+	while (next != NULL) {
+		thread->suspend_requested = false;
+		next();
+		next = NULL;
+		if (thread->suspend_requested) {
+			pthread_mutex_unlock(&vm_lock);
+			suspend(thread, thread->timeout);
+			pthread_mutex_lock(&vm_lock);
+			next = thread->callback;
+		}
+	}
+	exception = thread->exception;
+	pthread_mutex_unlock(&vm_lock);
+
+	return exception ? SNI_ERROR : SNI_OK;
+}
+
+void SNI_STUB_set_priority(int32_t priority)
+{
+	current_thread()->priority = priority;
+}
+
+uint32_t SNI_STUB_get_suspensions(void)
+{
+	return __atomic_load_n(&suspensions, __ATOMIC_SEQ_CST);
+}
+
+uint32_t SNI_STUB_get_resumes(void)
+{
+	return __atomic_load_n(&resumes, __ATOMIC_SEQ_CST);
+}
+
+/* SNI --------------------------------------------------------------------------------------------*/
+
+int32_t SNI_getCurrentJavaThreadID(void)
+{
+	return (current_java_thread == NULL) ? SNI_ERROR : (int32_t)(current_java_thread - java_threads);
+}
+
+int32_t SNI_suspendCurrentJavaThreadWithCallback(int64_t timeout, SNI_callback sniCallback, void* callbackSuspendArg)
+{
+	java_thread_t* thread = current_java_thread;
+
+	if ((thread == NULL) || thread->exception) {
+		return SNI_ERROR;
+	}
+	thread->suspend_requested = true;
+	thread->timeout = timeout;
+	thread->callback = sniCallback;
+	thread->callback_arg = callbackSuspendArg;
+	return SNI_OK;
+}
+
+int32_t SNI_resumeJavaThread(int32_t javaThreadID)
+{
+	java_thread_t* thread = get_thread(javaThreadID);
+
+	if (thread == NULL) {
+		return SNI_ERROR;
+	}
+	__atomic_add_fetch(&resumes, 1, __ATOMIC_SEQ_CST);
+	pthread_mutex_lock(&state_lock);
+	thread->resume_pending = true;
+	pthread_cond_signal(&thread->resumed);
+	pthread_mutex_unlock(&state_lock);
+	return SNI_OK;
+}
+
+int32_t SNI_getCallbackArgs(void** callbackSuspendArgPtr, void** callbackResumeArgPtr)
+{
+	if (current_java_thread == NULL) {
+		return SNI_ERROR;
+	}
+	if (callbackSuspendArgPtr != NULL) {
+		*callbackSuspendArgPtr = current_java_thread->callback_arg;
+	}
+	if (callbackResumeArgPtr != NULL) {
+		*callbackResumeArgPtr = NULL;
+	}
+	return SNI_OK;
+}
+
+int32_t SNI_throwNativeIOException(int32_t errorCode, const char* message)
+{
+	(void)errorCode;
+	(void)message;
+	if (current_java_thread == NULL) {
+		return SNI_ERROR;
+	}
+	current_java_thread->exception = true;
+	return SNI_OK;
+}
+
+/* MJVM_MONITOR -----------------------------------------------------------------------------------*/
+
+int32_t MJVM_MONITOR_get_thread_info(int32_t thread_id, MJVM_MONITOR_thread_info_t* thread_info, char* name, int32_t name_length)
+{
+	java_thread_t* thread = get_thread(thread_id);
+
+	if (thread == NULL) {
+		return MJVM_MONITOR_INVALID_THREAD_ID;
+	}
+	thread_info->id = thread_id;
+	thread_info->priority = thread->priority;
+	thread_info->state = MJVM_MONITOR_STATE_RUNNING;
+	thread_info->max_stack_usage = -1;
+	if ((name != NULL) && (name_length > 0)) {
+		snprintf(name, (size_t)name_length, "Java thread %d", (int)thread_id);
+	}
+	return MJVM_MONITOR_OK;
+}
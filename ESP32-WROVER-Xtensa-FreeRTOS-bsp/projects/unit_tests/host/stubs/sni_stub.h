@@ -0,0 +1,50 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host stub of the virtual machine services used by the natives (SNI and MJVM_MONITOR).
+ *
+ * A host thread becomes a Java thread when it calls a native with SNI_STUB_call(). As in the
+ * virtual machine task, one Java thread at a time executes a native or an SNI callback: the other
+ * ones wait for the virtual machine lock or are suspended. A suspended Java thread releases the
+ * lock until it is resumed by SNI_resumeJavaThread() or its timeout expires, then calls the SNI
+ * callback given to SNI_suspendCurrentJavaThreadWithCallback().
+ */
+
+#ifndef SNI_STUB_H
+#define SNI_STUB_H
+
+#include <stdint.h>
+#include "sni.h"
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/* Maximum number of host threads that can become Java threads */
+#define SNI_STUB_MAX_THREADS (1024)
+
+/*
+ * Call a native in the current Java thread, then the SNI callbacks of its suspensions, until the
+ * Java thread returns to Java. Returns SNI_ERROR if an exception is pending, SNI_OK otherwise.
+ */
+int32_t SNI_STUB_call(SNI_callback native);
+
+/* Set the Java priority of the current thread, returned by MJVM_MONITOR_get_thread_info() */
+void SNI_STUB_set_priority(int32_t priority);
+
+/* Number of times a Java thread has actually been suspended (its pending resume flag was not set) */
+uint32_t SNI_STUB_get_suspensions(void);
+
+/* Number of calls to SNI_resumeJavaThread() */
+uint32_t SNI_STUB_get_resumes(void);
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif // SNI_STUB_H
@@ -0,0 +1,253 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host stub of the Graphics Engine drawing services and of the software algorithms, see
+ * ui_drawing_stub.h. The clip functions follow the LLUI_DISPLAY.h documentation.
+ */
+
+#include <string.h>
+#include "ui_drawing_soft.h"
+#include "dw_drawing_soft.h"
+#include "LLUI_DISPLAY_stub.h"
+#include "ui_drawing_stub.h"
+
+static bool clip_enabled = true;
+static uint32_t soft_calls = 0;
+static bool limits_set = false;
+static jint limits[4];
+
+static inline jint stub_max(jint a, jint b)
+{
+	return (a > b) ? a : b;
+}
+
+static inline jint stub_min(jint a, jint b)
+{
+	return (a < b) ? a : b;
+}
+
+/* API -----------------------------------------------------------------------*/
+
+void UI_DRAWING_STUB_init_gc(MICROUI_GraphicsContext* gc, MICROUI_ImageFormat format, uint32_t width, uint32_t height, uint8_t* buffer, uint32_t stride)
+{
+	memset(gc, 0, sizeof(MICROUI_GraphicsContext));
+	gc->image.width = (jchar)width;
+	gc->image.height = (jchar)height;
+	gc->image.format = (jbyte)format;
+	LLUI_DISPLAY_STUB_set_buffer(&gc->image, buffer, stride);
+	UI_DRAWING_STUB_set_clip(gc, 0, 0, (jint)width - 1, (jint)height - 1);
+}
+
+void UI_DRAWING_STUB_set_clip(MICROUI_GraphicsContext* gc, jint x1, jint y1, jint x2, jint y2)
+{
+	gc->clip_x1 = (jshort)x1;
+	gc->clip_y1 = (jshort)y1;
+	gc->clip_x2 = (jshort)x2;
+	gc->clip_y2 = (jshort)y2;
+}
+
+void UI_DRAWING_STUB_set_clip_enabled(bool enabled)
+{
+	clip_enabled = enabled;
+}
+
+uint32_t UI_DRAWING_STUB_get_soft_calls(void)
+{
+	return soft_calls;
+}
+
+bool UI_DRAWING_STUB_get_drawing_limits(jint* xmin, jint* ymin, jint* xmax, jint* ymax)
+{
+	*xmin = limits[0];
+	*ymin = limits[1];
+	*xmax = limits[2];
+	*ymax = limits[3];
+	return limits_set;
+}
+
+void UI_DRAWING_STUB_reset(void)
+{
+	clip_enabled = true;
+	soft_calls = 0;
+	limits_set = false;
+}
+
+/* LLUI_DISPLAY.h functions --------------------------------------------------*/
+
+bool LLUI_DISPLAY_isClipEnabled(MICROUI_GraphicsContext* gc)
+{
+	(void)gc;
+	return clip_enabled;
+}
+
+bool LLUI_DISPLAY_clipHorizontalLine(MICROUI_GraphicsContext* gc, jint* x1, jint* x2, jint y)
+{
+	*x1 = stub_max(*x1, gc->clip_x1);
+	*x2 = stub_min(*x2, gc->clip_x2);
+	return (*x1 <= *x2) && (y >= gc->clip_y1) && (y <= gc->clip_y2);
+}
+
+bool LLUI_DISPLAY_clipRectangle(MICROUI_GraphicsContext* gc, jint* x1, jint* y1, jint* x2, jint* y2)
+{
+	*x1 = stub_max(*x1, gc->clip_x1);
+	*y1 = stub_max(*y1, gc->clip_y1);
+	*x2 = stub_min(*x2, gc->clip_x2);
+	*y2 = stub_min(*y2, gc->clip_y2);
+	return (*x1 <= *x2) && (*y1 <= *y2);
+}
+
+bool LLUI_DISPLAY_clipRegion(MICROUI_GraphicsContext* gc, jint* x, jint* y, jint* width, jint* height, jint* destX, jint* destY)
+{
+	if (*destX < gc->clip_x1) {
+		*x += gc->clip_x1 - *destX;
+		*width -= gc->clip_x1 - *destX;
+		*destX = gc->clip_x1;
+	}
+	if (*destY < gc->clip_y1) {
+		*y += gc->clip_y1 - *destY;
+		*height -= gc->clip_y1 - *destY;
+		*destY = gc->clip_y1;
+	}
+	*width = stub_min(*width, gc->clip_x2 - *destX + 1);
+	*height = stub_min(*height, gc->clip_y2 - *destY + 1);
+	return (*width > 0) && (*height > 0);
+}
+
+bool LLUI_DISPLAY_regionsOverlap(MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint regionX, jint regionY, jint width, jint height, jint destX, jint destY)
+{
+	return (img == &gc->image) && (regionX < (destX + width)) && (destX < (regionX + width))
+			&& (regionY < (destY + height)) && (destY < (regionY + height));
+}
+
+bool LLUI_DISPLAY_setDrawingLimits(jint xmin, jint ymin, jint xmax, jint ymax)
+{
+	limits[0] = xmin;
+	limits[1] = ymin;
+	limits[2] = xmax;
+	limits[3] = ymax;
+	limits_set = true;
+	return true;
+}
+
+uint32_t LLUI_DISPLAY_convertARGBColorToDisplayColor(uint32_t color)
+{
+	return ((color >> 8) & 0xF800) | ((color >> 5) & 0x07E0) | ((color >> 3) & 0x001F);
+}
+
+/* ui_drawing_soft.h and dw_drawing_soft.h functions -------------------------*/
+
+void UI_DRAWING_SOFT_drawHorizontalLine(MICROUI_GraphicsContext* gc, jint x1, jint x2, jint y)
+{
+	(void)gc;
+	(void)x1;
+	(void)x2;
+	(void)y;
+	soft_calls++;
+}
+
+void UI_DRAWING_SOFT_fillRectangle(MICROUI_GraphicsContext* gc, jint x1, jint y1, jint x2, jint y2)
+{
+	(void)gc;
+	(void)x1;
+	(void)y1;
+	(void)x2;
+	(void)y2;
+	soft_calls++;
+}
+
+void UI_DRAWING_SOFT_drawImage(MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint regionX, jint regionY, jint width, jint height, jint x, jint y, jint alpha)
+{
+	(void)gc;
+	(void)img;
+	(void)regionX;
+	(void)regionY;
+	(void)width;
+	(void)height;
+	(void)x;
+	(void)y;
+	(void)alpha;
+	soft_calls++;
+}
+
+void DW_DRAWING_SOFT_drawThickFadedLine(MICROUI_GraphicsContext* gc, jint startX, jint startY, jint endX, jint endY, jint thickness, jint fade, DRAWING_Cap startCap, DRAWING_Cap endCap)
+{
+	(void)gc;
+	(void)startX;
+	(void)startY;
+	(void)endX;
+	(void)endY;
+	(void)thickness;
+	(void)fade;
+	(void)startCap;
+	(void)endCap;
+	soft_calls++;
+}
+
+void DW_DRAWING_SOFT_drawThickFadedCircle(MICROUI_GraphicsContext* gc, jint x, jint y, jint diameter, jint thickness, jint fade)
+{
+	(void)gc;
+	(void)x;
+	(void)y;
+	(void)diameter;
+	(void)thickness;
+	(void)fade;
+	soft_calls++;
+}
+
+void DW_DRAWING_SOFT_drawThickFadedCircleArc(MICROUI_GraphicsContext* gc, jint x, jint y, jint diameter, jfloat startAngle, jfloat arcAngle, jint thickness, jint fade, DRAWING_Cap start, DRAWING_Cap end)
+{
+	(void)gc;
+	(void)x;
+	(void)y;
+	(void)diameter;
+	(void)startAngle;
+	(void)arcAngle;
+	(void)thickness;
+	(void)fade;
+	(void)start;
+	(void)end;
+	soft_calls++;
+}
+
+void DW_DRAWING_SOFT_drawRotatedImageNearestNeighbor(MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jint rotationX, jint rotationY, jfloat angle, jint alpha)
+{
+	(void)gc;
+	(void)img;
+	(void)x;
+	(void)y;
+	(void)rotationX;
+	(void)rotationY;
+	(void)angle;
+	(void)alpha;
+	soft_calls++;
+}
+
+void DW_DRAWING_SOFT_drawRotatedImageBilinear(MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jint rotationX, jint rotationY, jfloat angle, jint alpha)
+{
+	(void)gc;
+	(void)img;
+	(void)x;
+	(void)y;
+	(void)rotationX;
+	(void)rotationY;
+	(void)angle;
+	(void)alpha;
+	soft_calls++;
+}
+
+void DW_DRAWING_SOFT_drawScaledImageNearestNeighbor(MICROUI_GraphicsContext* gc, MICROUI_Image* img, jint x, jint y, jfloat factorX, jfloat factorY, jint alpha)
+{
+	(void)gc;
+	(void)img;
+	(void)x;
+	(void)y;
+	(void)factorX;
+	(void)factorY;
+	(void)alpha;
+	soft_calls++;
+}
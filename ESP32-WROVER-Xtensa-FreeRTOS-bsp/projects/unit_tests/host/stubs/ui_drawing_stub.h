@@ -0,0 +1,53 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host stub of the Graphics Engine drawing services (LLUI_DISPLAY.h: clip, drawing limits,
+ * colors) and of the software algorithms (ui_drawing_soft.h, dw_drawing_soft.h), to run the
+ * drawing kernels of the BSP. The software algorithms only count their calls: a drawing
+ * delegated to them leaves the destination untouched.
+ */
+
+#ifndef UI_DRAWING_STUB_H
+#define UI_DRAWING_STUB_H
+
+#include <stdint.h>
+#include "LLUI_DISPLAY.h"
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/*
+ * Initialize a graphics context on a buffer: its clip is the whole buffer.
+ */
+void UI_DRAWING_STUB_init_gc(MICROUI_GraphicsContext* gc, MICROUI_ImageFormat format, uint32_t width, uint32_t height, uint8_t* buffer, uint32_t stride);
+
+/*
+ * Set the clip of a graphics context (inclusive bounds).
+ */
+void UI_DRAWING_STUB_set_clip(MICROUI_GraphicsContext* gc, jint x1, jint y1, jint x2, jint y2);
+
+/* Enable or disable the clip of all the graphics contexts (LLUI_DISPLAY_isClipEnabled()) */
+void UI_DRAWING_STUB_set_clip_enabled(bool enabled);
+
+/* Number of calls to the software algorithms since the last reset */
+uint32_t UI_DRAWING_STUB_get_soft_calls(void);
+
+/*
+ * Get the drawing limits given by the last LLUI_DISPLAY_setDrawingLimits() call since the last
+ * reset; return false when there was no call.
+ */
+bool UI_DRAWING_STUB_get_drawing_limits(jint* xmin, jint* ymin, jint* xmax, jint* ymax);
+
+void UI_DRAWING_STUB_reset(void);
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif // UI_DRAWING_STUB_H
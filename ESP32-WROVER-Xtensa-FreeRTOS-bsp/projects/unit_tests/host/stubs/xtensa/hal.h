@@ -0,0 +1,22 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Host stub of the Xtensa HAL: the cycle counter, see cpu_stub.h.
+ */
+
+#ifndef _XTENSA_HAL_H_
+#define _XTENSA_HAL_H_
+
+#include "cpu_stub.h"
+
+static inline uint32_t xthal_get_ccount(void)
+{
+	return CPU_STUB_get_cycles();
+}
+
+#endif /* _XTENSA_HAL_H_ */
@@ -8,11 +8,24 @@
 COMPONENT_ADD_INCLUDEDIRS += ../embunit \
                              ../embunit/textui \
                              ../ram \
-                             ../ram/inc
+                             ../ram/inc \
+                             ../drawing \
+                             ../../microej/ui/inc \
+                             ../../microej/platform/inc
 
 COMPONENT_SRCDIRS += ../embunit/embUnit \
                      ../embunit/textui \
                      ../ram \
-                     ../ram/src
+                     ../ram/src \
+                     ../drawing \
+                     ../../microej/ui/src
+
+# Only the RGB565 drawing overrides and the images heap of the BSP UI port are tested: the
+# other modules of the folder are not built
+UT_UI_SOURCES := ui_drawing_rgb565.c dw_drawing_rgb565.c LLUI_DISPLAY_HEAP_impl.c
+COMPONENT_OBJEXCLUDE += $(addprefix ../../microej/ui/src/,$(patsubst %.c,%.o,$(filter-out $(UT_UI_SOURCES),$(notdir $(wildcard $(COMPONENT_PATH)/../../microej/ui/src/*.c)))))
+
+# Software algorithms of the Graphics Engine, compared with the RGB565 drawing overrides
+COMPONENT_ADD_LDFLAGS += $(COMPONENT_PATH)/../../microej/platform/lib/microejruntime.a
 
 CFLAGS += -fno-strict-aliasing     # embunit module uses type-casting which break the anti-aliasing rules
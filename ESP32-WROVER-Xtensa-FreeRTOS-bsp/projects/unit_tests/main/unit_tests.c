@@ -28,11 +28,14 @@
 
 /* Test constants */
 #define PERFORM_RAM_TEST
+#define PERFORM_DRAWING_TEST
 
 /******************************************************
  *               External Function Declarations
  ******************************************************/
 extern TestRef ram_tests(void);
+extern TestRef ui_drawing_soft_tests(void);
+extern TestRef dw_drawing_soft_tests(void);
 
 /******************************************************
  *               Static Function Declarations
@@ -49,6 +52,12 @@ static void xUnitTestsTaskFunction(void * pvParameters)
 	TextUIRunner_runTest(ram_tests());
 #endif
 
+#ifdef PERFORM_DRAWING_TEST
+	printf("\r\nPerform drawing tests.\r\n");
+	TextUIRunner_runTest(ui_drawing_soft_tests());
+	TextUIRunner_runTest(dw_drawing_soft_tests());
+#endif
+
 	TextUIRunner_end();
 
 	vTaskDelete(xTaskGetCurrentTaskHandle());
@@ -0,0 +1,389 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Tests of the display driver (LLUI_DISPLAY.c) on the simulated LCD bus (lcd_bus_sim.c).
+ *
+ * The driver runs its transfer task on the host OSAL port: the test plays the Graphics Engine
+ * (initialization, flushes, flush done wait) and checks the commands and the GRAM of the
+ * simulated LCD.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <embUnit/embUnit.h>
+#include "LLUI_DISPLAY_configuration.h"
+#include "LLUI_DISPLAY_impl.h"
+#include "display_orientation.h"
+#include "lcd_bus_sim.h"
+#include "osal_pthread.h"
+#include "esp_timer.h"
+
+#define WIDTH 320
+#define HEIGHT 240
+#define BYTES_PER_PIXEL (LLUI_DISPLAY_BPP / 8)
+
+/* MIPI DCS commands of the initialization sequence */
+#define CMD_RDDID  0x04
+#define CMD_SLPOUT 0x11
+#define CMD_DISPON 0x29
+#define CMD_CASET  0x2A
+#define CMD_RASET  0x2B
+#define CMD_RAMWR  0x2C
+#define CMD_MADCTL 0x36
+
+/* MADCTL of the simulated panel (ST7789V) in each display orientation */
+#define MADCTL_LANDSCAPE      0x60
+#define MADCTL_LANDSCAPE_FLIP 0xA0
+
+/* Java natives of the display orientation */
+jboolean javaDisplayOrientationSet(jint new_orientation);
+jint javaDisplayOrientationGet(void);
+
+static LLUI_DISPLAY_SInitData init_data;
+static uint8_t* back_buffer;
+static volatile uint32_t flush_done_count;
+
+/* Graphics Engine stubs ----------------------------------------------------*/
+
+void LLUI_DISPLAY_flushDone(bool from_isr)
+{
+    (void)from_isr;
+    __atomic_add_fetch(&flush_done_count, 1, __ATOMIC_SEQ_CST);
+}
+
+bool LLUI_DISPLAY_requestFlush(bool force)
+{
+    (void)force;
+    return true;
+}
+
+/* Helpers -------------------------------------------------------------------*/
+
+static void fill(uint8_t* buffer, uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, uint16_t color)
+{
+    uint16_t* pixels = (uint16_t*)buffer;
+    for (uint32_t y = y1; y <= y2; y++) {
+        for (uint32_t x = x1; x <= x2; x++) {
+            pixels[(y * WIDTH) + x] = color;
+        }
+    }
+}
+
+/*
+ * Flush the back buffer like the Graphics Engine and wait for the end of the transfer.
+ * The back buffer becomes the buffer returned by the driver.
+ */
+static void flush(uint32_t xmin, uint32_t ymin, uint32_t xmax, uint32_t ymax)
+{
+    uint32_t expected = flush_done_count + 1;
+
+    back_buffer = LLUI_DISPLAY_IMPL_flush(NULL, back_buffer, xmin, ymin, xmax, ymax);
+    OSAL_PTHREAD_wait_idle();
+    TEST_ASSERT_EQUAL_INT(expected, flush_done_count);
+}
+
+/*
+ * Whether the simulated LCD shows the given buffer: the frame is in the LCD byte order.
+ */
+static int gram_matches(const uint8_t* buffer)
+{
+    const uint8_t* gram = LCD_BUS_SIM_get_gram();
+    for (uint32_t y = 0; y < HEIGHT; y++) {
+        if (memcmp(&gram[y * LCD_BUS_SIM_GRAM_SIDE * BYTES_PER_PIXEL], &buffer[y * WIDTH * BYTES_PER_PIXEL], WIDTH * BYTES_PER_PIXEL) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static uint32_t count_commands(uint8_t cmd)
+{
+    const lcd_bus_sim_command_t* commands;
+    uint32_t count = LCD_BUS_SIM_get_commands(&commands);
+    uint32_t found = 0;
+
+    if (count > LCD_BUS_SIM_COMMANDS_LOG_SIZE) {
+        count = LCD_BUS_SIM_COMMANDS_LOG_SIZE;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (commands[i].cmd == cmd) {
+            found++;
+        }
+    }
+    return found;
+}
+
+/*
+ * Return the index in the commands log of the first command with the given code, or the number of
+ * logged commands if there is none.
+ */
+static uint32_t find_command(uint8_t cmd)
+{
+    const lcd_bus_sim_command_t* commands;
+    uint32_t count = LCD_BUS_SIM_get_commands(&commands);
+    uint32_t i = 0;
+
+    if (count > LCD_BUS_SIM_COMMANDS_LOG_SIZE) {
+        count = LCD_BUS_SIM_COMMANDS_LOG_SIZE;
+    }
+    while ((i < count) && (commands[i].cmd != cmd)) {
+        i++;
+    }
+    return i;
+}
+
+/*
+ * Flush a drawing after a change of orientation: the LCD is oriented before the transfer, then
+ * the whole screen is sent again.
+ */
+static void check_orientation_flush(uint8_t madctl)
+{
+    const lcd_bus_sim_command_t* commands;
+    uint32_t madctl_index;
+    lcd_bus_stats_t stats;
+    uint8_t* flushed = back_buffer;
+
+    LCD_BUS_SIM_clear_commands();
+    LCD_BUS_SIM_reset_stats();
+    fill(flushed, 10, 10, 19, 19, (uint16_t)rand());
+    flush(10, 10, 19, 19);
+    LCD_BUS_get_stats(&stats);
+    (void)LCD_BUS_SIM_get_commands(&commands);
+    madctl_index = find_command(CMD_MADCTL);
+
+    TEST_ASSERT_EQUAL_INT(1, count_commands(CMD_MADCTL));
+    TEST_ASSERT_EQUAL_INT(1, (int)commands[madctl_index].length);
+    TEST_ASSERT_EQUAL_INT(madctl, commands[madctl_index].params[0]);
+    TEST_ASSERT(madctl_index < find_command(CMD_CASET));
+    TEST_ASSERT(madctl_index < find_command(CMD_RAMWR));
+    TEST_ASSERT(stats.data_bytes >= (WIDTH * HEIGHT * BYTES_PER_PIXEL));
+    TEST_ASSERT(gram_matches(flushed));
+}
+
+static void setUp(void)
+{
+    srand(1);
+}
+
+static void tearDown(void)
+{
+}
+
+/* Tests ---------------------------------------------------------------------*/
+
+static void llui_display_initialize_f(void)
+{
+    const lcd_bus_sim_command_t* commands;
+    uint8_t madctl;
+
+    LCD_BUS_SIM_clear_commands();
+    LLUI_DISPLAY_IMPL_initialize(&init_data);
+    OSAL_PTHREAD_wait_idle();
+    back_buffer = init_data.back_buffer_address;
+
+    TEST_ASSERT_EQUAL_INT(WIDTH, init_data.lcd_width);
+    TEST_ASSERT_EQUAL_INT(HEIGHT, init_data.lcd_height);
+    TEST_ASSERT(back_buffer != NULL);
+    TEST_ASSERT(init_data.binary_semaphore_0 != NULL);
+    TEST_ASSERT(init_data.binary_semaphore_1 != NULL);
+
+    /* The panel is identified, oriented, woken up and switched on */
+    TEST_ASSERT_EQUAL_INT(1, count_commands(CMD_RDDID));
+    TEST_ASSERT(count_commands(CMD_MADCTL) >= 1);
+    /* the orientation given to MicroUI is applied after the initialization list */
+    madctl = 0;
+    TEST_ASSERT(LCD_BUS_SIM_get_commands(&commands) <= LCD_BUS_SIM_COMMANDS_LOG_SIZE);
+    for (uint32_t i = 0; i < LCD_BUS_SIM_get_commands(&commands); i++) {
+        madctl = (CMD_MADCTL == commands[i].cmd) ? commands[i].params[0] : madctl;
+    }
+    TEST_ASSERT_EQUAL_INT(MADCTL_LANDSCAPE, madctl);
+    TEST_ASSERT_EQUAL_INT(1, count_commands(CMD_SLPOUT));
+    TEST_ASSERT_EQUAL_INT(1, count_commands(CMD_DISPON));
+}
+
+static void llui_display_semaphores_f(void)
+{
+    /* The MicroUI semaphores are binary: the second give is lost */
+    LLUI_DISPLAY_IMPL_binarySemaphoreGive(init_data.binary_semaphore_0, false);
+    LLUI_DISPLAY_IMPL_binarySemaphoreGive(init_data.binary_semaphore_0, true);
+    LLUI_DISPLAY_IMPL_binarySemaphoreTake(init_data.binary_semaphore_0);
+    LLUI_DISPLAY_IMPL_binarySemaphoreGive(init_data.binary_semaphore_1, false);
+    LLUI_DISPLAY_IMPL_binarySemaphoreTake(init_data.binary_semaphore_1);
+}
+
+static void llui_display_full_flush_f(void)
+{
+    uint16_t* pixels = (uint16_t*)back_buffer;
+    uint8_t* flushed = back_buffer;
+
+    for (uint32_t i = 0; i < WIDTH * HEIGHT; i++) {
+        pixels[i] = (uint16_t)rand();
+    }
+    flush(0, 0, WIDTH - 1, HEIGHT - 1);
+    TEST_ASSERT(gram_matches(flushed));
+
+#ifdef LLUI_DISPLAY_DOUBLE_BUFFER_ENABLED
+    /* The new back buffer is restored with the flushed frame */
+    TEST_ASSERT(back_buffer != flushed);
+    TEST_ASSERT(memcmp(back_buffer, flushed, WIDTH * HEIGHT * BYTES_PER_PIXEL) == 0);
+#endif
+}
+
+static void llui_display_partial_flush_f(void)
+{
+    lcd_bus_stats_t stats;
+    uint8_t* flushed;
+
+    /* Random drawings, each flushed with its own bounding box */
+    for (int32_t i = 0; i < 200; i++) {
+        uint32_t x1 = (uint32_t)rand() % (WIDTH - 40);
+        uint32_t y1 = (uint32_t)rand() % (HEIGHT - 20);
+        uint32_t x2 = x1 + ((uint32_t)rand() % 40);
+        uint32_t y2 = y1 + ((uint32_t)rand() % 20);
+        flushed = back_buffer;
+        fill(flushed, x1, y1, x2, y2, (uint16_t)rand());
+        flush(x1, y1, x2, y2);
+        TEST_ASSERT(gram_matches(flushed));
+#ifdef LLUI_DISPLAY_DOUBLE_BUFFER_ENABLED
+        TEST_ASSERT(memcmp(back_buffer, flushed, WIDTH * HEIGHT * BYTES_PER_PIXEL) == 0);
+#endif
+    }
+
+    /* A small drawing only sends a small part of the screen */
+    LCD_BUS_SIM_reset_stats();
+    fill(back_buffer, 100, 100, 109, 109, 0x1234);
+    flush(100, 100, 109, 109);
+    LCD_BUS_get_stats(&stats);
+    TEST_ASSERT(stats.data_bytes < (WIDTH * HEIGHT * BYTES_PER_PIXEL) / 100);
+    TEST_ASSERT(count_commands(CMD_RAMWR) >= 1);
+}
+
+/*
+ * The orientation is applied by the LCD controller (MADCTL) before the next transfer; once
+ * MicroUI has started, only the orientations of the same size are accepted.
+ */
+static void llui_display_orientation_f(void)
+{
+    LCD_BUS_SIM_clear_commands();
+    TEST_ASSERT_EQUAL_INT(DISPLAY_ORIENTATION_LANDSCAPE, DISPLAY_ORIENTATION_get());
+    TEST_ASSERT(!DISPLAY_ORIENTATION_set(DISPLAY_ORIENTATION_PORTRAIT));
+    TEST_ASSERT(!DISPLAY_ORIENTATION_set((display_orientation_t)4));
+    TEST_ASSERT_EQUAL_INT(JFALSE, javaDisplayOrientationSet(DISPLAY_ORIENTATION_PORTRAIT_FLIP));
+    TEST_ASSERT_EQUAL_INT(JFALSE, javaDisplayOrientationSet(-1));
+    TEST_ASSERT_EQUAL_INT(DISPLAY_ORIENTATION_LANDSCAPE, javaDisplayOrientationGet());
+    /* nothing is sent until the next transfer */
+    TEST_ASSERT(DISPLAY_ORIENTATION_set(DISPLAY_ORIENTATION_LANDSCAPE_FLIP));
+    TEST_ASSERT_EQUAL_INT(0, count_commands(CMD_MADCTL));
+    TEST_ASSERT_EQUAL_INT(DISPLAY_ORIENTATION_LANDSCAPE_FLIP, javaDisplayOrientationGet());
+
+    check_orientation_flush(MADCTL_LANDSCAPE_FLIP);
+
+    /* the orientation is applied once */
+    LCD_BUS_SIM_clear_commands();
+    fill(back_buffer, 30, 30, 39, 39, 0x4321);
+    flush(30, 30, 39, 39);
+    TEST_ASSERT_EQUAL_INT(0, count_commands(CMD_MADCTL));
+
+    TEST_ASSERT_EQUAL_INT(JTRUE, javaDisplayOrientationSet(DISPLAY_ORIENTATION_LANDSCAPE));
+    check_orientation_flush(MADCTL_LANDSCAPE);
+}
+
+static void llui_display_bus_queue_f(void)
+{
+    uint8_t data[4] = { 0 };
+    int64_t start = esp_timer_get_time();
+
+    /* More transactions than the bus queue holds, without any wait: the oldest ones are waited */
+    for (uint32_t i = 0; i < 4 * LCD_BUS_QUEUE_SIZE; i++) {
+        LCD_BUS_queue_command(0x00);
+        LCD_BUS_queue_data(data, sizeof(data));
+    }
+    LCD_BUS_wait(LCD_BUS_QUEUE_SIZE);
+
+    /* Every transaction has taken at least its overhead */
+    TEST_ASSERT((esp_timer_get_time() - start) >= ((8 * LCD_BUS_QUEUE_SIZE * LCD_BUS_SIM_TRANSACTION_OVERHEAD_NS) / 1000));
+}
+
+/*
+ * A queued transaction reaches the LCD when it is waited: its buffer must stay untouched until
+ * then, a refilled buffer is sent with its new content. The parameters up to 4 bytes are copied.
+ */
+static void llui_display_bus_in_flight_f(void)
+{
+    uint8_t window[4] = { 0, 0, 0, 15 };
+    uint8_t pixels[64];
+    uint8_t second_row[32];
+    const uint8_t* gram = LCD_BUS_SIM_get_gram();
+
+    memcpy(second_row, &gram[LCD_BUS_SIM_GRAM_SIDE * BYTES_PER_PIXEL], sizeof(second_row));
+    memset(pixels, 0x11, sizeof(pixels));
+    LCD_BUS_queue_command(CMD_CASET);
+    LCD_BUS_queue_data(window, sizeof(window));
+    LCD_BUS_queue_command(CMD_RASET);
+    window[3] = 0;
+    LCD_BUS_queue_data(window, sizeof(window));
+    LCD_BUS_queue_command(CMD_RAMWR);
+    LCD_BUS_queue_data(pixels, sizeof(pixels));
+
+    /* refilled in flight: the second half wraps in the one row window, as queued */
+    memset(pixels, 0x22, sizeof(pixels) / 2);
+    memset(&pixels[sizeof(pixels) / 2], 0x33, sizeof(pixels) / 2);
+    window[3] = 1;
+    LCD_BUS_wait(6);
+    for (uint32_t i = 0; i < sizeof(second_row); i++) {
+        TEST_ASSERT_EQUAL_INT(0x33, gram[i]);
+    }
+    TEST_ASSERT(memcmp(second_row, &gram[LCD_BUS_SIM_GRAM_SIDE * BYTES_PER_PIXEL], sizeof(second_row)) == 0);
+}
+
+/*
+ * The display buffers are in PSRAM, which is not DMA capable: the lines are copied to the
+ * chunks ring. When the display buffer is DMA capable, the whole lines are sent without copy.
+ */
+static void llui_display_dma_capable_f(void)
+{
+    uint16_t* pixels;
+    uint8_t* flushed;
+
+    for (int32_t zero_copy = 0; zero_copy < 2; zero_copy++) {
+        pixels = (uint16_t*)back_buffer;
+        flushed = back_buffer;
+        for (uint32_t i = 0; i < WIDTH * HEIGHT; i++) {
+            pixels[i] = (uint16_t)rand();
+        }
+        LCD_BUS_SIM_set_dma_capable(flushed, zero_copy ? (WIDTH * HEIGHT * BYTES_PER_PIXEL) : 0);
+        LCD_BUS_SIM_reset_stats();
+        flush(0, 0, WIDTH - 1, HEIGHT - 1);
+        TEST_ASSERT(gram_matches(flushed));
+        TEST_ASSERT_EQUAL_INT(0, LCD_BUS_SIM_get_non_dma_transactions());
+        if (zero_copy) {
+            TEST_ASSERT(LCD_BUS_SIM_get_dma_range_transactions() > 0);
+        } else {
+            TEST_ASSERT_EQUAL_INT(0, LCD_BUS_SIM_get_dma_range_transactions());
+        }
+    }
+    LCD_BUS_SIM_set_dma_capable(NULL, 0);
+}
+
+TestRef llui_display_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture("llui_display_initialize", llui_display_initialize_f),
+        new_TestFixture("llui_display_semaphores", llui_display_semaphores_f),
+        new_TestFixture("llui_display_full_flush", llui_display_full_flush_f),
+        new_TestFixture("llui_display_partial_flush", llui_display_partial_flush_f),
+        new_TestFixture("llui_display_orientation", llui_display_orientation_f),
+        new_TestFixture("llui_display_bus_queue", llui_display_bus_queue_f),
+        new_TestFixture("llui_display_bus_in_flight", llui_display_bus_in_flight_f),
+        new_TestFixture("llui_display_dma_capable", llui_display_dma_capable_f),
+    };
+    EMB_UNIT_TESTCALLER(llui_display, "llui_display", setUp, tearDown, fixtures);
+
+    return (TestRef)&llui_display;
+}
@@ -0,0 +1,233 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Tests of the dirty regions detection (display_dirty_regions.c).
+ *
+ * A panel model receives the rectangles returned by DISPLAY_DIRTY_REGIONS_detect(): after each
+ * flush, the panel must show the frame buffer content.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <embUnit/embUnit.h>
+#include "display_dirty_regions.h"
+
+#define WIDTH 320
+#define HEIGHT 240
+#define TILES_COUNT (((WIDTH + LLUI_DISPLAY_DIRTY_TILE_SIZE - 1) / LLUI_DISPLAY_DIRTY_TILE_SIZE) * ((HEIGHT + LLUI_DISPLAY_DIRTY_TILE_SIZE - 1) / LLUI_DISPLAY_DIRTY_TILE_SIZE))
+
+static uint16_t frame_buffer[WIDTH * HEIGHT];
+static uint16_t panel[WIDTH * HEIGHT];
+static display_dirty_regions_t regions;
+
+static void fill(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, uint16_t color)
+{
+    for (uint32_t y = y1; y <= y2; y++) {
+        for (uint32_t x = x1; x <= x2; x++) {
+            frame_buffer[(y * WIDTH) + x] = color;
+        }
+    }
+}
+
+/*
+ * Flush the given bounding box: the rectangles to transfer are copied to the panel.
+ * Return the number of bytes transferred.
+ */
+static uint32_t flush(uint32_t xmin, uint32_t ymin, uint32_t xmax, uint32_t ymax)
+{
+    DISPLAY_DIRTY_REGIONS_detect(&regions, (uint8_t*)frame_buffer, WIDTH, HEIGHT, xmin, ymin, xmax, ymax);
+    for (uint32_t i = 0; i < regions.count; i++) {
+        display_rect_t* rect = &regions.rects[i];
+        for (uint32_t y = rect->y1; y <= rect->y2; y++) {
+            memcpy(&panel[(y * WIDTH) + rect->x1], &frame_buffer[(y * WIDTH) + rect->x1], (rect->x2 - rect->x1 + 1) * sizeof(uint16_t));
+        }
+    }
+    return DISPLAY_DIRTY_REGIONS_get_bytes(&regions);
+}
+
+static int panel_matches(void)
+{
+    return memcmp(panel, frame_buffer, sizeof(panel)) == 0;
+}
+
+static void setUp(void)
+{
+    srand(1);
+    memset(frame_buffer, 0, sizeof(frame_buffer));
+    memset(panel, 0xA5, sizeof(panel));
+    DISPLAY_DIRTY_REGIONS_invalidate();
+    DISPLAY_DIRTY_REGIONS_reset_stats();
+}
+
+static void tearDown(void)
+{
+}
+
+static void dirty_regions_merge_f(void)
+{
+    DISPLAY_DIRTY_REGIONS_clear(&regions);
+
+    /* Overlapping rectangles are merged */
+    DISPLAY_DIRTY_REGIONS_add(&regions, 0, 0, 15, 15);
+    DISPLAY_DIRTY_REGIONS_add(&regions, 8, 8, 31, 31);
+    TEST_ASSERT_EQUAL_INT(1, regions.count);
+    TEST_ASSERT_EQUAL_INT(32 * 32 * 2, DISPLAY_DIRTY_REGIONS_get_bytes(&regions));
+
+    /* Far rectangles are kept apart: the merge would cost more than a window setup */
+    DISPLAY_DIRTY_REGIONS_add(&regions, 200, 200, 215, 215);
+    TEST_ASSERT_EQUAL_INT(2, regions.count);
+
+    /* The queue never holds more than LLUI_DISPLAY_DIRTY_REGIONS_MAX rectangles */
+    DISPLAY_DIRTY_REGIONS_clear(&regions);
+    for (uint32_t i = 0; i < 4 * LLUI_DISPLAY_DIRTY_REGIONS_MAX; i++) {
+        uint32_t x = (i % 8) * 40;
+        uint32_t y = (i / 8) * 60;
+        DISPLAY_DIRTY_REGIONS_add(&regions, x, y, x + 3, y + 3);
+        TEST_ASSERT(regions.count <= LLUI_DISPLAY_DIRTY_REGIONS_MAX);
+    }
+}
+
+static void dirty_regions_first_flush_f(void)
+{
+    /* The LCD content is unknown: the whole bounding box is sent */
+    TEST_ASSERT_EQUAL_INT(WIDTH * HEIGHT * 2, flush(0, 0, WIDTH - 1, HEIGHT - 1));
+    TEST_ASSERT(panel_matches());
+
+    /* Nothing has changed: only the refreshed tiles are sent */
+    TEST_ASSERT(flush(0, 0, WIDTH - 1, HEIGHT - 1) <= (LLUI_DISPLAY_DIRTY_REGIONS_REFRESH_TILES * LLUI_DISPLAY_DIRTY_TILE_SIZE * LLUI_DISPLAY_DIRTY_TILE_SIZE * 2));
+}
+
+static void dirty_regions_changes_f(void)
+{
+    flush(0, 0, WIDTH - 1, HEIGHT - 1);
+
+    /* Two small changes in opposite corners: two small rectangles instead of the whole box */
+    fill(2, 3, 20, 25, 0x1234);
+    fill(300, 220, 315, 235, 0x4321);
+    TEST_ASSERT(flush(2, 3, 315, 235) < (WIDTH * HEIGHT * 2) / 10);
+    TEST_ASSERT(panel_matches());
+
+    /* Random drawings, each flushed with its own bounding box */
+    for (int32_t i = 0; i < 500; i++) {
+        uint32_t x1 = (uint32_t)rand() % (WIDTH - 40);
+        uint32_t y1 = (uint32_t)rand() % (HEIGHT - 20);
+        uint32_t x2 = x1 + ((uint32_t)rand() % 40);
+        uint32_t y2 = y1 + ((uint32_t)rand() % 20);
+        fill(x1, y1, x2, y2, (uint16_t)rand());
+        flush(x1, y1, x2, y2);
+        TEST_ASSERT(panel_matches());
+    }
+}
+
+static void dirty_regions_partial_tiles_f(void)
+{
+    /* First flush over the top left quarter of the first tile only: the rest of the LCD is unknown */
+    fill(0, 0, WIDTH - 1, HEIGHT - 1, 0x5555);
+    flush(0, 0, (LLUI_DISPLAY_DIRTY_TILE_SIZE / 2) - 1, (LLUI_DISPLAY_DIRTY_TILE_SIZE / 2) - 1);
+
+    /* The first tile is then flushed whole without any change: the unsent part must be sent */
+    flush(0, 0, LLUI_DISPLAY_DIRTY_TILE_SIZE - 1, LLUI_DISPLAY_DIRTY_TILE_SIZE - 1);
+    TEST_ASSERT(memcmp(panel, frame_buffer, LLUI_DISPLAY_DIRTY_TILE_SIZE * sizeof(uint16_t)) == 0);
+    flush(0, 0, WIDTH - 1, HEIGHT - 1);
+    TEST_ASSERT(panel_matches());
+}
+
+static void dirty_regions_unaligned_box_f(void)
+{
+    flush(0, 0, WIDTH - 1, HEIGHT - 1);
+
+    /* Bounding boxes starting on odd pixels: the rows are not word-aligned */
+    for (uint32_t x = 1; x < 8; x++) {
+        fill(x, x, x + 30, x + 30, (uint16_t)(0x1000 + x));
+        flush(x, x, x + 30, x + 30);
+        TEST_ASSERT(panel_matches());
+    }
+}
+
+/*
+ * Changes of the same bit in two words of a tile, the other pixels unchanged: a hash which only
+ * spreads a bit toward the higher bits (xor-multiply on words) cancels the two changes of the
+ * high bits out. Each change must be sent by its own flush, before the refreshed tiles reach the
+ * tile.
+ */
+static void dirty_regions_same_bit_changes_f(void)
+{
+    /* pairs of pixels of the tile (5,5) in different words: same row, same column */
+    static const uint32_t pairs[][4] = { { 81, 80, 83, 80 }, { 80, 80, 95, 80 }, { 81, 80, 81, 95 } };
+
+    flush(0, 0, WIDTH - 1, HEIGHT - 1);
+    for (uint32_t bit = 0; bit < 16; bit++) {
+        for (uint32_t i = 0; i < (sizeof(pairs) / sizeof(pairs[0])); i++) {
+            const uint32_t* p = pairs[i];
+            frame_buffer[(p[1] * WIDTH) + p[0]] ^= (uint16_t)(1u << bit);
+            frame_buffer[(p[3] * WIDTH) + p[2]] ^= (uint16_t)(1u << bit);
+            flush(80, 80, 95, 95);
+            TEST_ASSERT(panel_matches());
+        }
+    }
+}
+
+static void dirty_regions_refresh_f(void)
+{
+    flush(0, 0, WIDTH - 1, HEIGHT - 1);
+
+    /* A stale pixel on the panel (e.g. a signature collision) is repaired by the refreshed tiles */
+    panel[(123 * WIDTH) + 45] ^= 0xFFFF;
+    TEST_ASSERT(!panel_matches());
+    for (uint32_t i = 0; i < (TILES_COUNT / LLUI_DISPLAY_DIRTY_REGIONS_REFRESH_TILES); i++) {
+        flush(0, 0, 0, 0);
+    }
+    TEST_ASSERT(panel_matches());
+}
+
+/*
+ * Bytes transferred with and without the dirty regions detection on a clock-like scenario:
+ * a full screen background, then every frame a small digits area and a progress bar redrawn
+ * in opposite corners with a single flush bounding box.
+ */
+static void dirty_regions_transfer_report_f(void)
+{
+    display_dirty_regions_stats_t stats;
+    uint32_t permille;
+
+    fill(0, 0, WIDTH - 1, HEIGHT - 1, 0x0010);
+    flush(0, 0, WIDTH - 1, HEIGHT - 1);
+    DISPLAY_DIRTY_REGIONS_reset_stats();
+
+    for (uint32_t frame = 0; frame < 600; frame++) {
+        fill(10, 10, 73, 41, (uint16_t)(frame / 60));
+        fill(20, HEIGHT - 20, 20 + ((frame * 280) / 600), HEIGHT - 12, 0xFFFF);
+        flush(10, 10, 300, HEIGHT - 12);
+        TEST_ASSERT(panel_matches());
+    }
+
+    DISPLAY_DIRTY_REGIONS_get_stats(&stats);
+    TEST_ASSERT(stats.transferred_bytes < stats.bbox_bytes);
+    permille = (uint32_t)((stats.transferred_bytes * 1000) / stats.bbox_bytes);
+    printf("DIRTY_REGIONS: %u flushes, %u rects, bounding boxes %llu bytes, transferred %llu bytes (%u.%u%%)\n",
+            (unsigned int)stats.flush_count, (unsigned int)stats.rect_count, (unsigned long long)stats.bbox_bytes,
+            (unsigned long long)stats.transferred_bytes, (unsigned int)(permille / 10), (unsigned int)(permille % 10));
+}
+
+TestRef display_dirty_regions_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture("dirty_regions_merge", dirty_regions_merge_f),
+        new_TestFixture("dirty_regions_first_flush", dirty_regions_first_flush_f),
+        new_TestFixture("dirty_regions_changes", dirty_regions_changes_f),
+        new_TestFixture("dirty_regions_partial_tiles", dirty_regions_partial_tiles_f),
+        new_TestFixture("dirty_regions_unaligned_box", dirty_regions_unaligned_box_f),
+        new_TestFixture("dirty_regions_same_bit_changes", dirty_regions_same_bit_changes_f),
+        new_TestFixture("dirty_regions_refresh", dirty_regions_refresh_f),
+        new_TestFixture("dirty_regions_transfer_report", dirty_regions_transfer_report_f),
+    };
+    EMB_UNIT_TESTCALLER(display_dirty_regions, "display_dirty_regions", setUp, tearDown, fixtures);
+
+    return (TestRef)&display_dirty_regions;
+}
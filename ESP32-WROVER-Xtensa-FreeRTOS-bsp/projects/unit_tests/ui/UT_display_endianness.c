@@ -0,0 +1,113 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Tests of the RGB565 endianness conversion (display_endianness.c) against a scalar swap.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <embUnit/embUnit.h>
+#include "display_endianness.h"
+
+#define MAX_PIXELS 300
+#define BUFFER_SIZE ((MAX_PIXELS * 2) + 16)
+
+#define SPEED_LENGTH 4000
+#define SPEED_LOOPS 20000
+
+static uint8_t src[BUFFER_SIZE];
+static uint8_t dst[BUFFER_SIZE];
+static uint8_t expected[BUFFER_SIZE];
+
+/* Scalar reference: one pixel at a time */
+static void scalar_swap(uint8_t* buffer, uint32_t length)
+{
+    for (uint32_t i = 0; i < length; i += 2) {
+        uint8_t byte = buffer[i];
+        buffer[i] = buffer[i + 1];
+        buffer[i + 1] = byte;
+    }
+}
+
+static void setUp(void)
+{
+    srand(1);
+    for (uint32_t i = 0; i < sizeof(src); i++) {
+        src[i] = (uint8_t)rand();
+    }
+}
+
+static void tearDown(void)
+{
+}
+
+static void endianness_copy_swap_f(void)
+{
+    /* Every source and destination alignment, every length up to several unrolled iterations */
+    for (uint32_t src_offset = 0; src_offset < 8; src_offset += 2) {
+        for (uint32_t dst_offset = 0; dst_offset < 8; dst_offset += 2) {
+            for (uint32_t pixels = 0; pixels <= MAX_PIXELS; pixels++) {
+                uint32_t length = pixels * 2;
+                memset(dst, 0xAA, sizeof(dst));
+                memset(expected, 0xAA, sizeof(expected));
+                memcpy(expected + dst_offset, src + src_offset, length);
+                scalar_swap(expected + dst_offset, length);
+
+                DISPLAY_ENDIANNESS_copy_swap(dst + dst_offset, src + src_offset, length);
+
+                /* The bytes around the destination are left untouched */
+                TEST_ASSERT(memcmp(dst, expected, sizeof(dst)) == 0);
+            }
+        }
+    }
+}
+
+/*
+ * Throughput of the fused copy and swap versus a copy followed by the scalar swap, on a
+ * chunk of the LCD transfer size with a source one pixel off the word boundary.
+ */
+static void endianness_speed_f(void)
+{
+    static uint8_t speed_src[SPEED_LENGTH + 4];
+    static uint8_t speed_dst[SPEED_LENGTH];
+    clock_t start;
+    double scalar_time;
+    double fused_time;
+
+    start = clock();
+    for (uint32_t i = 0; i < SPEED_LOOPS; i++) {
+        memcpy(speed_dst, speed_src + 2, SPEED_LENGTH);
+        scalar_swap(speed_dst, SPEED_LENGTH);
+        __asm__ volatile("" : : "r"(speed_dst) : "memory");
+    }
+    scalar_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (uint32_t i = 0; i < SPEED_LOOPS; i++) {
+        DISPLAY_ENDIANNESS_copy_swap(speed_dst, speed_src + 2, SPEED_LENGTH);
+        __asm__ volatile("" : : "r"(speed_dst) : "memory");
+    }
+    fused_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("DISPLAY_ENDIANNESS: memcpy + scalar swap %f MBytes/s, copy_swap %f MBytes/s\n",
+            ((double)SPEED_LENGTH * SPEED_LOOPS) / (scalar_time * 1024.0 * 1024.0),
+            ((double)SPEED_LENGTH * SPEED_LOOPS) / (fused_time * 1024.0 * 1024.0));
+}
+
+TestRef display_endianness_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture("endianness_copy_swap", endianness_copy_swap_f),
+        new_TestFixture("endianness_speed", endianness_speed_f),
+    };
+    EMB_UNIT_TESTCALLER(display_endianness, "display_endianness", setUp, tearDown, fixtures);
+
+    return (TestRef)&display_endianness;
+}
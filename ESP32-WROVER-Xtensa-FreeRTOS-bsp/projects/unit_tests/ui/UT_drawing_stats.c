@@ -0,0 +1,240 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Tests of the drawing statistics (drawing_stats.c, built with DRAWING_STATS_ENABLED).
+ *
+ * The drawings are timed with synthetic values of the cycle counter (cpu_stub.h): the durations
+ * histogram, the pixels of the drawn regions and the identifiers slots are checked exactly.
+ */
+
+#include <stdio.h>
+#include <embUnit/embUnit.h>
+#include "drawing_stats.h"
+#include "LLDW_PAINTER_impl.h"
+#include "ui_drawing_stub.h"
+#include "cpu_stub.h"
+
+/* LOG_DRAW identifiers of LLUI_PAINTER_impl.c and LLDW_PAINTER_impl.c */
+#define LOG_DRAW_fillRectangle 6
+#define LOG_DRAW_drawThickFadedLine 101
+#define LOG_DRAW_drawFlippedImage 200
+
+#define WIDTH 240
+#define HEIGHT 320
+
+static MICROUI_GraphicsContext gc;
+static MICROUI_Image image = { .width = 40, .height = 20, .format = MICROUI_IMAGE_FORMAT_RGB565 };
+
+static void setUp(void)
+{
+    UI_DRAWING_STUB_reset();
+    UI_DRAWING_STUB_init_gc(&gc, MICROUI_IMAGE_FORMAT_LCD, WIDTH, HEIGHT, NULL, WIDTH * 2);
+    CPU_STUB_set_core(0);
+    CPU_STUB_set_cycles(0);
+    DRAWING_STATS_reset();
+}
+
+static void tearDown(void)
+{
+    DRAWING_STATS_reset();
+}
+
+/*
+ * Time a drawing of the given duration (in cycles) starting at the given cycle counter value.
+ */
+static void draw(uint8_t id, uint32_t start, uint32_t cycles)
+{
+    CPU_STUB_set_cycles(start);
+    DRAWING_STATS_START();
+    CPU_STUB_set_cycles(start + cycles);
+    DRAWING_STATS_END(id);
+}
+
+/*
+ * Pixels of the drawing region given by a call to DRAWING_STATS_region() or to one of the
+ * region helpers.
+ */
+#define REGION_PIXELS(region) ( \
+    DRAWING_STATS_reset(), \
+    DRAWING_STATS_START(), \
+    (region), \
+    DRAWING_STATS_END(LOG_DRAW_fillRectangle), \
+    DRAWING_STATS_get(LOG_DRAW_fillRectangle)->pixels)
+
+static void drawing_stats_region_f(void)
+{
+    /* corners in any order */
+    TEST_ASSERT(21 * 16 == REGION_PIXELS(DRAWING_STATS_region(&gc, 10, 5, 30, 20)));
+    TEST_ASSERT(21 * 16 == REGION_PIXELS(DRAWING_STATS_region(&gc, 30, 20, 10, 5)));
+    TEST_ASSERT(21 * 16 == REGION_PIXELS(DRAWING_STATS_region(&gc, 10, 20, 30, 5)));
+    TEST_ASSERT(1 == REGION_PIXELS(DRAWING_STATS_region(&gc, 7, 7, 7, 7)));
+
+    /* clipped */
+    TEST_ASSERT(WIDTH * HEIGHT == REGION_PIXELS(DRAWING_STATS_region(&gc, -100, -100, 1000, 1000)));
+    UI_DRAWING_STUB_set_clip(&gc, 15, 10, 25, 12);
+    TEST_ASSERT(11 * 3 == REGION_PIXELS(DRAWING_STATS_region(&gc, 10, 5, 30, 20)));
+    TEST_ASSERT(0 == REGION_PIXELS(DRAWING_STATS_region(&gc, 26, 5, 30, 20)));
+    TEST_ASSERT(0 == REGION_PIXELS(DRAWING_STATS_region(&gc, 10, 13, 30, 20)));
+
+    /* regions of the same drawing add up */
+    UI_DRAWING_STUB_set_clip(&gc, 0, 0, WIDTH - 1, HEIGHT - 1);
+    DRAWING_STATS_START();
+    DRAWING_STATS_REGION(&gc, 0, 0, 9, 9);
+    DRAWING_STATS_REGION(&gc, 0, 0, 4, 4);
+    DRAWING_STATS_END(LOG_DRAW_fillRectangle);
+    TEST_ASSERT(100 + 25 == DRAWING_STATS_get(LOG_DRAW_fillRectangle)->pixels);
+}
+
+static void drawing_stats_shapes_f(void)
+{
+    /* bounding box of the line widened by the margin, whatever its direction */
+    TEST_ASSERT(27 * 12 == REGION_PIXELS(DRAWING_STATS_line_region(&gc, 10, 20, 30, 25, 3)));
+    TEST_ASSERT(27 * 12 == REGION_PIXELS(DRAWING_STATS_line_region(&gc, 30, 25, 10, 20, 3)));
+    TEST_ASSERT(27 * 12 == REGION_PIXELS(DRAWING_STATS_line_region(&gc, 10, 25, 30, 20, 3)));
+    TEST_ASSERT(3 * 3 == REGION_PIXELS(DRAWING_STATS_line_region(&gc, 5, 5, 5, 5, 1)));
+
+    /* the quarter turns swap the width and the height */
+    UI_DRAWING_STUB_set_clip(&gc, 0, 0, 49, 29);
+    TEST_ASSERT(40 * 20 == REGION_PIXELS(DRAWING_STATS_flipped_image_region(&gc, 0, 0, 40, 20, DRAWING_FLIP_NONE)));
+    TEST_ASSERT(40 * 20 == REGION_PIXELS(DRAWING_STATS_flipped_image_region(&gc, 0, 0, 40, 20, DRAWING_FLIP_MIRROR_180)));
+    TEST_ASSERT(20 * 30 == REGION_PIXELS(DRAWING_STATS_flipped_image_region(&gc, 0, 0, 40, 20, DRAWING_FLIP_90)));
+    TEST_ASSERT(20 * 30 == REGION_PIXELS(DRAWING_STATS_flipped_image_region(&gc, 0, 0, 40, 20, DRAWING_FLIP_MIRROR_270)));
+
+    /* bounding box of the rotated image: a quarter turn around its center, then 45 degrees */
+    UI_DRAWING_STUB_set_clip(&gc, 0, 0, WIDTH - 1, HEIGHT - 1);
+    TEST_ASSERT(40 * 20 == REGION_PIXELS(DRAWING_STATS_rotated_image_region(&gc, &image, 100, 100, 120, 110, 0.0f)));
+    TEST_ASSERT(40 * 20 == REGION_PIXELS(DRAWING_STATS_rotated_image_region(&gc, &image, 100, 100, 120, 110, 90.0f)));
+    TEST_ASSERT(40 * 20 == REGION_PIXELS(DRAWING_STATS_rotated_image_region(&gc, &image, 100, 100, 120, 110, -270.0f)));
+    TEST_ASSERT(42 * 42 == REGION_PIXELS(DRAWING_STATS_rotated_image_region(&gc, &image, 100, 100, 120, 110, 45.0f)));
+    /* rotated around its top-left corner, partly out of the clip */
+    TEST_ASSERT(20 * 40 == REGION_PIXELS(DRAWING_STATS_rotated_image_region(&gc, &image, 100, 100, 100, 100, 90.0f)));
+    TEST_ASSERT(20 * 40 == REGION_PIXELS(DRAWING_STATS_rotated_image_region(&gc, &image, 100, 100, 100, 100, 270.0f)));
+    TEST_ASSERT(20 * 10 == REGION_PIXELS(DRAWING_STATS_rotated_image_region(&gc, &image, 10, 10, 10, 10, 90.0f)));
+}
+
+/*
+ * The class 0 holds the durations lower than 256 cycles, each next class doubles the upper bound.
+ */
+static void drawing_stats_histogram_f(void)
+{
+    static const uint32_t durations[] = { 0, 255, 256, 511, 512, 1000, 65535, 65536, 0x7fffffff, 0xffffffff };
+    static const uint32_t classes[] = { 0, 0, 1, 1, 2, 2, 8, 9, 15, 15 };
+    uint32_t histogram[DRAWING_STATS_HISTOGRAM_SIZE] = { 0 };
+    uint64_t cycles = 0;
+    const DRAWING_STATS_entry_t* entry;
+
+    for (uint32_t i = 0; i < (sizeof(durations) / sizeof(durations[0])); i++) {
+        draw(LOG_DRAW_drawThickFadedLine, 1000, durations[i]);
+        histogram[classes[i]]++;
+        cycles += durations[i];
+    }
+    /* the cycle counter wraps around */
+    draw(LOG_DRAW_drawThickFadedLine, 0xffffff00, 0x200);
+    histogram[2]++;
+    cycles += 0x200;
+
+    entry = DRAWING_STATS_get(LOG_DRAW_drawThickFadedLine);
+    TEST_ASSERT_EQUAL_INT(11, entry->calls);
+    TEST_ASSERT(cycles == entry->cycles);
+    TEST_ASSERT(0xffffffff == entry->max_cycles);
+    TEST_ASSERT(0 == entry->pixels);
+    for (uint32_t i = 0; i < DRAWING_STATS_HISTOGRAM_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(histogram[i], entry->histogram[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(0, DRAWING_STATS_get_untimed());
+}
+
+/*
+ * A drawing during which the task moved to the other core is counted but not timed.
+ */
+static void drawing_stats_untimed_f(void)
+{
+    const DRAWING_STATS_entry_t* entry;
+
+    draw(LOG_DRAW_fillRectangle, 0, 300);
+    CPU_STUB_set_cycles(1000);
+    DRAWING_STATS_START();
+    DRAWING_STATS_REGION(&gc, 0, 0, 9, 9);
+    CPU_STUB_set_core(1);
+    CPU_STUB_set_cycles(100000);
+    DRAWING_STATS_END(LOG_DRAW_fillRectangle);
+    draw(LOG_DRAW_fillRectangle, 0, 300);
+
+    entry = DRAWING_STATS_get(LOG_DRAW_fillRectangle);
+    TEST_ASSERT_EQUAL_INT(3, entry->calls);
+    TEST_ASSERT(100 == entry->pixels);
+    TEST_ASSERT(600 == entry->cycles);
+    TEST_ASSERT_EQUAL_INT(300, entry->max_cycles);
+    TEST_ASSERT_EQUAL_INT(2, entry->histogram[1]);
+    TEST_ASSERT_EQUAL_INT(1, DRAWING_STATS_get_untimed());
+
+    DRAWING_STATS_reset();
+    TEST_ASSERT_EQUAL_INT(0, DRAWING_STATS_get(LOG_DRAW_fillRectangle)->calls);
+    TEST_ASSERT_EQUAL_INT(0, DRAWING_STATS_get_untimed());
+}
+
+/*
+ * Each LOG_DRAW identifier has its own slot; the other identifiers are ignored.
+ */
+static void drawing_stats_identifiers_f(void)
+{
+    static const uint8_t known[] = { 0, 19, 100, 108, 200, 204 };
+    static const uint8_t unknown[] = { 20, 99, 109, 199, 205, 255 };
+
+    for (uint32_t i = 0; i < sizeof(known); i++) {
+        for (uint32_t calls = 0; calls <= i; calls++) {
+            draw(known[i], 0, 10);
+        }
+    }
+    for (uint32_t i = 0; i < sizeof(unknown); i++) {
+        draw(unknown[i], 0, 10);
+        TEST_ASSERT(NULL == DRAWING_STATS_get(unknown[i]));
+    }
+    for (uint32_t i = 0; i < sizeof(known); i++) {
+        TEST_ASSERT_EQUAL_INT(i + 1, DRAWING_STATS_get(known[i])->calls);
+    }
+    for (uint32_t id = 0; id < 256; id++) {
+        bool is_known = (id < 20) || ((id >= 100) && (id <= 108)) || ((id >= 200) && (id <= 204));
+        TEST_ASSERT(is_known == (NULL != DRAWING_STATS_get((uint8_t)id)));
+    }
+}
+
+static void drawing_stats_report_f(void)
+{
+    for (uint32_t i = 0; i < 1000; i++) {
+        CPU_STUB_set_cycles(0);
+        DRAWING_STATS_START();
+        DRAWING_STATS_REGION(&gc, 0, 0, i % WIDTH, i % HEIGHT);
+        CPU_STUB_set_cycles(100 + (i * 100));
+        DRAWING_STATS_END(LOG_DRAW_fillRectangle);
+        CPU_STUB_set_cycles(0);
+        DRAWING_STATS_START();
+        DRAWING_STATS_FLIPPED_IMAGE_REGION(&gc, 0, 0, 40, 20, DRAWING_FLIP_270);
+        CPU_STUB_set_cycles(24000);
+        DRAWING_STATS_END(LOG_DRAW_drawFlippedImage);
+    }
+    TEST_ASSERT(1000 * 20 * 40 == DRAWING_STATS_get(LOG_DRAW_drawFlippedImage)->pixels);
+    /* 24000 cycles: 100 us at CPU_STUB_FREQUENCY */
+    TEST_ASSERT(1000 * 24000 == DRAWING_STATS_get(LOG_DRAW_drawFlippedImage)->cycles);
+    DRAWING_STATS_dump();
+}
+
+TestRef drawing_stats_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture("drawing_stats_region", drawing_stats_region_f),
+        new_TestFixture("drawing_stats_shapes", drawing_stats_shapes_f),
+        new_TestFixture("drawing_stats_histogram", drawing_stats_histogram_f),
+        new_TestFixture("drawing_stats_untimed", drawing_stats_untimed_f),
+        new_TestFixture("drawing_stats_identifiers", drawing_stats_identifiers_f),
+        new_TestFixture("drawing_stats_report", drawing_stats_report_f),
+    };
+    EMB_UNIT_TESTCALLER(drawing_stats, "drawing_stats", setUp, tearDown, fixtures);
+
+    return (TestRef)&drawing_stats;
+}
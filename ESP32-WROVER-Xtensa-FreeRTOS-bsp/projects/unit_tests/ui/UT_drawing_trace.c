@@ -0,0 +1,280 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Tests of the drawing trace recorder (drawing_trace.c, built with DRAWING_TRACE_ENABLED).
+ *
+ * The log is decoded again and compared with the recorded drawings. The last test records
+ * frames drawn by the RGB565 kernels and prints the log and the CRC32 of the frames: "make
+ * run-replay" replays this log with drawing_trace_replay and checks that the replayed frames
+ * have the same checksums.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <embUnit/embUnit.h>
+#include "drawing_trace.h"
+#include "ui_drawing.h"
+#include "dw_drawing.h"
+#include "ui_drawing_stub.h"
+
+/* LOG_DRAW identifiers of LLUI_PAINTER_impl.c and LLDW_PAINTER_impl.c */
+#define LOG_DRAW_drawHorizontalLine 3
+#define LOG_DRAW_fillRectangle 6
+#define LOG_DRAW_drawImage 19
+#define LOG_DRAW_drawThickFadedLine 101
+#define LOG_DRAW_drawThickFadedCircle 102
+
+/* Frames of the replayed trace */
+#define FRAME_WIDTH 240
+#define FRAME_HEIGHT 320
+#define FRAMES 20
+
+static uint16_t frame[FRAME_WIDTH * FRAME_HEIGHT];
+static MICROUI_GraphicsContext gc;
+
+/*
+ * Log reader: position in the log and decoded values.
+ */
+typedef struct {
+    const uint8_t* log;
+    uint32_t length;
+    uint32_t position;
+} reader_t;
+
+static int32_t read_value(reader_t* reader)
+{
+    uint32_t zigzag = 0;
+    uint32_t shift = 0;
+    uint8_t byte;
+
+    do {
+        byte = reader->log[reader->position++];
+        zigzag |= (uint32_t)(byte & 0x7f) << shift;
+        shift += 7;
+    } while (0 != (byte & 0x80));
+    return (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+}
+
+/*
+ * Read a record and check its tag and values; a drawing record starts with its identifier
+ * and its arguments count.
+ */
+static bool read_record(reader_t* reader, uint8_t tag, const int32_t* values, uint32_t count)
+{
+    if ((reader->position >= reader->length) || (tag != reader->log[reader->position++])) {
+        return false;
+    }
+    if (DRAWING_TRACE_TAG_DRAW == tag) {
+        if ((values[0] != reader->log[reader->position]) || ((count - 1) != reader->log[reader->position + 1])) {
+            return false;
+        }
+        reader->position += 2;
+        values++;
+        count--;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (values[i] != read_value(reader)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Skip a target or state record of the given number of values.
+ */
+static void skip_record(reader_t* reader, uint32_t count)
+{
+    reader->position++;
+    for (uint32_t i = 0; i < count; i++) {
+        (void)read_value(reader);
+    }
+}
+
+static uint32_t crc32(const uint8_t* data, uint32_t length)
+{
+    uint32_t crc = 0xffffffff;
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (uint32_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+static void setUp(void)
+{
+    memset(frame, 0, sizeof(frame));
+    UI_DRAWING_STUB_reset();
+    UI_DRAWING_STUB_init_gc(&gc, MICROUI_IMAGE_FORMAT_LCD, FRAME_WIDTH, FRAME_HEIGHT, (uint8_t*)frame, FRAME_WIDTH * sizeof(uint16_t));
+}
+
+static void tearDown(void)
+{
+    DRAWING_TRACE_stop();
+}
+
+static void drawing_trace_records_f(void)
+{
+    static const int32_t extremes[] = { 0, -1, 63, -64, 64, 8191, -8192, 0x7fffffff, (int32_t)0x80000000 };
+    MICROUI_Image image = { .width = 12, .height = 34, .format = MICROUI_IMAGE_FORMAT_ARGB8888 };
+    reader_t reader;
+    int32_t target[] = { (int32_t)(uintptr_t)&gc.image, FRAME_WIDTH, FRAME_HEIGHT, MICROUI_IMAGE_FORMAT_LCD };
+    int32_t state[] = { 0x123456, 1, 0, 0, FRAME_WIDTH - 1, FRAME_HEIGHT - 1 };
+    int32_t fill[] = { LOG_DRAW_fillRectangle, -5, 6, 700, 80000 };
+    int32_t image_draw[] = { LOG_DRAW_drawImage, (int32_t)(uintptr_t)&image, 12, 34, MICROUI_IMAGE_FORMAT_ARGB8888, 1, 2, 3, 4, 5, 6, 255 };
+    int32_t line[] = { LOG_DRAW_drawHorizontalLine, 0, 0, 0 };
+    int32_t flush[] = { 1, 2, 3, 4 };
+
+    gc.foreground_color = 0x123456;
+    DRAWING_TRACE_start();
+    DRAWING_TRACE_RECORD(&gc, fillRectangle, -5, 6, 700, 80000);
+    DRAWING_TRACE_RECORD(&gc, drawImage, DRAWING_TRACE_IMAGE(&image), 1, 2, 3, 4, 5, 6, 255);
+    /* new state: new color then clip disabled */
+    gc.foreground_color = 0xff00ff;
+    for (uint32_t i = 0; i < (sizeof(extremes) / sizeof(extremes[0])); i++) {
+        DRAWING_TRACE_RECORD(&gc, drawHorizontalLine, extremes[i], extremes[i], extremes[i]);
+    }
+    UI_DRAWING_STUB_set_clip_enabled(false);
+    DRAWING_TRACE_RECORD(&gc, drawHorizontalLine, 0, 0, 0);
+    DRAWING_TRACE_FLUSH(1, 2, 3, 4);
+    DRAWING_TRACE_stop();
+    /* not recorded */
+    DRAWING_TRACE_RECORD(&gc, fillRectangle, 0, 0, 0, 0);
+
+    reader.length = DRAWING_TRACE_get_log(&reader.log);
+    reader.position = 4;
+    TEST_ASSERT(0 == memcmp(reader.log, DRAWING_TRACE_MAGIC, 4));
+    TEST_ASSERT(!DRAWING_TRACE_is_truncated());
+    TEST_ASSERT(read_record(&reader, DRAWING_TRACE_TAG_TARGET, target, 4));
+    TEST_ASSERT(read_record(&reader, DRAWING_TRACE_TAG_STATE, state, 6));
+    TEST_ASSERT(read_record(&reader, DRAWING_TRACE_TAG_DRAW, fill, 5));
+    TEST_ASSERT(read_record(&reader, DRAWING_TRACE_TAG_DRAW, image_draw, 12));
+    state[0] = 0xff00ff;
+    TEST_ASSERT(read_record(&reader, DRAWING_TRACE_TAG_STATE, state, 6));
+    for (uint32_t i = 0; i < (sizeof(extremes) / sizeof(extremes[0])); i++) {
+        line[1] = extremes[i];
+        line[2] = extremes[i];
+        line[3] = extremes[i];
+        TEST_ASSERT(read_record(&reader, DRAWING_TRACE_TAG_DRAW, line, 4));
+    }
+    state[1] = 0;
+    line[1] = 0;
+    line[2] = 0;
+    line[3] = 0;
+    TEST_ASSERT(read_record(&reader, DRAWING_TRACE_TAG_STATE, state, 6));
+    TEST_ASSERT(read_record(&reader, DRAWING_TRACE_TAG_DRAW, line, 4));
+    TEST_ASSERT(read_record(&reader, DRAWING_TRACE_TAG_FLUSH, flush, 4));
+    TEST_ASSERT_EQUAL_INT(reader.length, reader.position);
+}
+
+/*
+ * The recording stops at the first record which does not fit: the log holds whole records.
+ */
+static void drawing_trace_truncated_f(void)
+{
+    reader_t reader;
+    int32_t fill[] = { LOG_DRAW_fillRectangle, 0x7fffffff, 0x7fffffff, 0x7fffffff, 0x7fffffff };
+    uint32_t records = 0;
+
+    DRAWING_TRACE_start();
+    while (!DRAWING_TRACE_is_truncated()) {
+        DRAWING_TRACE_RECORD(&gc, fillRectangle, 0x7fffffff, 0x7fffffff, 0x7fffffff, 0x7fffffff);
+        records++;
+    }
+    reader.length = DRAWING_TRACE_get_log(&reader.log);
+    TEST_ASSERT(reader.length <= DRAWING_TRACE_BUFFER_SIZE);
+
+    /* no more record once truncated, even after a flush */
+    DRAWING_TRACE_FLUSH(0, 0, 0, 0);
+    TEST_ASSERT_EQUAL_INT(reader.length, DRAWING_TRACE_get_log(&reader.log));
+
+    reader.position = 4;
+    skip_record(&reader, 4);
+    skip_record(&reader, 6);
+    while (reader.position < reader.length) {
+        TEST_ASSERT(read_record(&reader, DRAWING_TRACE_TAG_DRAW, fill, 5));
+        records--;
+    }
+    TEST_ASSERT_EQUAL_INT(reader.length, reader.position);
+    /* the last call did not fit */
+    TEST_ASSERT_EQUAL_INT(1, records);
+}
+
+/*
+ * Frames drawn by the RGB565 kernels: fills, lines and faded shapes, some of them clipped.
+ * The log and the checksum of each frame are printed for "make run-replay".
+ */
+static void drawing_trace_replay_report_f(void)
+{
+    const uint8_t* log;
+
+    srand(14);
+    DRAWING_TRACE_start();
+    for (uint32_t f = 0; f < FRAMES; f++) {
+        UI_DRAWING_STUB_set_clip(&gc, 0, 0, FRAME_WIDTH - 1, FRAME_HEIGHT - 1);
+        gc.foreground_color = 0x202020;
+        DRAWING_TRACE_RECORD(&gc, fillRectangle, 0, 0, FRAME_WIDTH - 1, FRAME_HEIGHT - 1);
+        UI_DRAWING_fillRectangle(&gc, 0, 0, FRAME_WIDTH - 1, FRAME_HEIGHT - 1);
+
+        for (uint32_t d = 0; d < 30; d++) {
+            jint x = rand() % FRAME_WIDTH;
+            jint y = rand() % FRAME_HEIGHT;
+            jint size = 4 + (rand() % 60);
+
+            gc.foreground_color = rand() & 0xffffff;
+            if (0 == (d % 10)) {
+                /* the clip is always in the frame */
+                UI_DRAWING_STUB_set_clip(&gc, x / 2, y / 2, ((x + size) < FRAME_WIDTH) ? (x + size) : (FRAME_WIDTH - 1),
+                        ((y + size) < FRAME_HEIGHT) ? (y + size) : (FRAME_HEIGHT - 1));
+            }
+            switch (d % 4) {
+            case 0:
+                DRAWING_TRACE_RECORD(&gc, fillRectangle, x, y, x + size, y + (size / 2));
+                UI_DRAWING_fillRectangle(&gc, x, y, x + size, y + (size / 2));
+                break;
+            case 1:
+                DRAWING_TRACE_RECORD(&gc, drawHorizontalLine, x - size, x + size, y);
+                UI_DRAWING_drawHorizontalLine(&gc, x - size, x + size, y);
+                break;
+            case 2:
+                DRAWING_TRACE_RECORD(&gc, drawThickFadedLine, x, y, x + size, y + (size / 3), 1 + (size / 8), 1, DRAWING_ENDOFLINE_ROUNDED, DRAWING_ENDOFLINE_NONE);
+                DW_DRAWING_drawThickFadedLine(&gc, x, y, x + size, y + (size / 3), 1 + (size / 8), 1, DRAWING_ENDOFLINE_ROUNDED, DRAWING_ENDOFLINE_NONE);
+                break;
+            default:
+                DRAWING_TRACE_RECORD(&gc, drawThickFadedCircle, x, y, size, 1 + (size / 10), 1);
+                DW_DRAWING_drawThickFadedCircle(&gc, x, y, size, 1 + (size / 10), 1);
+                break;
+            }
+        }
+        /* the whole frame is flushed: it was cleared */
+        DRAWING_TRACE_FLUSH(0, 0, FRAME_WIDTH - 1, FRAME_HEIGHT - 1);
+        printf("DRAWING_TRACE_REPLAY: flush %u: [0,0]-[%d,%d] crc32 %08x\n", (unsigned int)f, FRAME_WIDTH - 1, FRAME_HEIGHT - 1,
+                (unsigned int)crc32((uint8_t*)frame, sizeof(frame)));
+    }
+    DRAWING_TRACE_stop();
+
+    TEST_ASSERT(!DRAWING_TRACE_is_truncated());
+    TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+    printf("DRAWING_TRACE_REPLAY: %u frames, %u bytes\n", (unsigned int)FRAMES, (unsigned int)DRAWING_TRACE_get_log(&log));
+    DRAWING_TRACE_dump();
+}
+
+TestRef drawing_trace_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture("drawing_trace_records", drawing_trace_records_f),
+        new_TestFixture("drawing_trace_truncated", drawing_trace_truncated_f),
+        new_TestFixture("drawing_trace_replay_report", drawing_trace_replay_report_f),
+    };
+    EMB_UNIT_TESTCALLER(drawing_trace, "drawing_trace", setUp, tearDown, fixtures);
+
+    return (TestRef)&drawing_trace;
+}
@@ -0,0 +1,1216 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Tests of the RGB565 rotation, scaling and thick faded shapes kernels (dw_drawing_rgb565.c).
+ *
+ * The kernels are compared with double precision per-pixel reference models, on a buffer filled
+ * with a random pattern, from random RGB565 and ARGB8888 images, across angles, rotation
+ * centers, scaling factors, clips and global alphas:
+ * - the rotations by a multiple of 90 degrees must be equal to the models, row padding included;
+ * - a free rotation with the nearest neighbor algorithm and a scaling must be equal to the models,
+ *   except that a pixel whose source position is within EDGE_TOLERANCE (SCALE_EDGE_TOLERANCE) of
+ *   a source pixel edge may take the pixel on either side (the kernels step the positions in 16.16
+ *   fixed point);
+ * - a free rotation with the bilinear algorithm must be within BILINEAR_TOLERANCE of the model
+ *   on each RGB565 channel (the kernel weights the pixels of an RGB565 image on 5 bits).
+ *
+ * The thick faded lines, circles and arcs are compared, across thicknesses, fades, caps and
+ * clips, with a model of the alpha given by the distance of the pixel center to the skeleton of
+ * the shape: the alpha of a pixel must lie between the alphas of the distances within the error
+ * of the kernels distances (see model_init_fade()), the opaque and transparent pixels exactly.
+ * The comparison with the software algorithms of the Graphics Engine is done on the target
+ * (projects/unit_tests/drawing/UT_dw_drawing_soft.c).
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <embUnit/embUnit.h>
+#include "dw_drawing.h"
+#include "LLUI_DISPLAY_stub.h"
+#include "ui_drawing_stub.h"
+
+/* Destination buffer: odd sizes, padded rows */
+#define BUFFER_WIDTH 61
+#define BUFFER_HEIGHT 47
+#define BUFFER_STRIDE 64
+
+/* Source images */
+#define IMAGE_WIDTH 23
+#define IMAGE_HEIGHT 17
+#define IMAGE_STRIDE 24
+
+/* Distances (in source pixels) to a source pixel edge under which the nearest pixel is ambiguous */
+#define EDGE_TOLERANCE 0.004
+#define SCALE_EDGE_TOLERANCE 0.0001
+
+/* Largest difference with the model of a bilinear rotation on a channel (RGB565 units) */
+#define BILINEAR_TOLERANCE 3
+
+/* Display and image sizes and number of drawings of the benchmark */
+#define BENCH_WIDTH 240
+#define BENCH_HEIGHT 320
+#define BENCH_IMAGE_WIDTH 120
+#define BENCH_IMAGE_HEIGHT 90
+#define BENCH_DRAWINGS 50
+
+/* Faded shapes: subpixels of the kernels distances, their error (in subpixels) and the color */
+#define FADED_SUBPIXELS 32
+#define FADED_DISTANCE_ERROR 2
+#define FADED_COLOR 0x00C08040
+#define FADED_COLOR_RGB565 0xC408
+
+typedef struct {
+    jint x1;
+    jint y1;
+    jint x2;
+    jint y2;
+} rect_t;
+
+/* Clips: whole buffer, inner */
+static const rect_t clips[] = {
+    { 0, 0, BUFFER_WIDTH - 1, BUFFER_HEIGHT - 1 },
+    { 9, 7, 44, 30 },
+};
+
+/* Angles: quarter turns (of any sign and beyond a turn) and free angles */
+static const jfloat angles[] = { 0.0f, 90.0f, 180.0f, 270.0f, -90.0f, 450.0f, 30.0f, 45.0f, 137.5f, 200.0f, 333.0f, -10.0f, 1.0f };
+
+/* Scaling factors */
+static const jfloat factors[] = { 1.0f, 0.5f, 1.5f, 2.0f, 3.7f, 0.33f, 0.1f };
+
+static uint16_t buffer[BUFFER_STRIDE * BUFFER_HEIGHT];
+static uint16_t expected[BUFFER_STRIDE * BUFFER_HEIGHT];
+static MICROUI_GraphicsContext gc;
+
+static uint16_t rgb565_pixels[IMAGE_STRIDE * IMAGE_HEIGHT];
+static uint32_t argb8888_pixels[IMAGE_STRIDE * IMAGE_HEIGHT];
+static uint32_t rgb565_colors[IMAGE_STRIDE * IMAGE_HEIGHT];
+static MICROUI_Image rgb565_image;
+static MICROUI_Image argb8888_image;
+
+static double now_ms(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((double)now.tv_sec * 1000.0) + ((double)now.tv_nsec / 1000000.0);
+}
+
+/*
+ * Fill both buffers with the same random pattern and bind the destination to the graphics
+ * context.
+ */
+static void prepare(const rect_t* clip)
+{
+    for (uint32_t i = 0; i < (sizeof(buffer) / sizeof(buffer[0])); i++) {
+        buffer[i] = (uint16_t)rand();
+    }
+    memcpy(expected, buffer, sizeof(buffer));
+    UI_DRAWING_STUB_reset();
+    UI_DRAWING_STUB_init_gc(&gc, MICROUI_IMAGE_FORMAT_RGB565, BUFFER_WIDTH, BUFFER_HEIGHT, (uint8_t*)buffer, BUFFER_STRIDE * sizeof(uint16_t));
+    UI_DRAWING_STUB_set_clip(&gc, clip->x1, clip->y1, clip->x2, clip->y2);
+}
+
+static bool in_clip(const rect_t* clip, jint x, jint y)
+{
+    return (x >= clip->x1) && (x <= clip->x2) && (y >= clip->y1) && (y <= clip->y2);
+}
+
+static uint32_t to_rgb888(uint16_t pixel)
+{
+    uint32_t r = (pixel >> 11) & 0x1f;
+    uint32_t g = (pixel >> 5) & 0x3f;
+    uint32_t b = pixel & 0x1f;
+    return (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+}
+
+/*
+ * Reference model of the blending of an ARGB8888 color on an RGB565 pixel with a global
+ * alpha (see UT_ui_drawing_rgb565.c).
+ */
+static uint16_t model_blend(uint32_t color, uint16_t pixel, uint32_t global_alpha)
+{
+    uint32_t alpha = (((color >> 24) * global_alpha) + 127) / 255;
+    uint32_t background = to_rgb888(pixel);
+    uint32_t result = 0;
+
+    if (0 == alpha) {
+        return pixel;
+    }
+    for (uint32_t shift = 0; shift <= 16; shift += 8) {
+        uint32_t channel = ((((color >> shift) & 0xff) * alpha) + (((background >> shift) & 0xff) * (255 - alpha)) + 127) / 255;
+        result |= channel << shift;
+    }
+    return (uint16_t)(((result >> 8) & 0xf800) | ((result >> 5) & 0x07e0) | ((result >> 3) & 0x001f));
+}
+
+/*
+ * Largest difference between two RGB565 pixels on a channel, in RGB565 units.
+ */
+static uint32_t channel_error(uint16_t a, uint16_t b)
+{
+    static const uint32_t shifts[] = { 11, 5, 0 };
+    static const uint32_t masks[] = { 0x1f, 0x3f, 0x1f };
+    uint32_t error = 0;
+
+    for (uint32_t i = 0; i < 3; i++) {
+        int32_t difference = (int32_t)((a >> shifts[i]) & masks[i]) - (int32_t)((b >> shifts[i]) & masks[i]);
+        uint32_t absolute = (uint32_t)((difference < 0) ? -difference : difference);
+        error = (absolute > error) ? absolute : error;
+    }
+    return error;
+}
+
+static void init_image(MICROUI_Image* image, MICROUI_ImageFormat format, uint8_t* pixels, jint width, jint height, uint32_t stride)
+{
+    memset(image, 0, sizeof(MICROUI_Image));
+    image->width = width;
+    image->height = height;
+    image->format = (jbyte)format;
+    LLUI_DISPLAY_STUB_set_buffer(image, pixels, stride);
+}
+
+/*
+ * Fill the source images with random pixels; a third of the ARGB8888 pixels are opaque, a
+ * third are transparent. The RGB565 image is also given as ARGB8888 colors to the models.
+ */
+static void prepare_images(void)
+{
+    for (uint32_t i = 0; i < (IMAGE_STRIDE * IMAGE_HEIGHT); i++) {
+        uint32_t alpha = (uint32_t)rand() % 3;
+        rgb565_pixels[i] = (uint16_t)rand();
+        rgb565_colors[i] = 0xff000000 | to_rgb888(rgb565_pixels[i]);
+        argb8888_pixels[i] = ((uint32_t)rand() & 0x00ffffff) | ((0 == alpha) ? 0xff000000 : ((1 == alpha) ? 0 : ((uint32_t)rand() << 24)));
+    }
+    init_image(&rgb565_image, MICROUI_IMAGE_FORMAT_RGB565, (uint8_t*)rgb565_pixels, IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_STRIDE * sizeof(uint16_t));
+    init_image(&argb8888_image, MICROUI_IMAGE_FORMAT_ARGB8888, (uint8_t*)argb8888_pixels, IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_STRIDE * sizeof(uint32_t));
+}
+
+/*
+ * Rotation of an image drawn at (x, y) around (rotationX, rotationY).
+ */
+typedef struct {
+    jint x;
+    jint y;
+    jint rotationX;
+    jint rotationY;
+    jfloat angle;
+    jint alpha;
+} rotation_t;
+
+/*
+ * Source position (in pixels, relatively to the image) of the center of a destination pixel:
+ * the pixel is rotated clockwise back to the image.
+ */
+static void model_rotated_position(const rotation_t* rotation, jint dx, jint dy, double* sx, double* sy)
+{
+    double radians = (double)rotation->angle * (M_PI / 180.0);
+    double u = ((double)dx + 0.5) - rotation->rotationX;
+    double v = ((double)dy + 0.5) - rotation->rotationY;
+
+    *sx = (u * cos(radians)) - (v * sin(radians)) + (rotation->rotationX - rotation->x);
+    *sy = (u * sin(radians)) + (v * cos(radians)) + (rotation->rotationY - rotation->y);
+}
+
+/*
+ * Nearest source pixel of a source position, blended on the given background. When the position
+ * is within the given distance of a source pixel edge, the pixels on both sides are valid: the
+ * value drawn by the kernel is kept when it is one of them. Returns true in that case.
+ */
+static bool model_nearest(const uint32_t* source, double sx, double sy, double tolerance, uint32_t alpha, uint16_t* expected_pixel, uint16_t actual)
+{
+    double xs[2] = { floor(sx), floor(sx) };
+    double ys[2] = { floor(sy), floor(sy) };
+    uint16_t background = *expected_pixel;
+    bool ambiguous = false;
+
+    if (fabs(sx - round(sx)) < tolerance) {
+        xs[0] = round(sx) - 1.0;
+        xs[1] = round(sx);
+        ambiguous = true;
+    }
+    if (fabs(sy - round(sy)) < tolerance) {
+        ys[0] = round(sy) - 1.0;
+        ys[1] = round(sy);
+        ambiguous = true;
+    }
+    for (uint32_t i = 0; i < 4; i++) {
+        double px = xs[i & 1];
+        double py = ys[i >> 1];
+        uint16_t candidate = background;
+
+        if ((px >= 0.0) && (py >= 0.0) && (px < IMAGE_WIDTH) && (py < IMAGE_HEIGHT)) {
+            candidate = model_blend(source[((uint32_t)py * IMAGE_STRIDE) + (uint32_t)px], background, alpha);
+        }
+        if ((0 == i) || (candidate == actual)) {
+            *expected_pixel = candidate;
+        }
+    }
+    return ambiguous;
+}
+
+/*
+ * Reference model of a rotation with the nearest neighbor algorithm. Returns the number of
+ * pixels whose source position is ambiguous.
+ */
+static uint32_t model_rotate_nearest(const rect_t* clip, const uint32_t* source, const rotation_t* rotation)
+{
+    uint32_t ambiguous = 0;
+
+    for (jint dy = 0; dy < BUFFER_HEIGHT; dy++) {
+        for (jint dx = 0; dx < BUFFER_WIDTH; dx++) {
+            uint32_t index = ((uint32_t)dy * BUFFER_STRIDE) + (uint32_t)dx;
+            double sx;
+            double sy;
+
+            if (in_clip(clip, dx, dy)) {
+                model_rotated_position(rotation, dx, dy, &sx, &sy);
+                if (model_nearest(source, sx, sy, EDGE_TOLERANCE, (uint32_t)rotation->alpha, &expected[index], buffer[index])) {
+                    ambiguous++;
+                }
+            }
+        }
+    }
+    return ambiguous;
+}
+
+/*
+ * Reference model of a rotation with the bilinear algorithm: the four source pixels around the
+ * source position are weighted by their alpha (the pixels out of the image are transparent).
+ * Returns the largest difference with the kernel on a channel.
+ */
+static uint32_t model_rotate_bilinear(const rect_t* clip, const uint32_t* source, const rotation_t* rotation)
+{
+    uint32_t error = 0;
+
+    for (jint dy = 0; dy < BUFFER_HEIGHT; dy++) {
+        for (jint dx = 0; dx < BUFFER_WIDTH; dx++) {
+            uint32_t index = ((uint32_t)dy * BUFFER_STRIDE) + (uint32_t)dx;
+            double sums[4] = { 0.0, 0.0, 0.0, 0.0 };
+            double sx;
+            double sy;
+            double x0;
+            double y0;
+
+            if (!in_clip(clip, dx, dy)) {
+                continue;
+            }
+            model_rotated_position(rotation, dx, dy, &sx, &sy);
+            /* relatively to the pixels centers */
+            sx -= 0.5;
+            sy -= 0.5;
+            x0 = floor(sx);
+            y0 = floor(sy);
+            for (uint32_t i = 0; i < 4; i++) {
+                double px = x0 + (i & 1);
+                double py = y0 + (i >> 1);
+                double weight = ((i & 1) ? (sx - x0) : (1.0 - (sx - x0))) * ((i >> 1) ? (sy - y0) : (1.0 - (sy - y0)));
+
+                if ((px >= 0.0) && (py >= 0.0) && (px < IMAGE_WIDTH) && (py < IMAGE_HEIGHT)) {
+                    uint32_t color = source[((uint32_t)py * IMAGE_STRIDE) + (uint32_t)px];
+                    double alpha = weight * (color >> 24);
+                    sums[3] += alpha;
+                    sums[0] += alpha * ((color >> 16) & 0xff);
+                    sums[1] += alpha * ((color >> 8) & 0xff);
+                    sums[2] += alpha * (color & 0xff);
+                }
+            }
+            if (sums[3] > 0.0) {
+                double alpha = (sums[3] * rotation->alpha) / 255.0;
+                uint32_t background = to_rgb888(expected[index]);
+                uint32_t result = 0;
+
+                for (uint32_t c = 0; c < 3; c++) {
+                    double channel = ((sums[c] / sums[3]) * alpha) + (((background >> (16 - (c * 8))) & 0xff) * (255.0 - alpha));
+                    result |= (uint32_t)lround(channel / 255.0) << (16 - (c * 8));
+                }
+                expected[index] = (uint16_t)(((result >> 8) & 0xf800) | ((result >> 5) & 0x07e0) | ((result >> 3) & 0x001f));
+            }
+            {
+                uint32_t pixel_error = channel_error(expected[index], buffer[index]);
+                error = (pixel_error > error) ? pixel_error : error;
+            }
+        }
+    }
+    return error;
+}
+
+/*
+ * Reference model of a scaling with the nearest neighbor algorithm: the destination pixel
+ * center is scaled back to the image. The centers which fall on the edge of two source pixels
+ * (common with the simple factors, given as floats) may select either pixel. Returns the number
+ * of such pixels.
+ */
+static uint32_t model_scale(const rect_t* clip, const uint32_t* source, jint x, jint y, jfloat factorX, jfloat factorY, jint alpha)
+{
+    jint width = (jint)(IMAGE_WIDTH * factorX);
+    jint height = (jint)(IMAGE_HEIGHT * factorY);
+    uint32_t ambiguous = 0;
+
+    for (jint dy = y; dy < (y + height); dy++) {
+        for (jint dx = x; dx < (x + width); dx++) {
+            if ((dx >= 0) && (dy >= 0) && (dx < BUFFER_WIDTH) && (dy < BUFFER_HEIGHT) && in_clip(clip, dx, dy)) {
+                uint32_t index = ((uint32_t)dy * BUFFER_STRIDE) + (uint32_t)dx;
+                double sx = ((double)(dx - x) + 0.5) / factorX;
+                double sy = ((double)(dy - y) + 0.5) / factorY;
+
+                /* the last pixel of a row or column stays in the image */
+                sx = (sx >= IMAGE_WIDTH) ? (IMAGE_WIDTH - 0.5) : sx;
+                sy = (sy >= IMAGE_HEIGHT) ? (IMAGE_HEIGHT - 0.5) : sy;
+                if (model_nearest(source, sx, sy, SCALE_EDGE_TOLERANCE, (uint32_t)alpha, &expected[index], buffer[index])) {
+                    ambiguous++;
+                }
+            }
+        }
+    }
+    return ambiguous;
+}
+
+/*
+ * The pixels changed by a drawing are in the drawing limits given to the Graphics Engine.
+ */
+static bool check_limits(const uint16_t* before)
+{
+    jint xmin = BUFFER_WIDTH;
+    jint ymin = BUFFER_HEIGHT;
+    jint xmax = -1;
+    jint ymax = -1;
+    bool set = UI_DRAWING_STUB_get_drawing_limits(&xmin, &ymin, &xmax, &ymax);
+
+    for (jint y = 0; y < BUFFER_HEIGHT; y++) {
+        for (jint x = 0; x < BUFFER_WIDTH; x++) {
+            uint32_t index = ((uint32_t)y * BUFFER_STRIDE) + (uint32_t)x;
+            if ((before[index] != buffer[index]) && (!set || (x < xmin) || (x > xmax) || (y < ymin) || (y > ymax))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/*
+ * Rotation centers: center, top-left corner and bottom-right corner of the image, outside.
+ */
+static void init_rotation(rotation_t* rotation, uint32_t center)
+{
+    rotation->x = 19;
+    rotation->y = 15;
+    rotation->rotationX = rotation->x + ((0 == center) ? (IMAGE_WIDTH / 2) : ((1 == center) ? 0 : IMAGE_WIDTH));
+    rotation->rotationY = rotation->y + ((0 == center) ? (IMAGE_HEIGHT / 2) : ((1 == center) ? 0 : IMAGE_HEIGHT));
+    if (3 == center) {
+        rotation->rotationX = 5;
+        rotation->rotationY = 40;
+    }
+}
+
+/*
+ * Fade of a faded shape, in pixels: opaque up to half the thickness minus half a pixel from the
+ * skeleton of the shape, then decreasing linearly to transparent at the fade plus half a pixel
+ * beyond.
+ */
+typedef struct {
+    double half;
+    double opaque;
+    double transparent;
+    /* error of the distances computed by the kernels */
+    double tolerance;
+} model_fade_t;
+
+/* Distance of a pixel center to the skeleton of a faded shape */
+typedef double (*model_distance_t)(const void* shape, double x, double y);
+
+typedef struct {
+    model_fade_t fade;
+    double x;
+    double y;
+    double direction_x;
+    double direction_y;
+    double length;
+    DRAWING_Cap start_cap;
+    DRAWING_Cap end_cap;
+} model_line_t;
+
+typedef struct {
+    model_fade_t fade;
+    double x;
+    double y;
+    double radius;
+    bool arc;
+    bool wide;
+    double start_x;
+    double start_y;
+    double end_x;
+    double end_y;
+    DRAWING_Cap start_cap;
+    DRAWING_Cap end_cap;
+} model_ring_t;
+
+static void model_init_fade(model_fade_t* fade, jint thickness, jint fade_width)
+{
+    int32_t ramp;
+    uint32_t lut_shift = 0;
+
+    fade->half = thickness / 2.0;
+    fade->opaque = fade->half - 0.5;
+    fade->transparent = fade->half + fade_width + 0.5;
+    /* the kernels compute the distances in 1/32 pixel (positions and square roots rounded) and
+     * read the alpha in a table of 256 entries over the ramp, at the middle of an entry */
+    ramp = (int32_t)((fade->transparent - fade->opaque) * FADED_SUBPIXELS);
+    while ((ramp >> lut_shift) > 256) {
+        lut_shift++;
+    }
+    fade->tolerance = (FADED_DISTANCE_ERROR + ((double)(1u << lut_shift) / 2.0)) / FADED_SUBPIXELS;
+}
+
+static uint32_t model_fade_alpha(const model_fade_t* fade, double distance)
+{
+    uint32_t alpha = 0;
+
+    if (distance <= fade->opaque) {
+        alpha = 255;
+    }
+    else if (distance < fade->transparent) {
+        alpha = (uint32_t)lround(((fade->transparent - distance) * 255.0) / (fade->transparent - fade->opaque));
+    }
+    return alpha;
+}
+
+static double model_line_distance(const void* shape, double x, double y)
+{
+    const model_line_t* line = (const model_line_t*)shape;
+    double dx = x - line->x;
+    double dy = y - line->y;
+    double along = (dx * line->direction_x) + (dy * line->direction_y);
+    double distance = fabs((dy * line->direction_x) - (dx * line->direction_y));
+    double beyond = 0.0;
+    DRAWING_Cap cap = DRAWING_ENDOFLINE_NONE;
+
+    if (along < 0.0) {
+        beyond = -along;
+        cap = line->start_cap;
+    }
+    else if (along > line->length) {
+        beyond = along - line->length;
+        cap = line->end_cap;
+    }
+    if ((beyond > 0.0) && (DRAWING_ENDOFLINE_ROUNDED == cap)) {
+        distance = hypot(distance, beyond);
+    }
+    else if ((beyond > 0.0) && (DRAWING_ENDOFLINE_NONE == cap)) {
+        /* the line is cut at its end */
+        distance = INFINITY;
+    }
+    /* a perpendicular cap fades along the line like the line edges across it */
+    if (DRAWING_ENDOFLINE_PERPENDICULAR == line->start_cap) {
+        distance = fmax(distance, line->fade.half - along);
+    }
+    if (DRAWING_ENDOFLINE_PERPENDICULAR == line->end_cap) {
+        distance = fmax(distance, line->fade.half - (line->length - along));
+    }
+    return distance;
+}
+
+/*
+ * Distance of a pixel beyond the ends of an arc to the cap of an end, given the direction of
+ * the end, the signed distance to its line and the distance to the whole circle.
+ */
+static double model_cap_distance(const model_ring_t* ring, DRAWING_Cap cap, double x, double y, double end_x, double end_y, double side, double distance)
+{
+    bool ahead = ((x * end_x) + (y * end_y)) > 0.0;
+
+    if (DRAWING_ENDOFLINE_ROUNDED == cap) {
+        distance = hypot(x - (end_x * ring->radius), y - (end_y * ring->radius));
+    }
+    else if ((DRAWING_ENDOFLINE_PERPENDICULAR == cap) && ahead && (side < 0.0)) {
+        distance = fmax(distance, ring->fade.half - side);
+    }
+    else {
+        distance = INFINITY;
+    }
+    return distance;
+}
+
+static double model_ring_distance(const void* shape, double x, double y)
+{
+    const model_ring_t* ring = (const model_ring_t*)shape;
+    double dx = x - ring->x;
+    double dy = y - ring->y;
+    double distance = fabs(hypot(dx, dy) - ring->radius);
+
+    if (ring->arc) {
+        /* signed distances to the lines of the ends, positive on the side of the arc */
+        double start_side = (dx * ring->start_y) - (dy * ring->start_x);
+        double end_side = (dy * ring->end_x) - (dx * ring->end_y);
+        bool in_sector = ring->wide ? ((start_side >= 0.0) || (end_side >= 0.0)) : ((start_side >= 0.0) && (end_side >= 0.0));
+
+        if (in_sector) {
+            if ((DRAWING_ENDOFLINE_PERPENDICULAR == ring->start_cap) && (start_side >= 0.0) && (((dx * ring->start_x) + (dy * ring->start_y)) > 0.0)) {
+                distance = fmax(distance, ring->fade.half - start_side);
+            }
+            if ((DRAWING_ENDOFLINE_PERPENDICULAR == ring->end_cap) && (end_side >= 0.0) && (((dx * ring->end_x) + (dy * ring->end_y)) > 0.0)) {
+                distance = fmax(distance, ring->fade.half - end_side);
+            }
+        }
+        else {
+            distance = fmin(model_cap_distance(ring, ring->start_cap, dx, dy, ring->start_x, ring->start_y, start_side, distance),
+                    model_cap_distance(ring, ring->end_cap, dx, dy, ring->end_x, ring->end_y, end_side, distance));
+        }
+    }
+    return distance;
+}
+
+static void model_init_line(model_line_t* line, jint startX, jint startY, jint endX, jint endY, jint thickness, jint fade, DRAWING_Cap startCap, DRAWING_Cap endCap)
+{
+    model_init_fade(&line->fade, thickness, fade);
+    line->x = startX + 0.5;
+    line->y = startY + 0.5;
+    line->length = hypot(endX - startX, endY - startY);
+    line->direction_x = (endX - startX) / line->length;
+    line->direction_y = (endY - startY) / line->length;
+    line->start_cap = startCap;
+    line->end_cap = endCap;
+}
+
+/*
+ * An arc is drawn counterclockwise from its start to its end (the y axis is downwards); an arc
+ * of 360 degrees or more is a circle.
+ */
+static void model_init_ring(model_ring_t* ring, jint x, jint y, jint diameter, jfloat startAngle, jfloat arcAngle, jint thickness, jint fade, DRAWING_Cap start, DRAWING_Cap end)
+{
+    double start_radians;
+    double end_radians;
+
+    model_init_fade(&ring->fade, thickness, fade);
+    ring->radius = diameter / 2.0;
+    ring->x = x + ring->radius;
+    ring->y = y + ring->radius;
+    ring->start_cap = (arcAngle < 0.0f) ? end : start;
+    ring->end_cap = (arcAngle < 0.0f) ? start : end;
+    if (arcAngle < 0.0f) {
+        startAngle += arcAngle;
+        arcAngle = -arcAngle;
+    }
+    ring->arc = arcAngle < 360.0f;
+    ring->wide = arcAngle > 180.0f;
+    start_radians = (double)startAngle * (M_PI / 180.0);
+    end_radians = ((double)startAngle + (double)arcAngle) * (M_PI / 180.0);
+    ring->start_x = cos(start_radians);
+    ring->start_y = -sin(start_radians);
+    ring->end_x = cos(end_radians);
+    ring->end_y = -sin(end_radians);
+}
+
+/*
+ * Tells if the channels of an RGB565 pixel are between the ones of two pixels, within one unit.
+ */
+static bool is_between(uint16_t pixel, uint16_t a, uint16_t b)
+{
+    static const uint32_t shifts[] = { 11, 5, 0 };
+    static const uint32_t masks[] = { 0x1f, 0x3f, 0x1f };
+
+    for (uint32_t i = 0; i < 3; i++) {
+        int32_t value = (int32_t)((pixel >> shifts[i]) & masks[i]);
+        int32_t first = (int32_t)((a >> shifts[i]) & masks[i]);
+        int32_t second = (int32_t)((b >> shifts[i]) & masks[i]);
+        if ((value < (((first < second) ? first : second) - 1)) || (value > (((first > second) ? first : second) + 1))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Compares a faded shape drawn by a kernel with the model: the alpha of a pixel lies between the
+ * alphas of the distances around its center (within the tolerance of the fade). The opaque and
+ * transparent pixels are exact. Returns the number of pixels out of the model; counts the
+ * faded pixels.
+ */
+static uint32_t model_faded(const rect_t* clip, const void* shape, model_distance_t get_distance, const model_fade_t* fade, uint32_t* faded)
+{
+    uint32_t errors = 0;
+
+    for (jint py = 0; py < BUFFER_HEIGHT; py++) {
+        for (jint px = 0; px < BUFFER_WIDTH; px++) {
+            uint32_t index = ((uint32_t)py * BUFFER_STRIDE) + (uint32_t)px;
+            double min = INFINITY;
+            double max = 0.0;
+            uint32_t opaque_alpha;
+            uint32_t faded_alpha;
+
+            if (!in_clip(clip, px, py)) {
+                errors += (buffer[index] != expected[index]) ? 1 : 0;
+                continue;
+            }
+            for (int32_t i = 0; i < 9; i++) {
+                double distance = get_distance(shape, px + 0.5 + (((i % 3) - 1) * fade->tolerance), py + 0.5 + (((i / 3) - 1) * fade->tolerance));
+                min = fmin(min, distance);
+                max = fmax(max, distance);
+            }
+            opaque_alpha = model_fade_alpha(fade, min);
+            faded_alpha = model_fade_alpha(fade, max);
+            if ((0 == opaque_alpha) || (255 == faded_alpha)) {
+                /* transparent or opaque */
+                expected[index] = (0 == opaque_alpha) ? expected[index] : FADED_COLOR_RGB565;
+                errors += (buffer[index] != expected[index]) ? 1 : 0;
+            }
+            else {
+                uint16_t low = model_blend(FADED_COLOR | 0xff000000, expected[index], faded_alpha);
+                uint16_t high = model_blend(FADED_COLOR | 0xff000000, expected[index], opaque_alpha);
+                errors += is_between(buffer[index], low, high) ? 0 : 1;
+                (*faded)++;
+            }
+        }
+    }
+    return errors;
+}
+
+static void setUp(void)
+{
+    srand(18);
+    LLUI_DISPLAY_STUB_set_row_padding(0);
+    prepare_images();
+}
+
+static void tearDown(void)
+{
+    UI_DRAWING_STUB_reset();
+}
+
+static void dw_drawing_rgb565_rotate_nearest_f(void)
+{
+    static const jint alphas[] = { 255, 128, 0 };
+    static uint16_t before[BUFFER_STRIDE * BUFFER_HEIGHT];
+    uint32_t ambiguous = 0;
+    uint32_t pixels = 0;
+
+    for (uint32_t image = 0; image < 2; image++) {
+        for (uint32_t c = 0; c < (sizeof(clips) / sizeof(clips[0])); c++) {
+            for (uint32_t a = 0; a < (sizeof(angles) / sizeof(angles[0])); a++) {
+                for (uint32_t center = 0; center < 4; center++) {
+                    for (uint32_t alpha = 0; alpha < (sizeof(alphas) / sizeof(alphas[0])); alpha++) {
+                        rotation_t rotation = { .angle = angles[a], .alpha = alphas[alpha] };
+                        uint32_t pixel_ambiguous;
+
+                        init_rotation(&rotation, center);
+                        prepare(&clips[c]);
+                        memcpy(before, buffer, sizeof(buffer));
+                        TEST_ASSERT_EQUAL_INT(DRAWING_DONE, DW_DRAWING_drawRotatedImageNearestNeighbor(&gc, image ? &argb8888_image : &rgb565_image,
+                                rotation.x, rotation.y, rotation.rotationX, rotation.rotationY, rotation.angle, rotation.alpha));
+                        pixel_ambiguous = model_rotate_nearest(&clips[c], image ? argb8888_pixels : rgb565_colors, &rotation);
+                        TEST_ASSERT(0 == memcmp(buffer, expected, sizeof(buffer)));
+                        TEST_ASSERT(check_limits(before));
+                        TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+                        /* the source positions of the quarter turns are the pixels centers */
+                        TEST_ASSERT((0.0f != fmodf(rotation.angle, 90.0f)) || (0 == pixel_ambiguous));
+                        ambiguous += pixel_ambiguous;
+                        pixels += BUFFER_WIDTH * BUFFER_HEIGHT;
+                    }
+                }
+            }
+        }
+    }
+    /* a few pixels are close to an edge */
+    TEST_ASSERT(ambiguous < (pixels / 100));
+}
+
+static void dw_drawing_rgb565_rotate_bilinear_f(void)
+{
+    static const jint alphas[] = { 255, 100 };
+    static uint16_t before[BUFFER_STRIDE * BUFFER_HEIGHT];
+    uint32_t error = 0;
+
+    for (uint32_t image = 0; image < 2; image++) {
+        for (uint32_t c = 0; c < (sizeof(clips) / sizeof(clips[0])); c++) {
+            for (uint32_t a = 0; a < (sizeof(angles) / sizeof(angles[0])); a++) {
+                for (uint32_t center = 0; center < 4; center++) {
+                    for (uint32_t alpha = 0; alpha < (sizeof(alphas) / sizeof(alphas[0])); alpha++) {
+                        rotation_t rotation = { .angle = angles[a], .alpha = alphas[alpha] };
+                        uint32_t drawing_error;
+
+                        init_rotation(&rotation, center);
+                        prepare(&clips[c]);
+                        memcpy(before, buffer, sizeof(buffer));
+                        TEST_ASSERT_EQUAL_INT(DRAWING_DONE, DW_DRAWING_drawRotatedImageBilinear(&gc, image ? &argb8888_image : &rgb565_image,
+                                rotation.x, rotation.y, rotation.rotationX, rotation.rotationY, rotation.angle, rotation.alpha));
+                        drawing_error = model_rotate_bilinear(&clips[c], image ? argb8888_pixels : rgb565_colors, &rotation);
+                        TEST_ASSERT(drawing_error <= BILINEAR_TOLERANCE);
+                        TEST_ASSERT(check_limits(before));
+                        TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+                        if (0.0f == fmodf(rotation.angle, 90.0f)) {
+                            /* quarter turns: the pixels are copied */
+                            TEST_ASSERT_EQUAL_INT(0, model_rotate_nearest(&clips[c], image ? argb8888_pixels : rgb565_colors, &rotation));
+                        }
+                        error = (drawing_error > error) ? drawing_error : error;
+                    }
+                }
+            }
+        }
+    }
+    printf("DW_DRAWING_RGB565: bilinear rotation, largest difference with the model %u (RGB565 units)\n", (unsigned int)error);
+}
+
+static void dw_drawing_rgb565_scale_f(void)
+{
+    static const jint alphas[] = { 255, 128 };
+    static const jint positions[][2] = { { 3, 2 }, { -7, -5 }, { 40, 30 } };
+
+    for (uint32_t image = 0; image < 2; image++) {
+        for (uint32_t c = 0; c < (sizeof(clips) / sizeof(clips[0])); c++) {
+            for (uint32_t fx = 0; fx < (sizeof(factors) / sizeof(factors[0])); fx++) {
+                for (uint32_t fy = 0; fy < (sizeof(factors) / sizeof(factors[0])); fy++) {
+                    for (uint32_t p = 0; p < (sizeof(positions) / sizeof(positions[0])); p++) {
+                        for (uint32_t alpha = 0; alpha < (sizeof(alphas) / sizeof(alphas[0])); alpha++) {
+                            static uint16_t before[BUFFER_STRIDE * BUFFER_HEIGHT];
+
+                            prepare(&clips[c]);
+                            memcpy(before, buffer, sizeof(buffer));
+                            TEST_ASSERT_EQUAL_INT(DRAWING_DONE, DW_DRAWING_drawScaledImageNearestNeighbor(&gc, image ? &argb8888_image : &rgb565_image,
+                                    positions[p][0], positions[p][1], factors[fx], factors[fy], alphas[alpha]));
+                            model_scale(&clips[c], image ? argb8888_pixels : rgb565_colors, positions[p][0], positions[p][1], factors[fx], factors[fy], alphas[alpha]);
+                            TEST_ASSERT(0 == memcmp(buffer, expected, sizeof(buffer)));
+                            TEST_ASSERT(check_limits(before));
+                            TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*
+ * The other destinations and an image drawn in itself are delegated to the software algorithms.
+ */
+static void dw_drawing_rgb565_transform_delegated_f(void)
+{
+    static uint32_t argb8888_buffer[BUFFER_STRIDE * BUFFER_HEIGHT];
+
+    prepare(&clips[0]);
+    /* the destination itself */
+    init_image(&rgb565_image, MICROUI_IMAGE_FORMAT_RGB565, (uint8_t*)buffer, BUFFER_WIDTH, BUFFER_HEIGHT, BUFFER_STRIDE * sizeof(uint16_t));
+    DW_DRAWING_drawRotatedImageNearestNeighbor(&gc, &rgb565_image, 0, 0, 10, 10, 30.0f, 255);
+    DW_DRAWING_drawRotatedImageBilinear(&gc, &rgb565_image, 0, 0, 10, 10, 30.0f, 255);
+    DW_DRAWING_drawScaledImageNearestNeighbor(&gc, &rgb565_image, 0, 0, 2.0f, 2.0f, 255);
+    TEST_ASSERT_EQUAL_INT(3, UI_DRAWING_STUB_get_soft_calls());
+    TEST_ASSERT(0 == memcmp(buffer, expected, sizeof(buffer)));
+
+    /* an ARGB8888 destination */
+    prepare_images();
+    UI_DRAWING_STUB_reset();
+    UI_DRAWING_STUB_init_gc(&gc, MICROUI_IMAGE_FORMAT_ARGB8888, BUFFER_WIDTH, BUFFER_HEIGHT, (uint8_t*)argb8888_buffer, BUFFER_STRIDE * sizeof(uint32_t));
+    DW_DRAWING_drawRotatedImageNearestNeighbor(&gc, &rgb565_image, 0, 0, 10, 10, 30.0f, 255);
+    DW_DRAWING_drawRotatedImageBilinear(&gc, &argb8888_image, 0, 0, 10, 10, 30.0f, 255);
+    DW_DRAWING_drawScaledImageNearestNeighbor(&gc, &rgb565_image, 0, 0, 2.0f, 2.0f, 255);
+    TEST_ASSERT_EQUAL_INT(3, UI_DRAWING_STUB_get_soft_calls());
+}
+
+/*
+ * Speed of the kernels and of a naive per-pixel floating point loop over the bounding box of
+ * the drawing (as the reference models, with the same algorithm), on a display buffer.
+ */
+static void dw_drawing_rgb565_transform_report_f(void)
+{
+    static const struct {
+        const char* name;
+        jfloat angle;
+        bool bilinear;
+        jfloat factor;
+    } cases[] = {
+        { "rotation nearest 30 deg", 30.0f, false, 0.0f },
+        { "rotation bilinear 30 deg", 30.0f, true, 0.0f },
+        { "rotation nearest 90 deg", 90.0f, false, 0.0f },
+        { "scaling x1.5", 0.0f, false, 1.5f },
+    };
+    uint16_t* display = malloc(BENCH_WIDTH * BENCH_HEIGHT * sizeof(uint16_t));
+    uint16_t* pixels = malloc(BENCH_IMAGE_WIDTH * BENCH_IMAGE_HEIGHT * sizeof(uint16_t));
+    MICROUI_Image image;
+    jint x = (BENCH_WIDTH - BENCH_IMAGE_WIDTH) / 2;
+    jint y = (BENCH_HEIGHT - BENCH_IMAGE_HEIGHT) / 2;
+
+    TEST_ASSERT((NULL != display) && (NULL != pixels));
+    for (uint32_t i = 0; i < (BENCH_IMAGE_WIDTH * BENCH_IMAGE_HEIGHT); i++) {
+        pixels[i] = (uint16_t)rand();
+    }
+    memset(display, 0, BENCH_WIDTH * BENCH_HEIGHT * sizeof(uint16_t));
+    init_image(&image, MICROUI_IMAGE_FORMAT_RGB565, (uint8_t*)pixels, BENCH_IMAGE_WIDTH, BENCH_IMAGE_HEIGHT, BENCH_IMAGE_WIDTH * sizeof(uint16_t));
+    UI_DRAWING_STUB_reset();
+    UI_DRAWING_STUB_init_gc(&gc, MICROUI_IMAGE_FORMAT_RGB565, BENCH_WIDTH, BENCH_HEIGHT, (uint8_t*)display, BENCH_WIDTH * sizeof(uint16_t));
+
+    for (uint32_t k = 0; k < (sizeof(cases) / sizeof(cases[0])); k++) {
+        double kernel = INFINITY;
+        double loop = INFINITY;
+
+        /* best of BENCH_DRAWINGS drawings: the host timings are noisy */
+        for (uint32_t i = 0; i < BENCH_DRAWINGS; i++) {
+            double start = now_ms();
+            if (0.0f != cases[k].factor) {
+                /* centered on the display */
+                DW_DRAWING_drawScaledImageNearestNeighbor(&gc, &image, (BENCH_WIDTH / 2) - (jint)((BENCH_IMAGE_WIDTH * cases[k].factor) / 2),
+                        (BENCH_HEIGHT / 2) - (jint)((BENCH_IMAGE_HEIGHT * cases[k].factor) / 2), cases[k].factor, cases[k].factor, 255);
+            }
+            else if (cases[k].bilinear) {
+                DW_DRAWING_drawRotatedImageBilinear(&gc, &image, x, y, BENCH_WIDTH / 2, BENCH_HEIGHT / 2, cases[k].angle, 255);
+            }
+            else {
+                DW_DRAWING_drawRotatedImageNearestNeighbor(&gc, &image, x, y, BENCH_WIDTH / 2, BENCH_HEIGHT / 2, cases[k].angle, 255);
+            }
+            kernel = fmin(kernel, now_ms() - start);
+        }
+
+        /* naive loop: a floating point source position per pixel of the bounding box */
+        for (uint32_t i = 0; i < BENCH_DRAWINGS; i++) {
+            double start = now_ms();
+            double radians = (double)cases[k].angle * (M_PI / 180.0);
+            double cosine = cos(radians);
+            double sine = sin(radians);
+            /* the image is centered on the rotation center */
+            jint half_width = (0.0f != cases[k].factor) ? (jint)((BENCH_IMAGE_WIDTH * cases[k].factor) / 2)
+                    : (jint)ceil(((BENCH_IMAGE_WIDTH * fabs(cosine)) + (BENCH_IMAGE_HEIGHT * fabs(sine))) / 2);
+            jint half_height = (0.0f != cases[k].factor) ? (jint)((BENCH_IMAGE_HEIGHT * cases[k].factor) / 2)
+                    : (jint)ceil(((BENCH_IMAGE_WIDTH * fabs(sine)) + (BENCH_IMAGE_HEIGHT * fabs(cosine))) / 2);
+
+            for (jint dy = (BENCH_HEIGHT / 2) - half_height; dy < ((BENCH_HEIGHT / 2) + half_height); dy++) {
+                for (jint dx = (BENCH_WIDTH / 2) - half_width; dx < ((BENCH_WIDTH / 2) + half_width); dx++) {
+                    double u = ((double)dx + 0.5) - (BENCH_WIDTH / 2);
+                    double v = ((double)dy + 0.5) - (BENCH_HEIGHT / 2);
+                    double sx = (0.0f != cases[k].factor) ? ((u / cases[k].factor) + (BENCH_IMAGE_WIDTH / 2)) : ((u * cosine) - (v * sine) + ((BENCH_WIDTH / 2) - x));
+                    double sy = (0.0f != cases[k].factor) ? ((v / cases[k].factor) + (BENCH_IMAGE_HEIGHT / 2)) : ((u * sine) + (v * cosine) + ((BENCH_HEIGHT / 2) - y));
+                    if (cases[k].bilinear) {
+                        /* the four pixels around the position, relatively to the pixels centers */
+                        sx -= 0.5;
+                        sy -= 0.5;
+                        if ((sx >= 0.0) && (sy >= 0.0) && (sx < (BENCH_IMAGE_WIDTH - 1)) && (sy < (BENCH_IMAGE_HEIGHT - 1))) {
+                            const uint16_t* around = &pixels[((uint32_t)sy * BENCH_IMAGE_WIDTH) + (uint32_t)sx];
+                            double wx = sx - floor(sx);
+                            double wy = sy - floor(sy);
+                            uint32_t color = 0;
+                            for (uint32_t channel = 0; channel < 3; channel++) {
+                                static const uint32_t shifts[3] = { 11, 5, 0 };
+                                static const uint32_t masks[3] = { 0x1f, 0x3f, 0x1f };
+                                uint32_t shift = shifts[channel];
+                                uint32_t mask = masks[channel];
+                                double top = ((1.0 - wx) * ((around[0] >> shift) & mask)) + (wx * ((around[1] >> shift) & mask));
+                                double bottom = ((1.0 - wx) * ((around[BENCH_IMAGE_WIDTH] >> shift) & mask)) + (wx * ((around[BENCH_IMAGE_WIDTH + 1] >> shift) & mask));
+                                color |= (uint32_t)lround(((1.0 - wy) * top) + (wy * bottom)) << shift;
+                            }
+                            display[((uint32_t)dy * BENCH_WIDTH) + (uint32_t)dx] = (uint16_t)color;
+                        }
+                    }
+                    else if ((sx >= 0.0) && (sy >= 0.0) && (sx < BENCH_IMAGE_WIDTH) && (sy < BENCH_IMAGE_HEIGHT)) {
+                        display[((uint32_t)dy * BENCH_WIDTH) + (uint32_t)dx] = pixels[((uint32_t)sy * BENCH_IMAGE_WIDTH) + (uint32_t)sx];
+                    }
+                }
+            }
+            loop = fmin(loop, now_ms() - start);
+        }
+
+        printf("DW_DRAWING_RGB565: %-25s kernel %8.1f us, per-pixel float loop %8.1f us\n", cases[k].name, kernel * 1000.0, loop * 1000.0);
+    }
+    TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+    free(pixels);
+    free(display);
+}
+
+/*
+ * Draws the faded shapes with the foreground color.
+ */
+static void prepare_faded(const rect_t* clip, uint16_t* before)
+{
+    prepare(clip);
+    gc.foreground_color = FADED_COLOR;
+    memcpy(before, buffer, sizeof(buffer));
+}
+
+static void dw_drawing_rgb565_faded_line_f(void)
+{
+    static const jint lines[][4] = {
+        { 10, 20, 50, 20 }, { 30, 5, 30, 40 }, { 8, 6, 52, 40 }, { 50, 40, 12, 9 }, { 20, 3, 26, 44 }, { -10, 30, 70, 18 }, { 30, 23, 31, 23 },
+    };
+    static const jint thicknesses[] = { 1, 3, 12 };
+    static const jint fades[] = { 0, 1, 6 };
+    static uint16_t before[BUFFER_STRIDE * BUFFER_HEIGHT];
+    uint32_t faded = 0;
+
+    for (uint32_t c = 0; c < (sizeof(clips) / sizeof(clips[0])); c++) {
+        for (uint32_t l = 0; l < (sizeof(lines) / sizeof(lines[0])); l++) {
+            for (uint32_t t = 0; t < (sizeof(thicknesses) / sizeof(thicknesses[0])); t++) {
+                for (uint32_t f = 0; f < (sizeof(fades) / sizeof(fades[0])); f++) {
+                    for (uint32_t caps = 0; caps < 9; caps++) {
+                        model_line_t line;
+
+                        prepare_faded(&clips[c], before);
+                        TEST_ASSERT_EQUAL_INT(DRAWING_DONE, DW_DRAWING_drawThickFadedLine(&gc, lines[l][0], lines[l][1], lines[l][2], lines[l][3], thicknesses[t], fades[f],
+                                (DRAWING_Cap)(caps % 3), (DRAWING_Cap)(caps / 3)));
+                        model_init_line(&line, lines[l][0], lines[l][1], lines[l][2], lines[l][3], thicknesses[t], fades[f], (DRAWING_Cap)(caps % 3), (DRAWING_Cap)(caps / 3));
+                        TEST_ASSERT_EQUAL_INT(0, model_faded(&clips[c], &line, model_line_distance, &line.fade, &faded));
+                        TEST_ASSERT(check_limits(before));
+                        TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+                    }
+                }
+            }
+        }
+    }
+    TEST_ASSERT(0 != faded);
+}
+
+static void dw_drawing_rgb565_faded_circle_f(void)
+{
+    /* x, y, diameter: inside, a pixel, two pixels, across the buffer, small */
+    static const jint circles[][3] = { { 20, 10, 25 }, { 5, 5, 1 }, { 30, 20, 2 }, { -15, -10, 60 }, { 40, 30, 9 } };
+    /* thicker than the diameter: no hole */
+    static const jint thicknesses[] = { 1, 4, 13, 40 };
+    static const jint fades[] = { 0, 2, 7 };
+    static uint16_t before[BUFFER_STRIDE * BUFFER_HEIGHT];
+    uint32_t faded = 0;
+
+    for (uint32_t c = 0; c < (sizeof(clips) / sizeof(clips[0])); c++) {
+        for (uint32_t i = 0; i < (sizeof(circles) / sizeof(circles[0])); i++) {
+            for (uint32_t t = 0; t < (sizeof(thicknesses) / sizeof(thicknesses[0])); t++) {
+                for (uint32_t f = 0; f < (sizeof(fades) / sizeof(fades[0])); f++) {
+                    model_ring_t ring;
+
+                    prepare_faded(&clips[c], before);
+                    TEST_ASSERT_EQUAL_INT(DRAWING_DONE, DW_DRAWING_drawThickFadedCircle(&gc, circles[i][0], circles[i][1], circles[i][2], thicknesses[t], fades[f]));
+                    model_init_ring(&ring, circles[i][0], circles[i][1], circles[i][2], 0.0f, 360.0f, thicknesses[t], fades[f], DRAWING_ENDOFLINE_NONE, DRAWING_ENDOFLINE_NONE);
+                    TEST_ASSERT_EQUAL_INT(0, model_faded(&clips[c], &ring, model_ring_distance, &ring.fade, &faded));
+                    TEST_ASSERT(check_limits(before));
+                    TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+                }
+            }
+        }
+    }
+    TEST_ASSERT(0 != faded);
+}
+
+static void dw_drawing_rgb565_faded_arc_f(void)
+{
+    static const jint circles[][3] = { { 14, 6, 33 }, { 40, 30, 12 } };
+    static const jfloat starts[] = { 0.0f, 30.0f, 90.0f, 200.0f, -45.0f };
+    /* narrow, half, wide, clockwise, almost and more than a circle */
+    static const jfloat arcs[] = { 45.0f, 90.0f, 180.0f, 270.0f, -120.0f, 359.0f, 360.0f, 500.0f };
+    static const jint shapes[][2] = { { 3, 0 }, { 10, 3 } };
+    static uint16_t before[BUFFER_STRIDE * BUFFER_HEIGHT];
+    uint32_t faded = 0;
+
+    for (uint32_t i = 0; i < (sizeof(circles) / sizeof(circles[0])); i++) {
+        for (uint32_t s = 0; s < (sizeof(starts) / sizeof(starts[0])); s++) {
+            for (uint32_t a = 0; a < (sizeof(arcs) / sizeof(arcs[0])); a++) {
+                for (uint32_t t = 0; t < (sizeof(shapes) / sizeof(shapes[0])); t++) {
+                    for (uint32_t caps = 0; caps < 9; caps++) {
+                        model_ring_t ring;
+
+                        prepare_faded(&clips[(s + a) % 2], before);
+                        TEST_ASSERT_EQUAL_INT(DRAWING_DONE, DW_DRAWING_drawThickFadedCircleArc(&gc, circles[i][0], circles[i][1], circles[i][2], starts[s], arcs[a], shapes[t][0], shapes[t][1],
+                                (DRAWING_Cap)(caps % 3), (DRAWING_Cap)(caps / 3)));
+                        model_init_ring(&ring, circles[i][0], circles[i][1], circles[i][2], starts[s], arcs[a], shapes[t][0], shapes[t][1], (DRAWING_Cap)(caps % 3), (DRAWING_Cap)(caps / 3));
+                        TEST_ASSERT_EQUAL_INT(0, model_faded(&clips[(s + a) % 2], &ring, model_ring_distance, &ring.fade, &faded));
+                        TEST_ASSERT(check_limits(before));
+                        TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+                    }
+                }
+            }
+        }
+    }
+    TEST_ASSERT(0 != faded);
+}
+
+/*
+ * The faded shapes up to the supported sizes (thickness plus twice the fade and the diameter up to
+ * 2042 pixels) are drawn by the kernels: their edges cross the buffer.
+ */
+static void dw_drawing_rgb565_faded_large_f(void)
+{
+    /* start x, start y, end x, end y, thickness, fade */
+    static const jint lines[][6] = {
+        { -200, -100, -200, 200, 300, 150 }, { -100, -530, 200, -530, 1000, 500 }, { -700, 23, -650, 23, 1200, 200 }, { -300, -300, -40, -20, 2, 1020 },
+    };
+    /* x, y, diameter, thickness, fade */
+    static const jint circles[][5] = { { -570, -277, 600, 3, 4 }, { -170, 3, 40, 300, 150 }, { -970, -477, 1000, 20, 10 }, { -930, -477, 1000, 2, 20 } };
+    static const jfloat starts[] = { 0.0f, -30.0f };
+    static const jfloat arcs[] = { 90.0f, 60.0f, 300.0f };
+    static uint16_t before[BUFFER_STRIDE * BUFFER_HEIGHT];
+    uint32_t faded = 0;
+
+    for (uint32_t l = 0; l < (sizeof(lines) / sizeof(lines[0])); l++) {
+        for (uint32_t caps = 0; caps < 9; caps++) {
+            model_line_t line;
+
+            prepare_faded(&clips[l % 2], before);
+            TEST_ASSERT_EQUAL_INT(DRAWING_DONE, DW_DRAWING_drawThickFadedLine(&gc, lines[l][0], lines[l][1], lines[l][2], lines[l][3], lines[l][4], lines[l][5],
+                    (DRAWING_Cap)(caps % 3), (DRAWING_Cap)(caps / 3)));
+            model_init_line(&line, lines[l][0], lines[l][1], lines[l][2], lines[l][3], lines[l][4], lines[l][5], (DRAWING_Cap)(caps % 3), (DRAWING_Cap)(caps / 3));
+            TEST_ASSERT_EQUAL_INT(0, model_faded(&clips[l % 2], &line, model_line_distance, &line.fade, &faded));
+            TEST_ASSERT(check_limits(before));
+            TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+        }
+    }
+
+    for (uint32_t i = 0; i < (sizeof(circles) / sizeof(circles[0])); i++) {
+        model_ring_t ring;
+
+        prepare_faded(&clips[0], before);
+        TEST_ASSERT_EQUAL_INT(DRAWING_DONE, DW_DRAWING_drawThickFadedCircle(&gc, circles[i][0], circles[i][1], circles[i][2], circles[i][3], circles[i][4]));
+        model_init_ring(&ring, circles[i][0], circles[i][1], circles[i][2], 0.0f, 360.0f, circles[i][3], circles[i][4], DRAWING_ENDOFLINE_NONE, DRAWING_ENDOFLINE_NONE);
+        TEST_ASSERT_EQUAL_INT(0, model_faded(&clips[0], &ring, model_ring_distance, &ring.fade, &faded));
+        TEST_ASSERT(check_limits(before));
+        TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+
+        for (uint32_t s = 0; s < (sizeof(starts) / sizeof(starts[0])); s++) {
+            for (uint32_t a = 0; a < (sizeof(arcs) / sizeof(arcs[0])); a++) {
+                for (uint32_t caps = 0; caps < 9; caps++) {
+                    prepare_faded(&clips[(s + a) % 2], before);
+                    TEST_ASSERT_EQUAL_INT(DRAWING_DONE, DW_DRAWING_drawThickFadedCircleArc(&gc, circles[i][0], circles[i][1], circles[i][2], starts[s], arcs[a], circles[i][3], circles[i][4],
+                            (DRAWING_Cap)(caps % 3), (DRAWING_Cap)(caps / 3)));
+                    model_init_ring(&ring, circles[i][0], circles[i][1], circles[i][2], starts[s], arcs[a], circles[i][3], circles[i][4], (DRAWING_Cap)(caps % 3), (DRAWING_Cap)(caps / 3));
+                    TEST_ASSERT_EQUAL_INT(0, model_faded(&clips[(s + a) % 2], &ring, model_ring_distance, &ring.fade, &faded));
+                    TEST_ASSERT(check_limits(before));
+                    TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+                }
+            }
+        }
+    }
+    TEST_ASSERT(0 != faded);
+}
+
+/*
+ * The faded shapes out of the supported sizes and the other destinations are delegated to the
+ * software algorithms; the empty circles are not drawn.
+ */
+static void dw_drawing_rgb565_faded_delegated_f(void)
+{
+    static uint32_t argb8888_buffer[BUFFER_STRIDE * BUFFER_HEIGHT];
+    static uint16_t before[BUFFER_STRIDE * BUFFER_HEIGHT];
+
+    prepare_faded(&clips[0], before);
+    DW_DRAWING_drawThickFadedLine(&gc, 10, 10, 20, 20, 0, 2, DRAWING_ENDOFLINE_NONE, DRAWING_ENDOFLINE_NONE);
+    DW_DRAWING_drawThickFadedLine(&gc, 10, 10, 20, 20, 2039, 2, DRAWING_ENDOFLINE_NONE, DRAWING_ENDOFLINE_NONE);
+    DW_DRAWING_drawThickFadedLine(&gc, 10, 10, 20, 20, 4, 1020, DRAWING_ENDOFLINE_NONE, DRAWING_ENDOFLINE_NONE);
+    DW_DRAWING_drawThickFadedLine(&gc, 10, 10, 3000, 20, 4, 2, DRAWING_ENDOFLINE_NONE, DRAWING_ENDOFLINE_NONE);
+    DW_DRAWING_drawThickFadedLine(&gc, 10, 10, 10, 10, 4, 2, DRAWING_ENDOFLINE_ROUNDED, DRAWING_ENDOFLINE_ROUNDED);
+    DW_DRAWING_drawThickFadedCircle(&gc, 10, 10, 1018, 4, 2);
+    DW_DRAWING_drawThickFadedCircle(&gc, -3000, 10, 20, 4, 2);
+    DW_DRAWING_drawThickFadedCircleArc(&gc, 10, 10, 20, 0.0f, 0.0f, 4, 2, DRAWING_ENDOFLINE_NONE, DRAWING_ENDOFLINE_NONE);
+    DW_DRAWING_drawThickFadedCircleArc(&gc, 10, 10, 20, NAN, 90.0f, 4, 2, DRAWING_ENDOFLINE_NONE, DRAWING_ENDOFLINE_NONE);
+    TEST_ASSERT_EQUAL_INT(9, UI_DRAWING_STUB_get_soft_calls());
+    DW_DRAWING_drawThickFadedCircle(&gc, 10, 10, 0, 4, 2);
+    DW_DRAWING_drawThickFadedCircleArc(&gc, 10, 10, -5, 0.0f, 90.0f, 4, 2, DRAWING_ENDOFLINE_NONE, DRAWING_ENDOFLINE_NONE);
+    TEST_ASSERT_EQUAL_INT(9, UI_DRAWING_STUB_get_soft_calls());
+    TEST_ASSERT(0 == memcmp(buffer, before, sizeof(buffer)));
+
+    /* an ARGB8888 destination */
+    UI_DRAWING_STUB_reset();
+    UI_DRAWING_STUB_init_gc(&gc, MICROUI_IMAGE_FORMAT_ARGB8888, BUFFER_WIDTH, BUFFER_HEIGHT, (uint8_t*)argb8888_buffer, BUFFER_STRIDE * sizeof(uint32_t));
+    DW_DRAWING_drawThickFadedLine(&gc, 10, 10, 20, 20, 4, 2, DRAWING_ENDOFLINE_NONE, DRAWING_ENDOFLINE_NONE);
+    DW_DRAWING_drawThickFadedCircle(&gc, 10, 10, 20, 4, 2);
+    DW_DRAWING_drawThickFadedCircleArc(&gc, 10, 10, 20, 0.0f, 90.0f, 4, 2, DRAWING_ENDOFLINE_NONE, DRAWING_ENDOFLINE_NONE);
+    TEST_ASSERT_EQUAL_INT(3, UI_DRAWING_STUB_get_soft_calls());
+}
+
+/*
+ * Speed of the kernels and of a per-pixel floating point loop over the bounding box of the shape
+ * (the reference models), on a display buffer.
+ */
+static void dw_drawing_rgb565_faded_report_f(void)
+{
+    static const struct {
+        const char* name;
+        bool circle;
+        jfloat arc;
+        jint diameter;
+        jint thickness;
+        jint fade;
+    } cases[] = {
+        { "line 200 px, 6 + 2", false, 0.0f, 200, 6, 2 },
+        { "line 200 px, 30 + 8", false, 0.0f, 200, 30, 8 },
+        { "circle 200 px, 6 + 2", true, 360.0f, 200, 6, 2 },
+        { "circle 200 px, 30 + 8", true, 360.0f, 200, 30, 8 },
+        { "arc 200 px 270 deg, 12 + 3", true, 270.0f, 200, 12, 3 },
+    };
+    uint16_t* display = malloc(BENCH_WIDTH * BENCH_HEIGHT * sizeof(uint16_t));
+    jint x = (BENCH_WIDTH - 200) / 2;
+    jint y = (BENCH_HEIGHT - 200) / 2;
+
+    TEST_ASSERT(NULL != display);
+    memset(display, 0, BENCH_WIDTH * BENCH_HEIGHT * sizeof(uint16_t));
+    UI_DRAWING_STUB_reset();
+    UI_DRAWING_STUB_init_gc(&gc, MICROUI_IMAGE_FORMAT_RGB565, BENCH_WIDTH, BENCH_HEIGHT, (uint8_t*)display, BENCH_WIDTH * sizeof(uint16_t));
+    gc.foreground_color = FADED_COLOR;
+
+    for (uint32_t k = 0; k < (sizeof(cases) / sizeof(cases[0])); k++) {
+        model_line_t line;
+        model_ring_t ring;
+        const void* shape = &line;
+        model_distance_t get_distance = model_line_distance;
+        const model_fade_t* fade = &line.fade;
+        jint extent = cases[k].thickness + cases[k].fade + 1;
+        /* the line goes from (x, y + 50) to (x + 200, y + 150) */
+        jint top = cases[k].circle ? y : (y + 50);
+        jint bottom = cases[k].circle ? (y + cases[k].diameter) : (y + 150);
+        double kernel;
+        double loop;
+        double start = now_ms();
+
+        for (uint32_t i = 0; i < BENCH_DRAWINGS; i++) {
+            if (!cases[k].circle) {
+                DW_DRAWING_drawThickFadedLine(&gc, x, y + 50, x + 200, y + 150, cases[k].thickness, cases[k].fade, DRAWING_ENDOFLINE_ROUNDED, DRAWING_ENDOFLINE_ROUNDED);
+            }
+            else {
+                DW_DRAWING_drawThickFadedCircleArc(&gc, x, y, cases[k].diameter, 30.0f, cases[k].arc, cases[k].thickness, cases[k].fade, DRAWING_ENDOFLINE_ROUNDED,
+                        DRAWING_ENDOFLINE_ROUNDED);
+            }
+        }
+        kernel = (now_ms() - start) / BENCH_DRAWINGS;
+
+        if (cases[k].circle) {
+            model_init_ring(&ring, x, y, cases[k].diameter, 30.0f, cases[k].arc, cases[k].thickness, cases[k].fade, DRAWING_ENDOFLINE_ROUNDED, DRAWING_ENDOFLINE_ROUNDED);
+            shape = &ring;
+            get_distance = model_ring_distance;
+            fade = &ring.fade;
+        }
+        else {
+            model_init_line(&line, x, y + 50, x + 200, y + 150, cases[k].thickness, cases[k].fade, DRAWING_ENDOFLINE_ROUNDED, DRAWING_ENDOFLINE_ROUNDED);
+        }
+        start = now_ms();
+        for (uint32_t i = 0; i < BENCH_DRAWINGS; i++) {
+            for (jint py = top - extent; py < (bottom + extent); py++) {
+                for (jint px = x - extent; px < (x + cases[k].diameter + extent); px++) {
+                    uint32_t alpha = model_fade_alpha(fade, get_distance(shape, px + 0.5, py + 0.5));
+                    uint16_t* pixel = &display[((uint32_t)py * BENCH_WIDTH) + (uint32_t)px];
+                    *pixel = model_blend(FADED_COLOR | 0xff000000, *pixel, alpha);
+                }
+            }
+        }
+        loop = (now_ms() - start) / BENCH_DRAWINGS;
+
+        printf("DW_DRAWING_RGB565: faded %-27s kernel %8.1f us, per-pixel float loop %8.1f us\n", cases[k].name, kernel * 1000.0, loop * 1000.0);
+    }
+    TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+    free(display);
+}
+
+TestRef dw_drawing_rgb565_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture("dw_drawing_rgb565_rotate_nearest", dw_drawing_rgb565_rotate_nearest_f),
+        new_TestFixture("dw_drawing_rgb565_rotate_bilinear", dw_drawing_rgb565_rotate_bilinear_f),
+        new_TestFixture("dw_drawing_rgb565_scale", dw_drawing_rgb565_scale_f),
+        new_TestFixture("dw_drawing_rgb565_transform_delegated", dw_drawing_rgb565_transform_delegated_f),
+        new_TestFixture("dw_drawing_rgb565_transform_report", dw_drawing_rgb565_transform_report_f),
+        new_TestFixture("dw_drawing_rgb565_faded_line", dw_drawing_rgb565_faded_line_f),
+        new_TestFixture("dw_drawing_rgb565_faded_circle", dw_drawing_rgb565_faded_circle_f),
+        new_TestFixture("dw_drawing_rgb565_faded_arc", dw_drawing_rgb565_faded_arc_f),
+        new_TestFixture("dw_drawing_rgb565_faded_large", dw_drawing_rgb565_faded_large_f),
+        new_TestFixture("dw_drawing_rgb565_faded_delegated", dw_drawing_rgb565_faded_delegated_f),
+        new_TestFixture("dw_drawing_rgb565_faded_report", dw_drawing_rgb565_faded_report_f),
+    };
+    EMB_UNIT_TESTCALLER(dw_drawing_rgb565, "dw_drawing_rgb565", setUp, tearDown, fixtures);
+
+    return (TestRef)&dw_drawing_rgb565;
+}
@@ -0,0 +1,256 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Tests of the framerate statistics (framerate.c) with synthetic timestamps.
+ *
+ * The framerate task runs on the host OSAL port and its sleep waits for the test: the test
+ * notifies the flushes with chosen timestamps, then ends the period and checks the published
+ * frame intervals percentiles, flush latencies and dropped frames.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <embUnit/embUnit.h>
+#include "framerate_impl.h"
+#include "osal_pthread.h"
+
+/* Period of the framerate task: the framerate is the number of frames of the period */
+#define SCHEDULE_TIME_MS 1000
+
+/* Frame intervals of the accuracy test */
+#define RANDOM_INTERVALS 5000
+
+/* Java natives of framerate.c */
+uint32_t javaFramerateGetFrameTime(int32_t percentile);
+uint32_t javaFramerateGetFlushLatency(int32_t percentile);
+uint32_t javaFramerateGetDroppedFrames(void);
+
+static OSAL_task_stack_declare(framerate_task_stack, 1024);
+static OSAL_task_handle_t framerate_task_handle;
+static OSAL_binary_semaphore_handle_t period_end;
+static uint32_t now_us;
+
+/* Framerate task on the host OSAL port -------------------------------------*/
+
+static void framerate_task(void* args)
+{
+    (void)args;
+    framerate_task_work();
+}
+
+int32_t framerate_impl_start_task(void)
+{
+    if ((OSAL_OK != OSAL_binary_semaphore_create((uint8_t*)"framerate period", 0, &period_end))
+            || (OSAL_OK != OSAL_task_create(framerate_task, (uint8_t*)"framerate", framerate_task_stack, 1, NULL, &framerate_task_handle))) {
+        return FRAMERATE_ERROR;
+    }
+    return FRAMERATE_OK;
+}
+
+/* The period ends when the test says so */
+void framerate_impl_sleep(uint32_t ms)
+{
+    (void)ms;
+    OSAL_binary_semaphore_take(&period_end, OSAL_INFINITE_TIME);
+}
+
+/* Helpers -------------------------------------------------------------------*/
+
+/*
+ * End the current period and wait until the framerate task has published it.
+ */
+static void end_period(void)
+{
+    OSAL_binary_semaphore_give(&period_end);
+    OSAL_PTHREAD_wait_idle();
+}
+
+/*
+ * Flush a frame the given time after the previous one; its flush ends after the given latency.
+ */
+static void frame(uint32_t interval_us, uint32_t latency_us)
+{
+    now_us += interval_us;
+    framerate_increment();
+    framerate_add_flush(now_us);
+    framerate_add_flush_done(now_us + latency_us);
+}
+
+/*
+ * Value given by the histograms for a duration: the middle of its bucket, 16 buckets per power
+ * of two.
+ */
+static uint32_t bucket_value(uint32_t duration_us)
+{
+    uint32_t shift = 0;
+
+    while ((duration_us >> shift) >= 32) {
+        shift++;
+    }
+    return (duration_us < 16) ? duration_us : (((duration_us >> shift) << shift) + ((1u << shift) >> 1));
+}
+
+static int compare_durations(const void* a, const void* b)
+{
+    uint32_t first = *(const uint32_t*)a;
+    uint32_t second = *(const uint32_t*)b;
+    return (first > second) - (first < second);
+}
+
+static void setUp(void)
+{
+    /* the task is started by the first initialization: wait for its first sleep */
+    TEST_ASSERT_EQUAL_INT(FRAMERATE_OK, framerate_init(SCHEDULE_TIME_MS));
+    OSAL_PTHREAD_wait_idle();
+    /* a first flush far from the ones of the other tests, then a new period */
+    now_us += 10 * FRAMERATE_IDLE_INTERVAL_US;
+    framerate_add_flush(now_us);
+    end_period();
+}
+
+static void tearDown(void)
+{
+}
+
+/* Tests ---------------------------------------------------------------------*/
+
+/*
+ * 16.7 ms frames with four 50 ms stalls (two frames dropped each) and an idle gap which is not
+ * a frame interval.
+ */
+static void framerate_frame_times_f(void)
+{
+    for (uint32_t i = 0; i < 100; i++) {
+        frame(FRAMERATE_FRAME_PERIOD_US, 4000);
+        if (0 == (i % 25)) {
+            frame(50000, 4000);
+        }
+    }
+    frame(FRAMERATE_IDLE_INTERVAL_US + 1, 4000);
+    for (uint32_t i = 0; i < 20; i++) {
+        frame(FRAMERATE_FRAME_PERIOD_US, 4000);
+    }
+    end_period();
+
+    TEST_ASSERT_EQUAL_INT(125, framerate_get());
+    TEST_ASSERT_EQUAL_INT(8, framerate_get_dropped_frames());
+    TEST_ASSERT_EQUAL_INT(bucket_value(FRAMERATE_FRAME_PERIOD_US), framerate_get_frame_time(0));
+    TEST_ASSERT_EQUAL_INT(bucket_value(FRAMERATE_FRAME_PERIOD_US), framerate_get_frame_time(50));
+    TEST_ASSERT_EQUAL_INT(bucket_value(FRAMERATE_FRAME_PERIOD_US), framerate_get_frame_time(96));
+    TEST_ASSERT_EQUAL_INT(bucket_value(50000), framerate_get_frame_time(97));
+    TEST_ASSERT_EQUAL_INT(bucket_value(50000), framerate_get_frame_time(100));
+    TEST_ASSERT_EQUAL_INT(bucket_value(50000), framerate_get_frame_time(1000));
+    TEST_ASSERT_EQUAL_INT(bucket_value(4000), framerate_get_flush_latency(50));
+    TEST_ASSERT_EQUAL_INT(bucket_value(50000), javaFramerateGetFrameTime(100));
+    TEST_ASSERT_EQUAL_INT(bucket_value(FRAMERATE_FRAME_PERIOD_US), javaFramerateGetFrameTime(-1));
+    TEST_ASSERT_EQUAL_INT(8, javaFramerateGetDroppedFrames());
+
+    /* rounded number of frame periods: 1.4 periods drop nothing, 1.6 periods drop a frame */
+    frame((FRAMERATE_FRAME_PERIOD_US * 14) / 10, 0);
+    frame((FRAMERATE_FRAME_PERIOD_US * 16) / 10, 0);
+    frame(FRAMERATE_FRAME_PERIOD_US * 10, 0);
+    end_period();
+    TEST_ASSERT_EQUAL_INT(1 + 9, framerate_get_dropped_frames());
+}
+
+/*
+ * Latency from a flush to its end: one sample per flush, across the timestamps wrap-around,
+ * saturated in the last bucket.
+ */
+static void framerate_flush_latency_f(void)
+{
+    for (uint32_t i = 0; i < 9; i++) {
+        frame(FRAMERATE_FRAME_PERIOD_US, 3000 + (i * 1000));
+    }
+    /* no flush pending */
+    framerate_add_flush_done(now_us + 500000);
+    end_period();
+    TEST_ASSERT_EQUAL_INT(bucket_value(3000), framerate_get_flush_latency(0));
+    TEST_ASSERT_EQUAL_INT(bucket_value(7000), framerate_get_flush_latency(50));
+    TEST_ASSERT_EQUAL_INT(bucket_value(11000), framerate_get_flush_latency(100));
+    TEST_ASSERT_EQUAL_INT(bucket_value(11000), javaFramerateGetFlushLatency(100));
+
+    now_us = 0xffffff00;
+    framerate_add_flush(now_us);
+    framerate_add_flush_done(now_us + 0x200);
+    end_period();
+    TEST_ASSERT_EQUAL_INT(bucket_value(0x200), framerate_get_flush_latency(100));
+
+    framerate_add_flush(now_us);
+    framerate_add_flush_done(now_us + 100000000);
+    framerate_add_flush(now_us);
+    framerate_add_flush_done(now_us + 7);
+    end_period();
+    TEST_ASSERT_EQUAL_INT(7, framerate_get_flush_latency(50));
+    TEST_ASSERT_EQUAL_INT(bucket_value((1u << 24) - 1), framerate_get_flush_latency(100));
+}
+
+/*
+ * The values of a period are published at its end, then cleared.
+ */
+static void framerate_periods_f(void)
+{
+    frame(FRAMERATE_FRAME_PERIOD_US * 3, 1000);
+    framerate_add_flush_time(1000);
+    framerate_add_flush_time(3000);
+    end_period();
+    TEST_ASSERT_EQUAL_INT(1, framerate_get());
+    TEST_ASSERT_EQUAL_INT(2, framerate_get_dropped_frames());
+    TEST_ASSERT_EQUAL_INT(2000, framerate_get_flush_time());
+    TEST_ASSERT_EQUAL_INT(3000, framerate_get_flush_time_max());
+    TEST_ASSERT(0 != framerate_get_frame_time(50));
+
+    end_period();
+    TEST_ASSERT_EQUAL_INT(0, framerate_get());
+    TEST_ASSERT_EQUAL_INT(0, framerate_get_dropped_frames());
+    TEST_ASSERT_EQUAL_INT(0, framerate_get_flush_time());
+    TEST_ASSERT_EQUAL_INT(0, framerate_get_flush_time_max());
+    TEST_ASSERT_EQUAL_INT(0, framerate_get_frame_time(50));
+    TEST_ASSERT_EQUAL_INT(0, framerate_get_flush_latency(50));
+}
+
+/*
+ * The percentiles of random frame intervals are within 1/32 of the exact ones.
+ */
+static void framerate_percentiles_report_f(void)
+{
+    static const uint32_t percentiles[] = { 1, 10, 25, 50, 75, 90, 95, 99, 100 };
+    static uint32_t intervals[RANDOM_INTERVALS];
+
+    srand(16);
+    for (uint32_t i = 0; i < RANDOM_INTERVALS; i++) {
+        /* mostly regular frames, some long ones */
+        intervals[i] = 10000 + (rand() % 15000) + ((0 == (rand() % 10)) ? (rand() % 100000) : 0);
+        frame(intervals[i], 2000);
+    }
+    end_period();
+
+    qsort(intervals, RANDOM_INTERVALS, sizeof(intervals[0]), compare_durations);
+    for (uint32_t i = 0; i < (sizeof(percentiles) / sizeof(percentiles[0])); i++) {
+        uint32_t exact = intervals[(((RANDOM_INTERVALS * percentiles[i]) + 99) / 100) - 1];
+        uint32_t histogram = framerate_get_frame_time(percentiles[i]);
+        uint32_t error = (histogram > exact) ? (histogram - exact) : (exact - histogram);
+
+        TEST_ASSERT(error <= (exact / 32));
+        printf("FRAMERATE: p%u frame time %u us, exact %u us\n", (unsigned int)percentiles[i], (unsigned int)histogram, (unsigned int)exact);
+    }
+    printf("FRAMERATE: %u frames, %u dropped\n", (unsigned int)framerate_get(), (unsigned int)framerate_get_dropped_frames());
+}
+
+TestRef framerate_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture("framerate_frame_times", framerate_frame_times_f),
+        new_TestFixture("framerate_flush_latency", framerate_flush_latency_f),
+        new_TestFixture("framerate_periods", framerate_periods_f),
+        new_TestFixture("framerate_percentiles_report", framerate_percentiles_report_f),
+    };
+    EMB_UNIT_TESTCALLER(framerate, "framerate", setUp, tearDown, fixtures);
+
+    return (TestRef)&framerate;
+}
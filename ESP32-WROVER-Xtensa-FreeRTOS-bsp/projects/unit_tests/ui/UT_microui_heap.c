@@ -0,0 +1,328 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Tests of the images heap information (LLUI_DISPLAY_HEAP_impl.c) on the host model of the best
+ * fit allocator.
+ *
+ * A random allocation trace is replayed: after each step, the free blocks reported by the heap
+ * are compared with the free blocks of the allocator model. The trace alternately keeps fewer
+ * and more blocks alive than MICROUI_HEAP_TRACKED_BLOCKS: the free blocks are then unknown.
+ *
+ * The benchmark replays a recorded trace of small buffers and images and reports the time per
+ * operation and the heap peak usage. Compare the reports of "make run" and "make run-slab" to
+ * evaluate the slab layer (MICROUI_HEAP_SLAB_ENABLED).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <embUnit/embUnit.h>
+#include "microui_heap.h"
+#include "LLUI_DISPLAY_impl.h"
+#include "LLUI_DISPLAY_stub.h"
+#include "BESTFIT_ALLOCATOR_stub.h"
+#include "sni.h"
+
+#define HEAP_SIZE (1024 * 1024)
+
+/* Allocation trace: number of steps, maximum number of live blocks below and above the tracked blocks */
+#define TRACE_STEPS 100000
+#define TRACE_PERIOD 20000
+#define TRACE_FEW_BLOCKS 100
+#define TRACE_MANY_BLOCKS 300
+
+/* Benchmark trace: number of operations, live blocks, share of the small (up to 512 bytes) allocations in % */
+#define BENCH_OPERATIONS 200000
+#define BENCH_LIVE_BLOCKS 120
+#define BENCH_SMALL_SHARE 70
+
+/* Operation of the benchmark trace: allocate a block of the given size or free a live block (size 0) */
+typedef struct {
+    uint32_t size;
+    uint32_t index;
+} bench_operation_t;
+
+uint32_t javaImageHeapGetLargestFreeBlock(void);
+uint32_t javaImageHeapGetFragmentation(void);
+uint32_t javaImageHeapGetFreeBlocksHistogram(jint* histogram);
+
+static uint8_t* live[TRACE_MANY_BLOCKS];
+static uint32_t live_number;
+static bench_operation_t bench_trace[BENCH_OPERATIONS];
+
+static double now_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((double)now.tv_sec * 1e9) + (double)now.tv_nsec;
+}
+
+static uint32_t used_space(void)
+{
+    return MICROUI_HEAP_total_space() - MICROUI_HEAP_free_space();
+}
+
+static void free_all(void)
+{
+    while (live_number > 0) {
+        LLUI_DISPLAY_IMPL_image_heap_free(live[--live_number]);
+    }
+}
+
+/*
+ * Play one step of the allocation trace: free a random block or allocate a block of a random
+ * size (mostly small buffers, some images). Two allocations for one free: the number of live
+ * blocks grows up to the limit of the period.
+ */
+static void trace_step(uint32_t step)
+{
+    uint32_t limit = ((step / TRACE_PERIOD) % 2) ? TRACE_MANY_BLOCKS : TRACE_FEW_BLOCKS;
+
+    if ((live_number > 0) && ((live_number >= limit) || (0 == (rand() % 3)))) {
+        uint32_t index = (uint32_t)rand() % live_number;
+        LLUI_DISPLAY_IMPL_image_heap_free(live[index]);
+        live[index] = live[--live_number];
+    }
+    else {
+        uint32_t size = (rand() % 4) ? ((uint32_t)rand() % 2048) + 1 : ((uint32_t)rand() % 16000) + 1;
+        uint8_t* block = LLUI_DISPLAY_IMPL_image_heap_allocate(size);
+        if (NULL != block) {
+            live[live_number++] = block;
+        }
+    }
+}
+
+static void setUp(void)
+{
+    srand(7);
+    live_number = 0;
+    LLUI_DISPLAY_STUB_initialize_heap(HEAP_SIZE);
+}
+
+static void tearDown(void)
+{
+    free_all();
+}
+
+static void microui_heap_initialize_f(void)
+{
+    uint32_t histogram[MICROUI_HEAP_HISTOGRAM_SIZE];
+
+    TEST_ASSERT_EQUAL_INT(MICROUI_HEAP_total_space(), MICROUI_HEAP_free_space());
+    TEST_ASSERT_EQUAL_INT(0, MICROUI_HEAP_number_of_allocated_blocks());
+    TEST_ASSERT_EQUAL_INT(0, MICROUI_HEAP_high_water_mark());
+    TEST_ASSERT_EQUAL_INT(MICROUI_HEAP_total_space(), MICROUI_HEAP_largest_free_block());
+    TEST_ASSERT_EQUAL_INT(0, MICROUI_HEAP_fragmentation());
+    TEST_ASSERT_EQUAL_INT(1, MICROUI_HEAP_free_blocks_histogram(histogram));
+    TEST_ASSERT_EQUAL_INT(1, histogram[MICROUI_HEAP_HISTOGRAM_SIZE - 1]);
+}
+
+static void microui_heap_random_trace_f(void)
+{
+    uint32_t known = 0;
+    uint32_t unknown = 0;
+    uint32_t max_used = 0;
+
+    for (uint32_t step = 0; step < TRACE_STEPS; step++) {
+        uint32_t histogram[MICROUI_HEAP_HISTOGRAM_SIZE];
+        uint32_t count;
+        uint32_t largest;
+        uint32_t total;
+        uint32_t expected_count;
+        uint32_t histogram_count = 0;
+
+        trace_step(step);
+        max_used = (used_space() > max_used) ? used_space() : max_used;
+        TEST_ASSERT_EQUAL_INT(max_used, MICROUI_HEAP_high_water_mark());
+
+        expected_count = BESTFIT_ALLOCATOR_STUB_get_free_blocks(&largest, &total);
+        TEST_ASSERT_EQUAL_INT(total, MICROUI_HEAP_free_space());
+
+        count = MICROUI_HEAP_free_blocks_histogram(histogram);
+        for (uint32_t i = 0; i < MICROUI_HEAP_HISTOGRAM_SIZE; i++) {
+            histogram_count += histogram[i];
+        }
+        if (MICROUI_HEAP_UNKNOWN == count) {
+            /* Never a wrong value: every free blocks function tells that it does not know */
+            unknown++;
+            TEST_ASSERT_EQUAL_INT(0, histogram_count);
+            TEST_ASSERT(MICROUI_HEAP_UNKNOWN == MICROUI_HEAP_largest_free_block());
+            TEST_ASSERT(MICROUI_HEAP_UNKNOWN == MICROUI_HEAP_fragmentation());
+        }
+        else {
+            known++;
+            TEST_ASSERT_EQUAL_INT(expected_count, count);
+            TEST_ASSERT_EQUAL_INT(expected_count, histogram_count);
+            TEST_ASSERT_EQUAL_INT(largest, MICROUI_HEAP_largest_free_block());
+            TEST_ASSERT_EQUAL_INT((0 == total) ? 0 : (100 - (uint32_t)(((uint64_t)largest * 100) / total)), MICROUI_HEAP_fragmentation());
+        }
+    }
+    TEST_ASSERT(known > 0);
+    TEST_ASSERT(unknown > 0);
+
+    /* Everything freed: the free blocks are known again */
+    free_all();
+    TEST_ASSERT_EQUAL_INT(0, MICROUI_HEAP_number_of_allocated_blocks());
+    TEST_ASSERT(MICROUI_HEAP_UNKNOWN != MICROUI_HEAP_largest_free_block());
+}
+
+static void microui_heap_natives_f(void)
+{
+    /* Java int arrays: the length is stored before the first element */
+    jint short_array[1 + 4];
+    jint long_array[1 + MICROUI_HEAP_HISTOGRAM_SIZE + 2];
+    uint32_t histogram[MICROUI_HEAP_HISTOGRAM_SIZE];
+    uint32_t count;
+
+    for (uint32_t step = 0; step < 1000; step++) {
+        trace_step(step);
+    }
+    count = MICROUI_HEAP_free_blocks_histogram(histogram);
+
+    short_array[0] = 4;
+    memset(&short_array[1], 0xFF, 4 * sizeof(jint));
+    TEST_ASSERT_EQUAL_INT(count, javaImageHeapGetFreeBlocksHistogram(&short_array[1]));
+    for (uint32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT((jint)histogram[i], short_array[1 + i]);
+    }
+
+    long_array[0] = MICROUI_HEAP_HISTOGRAM_SIZE + 2;
+    memset(&long_array[1], 0xFF, (MICROUI_HEAP_HISTOGRAM_SIZE + 2) * sizeof(jint));
+    TEST_ASSERT_EQUAL_INT(count, javaImageHeapGetFreeBlocksHistogram(&long_array[1]));
+    for (uint32_t i = 0; i < MICROUI_HEAP_HISTOGRAM_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((jint)histogram[i], long_array[1 + i]);
+    }
+    TEST_ASSERT_EQUAL_INT(-1, long_array[1 + MICROUI_HEAP_HISTOGRAM_SIZE]);
+
+    /* More blocks than the tracked ones: -1 on the Java side */
+    free_all();
+    while (live_number < (MICROUI_HEAP_TRACKED_BLOCKS + 1)) {
+        live[live_number++] = LLUI_DISPLAY_IMPL_image_heap_allocate(1024);
+    }
+    TEST_ASSERT_EQUAL_INT(-1, (jint)javaImageHeapGetLargestFreeBlock());
+    TEST_ASSERT_EQUAL_INT(-1, (jint)javaImageHeapGetFragmentation());
+    TEST_ASSERT_EQUAL_INT(-1, (jint)javaImageHeapGetFreeBlocksHistogram(&long_array[1]));
+}
+
+/*
+ * Heap information at the end of the allocation trace (fewer blocks than the tracked ones).
+ */
+static void microui_heap_report_f(void)
+{
+    uint32_t histogram[MICROUI_HEAP_HISTOGRAM_SIZE];
+    uint32_t count;
+
+    for (uint32_t step = 0; step < TRACE_PERIOD; step++) {
+        trace_step(step);
+    }
+    count = MICROUI_HEAP_free_blocks_histogram(histogram);
+    TEST_ASSERT(MICROUI_HEAP_UNKNOWN != count);
+
+    printf("MICROUI_HEAP: %u blocks, free %u / %u bytes, high water mark %u, largest free block %u, fragmentation %u%%, free blocks %u:",
+            (unsigned int)MICROUI_HEAP_number_of_allocated_blocks(), (unsigned int)MICROUI_HEAP_free_space(), (unsigned int)MICROUI_HEAP_total_space(),
+            (unsigned int)MICROUI_HEAP_high_water_mark(), (unsigned int)MICROUI_HEAP_largest_free_block(), (unsigned int)MICROUI_HEAP_fragmentation(),
+            (unsigned int)count);
+    for (uint32_t i = 0; i < MICROUI_HEAP_HISTOGRAM_SIZE; i++) {
+        printf(" %u", (unsigned int)histogram[i]);
+    }
+    printf("\n");
+}
+
+/*
+ * Record the benchmark trace: the number of live blocks grows up to BENCH_LIVE_BLOCKS then
+ * the allocations and the frees alternate randomly.
+ */
+static void bench_record(void)
+{
+    uint32_t live_blocks = 0;
+
+    for (uint32_t i = 0; i < BENCH_OPERATIONS; i++) {
+        bench_operation_t* operation = &bench_trace[i];
+        if ((live_blocks > 0) && ((live_blocks >= BENCH_LIVE_BLOCKS) || (0 == (rand() % 3)))) {
+            operation->size = 0;
+            operation->index = (uint32_t)rand() % live_blocks;
+            live_blocks--;
+        }
+        else {
+            operation->size = ((uint32_t)(rand() % 100) < BENCH_SMALL_SHARE) ? ((uint32_t)rand() % 512) + 1 : ((uint32_t)rand() % 16384) + 1024;
+            operation->index = live_blocks;
+            live_blocks++;
+        }
+    }
+}
+
+/*
+ * Replay the benchmark trace; a failed allocation is recorded as a null block. Returns the
+ * number of failed allocations.
+ */
+static uint32_t bench_replay(void)
+{
+    uint32_t failures = 0;
+
+    for (uint32_t i = 0; i < BENCH_OPERATIONS; i++) {
+        bench_operation_t* operation = &bench_trace[i];
+        if (0 == operation->size) {
+            if (NULL != live[operation->index]) {
+                LLUI_DISPLAY_IMPL_image_heap_free(live[operation->index]);
+            }
+            live[operation->index] = live[--live_number];
+        }
+        else {
+            live[live_number] = LLUI_DISPLAY_IMPL_image_heap_allocate(operation->size);
+            failures += (NULL == live[live_number]) ? 1 : 0;
+            live_number++;
+        }
+    }
+    return failures;
+}
+
+static void microui_heap_benchmark_f(void)
+{
+    double start;
+    double duration;
+    uint32_t failures;
+    uint32_t fragmentation;
+
+    bench_record();
+    start = now_ns();
+    failures = bench_replay();
+    duration = now_ns() - start;
+    fragmentation = MICROUI_HEAP_fragmentation();
+
+    /* the null blocks of the failed allocations are not freed by the tear down */
+    for (uint32_t i = 0; i < live_number; i++) {
+        if (NULL == live[i]) {
+            live[i--] = live[--live_number];
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(live_number, MICROUI_HEAP_number_of_allocated_blocks());
+
+#ifdef MICROUI_HEAP_SLAB_ENABLED
+    printf("MICROUI_HEAP: slab enabled,  ");
+#else
+    printf("MICROUI_HEAP: slab disabled, ");
+#endif
+    printf("%u operations, %.1f ns per operation, high water mark %u bytes, %u failures, end fragmentation %u%%\n",
+            (unsigned int)BENCH_OPERATIONS, duration / BENCH_OPERATIONS, (unsigned int)MICROUI_HEAP_high_water_mark(),
+            (unsigned int)failures, (unsigned int)fragmentation);
+}
+
+TestRef microui_heap_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture("microui_heap_initialize", microui_heap_initialize_f),
+        new_TestFixture("microui_heap_random_trace", microui_heap_random_trace_f),
+        new_TestFixture("microui_heap_natives", microui_heap_natives_f),
+        new_TestFixture("microui_heap_report", microui_heap_report_f),
+        new_TestFixture("microui_heap_benchmark", microui_heap_benchmark_f),
+    };
+    EMB_UNIT_TESTCALLER(microui_heap, "microui_heap", setUp, tearDown, fixtures);
+
+    return (TestRef)&microui_heap;
+}
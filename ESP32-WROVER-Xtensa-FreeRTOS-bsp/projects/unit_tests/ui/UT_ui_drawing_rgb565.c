@@ -0,0 +1,614 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Tests of the RGB565 drawing kernels (ui_drawing_rgb565.c).
+ *
+ * The software algorithms of the Graphics Engine (ui_drawing_soft.h) are only delivered for the
+ * target: the kernels are compared with per-pixel reference models which follow their
+ * documentation. Each drawing is done on a buffer filled with a random pattern, by the kernel
+ * and by the model, across a set of clips, buffer alignments and strides; the whole buffers,
+ * row padding included, must be equal.
+ *
+ * The images are drawn with random regions, positions, clips and global alphas, from RGB565
+ * and ARGB8888 images and from the destination itself (overlapping regions). The blending
+ * of the kernels is also checked against the model for every global alpha and every RGB565
+ * background pixel. The comparison with the software algorithms of the Graphics Engine is
+ * done on the target (projects/unit_tests/drawing/UT_ui_drawing_soft.c).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <embUnit/embUnit.h>
+#include "ui_drawing.h"
+#include "ui_rgb565.h"
+#include "LLUI_DISPLAY_stub.h"
+#include "ui_drawing_stub.h"
+
+/* Destination buffer: an odd width, rows padded or not, first pixel 4-byte aligned or not */
+#define BUFFER_WIDTH 37
+#define BUFFER_HEIGHT 23
+#define BUFFER_MAX_STRIDE 40
+
+/* Source images: size, stride (in pixels) and number of random drawings */
+#define IMAGE_WIDTH 45
+#define IMAGE_HEIGHT 29
+#define IMAGE_STRIDE 48
+#define IMAGE_DRAWINGS 20000
+
+/* Display size and number of drawings of the benchmark */
+#define BENCH_WIDTH 240
+#define BENCH_HEIGHT 320
+#define BENCH_DRAWINGS 200
+
+/* Foreground color of the drawings, and its RGB565 conversion */
+#define COLOR 0x00C08040
+#define COLOR_RGB565 0xC408
+
+typedef struct {
+    jint x1;
+    jint y1;
+    jint x2;
+    jint y2;
+} rect_t;
+
+/* Clips: whole buffer, inner, single pixel, on the buffer edges, empty */
+static const rect_t clips[] = {
+    { 0, 0, BUFFER_WIDTH - 1, BUFFER_HEIGHT - 1 },
+    { 5, 3, 30, 19 },
+    { 6, 4, 29, 18 },
+    { 10, 10, 10, 10 },
+    { 0, 0, 0, BUFFER_HEIGHT - 1 },
+    { BUFFER_WIDTH - 1, 0, BUFFER_WIDTH - 1, BUFFER_HEIGHT - 1 },
+    { 0, BUFFER_HEIGHT - 1, BUFFER_WIDTH - 1, BUFFER_HEIGHT - 1 },
+    { 20, 10, 19, 12 },
+};
+
+/* Rectangles: inside, across each clip edge, around the clip, outside, odd and even bounds */
+static const rect_t rects[] = {
+    { 0, 0, BUFFER_WIDTH - 1, BUFFER_HEIGHT - 1 },
+    { 7, 5, 12, 9 },
+    { 8, 5, 13, 9 },
+    { 7, 5, 7, 5 },
+    { 8, 6, 9, 6 },
+    { -5, 2, 6, 8 },
+    { 25, 2, 50, 8 },
+    { 9, -4, 14, 4 },
+    { 9, 15, 14, 40 },
+    { -10, -10, 60, 60 },
+    { 31, 2, 36, 8 },
+    { -8, -8, -1, -1 },
+    { 40, 25, 45, 30 },
+    { 1, 11, 35, 11 },
+};
+
+static uint16_t buffer[(BUFFER_MAX_STRIDE * BUFFER_HEIGHT) + 2];
+static uint16_t expected[(BUFFER_MAX_STRIDE * BUFFER_HEIGHT) + 2];
+static MICROUI_GraphicsContext gc;
+
+static uint16_t rgb565_pixels[IMAGE_STRIDE * IMAGE_HEIGHT];
+static uint32_t argb8888_pixels[IMAGE_STRIDE * IMAGE_HEIGHT];
+static MICROUI_Image rgb565_image;
+static MICROUI_Image argb8888_image;
+
+static double now_ms(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((double)now.tv_sec * 1000.0) + ((double)now.tv_nsec / 1000000.0);
+}
+
+static jint max_of(jint a, jint b)
+{
+    return (a > b) ? a : b;
+}
+
+static jint min_of(jint a, jint b)
+{
+    return (a < b) ? a : b;
+}
+
+/*
+ * Fill both buffers with the same random pattern and bind the destination to the graphics
+ * context: the first pixel is at the given offset (in pixels) in the buffer.
+ */
+static uint16_t* prepare(uint32_t offset, uint32_t stride, const rect_t* clip)
+{
+    for (uint32_t i = 0; i < (sizeof(buffer) / sizeof(buffer[0])); i++) {
+        buffer[i] = (uint16_t)rand();
+    }
+    memcpy(expected, buffer, sizeof(buffer));
+    UI_DRAWING_STUB_reset();
+    UI_DRAWING_STUB_init_gc(&gc, MICROUI_IMAGE_FORMAT_RGB565, BUFFER_WIDTH, BUFFER_HEIGHT, (uint8_t*)&buffer[offset], stride * sizeof(uint16_t));
+    UI_DRAWING_STUB_set_clip(&gc, clip->x1, clip->y1, clip->x2, clip->y2);
+    gc.foreground_color = COLOR;
+    return &expected[offset];
+}
+
+/*
+ * Reference model of a solid fill: the pixels of the rectangle inside the clip get the
+ * foreground color. Returns false when no pixel is drawn.
+ */
+static bool model_fill(uint16_t* pixels, uint32_t stride, const rect_t* clip, rect_t* area)
+{
+    area->x1 = max_of(area->x1, clip->x1);
+    area->y1 = max_of(area->y1, clip->y1);
+    area->x2 = min_of(area->x2, clip->x2);
+    area->y2 = min_of(area->y2, clip->y2);
+    for (jint y = area->y1; y <= area->y2; y++) {
+        for (jint x = area->x1; x <= area->x2; x++) {
+            pixels[((uint32_t)y * stride) + (uint32_t)x] = COLOR_RGB565;
+        }
+    }
+    return (area->x1 <= area->x2) && (area->y1 <= area->y2);
+}
+
+/*
+ * Check the drawing limits given to the Graphics Engine: the drawn area, or no call.
+ */
+static bool check_limits(bool drawn, const rect_t* area)
+{
+    jint xmin;
+    jint ymin;
+    jint xmax;
+    jint ymax;
+    bool set = UI_DRAWING_STUB_get_drawing_limits(&xmin, &ymin, &xmax, &ymax);
+
+    if (!drawn) {
+        return !set;
+    }
+    return set && (xmin == area->x1) && (ymin == area->y1) && (xmax == area->x2) && (ymax == area->y2);
+}
+
+/*
+ * Returns the random value of a drawing parameter in [min, max].
+ */
+static jint random_in(jint min, jint max)
+{
+    return min + (rand() % (max - min + 1));
+}
+
+static void init_image(MICROUI_Image* image, MICROUI_ImageFormat format, uint8_t* pixels, uint32_t bytes_per_pixel)
+{
+    memset(image, 0, sizeof(MICROUI_Image));
+    image->width = IMAGE_WIDTH;
+    image->height = IMAGE_HEIGHT;
+    image->format = (jbyte)format;
+    LLUI_DISPLAY_STUB_set_buffer(image, pixels, IMAGE_STRIDE * bytes_per_pixel);
+}
+
+/*
+ * Fill the source images with random pixels; a third of the ARGB8888 pixels are opaque, a
+ * third are transparent.
+ */
+static void prepare_images(void)
+{
+    for (uint32_t i = 0; i < (IMAGE_STRIDE * IMAGE_HEIGHT); i++) {
+        uint32_t alpha = (uint32_t)rand() % 3;
+        rgb565_pixels[i] = (uint16_t)rand();
+        argb8888_pixels[i] = ((uint32_t)rand() & 0x00ffffff) | ((0 == alpha) ? 0xff000000 : ((1 == alpha) ? 0 : ((uint32_t)rand() << 24)));
+    }
+    init_image(&rgb565_image, MICROUI_IMAGE_FORMAT_RGB565, (uint8_t*)rgb565_pixels, sizeof(uint16_t));
+    init_image(&argb8888_image, MICROUI_IMAGE_FORMAT_ARGB8888, (uint8_t*)argb8888_pixels, sizeof(uint32_t));
+}
+
+/*
+ * Reference model of the blending of an ARGB8888 color on an RGB565 pixel with a global
+ * alpha: the alphas are multiplied, each channel is (color * alpha + pixel * (255 - alpha))
+ * / 255 rounded, the RGB565 channels being expanded to 8 bits by replicating their high bits.
+ */
+static uint16_t model_blend(uint32_t color, uint16_t pixel, uint32_t global_alpha)
+{
+    uint32_t alpha = (((color >> 24) * global_alpha) + 127) / 255;
+    uint32_t r = (pixel >> 11) & 0x1f;
+    uint32_t g = (pixel >> 5) & 0x3f;
+    uint32_t b = pixel & 0x1f;
+    uint32_t background = (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+    uint32_t result = 0;
+
+    if (0 == alpha) {
+        return pixel;
+    }
+    for (uint32_t shift = 0; shift <= 16; shift += 8) {
+        uint32_t channel = ((((color >> shift) & 0xff) * alpha) + (((background >> shift) & 0xff) * (255 - alpha)) + 127) / 255;
+        result |= channel << shift;
+    }
+    return (uint16_t)(((result >> 8) & 0xf800) | ((result >> 5) & 0x07e0) | ((result >> 3) & 0x001f));
+}
+
+/*
+ * Reference model of an image drawing: each pixel of the region whose destination is inside
+ * the clip is blended. The source pixels are read from the given ARGB8888 snapshot. Returns
+ * false when no pixel is drawn; fills the drawn area otherwise.
+ */
+static bool model_draw_image(uint16_t* pixels, uint32_t stride, const rect_t* clip, const uint32_t* source, uint32_t source_stride,
+        jint regionX, jint regionY, jint width, jint height, jint x, jint y, jint alpha, rect_t* area)
+{
+    area->x1 = max_of(x, clip->x1);
+    area->y1 = max_of(y, clip->y1);
+    area->x2 = min_of(x + width - 1, clip->x2);
+    area->y2 = min_of(y + height - 1, clip->y2);
+    for (jint dy = area->y1; dy <= area->y2; dy++) {
+        for (jint dx = area->x1; dx <= area->x2; dx++) {
+            uint32_t color = source[((uint32_t)(regionY + dy - y) * source_stride) + (uint32_t)(regionX + dx - x)];
+            uint16_t* pixel = &pixels[((uint32_t)dy * stride) + (uint32_t)dx];
+            *pixel = model_blend(color, *pixel, (uint32_t)alpha);
+        }
+    }
+    return (area->x1 <= area->x2) && (area->y1 <= area->y2);
+}
+
+/*
+ * Snapshot of RGB565 pixels as opaque ARGB8888 colors.
+ */
+static void snapshot_rgb565(const uint16_t* pixels, uint32_t length, uint32_t* colors)
+{
+    for (uint32_t i = 0; i < length; i++) {
+        uint32_t r = (pixels[i] >> 11) & 0x1f;
+        uint32_t g = (pixels[i] >> 5) & 0x3f;
+        uint32_t b = pixels[i] & 0x1f;
+        colors[i] = 0xff000000 | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+    }
+}
+
+/*
+ * Random global alpha: opaque, transparent, almost opaque or transparent, or any.
+ */
+static jint random_alpha(void)
+{
+    static const jint alphas[] = { 255, 255, 0, 1, 254, 128 };
+    uint32_t index = (uint32_t)rand() % ((sizeof(alphas) / sizeof(alphas[0])) + 2);
+    return (index < (sizeof(alphas) / sizeof(alphas[0]))) ? alphas[index] : random_in(0, 255);
+}
+
+static void setUp(void)
+{
+    srand(12);
+    LLUI_DISPLAY_STUB_set_row_padding(0);
+}
+
+static void tearDown(void)
+{
+    UI_DRAWING_STUB_reset();
+}
+
+static void ui_drawing_rgb565_fill_rectangle_f(void)
+{
+    for (uint32_t offset = 0; offset < 2; offset++) {
+        for (uint32_t stride = BUFFER_WIDTH; stride <= BUFFER_MAX_STRIDE; stride += BUFFER_MAX_STRIDE - BUFFER_WIDTH) {
+            for (uint32_t c = 0; c < (sizeof(clips) / sizeof(clips[0])); c++) {
+                for (uint32_t r = 0; r < (sizeof(rects) / sizeof(rects[0])); r++) {
+                    const rect_t* rect = &rects[r];
+                    rect_t area = *rect;
+                    uint16_t* pixels = prepare(offset, stride, &clips[c]);
+                    bool drawn = model_fill(pixels, stride, &clips[c], &area);
+
+                    TEST_ASSERT_EQUAL_INT(DRAWING_DONE, UI_DRAWING_fillRectangle(&gc, rect->x1, rect->y1, rect->x2, rect->y2));
+                    TEST_ASSERT(0 == memcmp(buffer, expected, sizeof(buffer)));
+                    TEST_ASSERT(check_limits(drawn, &area));
+                    TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+                }
+            }
+        }
+    }
+}
+
+static void ui_drawing_rgb565_horizontal_line_f(void)
+{
+    for (uint32_t offset = 0; offset < 2; offset++) {
+        for (uint32_t stride = BUFFER_WIDTH; stride <= BUFFER_MAX_STRIDE; stride += BUFFER_MAX_STRIDE - BUFFER_WIDTH) {
+            for (uint32_t c = 0; c < (sizeof(clips) / sizeof(clips[0])); c++) {
+                for (uint32_t r = 0; r < (sizeof(rects) / sizeof(rects[0])); r++) {
+                    /* a line on the top row and on the bottom row of each rectangle */
+                    for (uint32_t bottom = 0; bottom < 2; bottom++) {
+                        const rect_t* rect = &rects[r];
+                        jint y = bottom ? rect->y2 : rect->y1;
+                        rect_t area = { rect->x1, y, rect->x2, y };
+                        uint16_t* pixels = prepare(offset, stride, &clips[c]);
+                        bool drawn = model_fill(pixels, stride, &clips[c], &area);
+
+                        TEST_ASSERT_EQUAL_INT(DRAWING_DONE, UI_DRAWING_drawHorizontalLine(&gc, rect->x1, rect->x2, y));
+                        TEST_ASSERT(0 == memcmp(buffer, expected, sizeof(buffer)));
+                        TEST_ASSERT(check_limits(drawn, &area));
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Clip disabled: the Graphics Engine gives drawings inside the buffer, which are not clipped.
+ */
+static void ui_drawing_rgb565_clip_disabled_f(void)
+{
+    static const rect_t whole = { 0, 0, BUFFER_WIDTH - 1, BUFFER_HEIGHT - 1 };
+    static const rect_t inner = { 5, 3, 30, 19 };
+
+    for (uint32_t offset = 0; offset < 2; offset++) {
+        for (uint32_t r = 0; r < (sizeof(rects) / sizeof(rects[0])); r++) {
+            const rect_t* rect = &rects[r];
+            rect_t area = *rect;
+            uint16_t* pixels;
+            bool drawn;
+
+            if ((rect->x1 < 0) || (rect->y1 < 0) || (rect->x2 >= BUFFER_WIDTH) || (rect->y2 >= BUFFER_HEIGHT)) {
+                continue;
+            }
+            /* the graphics context clip is ignored */
+            pixels = prepare(offset, BUFFER_MAX_STRIDE, &inner);
+            drawn = model_fill(pixels, BUFFER_MAX_STRIDE, &whole, &area);
+            UI_DRAWING_STUB_set_clip_enabled(false);
+
+            TEST_ASSERT_EQUAL_INT(DRAWING_DONE, UI_DRAWING_fillRectangle(&gc, rect->x1, rect->y1, rect->x2, rect->y2));
+            TEST_ASSERT(0 == memcmp(buffer, expected, sizeof(buffer)));
+            TEST_ASSERT(check_limits(drawn, &area));
+        }
+    }
+}
+
+/*
+ * Random drawings of RGB565 and ARGB8888 images: random region of the image, position around
+ * the buffer, clip and global alpha.
+ */
+static void ui_drawing_rgb565_draw_image_f(void)
+{
+    static uint32_t source[IMAGE_STRIDE * IMAGE_HEIGHT];
+
+    prepare_images();
+    for (uint32_t i = 0; i < IMAGE_DRAWINGS; i++) {
+        bool argb8888 = (0 != (i & 1));
+        MICROUI_Image* image = argb8888 ? &argb8888_image : &rgb565_image;
+        jint regionX = random_in(0, IMAGE_WIDTH - 1);
+        jint regionY = random_in(0, IMAGE_HEIGHT - 1);
+        jint width = random_in(1, IMAGE_WIDTH - regionX);
+        jint height = random_in(1, IMAGE_HEIGHT - regionY);
+        jint x = random_in(-width, BUFFER_WIDTH);
+        jint y = random_in(-height, BUFFER_HEIGHT);
+        jint alpha = random_alpha();
+        const rect_t* clip = &clips[(uint32_t)rand() % (sizeof(clips) / sizeof(clips[0]))];
+        uint32_t stride = (0 != (i & 2)) ? BUFFER_MAX_STRIDE : BUFFER_WIDTH;
+        uint16_t* pixels = prepare((i >> 2) & 1, stride, clip);
+        rect_t area;
+        bool drawn;
+
+        if (argb8888) {
+            memcpy(source, argb8888_pixels, sizeof(source));
+        }
+        else {
+            snapshot_rgb565(rgb565_pixels, IMAGE_STRIDE * IMAGE_HEIGHT, source);
+        }
+        drawn = model_draw_image(pixels, stride, clip, source, IMAGE_STRIDE, regionX, regionY, width, height, x, y, alpha, &area);
+
+        TEST_ASSERT_EQUAL_INT(DRAWING_DONE, UI_DRAWING_drawImage(&gc, image, regionX, regionY, width, height, x, y, alpha));
+        TEST_ASSERT(0 == memcmp(buffer, expected, sizeof(buffer)));
+        TEST_ASSERT(check_limits(drawn, &area));
+        TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+    }
+}
+
+/*
+ * Copies and blendings of a region of the destination in itself, shifted in every direction:
+ * the source pixels are read before being overwritten.
+ */
+static void ui_drawing_rgb565_draw_image_overlap_f(void)
+{
+    static uint32_t source[BUFFER_MAX_STRIDE * BUFFER_HEIGHT];
+
+    for (jint dy = -3; dy <= 3; dy++) {
+        for (jint dx = -4; dx <= 4; dx++) {
+            for (uint32_t offset = 0; offset < 2; offset++) {
+                uint16_t* pixels = prepare(offset, BUFFER_MAX_STRIDE, &clips[1]);
+                rect_t area;
+                bool drawn;
+
+                snapshot_rgb565(pixels, BUFFER_MAX_STRIDE * BUFFER_HEIGHT, source);
+                drawn = model_draw_image(pixels, BUFFER_MAX_STRIDE, &clips[1], source, BUFFER_MAX_STRIDE, 8, 6, 20, 10, 8 + dx, 6 + dy, 255, &area);
+
+                TEST_ASSERT_EQUAL_INT(DRAWING_DONE, UI_DRAWING_drawImage(&gc, &gc.image, 8, 6, 20, 10, 8 + dx, 6 + dy, 255));
+                TEST_ASSERT(0 == memcmp(buffer, expected, sizeof(buffer)));
+                TEST_ASSERT(check_limits(drawn, &area));
+                TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+
+                pixels = prepare(offset, BUFFER_MAX_STRIDE, &clips[1]);
+                snapshot_rgb565(pixels, BUFFER_MAX_STRIDE * BUFFER_HEIGHT, source);
+                drawn = model_draw_image(pixels, BUFFER_MAX_STRIDE, &clips[1], source, BUFFER_MAX_STRIDE, 8, 6, 20, 10, 8 + dx, 6 + dy, 128, &area);
+
+                TEST_ASSERT_EQUAL_INT(DRAWING_DONE, UI_DRAWING_drawImage(&gc, &gc.image, 8, 6, 20, 10, 8 + dx, 6 + dy, 128));
+                TEST_ASSERT(0 == memcmp(buffer, expected, sizeof(buffer)));
+                TEST_ASSERT(check_limits(drawn, &area));
+                TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+            }
+        }
+    }
+}
+
+/*
+ * A destination which is not a 16-bit buffer is given to the software algorithms.
+ */
+static void ui_drawing_rgb565_other_destination_f(void)
+{
+    prepare(0, BUFFER_MAX_STRIDE / 2, &clips[0]);
+    gc.image.format = MICROUI_IMAGE_FORMAT_ARGB8888;
+
+    TEST_ASSERT_EQUAL_INT(DRAWING_DONE, UI_DRAWING_fillRectangle(&gc, 1, 1, 5, 5));
+    TEST_ASSERT_EQUAL_INT(DRAWING_DONE, UI_DRAWING_drawHorizontalLine(&gc, 1, 5, 1));
+    TEST_ASSERT_EQUAL_INT(2, UI_DRAWING_STUB_get_soft_calls());
+    TEST_ASSERT(0 == memcmp(buffer, expected, sizeof(buffer)));
+}
+
+/*
+ * The blending of the kernels (two channels per 32-bit word) against the model, for every
+ * global alpha and every RGB565 background pixel, with RGB888 and RGB565 foregrounds.
+ */
+static void ui_drawing_rgb565_blend_f(void)
+{
+    uint32_t errors = 0;
+
+    for (uint32_t alpha = 0; alpha <= 255; alpha++) {
+        for (uint32_t background = 0; background <= 0xffff; background++) {
+            uint32_t foreground = (background * 0x9E3779B1u) ^ (alpha * 0x85EBCA6Bu);
+            uint16_t foreground565 = (uint16_t)(foreground >> 8);
+            uint32_t foreground888;
+
+            snapshot_rgb565(&foreground565, 1, &foreground888);
+            errors += (UI_RGB565_blend(foreground & 0xffffff, background, alpha) != model_blend(0xff000000u | foreground, (uint16_t)background, alpha)) ? 1 : 0;
+            errors += (UI_RGB565_blend_rgb565(foreground565, background, alpha) != model_blend(foreground888, (uint16_t)background, alpha)) ? 1 : 0;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(0, errors);
+}
+
+/*
+ * The images which are neither RGB565 nor ARGB8888 are given to the software algorithms.
+ */
+static void ui_drawing_rgb565_other_image_f(void)
+{
+    static const MICROUI_ImageFormat formats[] = { MICROUI_IMAGE_FORMAT_ARGB4444, MICROUI_IMAGE_FORMAT_ARGB1555, MICROUI_IMAGE_FORMAT_RGB888, MICROUI_IMAGE_FORMAT_A8 };
+
+    prepare_images();
+    for (uint32_t i = 0; i < (sizeof(formats) / sizeof(formats[0])); i++) {
+        prepare(0, BUFFER_MAX_STRIDE, &clips[0]);
+        argb8888_image.format = (jbyte)formats[i];
+        TEST_ASSERT_EQUAL_INT(DRAWING_DONE, UI_DRAWING_drawImage(&gc, &argb8888_image, 0, 0, 10, 10, 0, 0, 255));
+        TEST_ASSERT_EQUAL_INT(1, UI_DRAWING_STUB_get_soft_calls());
+        TEST_ASSERT(0 == memcmp(buffer, expected, sizeof(buffer)));
+    }
+}
+
+/*
+ * Time of a full screen clear and of a 100 pixels wide rectangle on a 240x320 display: kernel
+ * and per-pixel reference loop.
+ */
+static void ui_drawing_rgb565_fill_report_f(void)
+{
+    static uint16_t frame[BENCH_WIDTH * BENCH_HEIGHT];
+    static const rect_t areas[] = {
+        { 0, 0, BENCH_WIDTH - 1, BENCH_HEIGHT - 1 },
+        { 71, 0, 170, BENCH_HEIGHT - 1 },
+    };
+
+    for (uint32_t a = 0; a < (sizeof(areas) / sizeof(areas[0])); a++) {
+        const rect_t* area = &areas[a];
+        uint32_t pixels = (uint32_t)((area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1));
+        double start;
+        double kernel;
+        double loop;
+
+        UI_DRAWING_STUB_reset();
+        UI_DRAWING_STUB_init_gc(&gc, MICROUI_IMAGE_FORMAT_RGB565, BENCH_WIDTH, BENCH_HEIGHT, (uint8_t*)frame, BENCH_WIDTH * sizeof(uint16_t));
+        start = now_ms();
+        for (uint32_t i = 0; i < BENCH_DRAWINGS; i++) {
+            gc.foreground_color = COLOR + i;
+            UI_DRAWING_fillRectangle(&gc, area->x1, area->y1, area->x2, area->y2);
+        }
+        kernel = (now_ms() - start) / BENCH_DRAWINGS;
+
+        start = now_ms();
+        for (uint32_t i = 0; i < BENCH_DRAWINGS; i++) {
+            uint16_t color = (uint16_t)LLUI_DISPLAY_convertARGBColorToDisplayColor(COLOR + i);
+            for (jint y = area->y1; y <= area->y2; y++) {
+                for (jint x = area->x1; x <= area->x2; x++) {
+                    frame[((uint32_t)y * BENCH_WIDTH) + (uint32_t)x] = color;
+                }
+            }
+        }
+        loop = (now_ms() - start) / BENCH_DRAWINGS;
+        TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+
+        printf("UI_DRAWING_RGB565: fill %ux%u kernel %.3f ms (%.0f Mpixels/s), per-pixel loop %.3f ms\n",
+                (unsigned int)(area->x2 - area->x1 + 1), (unsigned int)(area->y2 - area->y1 + 1), kernel, pixels / (kernel * 1000.0), loop);
+    }
+}
+
+/*
+ * Megapixels per second of each image kernel drawing a 240x320 image on a 240x320 display,
+ * and of the per-pixel reference model.
+ */
+static void ui_drawing_rgb565_draw_image_report_f(void)
+{
+    static uint16_t frame[BENCH_WIDTH * BENCH_HEIGHT];
+    static uint16_t image_rgb565[BENCH_WIDTH * BENCH_HEIGHT];
+    static uint32_t image_argb8888[BENCH_WIDTH * BENCH_HEIGHT];
+    static const struct {
+        const char* name;
+        bool argb8888;
+        jint alpha;
+    } kernels[] = {
+        { "RGB565 copy        ", false, 255 },
+        { "RGB565 alpha 128   ", false, 128 },
+        { "ARGB8888           ", true, 255 },
+        { "ARGB8888 alpha 128 ", true, 128 },
+    };
+    MICROUI_Image image;
+    uint32_t pixels = BENCH_WIDTH * BENCH_HEIGHT;
+
+    for (uint32_t i = 0; i < pixels; i++) {
+        image_rgb565[i] = (uint16_t)rand();
+        image_argb8888[i] = (uint32_t)rand() | ((0 == (i & 1)) ? 0xff000000 : 0);
+    }
+
+    for (uint32_t k = 0; k < (sizeof(kernels) / sizeof(kernels[0])); k++) {
+        double start;
+        double kernel;
+        double model;
+
+        memset(&image, 0, sizeof(image));
+        image.width = BENCH_WIDTH;
+        image.height = BENCH_HEIGHT;
+        image.format = (jbyte)(kernels[k].argb8888 ? MICROUI_IMAGE_FORMAT_ARGB8888 : MICROUI_IMAGE_FORMAT_RGB565);
+        LLUI_DISPLAY_STUB_set_buffer(&image, kernels[k].argb8888 ? (uint8_t*)image_argb8888 : (uint8_t*)image_rgb565, BENCH_WIDTH * (kernels[k].argb8888 ? 4 : 2));
+        UI_DRAWING_STUB_reset();
+        UI_DRAWING_STUB_init_gc(&gc, MICROUI_IMAGE_FORMAT_RGB565, BENCH_WIDTH, BENCH_HEIGHT, (uint8_t*)frame, BENCH_WIDTH * sizeof(uint16_t));
+
+        start = now_ms();
+        for (uint32_t i = 0; i < (BENCH_DRAWINGS / 10); i++) {
+            UI_DRAWING_drawImage(&gc, &image, 0, 0, BENCH_WIDTH, BENCH_HEIGHT, 0, 0, kernels[k].alpha);
+        }
+        kernel = (now_ms() - start) / (BENCH_DRAWINGS / 10);
+        TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+
+        start = now_ms();
+        for (uint32_t i = 0; i < (BENCH_DRAWINGS / 10); i++) {
+            for (uint32_t p = 0; p < pixels; p++) {
+                uint32_t color;
+                if (kernels[k].argb8888) {
+                    color = image_argb8888[p];
+                }
+                else {
+                    snapshot_rgb565(&image_rgb565[p], 1, &color);
+                }
+                frame[p] = model_blend(color, frame[p], (uint32_t)kernels[k].alpha);
+            }
+        }
+        model = (now_ms() - start) / (BENCH_DRAWINGS / 10);
+
+        printf("UI_DRAWING_RGB565: image %s kernel %7.1f Mpixels/s, per-pixel model %6.1f Mpixels/s\n",
+                kernels[k].name, pixels / (kernel * 1000.0), pixels / (model * 1000.0));
+    }
+}
+
+TestRef ui_drawing_rgb565_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture("ui_drawing_rgb565_fill_rectangle", ui_drawing_rgb565_fill_rectangle_f),
+        new_TestFixture("ui_drawing_rgb565_horizontal_line", ui_drawing_rgb565_horizontal_line_f),
+        new_TestFixture("ui_drawing_rgb565_clip_disabled", ui_drawing_rgb565_clip_disabled_f),
+        new_TestFixture("ui_drawing_rgb565_draw_image", ui_drawing_rgb565_draw_image_f),
+        new_TestFixture("ui_drawing_rgb565_draw_image_overlap", ui_drawing_rgb565_draw_image_overlap_f),
+        new_TestFixture("ui_drawing_rgb565_blend", ui_drawing_rgb565_blend_f),
+        new_TestFixture("ui_drawing_rgb565_other_destination", ui_drawing_rgb565_other_destination_f),
+        new_TestFixture("ui_drawing_rgb565_other_image", ui_drawing_rgb565_other_image_f),
+        new_TestFixture("ui_drawing_rgb565_fill_report", ui_drawing_rgb565_fill_report_f),
+        new_TestFixture("ui_drawing_rgb565_draw_image_report", ui_drawing_rgb565_draw_image_report_f),
+    };
+    EMB_UNIT_TESTCALLER(ui_drawing_rgb565, "ui_drawing_rgb565", setUp, tearDown, fixtures);
+
+    return (TestRef)&ui_drawing_rgb565;
+}
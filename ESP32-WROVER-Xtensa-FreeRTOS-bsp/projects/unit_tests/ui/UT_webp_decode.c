@@ -0,0 +1,841 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Tests of the WebP decoder entry point (microej_decode.c) on a corpus of lossy, lossless and
+ * alpha images (webp_corpus.h).
+ *
+ * The RGB565 images are compared with the ARGB8888 decoding of the same file: the lossless
+ * images must give the RGB565 truncation of the ARGB8888 pixels, the lossy images are allowed
+ * the rounding difference of the direct YUV to RGB565 conversion. The images downscaled while
+ * decoding are compared with a 2x2 box filter of the full size image. The images decoded by chunks
+ * (streaming decoder) must be the images decoded in one call. The decoder working memory is
+ * allocated in the scratch arena (microej_scratch.c), which is rewound after each decoding.
+ * The bounds set by the application for its next image are checked through the decoding entry
+ * point of the Graphics Engine (LLUI_DISPLAY_IMPL_decodeImage()).
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <embUnit/embUnit.h>
+#include "src/microej/microej_decode.h"
+#include "src/microej/microej_scratch.h"
+#include "microui_heap.h"
+#include "LLUI_DISPLAY_stub.h"
+#include "BESTFIT_ALLOCATOR_stub.h"
+#include "ui_drawing_stub.h"
+#include "ui_drawing.h"
+#include "dw_drawing.h"
+#include "display_webp.h"
+#include "LLUI_DISPLAY_impl.h"
+#include "sni_stub.h"
+#include "webp_corpus.h"
+
+/* Size of the images heap: a lossless 480x640 image needs 4 bytes per pixel of decoder memory */
+#define HEAP_SIZE (4 * 1024 * 1024)
+
+/* Padding at the end of the rows of the images, keeping the pixels aligned: the decoder must honor the stride */
+#define ROW_PADDING 8
+
+/* Maximum channel difference between the RGB565 and ARGB8888 decodings of a lossy image */
+#define LOSSY_TOLERANCE 8
+
+/*
+ * Maximum mean channel difference between a half size image and the 2x2 box filter of the full
+ * size image. The lossy images are rescaled in YUV, before the chroma upsampling.
+ */
+#define SCALED_LOSSLESS_TOLERANCE 1
+#define SCALED_LOSSY_TOLERANCE 6
+
+/* Images heap fragmentation workload: number of decodings and of images kept alive */
+#define WORKLOAD_HEAP_SIZE (3 * 1024 * 1024)
+#define WORKLOAD_DECODINGS 400
+#define WORKLOAD_LIVE_IMAGES 6
+
+/* Size of the chunks of the streaming benchmark, as read from a file */
+#define STREAM_CHUNK_SIZE 256
+
+/* Display size for the downscaling benchmark */
+#define DISPLAY_WIDTH 240
+#define DISPLAY_HEIGHT 320
+
+static double now_ms(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((double)now.tv_sec * 1000.0) + ((double)now.tv_nsec / 1000000.0);
+}
+
+static uint32_t max_of(uint32_t a, uint32_t b)
+{
+    return (a > b) ? a : b;
+}
+
+static uint32_t argb8888_pixel(MICROUI_Image* image, uint32_t x, uint32_t y)
+{
+    return *(uint32_t*)(LLUI_DISPLAY_getBufferAddress(image) + (y * LLUI_DISPLAY_getStrideInBytes(image)) + (x * 4));
+}
+
+static uint16_t rgb565_pixel(MICROUI_Image* image, uint32_t x, uint32_t y)
+{
+    return *(uint16_t*)(LLUI_DISPLAY_getBufferAddress(image) + (y * LLUI_DISPLAY_getStrideInBytes(image)) + (x * 2));
+}
+
+/*
+ * Whether the padding at the end of the rows still holds the stub fill value.
+ */
+static int padding_untouched(MICROUI_Image* image, uint32_t bytes_per_pixel)
+{
+    uint8_t* buffer = LLUI_DISPLAY_getBufferAddress(image);
+    uint32_t stride = LLUI_DISPLAY_getStrideInBytes(image);
+
+    for (uint32_t y = 0; y < image->height; y++) {
+        for (uint32_t i = image->width * bytes_per_pixel; i < stride; i++) {
+            if (buffer[(y * stride) + i] != LLUI_DISPLAY_STUB_FILL) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/*
+ * Whether two images have the same size, format and pixels.
+ */
+static int images_match(MICROUI_Image* a, MICROUI_Image* b)
+{
+    uint32_t row_bytes = a->width * ((MICROUI_IMAGE_FORMAT_RGB565 == a->format) ? 2 : 4);
+
+    if ((a->width != b->width) || (a->height != b->height) || (a->format != b->format)) {
+        return 0;
+    }
+    for (uint32_t y = 0; y < a->height; y++) {
+        if (memcmp(LLUI_DISPLAY_getBufferAddress(a) + (y * LLUI_DISPLAY_getStrideInBytes(a)),
+                LLUI_DISPLAY_getBufferAddress(b) + (y * LLUI_DISPLAY_getStrideInBytes(b)), row_bytes) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Scratch memory of the streams */
+static uint8_t __attribute__((aligned(8))) stream_scratch[2][MICROEJ_SCRATCH_SIZE];
+
+/*
+ * Decode the given bytes of a file by chunks of the given size in a stream, which ends with the
+ * given status.
+ */
+static void decode_stream(const webp_corpus_image_t* file, uint32_t length, uint32_t chunk, MICROUI_ImageFormat format, MICROUI_Image* image, MICROEJ_DECODE_stream_status_t expected)
+{
+    MICROEJ_DECODE_webp_stream_t stream;
+    MICROEJ_DECODE_stream_status_t status = MICROEJ_DECODE_STREAM_SUSPENDED;
+
+    MICROEJ_DECODE_webp_stream_start(&stream, format, 0, 0, image, stream_scratch[0], MICROEJ_SCRATCH_SIZE);
+    for (uint32_t offset = 0; (MICROEJ_DECODE_STREAM_SUSPENDED == status) && (offset < length); offset += chunk) {
+        status = MICROEJ_DECODE_webp_stream_append(&stream, file->data + offset, ((length - offset) < chunk) ? (length - offset) : chunk);
+    }
+    MICROEJ_DECODE_webp_stream_end(&stream, status);
+    TEST_ASSERT_EQUAL_INT(expected, status);
+    if (MICROEJ_DECODE_STREAM_DONE == status) {
+        TEST_ASSERT_EQUAL_INT(image->height, stream.decoded_rows);
+        TEST_ASSERT(stream.is_fully_opaque == !file->alpha);
+    }
+    TEST_ASSERT_EQUAL_INT(0, stream.scratch.stats.used);
+    TEST_ASSERT_EQUAL_INT(0, stream.scratch.stats.leaked_blocks);
+}
+
+static void setUp(void)
+{
+    LLUI_DISPLAY_STUB_initialize_heap(HEAP_SIZE);
+    LLUI_DISPLAY_STUB_set_row_padding(ROW_PADDING);
+}
+
+static void tearDown(void)
+{
+    LLUI_DISPLAY_STUB_set_row_padding(0);
+}
+
+static void webp_decode_formats_f(void)
+{
+    llui_display_stub_stats_t stats;
+
+    for (uint32_t i = 0; i < WEBP_CORPUS_SIZE; i++) {
+        const webp_corpus_image_t* file = &webp_corpus[i];
+        MICROUI_Image argb = { 0 };
+        MICROUI_Image rgb = { 0 };
+        bool argb_opaque;
+        bool rgb_opaque;
+
+        TEST_ASSERT_EQUAL_INT(LLUI_DISPLAY_OK, MICROEJ_DECODE_webp((uint8_t*)file->data, file->length, MICROUI_IMAGE_FORMAT_ARGB8888, 0, 0, &argb, &argb_opaque));
+        TEST_ASSERT_EQUAL_INT(MICROUI_IMAGE_FORMAT_ARGB8888, argb.format);
+        TEST_ASSERT_EQUAL_INT(file->width, argb.width);
+        TEST_ASSERT_EQUAL_INT(file->height, argb.height);
+        TEST_ASSERT(argb_opaque == !file->alpha);
+        TEST_ASSERT(padding_untouched(&argb, 4));
+
+        /* RGB565 is only used for the opaque images */
+        TEST_ASSERT_EQUAL_INT(LLUI_DISPLAY_OK, MICROEJ_DECODE_webp((uint8_t*)file->data, file->length, MICROUI_IMAGE_FORMAT_RGB565, 0, 0, &rgb, &rgb_opaque));
+        TEST_ASSERT_EQUAL_INT((file->alpha ? MICROUI_IMAGE_FORMAT_ARGB8888 : MICROUI_IMAGE_FORMAT_RGB565), rgb.format);
+        TEST_ASSERT_EQUAL_INT(file->width, rgb.width);
+        TEST_ASSERT_EQUAL_INT(file->height, rgb.height);
+        TEST_ASSERT(rgb_opaque == !file->alpha);
+        TEST_ASSERT(padding_untouched(&rgb, file->alpha ? 4 : 2));
+
+        LLUI_DISPLAY_freeImageBuffer(&argb);
+        LLUI_DISPLAY_freeImageBuffer(&rgb);
+    }
+
+    LLUI_DISPLAY_STUB_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.image_buffers);
+    TEST_ASSERT_EQUAL_INT(0, MICROUI_HEAP_number_of_allocated_blocks());
+}
+
+static void webp_decode_rgb565_pixels_f(void)
+{
+    for (uint32_t i = 0; i < WEBP_CORPUS_SIZE; i++) {
+        const webp_corpus_image_t* file = &webp_corpus[i];
+        MICROUI_Image argb = { 0 };
+        MICROUI_Image rgb = { 0 };
+        uint32_t max_difference = 0;
+        bool opaque;
+
+        if (file->alpha) {
+            continue;
+        }
+        MICROEJ_DECODE_webp((uint8_t*)file->data, file->length, MICROUI_IMAGE_FORMAT_ARGB8888, 0, 0, &argb, &opaque);
+        MICROEJ_DECODE_webp((uint8_t*)file->data, file->length, MICROUI_IMAGE_FORMAT_RGB565, 0, 0, &rgb, &opaque);
+
+        for (uint32_t y = 0; y < argb.height; y++) {
+            for (uint32_t x = 0; x < argb.width; x++) {
+                uint32_t expected = argb8888_pixel(&argb, x, y);
+                uint16_t actual = rgb565_pixel(&rgb, x, y);
+                int32_t red = (int32_t)((expected >> 16) & 0xFF) - (int32_t)((actual >> 11) << 3);
+                int32_t green = (int32_t)((expected >> 8) & 0xFF) - (int32_t)(((actual >> 5) & 0x3F) << 2);
+                int32_t blue = (int32_t)(expected & 0xFF) - (int32_t)((actual & 0x1F) << 3);
+
+                if (file->lossless) {
+                    /* Same pixels, truncated to RGB565 */
+                    TEST_ASSERT((red >= 0) && (red < 8) && (green >= 0) && (green < 4) && (blue >= 0) && (blue < 8));
+                }
+                max_difference = max_of(max_difference, (uint32_t)abs(red));
+                max_difference = max_of(max_difference, (uint32_t)abs(green));
+                max_difference = max_of(max_difference, (uint32_t)abs(blue));
+            }
+        }
+        TEST_ASSERT(max_difference <= LOSSY_TOLERANCE);
+
+        LLUI_DISPLAY_freeImageBuffer(&argb);
+        LLUI_DISPLAY_freeImageBuffer(&rgb);
+    }
+}
+
+static void webp_decode_invalid_f(void)
+{
+    const webp_corpus_image_t* file = &webp_corpus[3];
+    llui_display_stub_stats_t stats;
+    MICROUI_Image image = { 0 };
+    uint8_t corrupted[2048];
+    bool opaque;
+
+    /* Truncated file: the image is freed */
+    TEST_ASSERT_EQUAL_INT(LLUI_DISPLAY_NOK, MICROEJ_DECODE_webp((uint8_t*)file->data, file->length / 2, MICROUI_IMAGE_FORMAT_RGB565, 0, 0, &image, &opaque));
+
+    /* Not a WebP file */
+    memset(corrupted, 0x55, sizeof(corrupted));
+    TEST_ASSERT_EQUAL_INT(LLUI_DISPLAY_NOK, MICROEJ_DECODE_webp(corrupted, sizeof(corrupted), MICROUI_IMAGE_FORMAT_RGB565, 0, 0, &image, &opaque));
+
+    LLUI_DISPLAY_STUB_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.image_buffers);
+    TEST_ASSERT_EQUAL_INT(0, MICROUI_HEAP_number_of_allocated_blocks());
+}
+
+/*
+ * Decoding time and image size of the opaque images in ARGB8888 and RGB565.
+ */
+static void webp_decode_rgb565_report_f(void)
+{
+    LLUI_DISPLAY_STUB_set_row_padding(0);
+
+    for (uint32_t i = 0; i < WEBP_CORPUS_SIZE; i++) {
+        const webp_corpus_image_t* file = &webp_corpus[i];
+        MICROUI_ImageFormat formats[] = { MICROUI_IMAGE_FORMAT_ARGB8888, MICROUI_IMAGE_FORMAT_RGB565 };
+
+        if (file->alpha || (file->width < 100)) {
+            continue;
+        }
+        for (uint32_t f = 0; f < 2; f++) {
+            llui_display_stub_stats_t stats;
+            MICROUI_Image image = { 0 };
+            double best = 1e9;
+            bool opaque;
+
+            for (uint32_t run = 0; run < 5; run++) {
+                double start = now_ms();
+                MICROEJ_DECODE_webp((uint8_t*)file->data, file->length, formats[f], 0, 0, &image, &opaque);
+                double duration = now_ms() - start;
+                best = (duration < best) ? duration : best;
+                LLUI_DISPLAY_STUB_get_stats(&stats);
+                LLUI_DISPLAY_freeImageBuffer(&image);
+            }
+            printf("WEBP_DECODE: %-16s %s %.2f ms, image %u bytes\n", file->name, (0 == f) ? "ARGB8888" : "RGB565  ",
+                    best, (unsigned int)stats.image_bytes);
+        }
+    }
+}
+
+/*
+ * Decoding by chunks of 1 byte (small images), of a few bytes and of the benchmark size gives
+ * the image decoded in one call.
+ */
+static void webp_decode_stream_f(void)
+{
+    static const uint32_t chunks[] = { 1, 7, STREAM_CHUNK_SIZE };
+    llui_display_stub_stats_t stats;
+
+    for (uint32_t i = 0; i < WEBP_CORPUS_SIZE; i++) {
+        const webp_corpus_image_t* file = &webp_corpus[i];
+        for (uint32_t format = 0; format < 2; format++) {
+            MICROUI_ImageFormat expected = format ? MICROUI_IMAGE_FORMAT_RGB565 : MICROUI_IMAGE_FORMAT_ARGB8888;
+            MICROUI_Image reference = { 0 };
+            bool opaque;
+
+            TEST_ASSERT_EQUAL_INT(LLUI_DISPLAY_OK, MICROEJ_DECODE_webp((uint8_t*)file->data, file->length, expected, 0, 0, &reference, &opaque));
+            for (uint32_t c = (file->length > 1024) ? 1 : 0; c < (sizeof(chunks) / sizeof(chunks[0])); c++) {
+                MICROUI_Image image = { 0 };
+                decode_stream(file, file->length, chunks[c], expected, &image, MICROEJ_DECODE_STREAM_DONE);
+                TEST_ASSERT(images_match(&reference, &image));
+                LLUI_DISPLAY_freeImageBuffer(&image);
+            }
+            LLUI_DISPLAY_freeImageBuffer(&reference);
+        }
+    }
+
+    LLUI_DISPLAY_STUB_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.image_buffers);
+}
+
+/*
+ * A truncated file leaves the stream suspended: ending it frees the image. Invalid headers are an
+ * error.
+ */
+static void webp_decode_stream_incomplete_f(void)
+{
+    const webp_corpus_image_t* file = &webp_corpus[6];
+    uint8_t garbage[STREAM_CHUNK_SIZE];
+    MICROEJ_DECODE_webp_stream_t stream;
+    llui_display_stub_stats_t stats;
+    MICROUI_Image image = { 0 };
+
+    decode_stream(file, file->length / 2, STREAM_CHUNK_SIZE, MICROUI_IMAGE_FORMAT_RGB565, &image, MICROEJ_DECODE_STREAM_SUSPENDED);
+
+    memset(garbage, 0x5A, sizeof(garbage));
+    MICROEJ_DECODE_webp_stream_start(&stream, MICROUI_IMAGE_FORMAT_RGB565, 0, 0, &image, stream_scratch[0], MICROEJ_SCRATCH_SIZE);
+    TEST_ASSERT_EQUAL_INT(MICROEJ_DECODE_STREAM_ERROR, MICROEJ_DECODE_webp_stream_append(&stream, garbage, sizeof(garbage)));
+    MICROEJ_DECODE_webp_stream_end(&stream, MICROEJ_DECODE_STREAM_ERROR);
+
+    LLUI_DISPLAY_STUB_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.image_buffers);
+}
+
+/*
+ * Two streams decoded at the same time, chunk after chunk, while one-shot decodings rewind the
+ * default arena: each decoder keeps its working memory in its own arena.
+ */
+static void webp_decode_stream_interleaved_f(void)
+{
+    const webp_corpus_image_t* files[2] = { &webp_corpus[6], &webp_corpus[5] };
+    MICROEJ_DECODE_webp_stream_t streams[2];
+    MICROEJ_DECODE_stream_status_t status[2] = { MICROEJ_DECODE_STREAM_SUSPENDED, MICROEJ_DECODE_STREAM_SUSPENDED };
+    MICROUI_Image images[2] = { { 0 }, { 0 } };
+    MICROUI_Image references[2] = { { 0 }, { 0 } };
+    uint32_t offsets[2] = { 0, 0 };
+    bool opaque;
+
+    for (uint32_t s = 0; s < 2; s++) {
+        MICROEJ_DECODE_webp_stream_start(&streams[s], MICROUI_IMAGE_FORMAT_RGB565, 0, 0, &images[s], stream_scratch[s], MICROEJ_SCRATCH_SIZE);
+    }
+    while ((MICROEJ_DECODE_STREAM_SUSPENDED == status[0]) || (MICROEJ_DECODE_STREAM_SUSPENDED == status[1])) {
+        for (uint32_t s = 0; s < 2; s++) {
+            if (MICROEJ_DECODE_STREAM_SUSPENDED == status[s]) {
+                uint32_t length = files[s]->length - offsets[s];
+                length = (length < 64) ? length : 64;
+                status[s] = MICROEJ_DECODE_webp_stream_append(&streams[s], files[s]->data + offsets[s], length);
+                offsets[s] += length;
+            }
+        }
+        TEST_ASSERT_EQUAL_INT(LLUI_DISPLAY_OK, MICROEJ_DECODE_webp((uint8_t*)webp_corpus[0].data, webp_corpus[0].length, MICROUI_IMAGE_FORMAT_RGB565, 0, 0, &references[0], &opaque));
+        LLUI_DISPLAY_freeImageBuffer(&references[0]);
+    }
+
+    for (uint32_t s = 0; s < 2; s++) {
+        TEST_ASSERT_EQUAL_INT(MICROEJ_DECODE_STREAM_DONE, status[s]);
+        MICROEJ_DECODE_webp_stream_end(&streams[s], status[s]);
+        TEST_ASSERT_EQUAL_INT(LLUI_DISPLAY_OK, MICROEJ_DECODE_webp((uint8_t*)files[s]->data, files[s]->length, MICROUI_IMAGE_FORMAT_RGB565, 0, 0, &references[s], &opaque));
+        TEST_ASSERT(images_match(&references[s], &images[s]));
+        TEST_ASSERT(streams[s].scratch.stats.allocations > 0);
+        TEST_ASSERT_EQUAL_INT(0, streams[s].scratch.stats.leaked_blocks);
+        LLUI_DISPLAY_freeImageBuffer(&references[s]);
+        LLUI_DISPLAY_freeImageBuffer(&images[s]);
+    }
+}
+
+/*
+ * Peak memory and time to the first decoded row, decoding in one call the whole file resident in
+ * memory and decoding by chunks of STREAM_CHUNK_SIZE bytes as read from a file. The peak memory
+ * counts the encoded data in memory, the images heap (the image and the decoder allocations
+ * which do not fit in the arena) and the arena.
+ */
+static void webp_decode_stream_report_f(void)
+{
+    MICROEJ_SCRATCH_arena_t arena;
+
+    LLUI_DISPLAY_STUB_set_row_padding(0);
+    for (uint32_t i = 6; i < WEBP_CORPUS_SIZE; i++) {
+        const webp_corpus_image_t* file = &webp_corpus[i];
+        MICROEJ_DECODE_webp_stream_t stream;
+        MICROEJ_DECODE_stream_status_t status = MICROEJ_DECODE_STREAM_SUSPENDED;
+        MICROUI_Image image = { 0 };
+        MICROEJ_SCRATCH_arena_t* previous;
+        uint32_t one_shot_peak;
+        uint32_t stream_peak;
+        double one_shot_ms;
+        double first_row_ms = 0.0;
+        double stream_ms;
+        double start;
+        bool opaque;
+
+        /* one call, on an arena of the default size */
+        LLUI_DISPLAY_STUB_initialize_heap(HEAP_SIZE);
+        MICROEJ_SCRATCH_initialize(&arena, stream_scratch[1], MICROEJ_SCRATCH_SIZE);
+        previous = MICROEJ_SCRATCH_select(&arena);
+        start = now_ms();
+        TEST_ASSERT_EQUAL_INT(LLUI_DISPLAY_OK, MICROEJ_DECODE_webp((uint8_t*)file->data, file->length, MICROUI_IMAGE_FORMAT_RGB565, 0, 0, &image, &opaque));
+        one_shot_ms = now_ms() - start;
+        (void)MICROEJ_SCRATCH_select(previous);
+        one_shot_peak = file->length + MICROUI_HEAP_high_water_mark() + arena.stats.high_water_mark;
+        LLUI_DISPLAY_freeImageBuffer(&image);
+
+        /* by chunks */
+        LLUI_DISPLAY_STUB_initialize_heap(HEAP_SIZE);
+        start = now_ms();
+        MICROEJ_DECODE_webp_stream_start(&stream, MICROUI_IMAGE_FORMAT_RGB565, 0, 0, &image, stream_scratch[0], MICROEJ_SCRATCH_SIZE);
+        for (uint32_t offset = 0; (MICROEJ_DECODE_STREAM_SUSPENDED == status) && (offset < file->length); offset += STREAM_CHUNK_SIZE) {
+            uint32_t length = file->length - offset;
+            status = MICROEJ_DECODE_webp_stream_append(&stream, file->data + offset, (length < STREAM_CHUNK_SIZE) ? length : STREAM_CHUNK_SIZE);
+            if ((0.0 == first_row_ms) && (stream.decoded_rows > 0)) {
+                first_row_ms = now_ms() - start;
+            }
+        }
+        stream_ms = now_ms() - start;
+        TEST_ASSERT_EQUAL_INT(MICROEJ_DECODE_STREAM_DONE, status);
+        stream_peak = STREAM_CHUNK_SIZE + MICROUI_HEAP_high_water_mark() + stream.scratch.stats.high_water_mark;
+        MICROEJ_DECODE_webp_stream_end(&stream, status);
+        LLUI_DISPLAY_freeImageBuffer(&image);
+
+        printf("WEBP_DECODE: %-16s one call: first row %.2f ms, peak %u bytes; by %u bytes chunks: first row %.2f ms, whole image %.2f ms, peak %u bytes\n",
+                file->name, one_shot_ms, (unsigned int)one_shot_peak, STREAM_CHUNK_SIZE, first_row_ms, stream_ms, (unsigned int)stream_peak);
+        /* the rows of a lossy image are available long before its end */
+        if (!file->lossless) {
+            TEST_ASSERT(first_row_ms < one_shot_ms);
+        }
+    }
+}
+
+static void webp_decode_scaled_size_f(void)
+{
+    const webp_corpus_image_t* large = &webp_corpus[6];
+    const webp_corpus_image_t* small = &webp_corpus[0];
+    /* bounds, expected size */
+    const uint32_t cases[][4] = {
+        { 240, 320, 240, 320 },   // same aspect ratio
+        { 240, 240, 180, 240 },   // the height is the most constrained side
+        { 300, 1000, 300, 400 },  // the width is the most constrained side
+        { 0, 320, 240, 320 },     // unconstrained width
+        { 240, 0, 240, 320 },     // unconstrained height
+        { 1000, 1000, 480, 640 }, // the image fits: original size
+    };
+    llui_display_stub_stats_t stats;
+    MICROUI_Image image = { 0 };
+    bool opaque;
+
+    for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        TEST_ASSERT_EQUAL_INT(LLUI_DISPLAY_OK, MICROEJ_DECODE_webp((uint8_t*)large->data, large->length, MICROUI_IMAGE_FORMAT_RGB565, cases[i][0], cases[i][1], &image, &opaque));
+        TEST_ASSERT_EQUAL_INT(cases[i][2], image.width);
+        TEST_ASSERT_EQUAL_INT(cases[i][3], image.height);
+        TEST_ASSERT_EQUAL_INT(MICROUI_IMAGE_FORMAT_RGB565, image.format);
+        TEST_ASSERT(padding_untouched(&image, 2));
+        LLUI_DISPLAY_freeImageBuffer(&image);
+    }
+
+    /* A side is never scaled down to 0 */
+    TEST_ASSERT_EQUAL_INT(LLUI_DISPLAY_OK, MICROEJ_DECODE_webp((uint8_t*)small->data, small->length, MICROUI_IMAGE_FORMAT_ARGB8888, 1, 1, &image, &opaque));
+    TEST_ASSERT_EQUAL_INT(1, image.width);
+    TEST_ASSERT_EQUAL_INT(1, image.height);
+    LLUI_DISPLAY_freeImageBuffer(&image);
+
+    LLUI_DISPLAY_STUB_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.image_buffers);
+    TEST_ASSERT_EQUAL_INT(0, MICROUI_HEAP_number_of_allocated_blocks());
+}
+
+/* Java natives of the bounds of the next image, and their arguments and results */
+jboolean javaDisplayWebpSetNextMaxSize(jint max_width, jint max_height);
+
+static const webp_corpus_image_t* next_file;
+static jint next_max_width;
+static jint next_max_height;
+static jboolean next_set;
+static LLUI_DISPLAY_Status next_status;
+static MICROUI_Image next_image;
+
+static void set_next_max_size_native(void)
+{
+    next_set = javaDisplayWebpSetNextMaxSize(next_max_width, next_max_height);
+}
+
+/* The Graphics Engine decodes the image in the Java thread which loads it */
+static void load_image_native(void)
+{
+    bool opaque;
+    memset(&next_image, 0, sizeof(next_image));
+    next_status = LLUI_DISPLAY_IMPL_decodeImage((uint8_t*)next_file->data, next_file->length, MICROUI_IMAGE_FORMAT_RGB565, &next_image, &opaque);
+}
+
+static void* load_image_thread(void* arg)
+{
+    (void)arg;
+    SNI_STUB_call(load_image_native);
+    return NULL;
+}
+
+/* A thread which does not call a native is not a Java thread */
+static void* set_outside_thread(void* arg)
+{
+    *(bool*)arg = DISPLAY_WEBP_set_next_max_size(32, 32);
+    return NULL;
+}
+
+static void assert_next_set(jint max_width, jint max_height, jboolean expected)
+{
+    next_max_width = max_width;
+    next_max_height = max_height;
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(set_next_max_size_native));
+    TEST_ASSERT_EQUAL_INT(expected, next_set);
+}
+
+static void assert_loaded(uint32_t width, uint32_t height)
+{
+    TEST_ASSERT_EQUAL_INT(LLUI_DISPLAY_OK, next_status);
+    TEST_ASSERT_EQUAL_INT(width, next_image.width);
+    TEST_ASSERT_EQUAL_INT(height, next_image.height);
+    LLUI_DISPLAY_freeImageBuffer(&next_image);
+}
+
+/*
+ * The bounds set by the application apply to the next image decoded by the same Java thread
+ * only (LLUI_DISPLAY_IMPL_decodeImage()), then the default bounds (none) apply again.
+ */
+static void webp_decode_next_max_size_f(void)
+{
+    static const uint8_t not_webp[] = { 0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d };
+    static const webp_corpus_image_t not_webp_file = { "png", not_webp, sizeof(not_webp), 0, 0, false, false };
+    const webp_corpus_image_t* file = &webp_corpus[3];
+    llui_display_stub_stats_t stats;
+    pthread_t other;
+    bool outside_set = true;
+
+    next_file = file;
+
+    /* next image of this thread */
+    assert_next_set(32, 0, JTRUE);
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(load_image_native));
+    assert_loaded(32, 24);
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(load_image_native));
+    assert_loaded(file->width, file->height);
+
+    /* an image loaded by another Java thread is not bounded */
+    assert_next_set(0, 12, JTRUE);
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&other, NULL, load_image_thread, NULL));
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(other, NULL));
+    assert_loaded(file->width, file->height);
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(load_image_native));
+    assert_loaded(16, 12);
+
+    /* the bounds are used by the next decoding, even if it is not a WebP image */
+    assert_next_set(32, 32, JTRUE);
+    next_file = &not_webp_file;
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(load_image_native));
+    TEST_ASSERT_EQUAL_INT(LLUI_DISPLAY_NOK, next_status);
+    next_file = file;
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(load_image_native));
+    assert_loaded(file->width, file->height);
+
+    /* invalid bounds, outside of a Java thread */
+    assert_next_set(-1, 10, JFALSE);
+    assert_next_set(10, -1, JFALSE);
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&other, NULL, set_outside_thread, &outside_set));
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(other, NULL));
+    TEST_ASSERT(!outside_set);
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(load_image_native));
+    assert_loaded(file->width, file->height);
+
+    LLUI_DISPLAY_STUB_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.image_buffers);
+}
+
+static void webp_decode_scaled_pixels_f(void)
+{
+    for (uint32_t i = 0; i < WEBP_CORPUS_SIZE; i++) {
+        const webp_corpus_image_t* file = &webp_corpus[i];
+        MICROUI_Image full = { 0 };
+        MICROUI_Image half = { 0 };
+        uint64_t difference = 0;
+        bool opaque;
+
+        if ((file->width % 2) || (file->height % 2)) {
+            continue;
+        }
+        MICROEJ_DECODE_webp((uint8_t*)file->data, file->length, MICROUI_IMAGE_FORMAT_ARGB8888, 0, 0, &full, &opaque);
+        MICROEJ_DECODE_webp((uint8_t*)file->data, file->length, MICROUI_IMAGE_FORMAT_ARGB8888, file->width / 2, file->height / 2, &half, &opaque);
+        TEST_ASSERT_EQUAL_INT(file->width / 2, half.width);
+        TEST_ASSERT_EQUAL_INT(file->height / 2, half.height);
+
+        for (uint32_t y = 0; y < half.height; y++) {
+            for (uint32_t x = 0; x < half.width; x++) {
+                uint32_t actual = argb8888_pixel(&half, x, y);
+                for (uint32_t shift = 0; shift < 32; shift += 8) {
+                    uint32_t box = ((argb8888_pixel(&full, 2 * x, 2 * y) >> shift) & 0xFF) + ((argb8888_pixel(&full, (2 * x) + 1, 2 * y) >> shift) & 0xFF)
+                            + ((argb8888_pixel(&full, 2 * x, (2 * y) + 1) >> shift) & 0xFF) + ((argb8888_pixel(&full, (2 * x) + 1, (2 * y) + 1) >> shift) & 0xFF);
+                    difference += (uint32_t)abs((int32_t)((box + 2) / 4) - (int32_t)((actual >> shift) & 0xFF));
+                }
+            }
+        }
+        TEST_ASSERT(difference <= (uint64_t)(file->lossless ? SCALED_LOSSLESS_TOLERANCE : SCALED_LOSSY_TOLERANCE) * 4 * half.width * half.height);
+
+        LLUI_DISPLAY_freeImageBuffer(&full);
+        LLUI_DISPLAY_freeImageBuffer(&half);
+    }
+}
+
+/*
+ * Decoding time, memory and drawing time of the large images displayed on a 240x320 RGB565
+ * display: decoded at full size and drawn with a 0.5 scaling, or downscaled while decoding and
+ * drawn without scaling.
+ */
+static void webp_decode_scaled_report_f(void)
+{
+    static uint16_t frame[DISPLAY_WIDTH * DISPLAY_HEIGHT];
+    MICROUI_GraphicsContext gc;
+
+    LLUI_DISPLAY_STUB_set_row_padding(0);
+    UI_DRAWING_STUB_reset();
+    UI_DRAWING_STUB_init_gc(&gc, MICROUI_IMAGE_FORMAT_RGB565, DISPLAY_WIDTH, DISPLAY_HEIGHT, (uint8_t*)frame, DISPLAY_WIDTH * sizeof(uint16_t));
+
+    for (uint32_t i = 0; i < WEBP_CORPUS_SIZE; i++) {
+        const webp_corpus_image_t* file = &webp_corpus[i];
+
+        if (file->alpha || (file->width != (2 * DISPLAY_WIDTH)) || (file->height != (2 * DISPLAY_HEIGHT))) {
+            continue;
+        }
+        for (uint32_t scaled = 0; scaled < 2; scaled++) {
+            uint32_t max_width = scaled ? DISPLAY_WIDTH : 0;
+            uint32_t max_height = scaled ? DISPLAY_HEIGHT : 0;
+            MICROUI_Image image = { 0 };
+            double decode = 1e9;
+            double draw = 1e9;
+            bool opaque;
+
+            for (uint32_t run = 0; run < 5; run++) {
+                /* new heap: its high water mark is the memory needed by the decoding */
+                LLUI_DISPLAY_STUB_initialize_heap(HEAP_SIZE);
+                double start = now_ms();
+                MICROEJ_DECODE_webp((uint8_t*)file->data, file->length, MICROUI_IMAGE_FORMAT_RGB565, max_width, max_height, &image, &opaque);
+                double duration = now_ms() - start;
+                decode = (duration < decode) ? duration : decode;
+                if (run < 4) {
+                    LLUI_DISPLAY_freeImageBuffer(&image);
+                }
+            }
+
+            for (uint32_t run = 0; run < 20; run++) {
+                double start = now_ms();
+                if (scaled) {
+                    UI_DRAWING_drawImage(&gc, &image, 0, 0, image.width, image.height, 0, 0, 255);
+                }
+                else {
+                    DW_DRAWING_drawScaledImageNearestNeighbor(&gc, &image, 0, 0, 0.5f, 0.5f, 255);
+                }
+                double duration = now_ms() - start;
+                draw = (duration < draw) ? duration : draw;
+            }
+            /* Both drawings are done by the RGB565 kernels and cover the display */
+            TEST_ASSERT_EQUAL_INT(0, UI_DRAWING_STUB_get_soft_calls());
+
+            printf("WEBP_DECODE: %-16s %s decode %.2f ms, image %u bytes, heap peak %u bytes, draw %.3f ms\n",
+                    file->name, scaled ? "downscaled" : "full size ", decode,
+                    (unsigned int)(LLUI_DISPLAY_getStrideInBytes(&image) * image.height), (unsigned int)MICROUI_HEAP_high_water_mark(), draw);
+            LLUI_DISPLAY_freeImageBuffer(&image);
+        }
+    }
+}
+
+static void webp_decode_scratch_f(void)
+{
+    const webp_corpus_image_t* file = &webp_corpus[3];
+    MICROEJ_SCRATCH_stats_t before;
+    MICROEJ_SCRATCH_stats_t after;
+    MICROUI_Image image = { 0 };
+    uint8_t* leaked;
+    uint8_t* live;
+    bool opaque;
+
+    /* The arena is empty after each decoding, successful or not, and the decoder does not leak */
+    MICROEJ_SCRATCH_get_stats(&before);
+    for (uint32_t i = 0; i < WEBP_CORPUS_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(LLUI_DISPLAY_OK, MICROEJ_DECODE_webp((uint8_t*)webp_corpus[i].data, webp_corpus[i].length, MICROUI_IMAGE_FORMAT_RGB565, 0, 0, &image, &opaque));
+        MICROEJ_SCRATCH_get_stats(&after);
+        TEST_ASSERT_EQUAL_INT(0, after.used);
+        LLUI_DISPLAY_freeImageBuffer(&image);
+    }
+    TEST_ASSERT_EQUAL_INT(LLUI_DISPLAY_NOK, MICROEJ_DECODE_webp((uint8_t*)file->data, file->length / 2, MICROUI_IMAGE_FORMAT_RGB565, 0, 0, &image, &opaque));
+    MICROEJ_SCRATCH_get_stats(&after);
+    TEST_ASSERT_EQUAL_INT(0, after.used);
+    TEST_ASSERT_EQUAL_INT(before.leaked_blocks, after.leaked_blocks);
+    TEST_ASSERT(after.high_water_mark > 0);
+
+    /* A block still allocated at the end of a decoding does not keep the arena from being rewound */
+    leaked = MICROEJ_SCRATCH_allocate(100);
+    TEST_ASSERT(NULL != MICROEJ_SCRATCH_allocate(100));
+    MICROEJ_SCRATCH_reset();
+    MICROEJ_SCRATCH_get_stats(&after);
+    TEST_ASSERT_EQUAL_INT(0, after.used);
+    TEST_ASSERT_EQUAL_INT(before.leaked_blocks + 2, after.leaked_blocks);
+    TEST_ASSERT(leaked == MICROEJ_SCRATCH_allocate(100));
+    MICROEJ_SCRATCH_reset();
+
+    /* Freeing a block allocated before the last reset has no effect on the blocks allocated since */
+    leaked = MICROEJ_SCRATCH_allocate(100);
+    MICROEJ_SCRATCH_reset();
+    MICROEJ_SCRATCH_free(leaked);
+    MICROEJ_SCRATCH_get_stats(&after);
+    TEST_ASSERT_EQUAL_INT(0, after.used);
+    TEST_ASSERT(NULL != MICROEJ_SCRATCH_allocate(100));
+    leaked = MICROEJ_SCRATCH_allocate(100);
+    MICROEJ_SCRATCH_reset();
+    live = MICROEJ_SCRATCH_allocate(100);
+    MICROEJ_SCRATCH_free(leaked);
+    MICROEJ_SCRATCH_get_stats(&after);
+    TEST_ASSERT_EQUAL_INT(8 + 104, after.used);
+    MICROEJ_SCRATCH_free(live);
+    MICROEJ_SCRATCH_get_stats(&after);
+    TEST_ASSERT_EQUAL_INT(0, after.used);
+}
+
+/*
+ * Decode the corpus images in turn, keeping the last WORKLOAD_LIVE_IMAGES images alive like an
+ * application which loads its images on demand. Without the arena, the arena is filled before
+ * each decoding: all the decoder allocations fall back to the images heap.
+ *
+ * The largest free block of the images heap is sampled after each allocation during the
+ * decodings: its lowest value is the largest image that another task (or the decoding itself)
+ * could have allocated while the decoder working memory was live. The fragmentation and the
+ * free blocks are sampled after each decoding.
+ */
+static void scratch_workload(bool arena, uint32_t* failures, uint32_t* mean_largest_free_block, uint32_t* mean_fragmentation, uint32_t* mean_free_blocks)
+{
+    MICROUI_Image images[WORKLOAD_LIVE_IMAGES];
+    uint32_t histogram[MICROUI_HEAP_HISTOGRAM_SIZE];
+    uint64_t largest_free_block = 0;
+    uint32_t fragmentation = 0;
+    uint32_t free_blocks = 0;
+
+    memset(images, 0, sizeof(images));
+    LLUI_DISPLAY_STUB_initialize_heap(WORKLOAD_HEAP_SIZE);
+    *failures = 0;
+
+    for (uint32_t i = 0; i < WORKLOAD_DECODINGS; i++) {
+        const webp_corpus_image_t* file = &webp_corpus[(i * 5) % WEBP_CORPUS_SIZE];
+        MICROUI_Image* image = &images[i % WORKLOAD_LIVE_IMAGES];
+        bool opaque;
+
+        if (0 != image->width) {
+            LLUI_DISPLAY_freeImageBuffer(image);
+            memset(image, 0, sizeof(MICROUI_Image));
+        }
+        if (!arena) {
+            /* reclaimed by the reset at the end of the decoding */
+            (void)MICROEJ_SCRATCH_allocate(MICROEJ_SCRATCH_SIZE - 8);
+        }
+        (void)BESTFIT_ALLOCATOR_STUB_get_lowest_largest_free_block();
+        if (LLUI_DISPLAY_OK != MICROEJ_DECODE_webp((uint8_t*)file->data, file->length, MICROUI_IMAGE_FORMAT_RGB565, 0, 0, image, &opaque)) {
+            (*failures)++;
+            memset(image, 0, sizeof(MICROUI_Image));
+        }
+        largest_free_block += BESTFIT_ALLOCATOR_STUB_get_lowest_largest_free_block();
+        fragmentation += MICROUI_HEAP_fragmentation();
+        free_blocks += MICROUI_HEAP_free_blocks_histogram(histogram);
+    }
+    *mean_largest_free_block = (uint32_t)(largest_free_block / WORKLOAD_DECODINGS);
+    *mean_fragmentation = fragmentation / WORKLOAD_DECODINGS;
+    *mean_free_blocks = free_blocks / WORKLOAD_DECODINGS;
+
+    for (uint32_t i = 0; i < WORKLOAD_LIVE_IMAGES; i++) {
+        if (0 != images[i].width) {
+            LLUI_DISPLAY_freeImageBuffer(&images[i]);
+        }
+    }
+}
+
+/*
+ * Images heap during and after each decoding of a decode-heavy workload, with and without the
+ * scratch arena.
+ */
+static void webp_decode_scratch_report_f(void)
+{
+    uint32_t failures[2];
+    uint32_t largest_free_block[2];
+    uint32_t fragmentation[2];
+    uint32_t free_blocks[2];
+
+    LLUI_DISPLAY_STUB_set_row_padding(0);
+    for (uint32_t arena = 0; arena < 2; arena++) {
+        scratch_workload(arena, &failures[arena], &largest_free_block[arena], &fragmentation[arena], &free_blocks[arena]);
+        printf("WEBP_DECODE: %s %u decodings, %u failures, during the decodings: mean largest free block %u bytes; after: mean fragmentation %u%%, mean free blocks %u\n",
+                arena ? "scratch arena  " : "images heap only", WORKLOAD_DECODINGS, (unsigned int)failures[arena],
+                (unsigned int)largest_free_block[arena], (unsigned int)fragmentation[arena], (unsigned int)free_blocks[arena]);
+    }
+    /* The decoder working memory no longer takes the space of the images while they are decoded */
+    TEST_ASSERT(largest_free_block[1] > largest_free_block[0]);
+    TEST_ASSERT_EQUAL_INT(0, failures[1]);
+    TEST_ASSERT(failures[1] <= failures[0]);
+}
+
+TestRef webp_decode_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture("webp_decode_formats", webp_decode_formats_f),
+        new_TestFixture("webp_decode_rgb565_pixels", webp_decode_rgb565_pixels_f),
+        new_TestFixture("webp_decode_invalid", webp_decode_invalid_f),
+        new_TestFixture("webp_decode_rgb565_report", webp_decode_rgb565_report_f),
+        new_TestFixture("webp_decode_stream", webp_decode_stream_f),
+        new_TestFixture("webp_decode_stream_incomplete", webp_decode_stream_incomplete_f),
+        new_TestFixture("webp_decode_stream_interleaved", webp_decode_stream_interleaved_f),
+        new_TestFixture("webp_decode_stream_report", webp_decode_stream_report_f),
+        new_TestFixture("webp_decode_scaled_size", webp_decode_scaled_size_f),
+        new_TestFixture("webp_decode_next_max_size", webp_decode_next_max_size_f),
+        new_TestFixture("webp_decode_scaled_pixels", webp_decode_scaled_pixels_f),
+        new_TestFixture("webp_decode_scaled_report", webp_decode_scaled_report_f),
+        new_TestFixture("webp_decode_scratch", webp_decode_scratch_f),
+        new_TestFixture("webp_decode_scratch_report", webp_decode_scratch_report_f),
+    };
+    EMB_UNIT_TESTCALLER(webp_decode, "webp_decode", setUp, tearDown, fixtures);
+
+    return (TestRef)&webp_decode;
+}
@@ -0,0 +1,622 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * WebP corpus of the decoder tests: synthetic images (gradients, a disc and a noise pattern)
+ * encoded with Pillow 12.3 (libwebp). The lossy images are encoded with a quality of 80 (60
+ * for the 480x640 one), the alpha images are lossy with a lossless alpha plane.
+ */
+
+#ifndef WEBP_CORPUS_H
+#define WEBP_CORPUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct {
+    const char* name;
+    const uint8_t* data;
+    uint32_t length;
+    uint32_t width;
+    uint32_t height;
+    bool lossless;
+    bool alpha;
+} webp_corpus_image_t;
+
+static const uint8_t lossy_17x9_webp[] = {
+    0x52, 0x49, 0x46, 0x46, 0x90, 0x00, 0x00, 0x00, 0x57, 0x45, 0x42, 0x50, 0x56, 0x50, 0x38, 0x20,
+    0x84, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x9d, 0x01, 0x2a, 0x11, 0x00, 0x09, 0x00, 0x3e, 0x6d,
+    0x2c, 0x92, 0x45, 0xa4, 0x22, 0xa1, 0x98, 0x04, 0x00, 0x40, 0x06, 0xc4, 0xb6, 0x00, 0x4e, 0x99,
+    0x42, 0x30, 0x00, 0x06, 0x1e, 0xf1, 0x97, 0x72, 0x8c, 0x7e, 0x4b, 0xd9, 0x18, 0x00, 0xfe, 0xfc,
+    0x03, 0xf6, 0xc6, 0x47, 0xc8, 0x71, 0x51, 0xba, 0x83, 0x4b, 0x24, 0x31, 0xc7, 0x66, 0x09, 0x4c,
+    0x04, 0x87, 0x27, 0x69, 0xf2, 0x88, 0xf6, 0x4f, 0x39, 0xd5, 0xff, 0xf6, 0xaf, 0x7d, 0x42, 0xe3,
+    0xa5, 0xf9, 0x7d, 0x8b, 0xf7, 0xf3, 0xff, 0x1f, 0xf1, 0xf7, 0x69, 0xfe, 0xab, 0x88, 0x62, 0xff,
+    0xd1, 0x9b, 0xf8, 0x93, 0xfb, 0xdc, 0x6c, 0x5d, 0x63, 0x33, 0xf5, 0xf7, 0xfa, 0x41, 0x99, 0x5b,
+    0xea, 0x7d, 0xbe, 0x62, 0xa2, 0x7e, 0x75, 0x8a, 0x96, 0x4c, 0x6c, 0x56, 0x40, 0x86, 0x24, 0x11,
+    0x0c, 0x48, 0x3b, 0x51, 0xf0, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t lossless_17x9_webp[] = {
+    0x52, 0x49, 0x46, 0x46, 0x60, 0x00, 0x00, 0x00, 0x57, 0x45, 0x42, 0x50, 0x56, 0x50, 0x38, 0x4c,
+    0x54, 0x00, 0x00, 0x00, 0x2f, 0x10, 0x00, 0x02, 0x00, 0xb9, 0x32, 0x44, 0xf4, 0x3f, 0x76, 0x51,
+    0xff, 0xe8, 0x7f, 0x40, 0x41, 0xdb, 0x36, 0x8c, 0x99, 0x6c, 0xfc, 0x71, 0x7e, 0x06, 0x02, 0x81,
+    0x14, 0x66, 0xf0, 0xac, 0x22, 0xdb, 0x6a, 0x73, 0xe8, 0x4d, 0x00, 0x06, 0x30, 0x00, 0xe9, 0xc5,
+    0xbf, 0x8a, 0xa8, 0xe8, 0xf9, 0x8c, 0x09, 0x00, 0x09, 0x8b, 0x6d, 0x00, 0x51, 0xf3, 0x03, 0x09,
+    0x51, 0x26, 0x2a, 0x4e, 0x00, 0x1e, 0xf2, 0x0c, 0x00, 0x80, 0xf4, 0x44, 0xe1, 0x00, 0x3a, 0xa6,
+    0x19, 0x82, 0x8a, 0x65, 0x47, 0x2c, 0x86, 0x07,
+};
+
+static const uint8_t alpha_17x9_webp[] = {
+    0x52, 0x49, 0x46, 0x46, 0xe6, 0x00, 0x00, 0x00, 0x57, 0x45, 0x42, 0x50, 0x56, 0x50, 0x38, 0x58,
+    0x0a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x41, 0x4c,
+    0x50, 0x48, 0x31, 0x00, 0x00, 0x00, 0x05, 0x2f, 0x40, 0x98, 0x6d, 0xb4, 0xdf, 0x98, 0x07, 0x7a,
+    0x30, 0x67, 0x12, 0x11, 0x81, 0x7b, 0x42, 0x41, 0x24, 0xa9, 0xcd, 0x83, 0x82, 0x2e, 0x04, 0x07,
+    0xf8, 0xd7, 0x55, 0x12, 0x09, 0x11, 0xfd, 0x9f, 0x00, 0xd1, 0x99, 0x44, 0xb5, 0xd0, 0x13, 0x03,
+    0xf9, 0xad, 0xd0, 0x3a, 0x8c, 0x5f, 0x00, 0x00, 0x56, 0x50, 0x38, 0x20, 0x8e, 0x00, 0x00, 0x00,
+    0x70, 0x04, 0x00, 0x9d, 0x01, 0x2a, 0x11, 0x00, 0x09, 0x00, 0x3e, 0x6d, 0x2c, 0x92, 0x45, 0xa4,
+    0x22, 0xa1, 0x98, 0x04, 0x00, 0x40, 0x06, 0xc4, 0xb6, 0x00, 0x4e, 0x99, 0x42, 0x38, 0x1b, 0xc0,
+    0x00, 0x30, 0xf0, 0x5d, 0xbf, 0xd1, 0xfe, 0x5b, 0xed, 0x9b, 0x26, 0x00, 0x00, 0xfe, 0xfa, 0x0a,
+    0x90, 0x6b, 0x4f, 0x1b, 0x94, 0x35, 0xe1, 0xbb, 0x2a, 0x2d, 0x56, 0x76, 0x84, 0x3a, 0xd8, 0x3e,
+    0xad, 0x65, 0xb9, 0x53, 0xf7, 0x48, 0x09, 0x8b, 0xba, 0xb0, 0x39, 0xda, 0xf4, 0x4e, 0xf8, 0xff,
+    0xed, 0x5e, 0xfa, 0x85, 0xc6, 0x2e, 0xdd, 0xbe, 0xcc, 0x4f, 0xfb, 0x8f, 0xfa, 0x7d, 0xda, 0x7f,
+    0xaa, 0xe7, 0xc1, 0x89, 0xf4, 0x66, 0xfe, 0x24, 0xfd, 0xd6, 0x86, 0x8c, 0xc3, 0xd7, 0xdd, 0x7f,
+    0x64, 0x19, 0x94, 0xcd, 0x68, 0xea, 0x4b, 0x9f, 0x19, 0x2a, 0x4f, 0x3f, 0x22, 0x98, 0xf3, 0xf2,
+    0x2b, 0xb2, 0x33, 0xc8, 0xe4, 0x7f, 0x0c, 0x71, 0xb7, 0xc5, 0xf4, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t lossy_64x48_webp[] = {
+    0x52, 0x49, 0x46, 0x46, 0x54, 0x03, 0x00, 0x00, 0x57, 0x45, 0x42, 0x50, 0x56, 0x50, 0x38, 0x20,
+    0x48, 0x03, 0x00, 0x00, 0xd0, 0x12, 0x00, 0x9d, 0x01, 0x2a, 0x40, 0x00, 0x30, 0x00, 0x3e, 0x6d,
+    0x2e, 0x91, 0x46, 0x24, 0x22, 0xa1, 0xa1, 0x2a, 0xac, 0x00, 0x80, 0x0d, 0x89, 0x6c, 0x00, 0x9d,
+    0x32, 0x84, 0x75, 0x3f, 0xaa, 0xfe, 0x2e, 0x7b, 0x16, 0x56, 0x1f, 0xa3, 0x6b, 0xbd, 0x10, 0xec,
+    0xc0, 0x3b, 0x4b, 0xed, 0xe8, 0xe7, 0xc3, 0xe9, 0x00, 0xfd, 0x92, 0xeb, 0x2d, 0xfd, 0x60, 0xf6,
+    0x00, 0xfd, 0x33, 0xf4, 0xa8, 0xfd, 0xa0, 0xf8, 0x26, 0xfd, 0x8a, 0xfd, 0xbd, 0xf6, 0x84, 0xff,
+    0xef, 0x83, 0x8e, 0xd4, 0x9f, 0x7b, 0x73, 0x85, 0x42, 0xae, 0xfb, 0x99, 0x85, 0xcf, 0x3f, 0xdf,
+    0x15, 0xf3, 0xcc, 0x11, 0x32, 0x95, 0xda, 0x72, 0x99, 0xd0, 0xcf, 0xfc, 0x0c, 0x21, 0x58, 0x8b,
+    0x11, 0x0c, 0x1f, 0x0b, 0xc8, 0xd4, 0x99, 0xe2, 0x38, 0xf1, 0x4e, 0xef, 0x6a, 0xea, 0xb8, 0x2f,
+    0x32, 0x7a, 0xed, 0x79, 0xa8, 0x4a, 0x67, 0xd7, 0x9d, 0x5f, 0xf5, 0x9b, 0x79, 0x4a, 0x94, 0xb1,
+    0xd3, 0xee, 0xaa, 0x47, 0x72, 0x98, 0xa0, 0x6f, 0xc0, 0x93, 0x39, 0xe6, 0xa9, 0x0c, 0x4a, 0x80,
+    0x4b, 0x31, 0x00, 0x00, 0xfe, 0xff, 0xc4, 0xf6, 0xa2, 0x57, 0x57, 0x49, 0xd7, 0x96, 0xda, 0x86,
+    0x5b, 0x21, 0xff, 0xdf, 0x5d, 0x89, 0x2b, 0x14, 0xbc, 0xe3, 0x84, 0xfe, 0x5f, 0x76, 0x4c, 0x19,
+    0x79, 0x4d, 0xc0, 0xf6, 0xc5, 0x0a, 0x8f, 0x59, 0xa7, 0x17, 0xe3, 0x23, 0xf0, 0xc1, 0xd4, 0xce,
+    0x86, 0xa2, 0xac, 0x90, 0xc4, 0xb2, 0xd7, 0x91, 0x24, 0xb9, 0x0a, 0x96, 0xbd, 0x66, 0xf5, 0x7c,
+    0xd9, 0x43, 0x27, 0x47, 0xf3, 0x84, 0xfd, 0xe7, 0xf8, 0xb9, 0xce, 0xcf, 0x6a, 0xbf, 0x12, 0xfc,
+    0x76, 0x7b, 0x6f, 0x0c, 0x29, 0xe7, 0x09, 0xf6, 0xf3, 0x11, 0x9b, 0x4f, 0x20, 0x8c, 0x7b, 0x91,
+    0x05, 0xf8, 0xf6, 0x84, 0x8b, 0xbf, 0x0e, 0x88, 0x08, 0x27, 0xa5, 0xf5, 0x2a, 0xa5, 0x62, 0xeb,
+    0xfa, 0x9e, 0xdf, 0x06, 0xbf, 0xf7, 0x4e, 0x05, 0xa1, 0x70, 0xb1, 0xfe, 0xc7, 0xeb, 0x50, 0x3a,
+    0x69, 0xd6, 0x02, 0x78, 0x35, 0x8b, 0x5e, 0x90, 0x81, 0x6d, 0xc8, 0xe3, 0x83, 0x8b, 0x3b, 0xf1,
+    0xae, 0x8e, 0xdc, 0x58, 0x0f, 0xbd, 0x78, 0xe6, 0xeb, 0x69, 0xff, 0x64, 0xe0, 0xfa, 0x28, 0x5e,
+    0x0a, 0x89, 0x69, 0xb3, 0x8f, 0x76, 0x06, 0x42, 0x03, 0xe3, 0x47, 0x58, 0x26, 0x4b, 0xa5, 0x83,
+    0x1f, 0xea, 0x67, 0x23, 0xd2, 0xf7, 0xd5, 0xf9, 0x82, 0x37, 0x93, 0x99, 0xc2, 0x31, 0x68, 0xfd,
+    0x02, 0x1d, 0xcc, 0x96, 0xb3, 0x03, 0xdb, 0xe6, 0x41, 0xea, 0xb7, 0x15, 0xf7, 0x69, 0xee, 0x1b,
+    0x8c, 0x62, 0xc3, 0xd9, 0xdf, 0x0a, 0x1d, 0x8b, 0x4b, 0xe9, 0x9b, 0xb4, 0x73, 0xe8, 0x8d, 0x07,
+    0x78, 0x1e, 0x25, 0xb8, 0x80, 0x21, 0x45, 0x1f, 0xe0, 0x43, 0x2f, 0x3c, 0xa7, 0x57, 0x13, 0x3d,
+    0xb3, 0x0f, 0xf6, 0xd6, 0xb1, 0x7f, 0x17, 0xe7, 0x0c, 0xed, 0xa7, 0x9a, 0xaa, 0xa9, 0xca, 0xb2,
+    0x59, 0xff, 0xd3, 0x91, 0xf3, 0xdf, 0xa7, 0x9b, 0xfa, 0x0b, 0x47, 0xa8, 0x48, 0x41, 0x6a, 0xac,
+    0x2c, 0xa0, 0x71, 0xbf, 0xe3, 0xe7, 0xa7, 0xec, 0x20, 0x3d, 0x96, 0x99, 0x99, 0xad, 0xc9, 0x0d,
+    0xf5, 0x64, 0x6c, 0x42, 0x84, 0x2a, 0xf4, 0x27, 0x1d, 0x22, 0x5e, 0x85, 0x9a, 0x3b, 0xfd, 0xbd,
+    0xeb, 0x2c, 0x71, 0xfa, 0xbc, 0x94, 0xa1, 0x6c, 0x1f, 0xd8, 0xc5, 0x28, 0x0d, 0x33, 0x07, 0xc2,
+    0x70, 0x97, 0x86, 0x57, 0xa5, 0xd4, 0x83, 0x69, 0x76, 0x09, 0xfc, 0x90, 0xaf, 0xf9, 0x03, 0x7a,
+    0xef, 0xee, 0x2d, 0x11, 0x81, 0xf7, 0x80, 0x6d, 0x9b, 0x79, 0x1c, 0x06, 0xf0, 0x79, 0x6f, 0xcc,
+    0x6c, 0xba, 0x17, 0xe7, 0xdb, 0x47, 0xb1, 0xa7, 0xcf, 0x14, 0xff, 0xfc, 0xf9, 0xff, 0x9f, 0x7d,
+    0xa0, 0x8c, 0xda, 0x1c, 0x20, 0xb0, 0x75, 0xe0, 0x77, 0xb6, 0x7e, 0x08, 0x84, 0x26, 0x1c, 0x1b,
+    0xe4, 0x48, 0x1b, 0xab, 0x11, 0xe6, 0x90, 0xfc, 0x61, 0x0b, 0x2b, 0x9f, 0x02, 0x2b, 0xea, 0xf6,
+    0x7b, 0xe7, 0x9c, 0x93, 0xe6, 0x90, 0x6e, 0x5f, 0xa1, 0xe6, 0xaf, 0x4a, 0xcd, 0x3b, 0xdf, 0x18,
+    0xd0, 0xf6, 0x75, 0x32, 0xae, 0xe7, 0xfe, 0xbb, 0x33, 0xb0, 0xae, 0xf6, 0xda, 0xd7, 0xc2, 0xeb,
+    0xe5, 0x7d, 0x87, 0x8d, 0xc8, 0xbe, 0x69, 0xd9, 0x7f, 0x32, 0xf7, 0xe1, 0xc1, 0x01, 0xf9, 0xd9,
+    0x42, 0x87, 0x84, 0x94, 0xf6, 0x68, 0xf5, 0x07, 0x8d, 0x70, 0x16, 0xd5, 0x55, 0xd6, 0xb3, 0x7c,
+    0xbb, 0x03, 0xc2, 0x99, 0xdf, 0x78, 0x2d, 0xa7, 0x5f, 0xdc, 0x2d, 0xf5, 0xf6, 0x26, 0x6b, 0xef,
+    0x24, 0xe6, 0xd4, 0xe9, 0xa9, 0x4c, 0x5d, 0xfd, 0x4f, 0xe9, 0x91, 0xc8, 0x1e, 0x16, 0x3c, 0xd4,
+    0xd2, 0x50, 0x77, 0x05, 0xba, 0xe7, 0x2f, 0xcb, 0x28, 0x16, 0x05, 0x8f, 0x1a, 0x67, 0x7d, 0x93,
+    0xcb, 0xcb, 0x5a, 0x45, 0x8f, 0x2f, 0x8f, 0xcb, 0x9b, 0x11, 0xfe, 0x32, 0x93, 0x39, 0xfd, 0x67,
+    0x15, 0x15, 0x7f, 0x40, 0xce, 0xc0, 0x06, 0x1c, 0x91, 0xa7, 0x47, 0x17, 0x3e, 0x6f, 0x86, 0xe7,
+    0x7c, 0x4c, 0x33, 0x41, 0xc7, 0x22, 0x44, 0x60, 0xf7, 0x5a, 0x9a, 0x14, 0xb3, 0x47, 0xe6, 0xf2,
+    0x2d, 0xe6, 0x72, 0x97, 0x0c, 0xf1, 0x9f, 0xa7, 0x46, 0x50, 0xfb, 0x3c, 0x58, 0xad, 0x9e, 0xf2,
+    0xe5, 0x02, 0x27, 0xa6, 0x3f, 0x92, 0xd3, 0x6f, 0x3c, 0xb5, 0x6a, 0xd1, 0x17, 0x53, 0x62, 0x2c,
+    0x3c, 0x64, 0xa9, 0x25, 0xd9, 0x0d, 0xae, 0x4c, 0x92, 0x78, 0x66, 0x79, 0x81, 0x97, 0x94, 0xf3,
+    0x60, 0xdd, 0x91, 0xa0, 0xef, 0x2b, 0x7f, 0x7e, 0xee, 0xa1, 0x14, 0x87, 0xcc, 0x96, 0x1c, 0xda,
+    0x28, 0xd6, 0x9e, 0x80, 0x11, 0x06, 0x97, 0x73, 0x7e, 0xac, 0xc3, 0x70, 0xe0, 0x19, 0x18, 0x16,
+    0x64, 0xcf, 0xbf, 0xa1, 0xa7, 0xa4, 0x78, 0x58, 0x97, 0x83, 0x58, 0xc4, 0x9b, 0xf6, 0x9c, 0xef,
+    0x46, 0x56, 0x65, 0x73, 0x26, 0x31, 0x61, 0x9c, 0x3e, 0xcb, 0x36, 0x3c, 0xa6, 0xd9, 0xd6, 0xdb,
+    0x1f, 0xa0, 0x08, 0x3a, 0xf4, 0x27, 0x12, 0x5a, 0x6b, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t lossless_64x48_webp[] = {
+    0x52, 0x49, 0x46, 0x46, 0x98, 0x03, 0x00, 0x00, 0x57, 0x45, 0x42, 0x50, 0x56, 0x50, 0x38, 0x4c,
+    0x8b, 0x03, 0x00, 0x00, 0x2f, 0x3f, 0xc0, 0x0b, 0x00, 0xcd, 0x95, 0x21, 0xa2, 0xff, 0xb1, 0x50,
+    0xd0, 0xb6, 0x0d, 0x13, 0xfe, 0x48, 0x0b, 0xe4, 0x6d, 0x0c, 0x84, 0x04, 0x09, 0xd1, 0xff, 0x7b,
+    0x0d, 0x03, 0xde, 0xff, 0x09, 0x40, 0xe6, 0x55, 0xf0, 0x7f, 0x70, 0x14, 0x49, 0x92, 0xa0, 0xe4,
+    0x07, 0xfc, 0x5b, 0x86, 0xed, 0x99, 0xed, 0x03, 0x03, 0x0c, 0xdb, 0xb6, 0x8d, 0xc4, 0x34, 0xbe,
+    0xfd, 0xf7, 0x4d, 0x9f, 0x93, 0xa4, 0x6d, 0xdb, 0xb1, 0x37, 0xcf, 0xf5, 0xdb, 0xb6, 0x6d, 0x3b,
+    0xb6, 0x6d, 0xcc, 0xd2, 0x76, 0x07, 0x69, 0x97, 0xa0, 0x55, 0x74, 0x98, 0xee, 0xa0, 0x5d, 0x82,
+    0x46, 0x36, 0x47, 0xf1, 0xb8, 0x46, 0x40, 0x70, 0xdb, 0x46, 0x92, 0x64, 0xa1, 0x03, 0x54, 0xc6,
+    0xd5, 0x47, 0x2a, 0x55, 0xbb, 0x6f, 0x40, 0x44, 0x12, 0x61, 0xc7, 0x87, 0x90, 0xfc, 0xe4, 0x65,
+    0x5e, 0x7e, 0x83, 0x00, 0xff, 0xe5, 0x23, 0x0f, 0x0d, 0x20, 0xff, 0xd4, 0xdb, 0x2f, 0x00, 0x07,
+    0x05, 0xff, 0x51, 0xfe, 0x35, 0x00, 0xd8, 0x80, 0xf0, 0xdf, 0x00, 0x00, 0x2e, 0x16, 0x9d, 0xb8,
+    0xce, 0x9f, 0x01, 0xf7, 0x2b, 0xa1, 0x9c, 0x21, 0x70, 0x50, 0x8a, 0x42, 0x5c, 0xe3, 0x37, 0x5f,
+    0x91, 0x01, 0xd3, 0xfc, 0xe6, 0xb8, 0x10, 0x9d, 0x55, 0xe1, 0x12, 0xc5, 0x4d, 0xac, 0xf1, 0x01,
+    0x59, 0xc1, 0x8d, 0x13, 0x50, 0x84, 0x28, 0xc2, 0x8d, 0x37, 0x00, 0x00, 0x2a, 0x17, 0xa3, 0xbc,
+    0x42, 0x2e, 0x70, 0xc2, 0x38, 0x69, 0xe8, 0x78, 0x01, 0x06, 0xe7, 0xb1, 0x9b, 0xa8, 0xf3, 0x14,
+    0xb9, 0xc2, 0x03, 0x0e, 0x3b, 0xa1, 0xdb, 0x02, 0x80, 0x01, 0x34, 0x43, 0xa4, 0x78, 0x82, 0x14,
+    0x70, 0x93, 0xa3, 0x8b, 0x50, 0x67, 0x79, 0x22, 0x14, 0x2e, 0x2e, 0x90, 0x8a, 0x79, 0x8f, 0x5c,
+    0x01, 0x7a, 0xf7, 0x34, 0xc0, 0xd2, 0x82, 0xa8, 0x38, 0xed, 0x44, 0x06, 0xcd, 0x11, 0x26, 0x00,
+    0xaa, 0x97, 0xf4, 0x15, 0x8f, 0xaf, 0x8b, 0x4b, 0xa4, 0x84, 0x12, 0x2a, 0x00, 0xa0, 0x5b, 0x59,
+    0xae, 0xae, 0x07, 0xba, 0xdf, 0x19, 0xd3, 0x18, 0xdc, 0x5d, 0xbe, 0xcb, 0x5a, 0xb0, 0x0a, 0x2d,
+    0x00, 0x30, 0xde, 0x05, 0x00, 0xf0, 0x5f, 0x8a, 0x3c, 0x16, 0x46, 0x00, 0xfa, 0x87, 0xa5, 0x13,
+    0x97, 0xae, 0x58, 0xf2, 0x48, 0xe8, 0x96, 0x0c, 0xb4, 0x01, 0x1d, 0x77, 0x11, 0x47, 0x94, 0xf4,
+    0xc2, 0x01, 0xb4, 0x61, 0x03, 0x4b, 0x15, 0x50, 0xe2, 0xfe, 0x5a, 0x8c, 0x20, 0x5a, 0x2a, 0xa1,
+    0x02, 0x60, 0x70, 0xcd, 0x00, 0x30, 0x5d, 0xa5, 0xc7, 0x8d, 0x1a, 0x17, 0x25, 0x58, 0xcd, 0xe8,
+    0x01, 0x98, 0x2c, 0x07, 0x18, 0x88, 0x00, 0x47, 0x4c, 0x23, 0x08, 0x52, 0xb8, 0xb8, 0xb3, 0xde,
+    0x0b, 0x27, 0x30, 0xd8, 0x5a, 0xb6, 0x7d, 0x13, 0xae, 0x7e, 0xdf, 0x30, 0xf1, 0xc0, 0x82, 0x89,
+    0x04, 0x00, 0x70, 0x8c, 0x1a, 0x41, 0xee, 0x2e, 0x1e, 0x72, 0x30, 0x0f, 0x3c, 0x6a, 0x30, 0xc1,
+    0x5b, 0x07, 0xc0, 0xc9, 0x1b, 0x24, 0xb0, 0x05, 0x11, 0x19, 0xe2, 0x1d, 0x6b, 0xe3, 0x55, 0xa9,
+    0xac, 0x9d, 0xcb, 0x72, 0x11, 0x30, 0x90, 0x80, 0x80, 0x71, 0xee, 0x21, 0x89, 0x27, 0xe9, 0xe2,
+    0x8c, 0x51, 0x38, 0xc2, 0x0e, 0x8c, 0x2f, 0xad, 0xcb, 0x60, 0xa6, 0x6b, 0x38, 0xe4, 0x06, 0x82,
+    0x20, 0xcb, 0xc3, 0xf8, 0x4e, 0x1d, 0x00, 0x00, 0x0d, 0xd0, 0x37, 0x3f, 0x0f, 0x18, 0x2a, 0xd3,
+    0xa8, 0x88, 0x4c, 0xe1, 0xa0, 0x44, 0x90, 0xcc, 0x74, 0xc9, 0x29, 0x41, 0x52, 0x51, 0x4c, 0xca,
+    0x90, 0xa0, 0x01, 0x06, 0x20, 0xc1, 0xf5, 0x02, 0xb4, 0x60, 0x20, 0x0d, 0xc0, 0x37, 0x42, 0x03,
+    0xaf, 0xa5, 0x01, 0x00, 0x14, 0x4b, 0x96, 0xc0, 0xec, 0x7c, 0x3c, 0xc0, 0xd2, 0x1b, 0xf0, 0x14,
+    0x54, 0xc4, 0xc6, 0x91, 0x8c, 0x9e, 0xf4, 0xd2, 0xed, 0xcc, 0xcc, 0xde, 0x63, 0xf1, 0x3e, 0x40,
+    0x49, 0x6c, 0x08, 0x3b, 0x95, 0xa1, 0x51, 0x47, 0x1b, 0xac, 0x52, 0x82, 0x14, 0xe1, 0xb1, 0x67,
+    0x31, 0x03, 0xb3, 0x0f, 0x2c, 0x80, 0x92, 0x38, 0xdc, 0xc0, 0x41, 0xcd, 0x45, 0x13, 0xeb, 0x35,
+    0xb2, 0x28, 0x80, 0x91, 0x69, 0x79, 0x06, 0x2e, 0x9a, 0xf3, 0x01, 0x79, 0xa6, 0xe3, 0xa2, 0x79,
+    0x7d, 0x9f, 0x36, 0xa0, 0x24, 0x39, 0x7a, 0x8b, 0xe2, 0xa8, 0x30, 0xcd, 0x3c, 0x0f, 0x25, 0xc8,
+    0xc0, 0xc8, 0x32, 0x31, 0x1e, 0xc5, 0xc2, 0x2d, 0xa0, 0x24, 0x05, 0x17, 0x48, 0x8c, 0x45, 0xa0,
+    0x01, 0x01, 0x71, 0x6f, 0x3c, 0x5c, 0x58, 0xc7, 0xbe, 0x21, 0xca, 0xe8, 0xf3, 0xc1, 0x58, 0x21,
+    0xaa, 0xe3, 0x6b, 0x99, 0x09, 0x17, 0x81, 0xdc, 0xf1, 0x58, 0x81, 0xcd, 0xde, 0x82, 0x85, 0x7a,
+    0x96, 0x85, 0x72, 0x36, 0x29, 0xf9, 0xbc, 0x48, 0xa7, 0x4b, 0x12, 0x4c, 0x65, 0x3f, 0x30, 0x96,
+    0x2d, 0xf8, 0x02, 0xfc, 0x0c, 0xd2, 0xd9, 0x86, 0xe0, 0x2d, 0x1d, 0x17, 0x5a, 0x60, 0x35, 0x7f,
+    0x60, 0xa3, 0x0a, 0xa8, 0x29, 0x64, 0x61, 0x68, 0x85, 0xf0, 0x33, 0xbc, 0xff, 0xb1, 0xa0, 0x14,
+    0x3d, 0x8c, 0x9d, 0x0e, 0x1c, 0x08, 0x32, 0x7a, 0x4b, 0xa3, 0x20, 0x57, 0xd5, 0x90, 0x56, 0xae,
+    0x51, 0x54, 0x0b, 0x3d, 0xd5, 0x70, 0x11, 0x90, 0xd1, 0x2c, 0x01, 0x6b, 0xcf, 0xf6, 0x3d, 0x36,
+    0xba, 0xb0, 0x81, 0x2f, 0xba, 0x14, 0x5d, 0x2e, 0x20, 0x31, 0x66, 0x5c, 0x2c, 0x96, 0xf7, 0x6a,
+    0xd2, 0xa8, 0x29, 0xc3, 0x06, 0x01, 0xc6, 0xe3, 0x1b, 0xe8, 0xc5, 0x02, 0x52, 0xc9, 0x05, 0x60,
+    0xe9, 0xb8, 0x08, 0x32, 0x91, 0xc7, 0x50, 0x6f, 0xc1, 0x42, 0x37, 0x16, 0x86, 0x66, 0xdc, 0x8f,
+    0x6a, 0x54, 0x35, 0x9b, 0x98, 0x1c, 0x6b, 0x00, 0x00, 0x76, 0x8a, 0x25, 0x01, 0x00, 0x88, 0x31,
+    0xf7, 0x1d, 0xfc, 0x1a, 0x72, 0xac, 0x03, 0x00, 0x50, 0x60, 0x13, 0x8e, 0x8b, 0x6d, 0xe8, 0x03,
+    0x5a, 0x1a, 0x71, 0x13, 0xfa, 0xe3, 0xa4, 0x65, 0x3c, 0xcc, 0xcc, 0x1f, 0x91, 0x3d, 0x17, 0x4a,
+    0x60, 0x1f, 0x00, 0x1c, 0xa3, 0xea, 0x94, 0x7d, 0x8b, 0x81, 0xce, 0xfd, 0x13, 0xc2, 0x85, 0x3b,
+    0xfa, 0x94, 0x24, 0x2b, 0x00, 0x80, 0x8a, 0x5a, 0x9c, 0x04, 0x0c, 0x1b, 0x40, 0x03, 0xc4, 0xd6,
+    0x80, 0x82, 0xea, 0xfd, 0x26, 0x0c, 0x6d, 0x5f, 0x43, 0x37, 0x9a, 0x9d, 0x85, 0x73, 0x51, 0x8f,
+    0x4e, 0x60, 0x0a, 0x00, 0x5c, 0xac, 0x12, 0x7b, 0x6d, 0x1a, 0x13, 0xfd, 0x30, 0xc1, 0xce, 0x08,
+    0x4c, 0xf0, 0x30, 0x09, 0x30, 0xfe, 0x6b, 0x22, 0xc8, 0x5c, 0x1c, 0xbf, 0xf6, 0x55, 0x05, 0x00,
+};
+
+static const uint8_t alpha_64x48_webp[] = {
+    0x52, 0x49, 0x46, 0x46, 0xf2, 0x03, 0x00, 0x00, 0x57, 0x45, 0x42, 0x50, 0x56, 0x50, 0x38, 0x58,
+    0x0a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x41, 0x4c,
+    0x50, 0x48, 0x6f, 0x00, 0x00, 0x00, 0x05, 0x60, 0x62, 0x6b, 0xdb, 0x8c, 0xb7, 0x99, 0x56, 0x60,
+    0x05, 0x9a, 0xa6, 0x69, 0x12, 0x4d, 0xb2, 0x02, 0x4d, 0xd3, 0x34, 0x4d, 0xb3, 0xeb, 0xef, 0xfb,
+    0xfe, 0x79, 0x2a, 0x11, 0xa1, 0xa0, 0x6d, 0x1b, 0xc6, 0xc1, 0xb0, 0x83, 0x01, 0x95, 0xe9, 0x94,
+    0xac, 0x20, 0xea, 0x4c, 0x38, 0xc0, 0xd4, 0xeb, 0x76, 0x42, 0xd0, 0xa0, 0xd5, 0x05, 0x51, 0xa3,
+    0x46, 0x37, 0x84, 0x4d, 0xda, 0x3c, 0x10, 0x37, 0x6b, 0xf2, 0x42, 0xa1, 0xc5, 0x09, 0x1f, 0x94,
+    0xda, 0x1c, 0xf0, 0x43, 0xb1, 0x3d, 0xff, 0x31, 0x3f, 0x77, 0xc6, 0x39, 0xbf, 0xb7, 0x8c, 0xef,
+    0x5d, 0xe3, 0x7b, 0xdf, 0xf8, 0xdd, 0x31, 0x7e, 0xf7, 0x4c, 0xdf, 0x5d, 0x6b, 0xef, 0xbe, 0xb6,
+    0xbf, 0xa3, 0x5c, 0xab, 0x00, 0x00, 0x56, 0x50, 0x38, 0x20, 0x5c, 0x03, 0x00, 0x00, 0x70, 0x13,
+    0x00, 0x9d, 0x01, 0x2a, 0x40, 0x00, 0x30, 0x00, 0x3e, 0x6d, 0x32, 0x91, 0x46, 0xa4, 0x23, 0x21,
+    0xa1, 0x2a, 0xbb, 0xfc, 0x00, 0x80, 0x0d, 0x89, 0x6c, 0x00, 0x9d, 0x32, 0x84, 0x75, 0x77, 0xa0,
+    0x7e, 0x33, 0x7b, 0x0c, 0x57, 0x1f, 0xa3, 0xeb, 0x97, 0x10, 0xee, 0x50, 0x7d, 0xaa, 0xf6, 0x92,
+    0xdb, 0xd9, 0xe3, 0x21, 0xfa, 0x67, 0xef, 0x99, 0xd2, 0x01, 0xfb, 0x3b, 0xd6, 0x57, 0xfb, 0x01,
+    0xec, 0x01, 0xfa, 0x67, 0xe9, 0x33, 0xfb, 0x31, 0xf0, 0x55, 0xfb, 0x1f, 0xfb, 0xa9, 0xf0, 0x19,
+    0xfb, 0x0d, 0xff, 0xdf, 0x07, 0x09, 0xa7, 0x5e, 0x96, 0x68, 0xdb, 0x75, 0x98, 0x5d, 0x88, 0xaa,
+    0x79, 0xee, 0xf9, 0xcf, 0x95, 0x60, 0xaf, 0xfa, 0x79, 0x7a, 0xf4, 0xdc, 0x60, 0xec, 0x41, 0xdc,
+    0xef, 0xec, 0xb7, 0x36, 0xbc, 0x57, 0x86, 0xd4, 0xf2, 0xf1, 0x1d, 0xca, 0x5a, 0x7d, 0xed, 0xa9,
+    0x5d, 0x3d, 0xbc, 0x7c, 0x3b, 0x09, 0x4f, 0x25, 0xde, 0x7f, 0xe0, 0x2e, 0x56, 0x3d, 0x3f, 0xbc,
+    0xcf, 0xa2, 0xa1, 0xd6, 0x5d, 0x66, 0x96, 0xb5, 0x11, 0xbd, 0xe2, 0x7b, 0x12, 0x97, 0xf9, 0xf8,
+    0x5e, 0x00, 0x00, 0xfe, 0xff, 0x95, 0x9a, 0x91, 0x3b, 0xa7, 0x28, 0xa3, 0x55, 0xbe, 0x64, 0x7c,
+    0x25, 0x91, 0x81, 0x87, 0x62, 0x43, 0x55, 0xaf, 0xe9, 0x01, 0xfb, 0xd0, 0xf8, 0xe4, 0x82, 0x6d,
+    0x45, 0x1a, 0x8a, 0x1c, 0xb8, 0x51, 0x69, 0x41, 0x72, 0x90, 0x96, 0x89, 0xc6, 0x0e, 0xe7, 0x8d,
+    0xcd, 0x50, 0x21, 0x13, 0xb9, 0xbe, 0x45, 0xbc, 0xe6, 0x59, 0xa7, 0x98, 0x13, 0xf6, 0x64, 0x9f,
+    0x8d, 0x36, 0x47, 0xc5, 0x57, 0xaa, 0x4e, 0x42, 0x3f, 0xbc, 0xfd, 0xb0, 0x02, 0xc9, 0xd6, 0xc3,
+    0xe1, 0xa6, 0x99, 0x82, 0xa4, 0x90, 0xe6, 0xf4, 0x38, 0x1d, 0x9a, 0xc4, 0x4d, 0xc4, 0xd8, 0x11,
+    0x15, 0x7b, 0x14, 0x67, 0x5b, 0x37, 0x9b, 0x44, 0xc6, 0x8c, 0xa7, 0x2a, 0x54, 0xd6, 0xfe, 0x82,
+    0xe1, 0x4b, 0xf7, 0xaf, 0xf7, 0x3f, 0x6b, 0x73, 0x1f, 0xbf, 0xf2, 0xda, 0xbe, 0x3a, 0x9d, 0xcc,
+    0x76, 0x27, 0x12, 0x63, 0x39, 0x43, 0x81, 0x5d, 0xcc, 0x30, 0x74, 0xb6, 0x2f, 0x7a, 0x24, 0x6f,
+    0x73, 0x12, 0xe6, 0xd9, 0xc7, 0x05, 0x3f, 0x26, 0xa6, 0x78, 0x02, 0xea, 0x8e, 0x5d, 0xb6, 0x5f,
+    0x43, 0xf4, 0x79, 0xa6, 0x6d, 0x17, 0xef, 0xad, 0x90, 0xfc, 0xde, 0x77, 0x3c, 0x22, 0x04, 0x28,
+    0xa8, 0xae, 0x46, 0xfc, 0xdb, 0x40, 0x5f, 0xfe, 0x5e, 0x7b, 0x2e, 0xe0, 0xca, 0xcc, 0x34, 0x8d,
+    0x7f, 0x94, 0x9d, 0x50, 0x05, 0x44, 0x4d, 0x6d, 0x90, 0x8e, 0x31, 0xc1, 0xf7, 0xa9, 0x50, 0x06,
+    0x69, 0x2f, 0xcb, 0x27, 0xa9, 0xc3, 0x3a, 0x7f, 0x29, 0x90, 0x10, 0x9e, 0xc1, 0x18, 0x1b, 0xe5,
+    0xc6, 0x5d, 0x62, 0x0a, 0xf1, 0x6d, 0x27, 0x26, 0x70, 0x75, 0x07, 0x6e, 0xd9, 0xa2, 0xfc, 0x73,
+    0xcf, 0x97, 0xfc, 0x37, 0xf7, 0x03, 0xfb, 0xea, 0x7c, 0xb5, 0x0f, 0xd1, 0xfb, 0x54, 0x87, 0xf8,
+    0xc8, 0x93, 0xb3, 0x4c, 0x5f, 0x76, 0xa4, 0x89, 0x5c, 0x30, 0x25, 0xc3, 0x1a, 0x9f, 0x85, 0x7b,
+    0x2a, 0xcc, 0x48, 0x4d, 0x20, 0x31, 0x93, 0xf1, 0xa8, 0x03, 0x01, 0xcc, 0xa5, 0xfa, 0x6d, 0x03,
+    0x9b, 0x55, 0x23, 0xa7, 0xfb, 0xed, 0xb3, 0x99, 0x81, 0x86, 0x62, 0xfb, 0x91, 0xc3, 0x2e, 0xe5,
+    0xec, 0x58, 0xfe, 0x36, 0x25, 0x06, 0xdf, 0xed, 0xcf, 0x26, 0x53, 0xe1, 0x8e, 0xb0, 0x89, 0xba,
+    0x00, 0x0e, 0xd5, 0xc6, 0x93, 0x70, 0xaf, 0x46, 0x57, 0x47, 0x5e, 0xd9, 0x71, 0xd4, 0x08, 0xaf,
+    0x6c, 0xcb, 0x5e, 0xb7, 0x8f, 0x9d, 0x85, 0x45, 0x40, 0x30, 0x4c, 0x04, 0x68, 0x4c, 0x49, 0x1c,
+    0xf1, 0x73, 0x08, 0xe1, 0x5b, 0x4c, 0xbb, 0xf9, 0xb2, 0xd5, 0xa3, 0xa5, 0xa0, 0x1a, 0xa3, 0xbf,
+    0xf2, 0x4c, 0xda, 0x28, 0x16, 0x67, 0x24, 0x35, 0xc0, 0x3e, 0x52, 0xc9, 0x2c, 0x2c, 0x6d, 0x25,
+    0x78, 0x87, 0xc4, 0x0a, 0x39, 0x95, 0x15, 0xc5, 0xed, 0x57, 0xb2, 0xca, 0xf2, 0xce, 0x9b, 0xf8,
+    0x8f, 0x80, 0x08, 0x78, 0x9a, 0x4b, 0x3c, 0x11, 0xfd, 0xe2, 0xe2, 0x66, 0x1c, 0xd6, 0x13, 0x62,
+    0x86, 0x76, 0x76, 0x35, 0xeb, 0x55, 0xd7, 0x12, 0x90, 0x7d, 0x59, 0x22, 0x02, 0xc6, 0xda, 0x30,
+    0xe4, 0x1a, 0xd3, 0xd9, 0xad, 0xe9, 0x17, 0x93, 0x87, 0x7c, 0xe3, 0xec, 0xf8, 0xd0, 0xa6, 0x64,
+    0x34, 0x98, 0xa1, 0x89, 0xbd, 0x01, 0x33, 0xb7, 0x3e, 0x43, 0xfa, 0x88, 0x9e, 0xe3, 0x83, 0xb1,
+    0x70, 0x22, 0x03, 0xf8, 0xbf, 0xbd, 0xbd, 0xb7, 0xe7, 0x34, 0x3c, 0x50, 0xd8, 0xac, 0x15, 0xac,
+    0x52, 0x8e, 0x17, 0x45, 0x6f, 0x90, 0xd6, 0x94, 0x42, 0x0f, 0xba, 0xdf, 0x40, 0x37, 0xff, 0x53,
+    0xf3, 0xd4, 0x54, 0x0d, 0x33, 0xdc, 0xc7, 0xf4, 0xba, 0x8f, 0xca, 0xcd, 0x64, 0xa1, 0x82, 0xe1,
+    0x1f, 0x1f, 0xe3, 0x5f, 0xca, 0x30, 0xd3, 0x67, 0x06, 0x39, 0x5e, 0xa7, 0x65, 0x00, 0xb7, 0xc9,
+    0xee, 0x18, 0xdf, 0xfb, 0x00, 0xa0, 0xce, 0xfa, 0x5c, 0xb7, 0x46, 0x1a, 0x5b, 0xa0, 0x70, 0x6e,
+    0x28, 0x6a, 0x31, 0x96, 0x07, 0x26, 0x76, 0xd3, 0x9c, 0x59, 0x6b, 0xdb, 0xad, 0x21, 0x1a, 0x3f,
+    0x89, 0x9d, 0xc5, 0xeb, 0x38, 0x58, 0x9a, 0xa0, 0xb4, 0x35, 0xaf, 0xf5, 0x68, 0x4b, 0xc2, 0x39,
+    0x7f, 0xce, 0x9a, 0xe0, 0x60, 0xc0, 0xf0, 0xe7, 0xf9, 0x4b, 0xe0, 0xd6, 0x00, 0x18, 0xd2, 0x40,
+    0x27, 0xf0, 0xab, 0x9f, 0x9b, 0xaa, 0x45, 0x15, 0xb5, 0x82, 0x9f, 0x98, 0x4c, 0x8f, 0x43, 0xd3,
+    0xdf, 0x5c, 0x73, 0x7f, 0x24, 0x03, 0x43, 0x4d, 0x8a, 0xff, 0xc2, 0xf0, 0x09, 0xd5, 0x7c, 0x61,
+    0x92, 0xc3, 0xff, 0x0e, 0xb9, 0xb1, 0x59, 0x4c, 0x45, 0x9e, 0x00, 0xbf, 0xf0, 0xf3, 0xc9, 0xd0,
+    0xa8, 0xd2, 0x05, 0x06, 0xdf, 0x1b, 0x5e, 0x32, 0x50, 0x29, 0x84, 0x46, 0xf7, 0x83, 0x76, 0xdb,
+    0x99, 0x54, 0xbf, 0xa5, 0xbd, 0x41, 0x41, 0x8c, 0xde, 0xd9, 0x67, 0x77, 0x9e, 0x12, 0x61, 0xed,
+    0xcb, 0x28, 0x20, 0x0c, 0x23, 0x7b, 0xb9, 0x18, 0x13, 0x93, 0x8c, 0xd9, 0xd0, 0xb8, 0x0f, 0x4d,
+    0xba, 0xe8, 0x14, 0x82, 0xf4, 0x67, 0x82, 0x66, 0x00, 0x00,
+};
+
+static const uint8_t lossy_480x640_webp[] = {
+    0x52, 0x49, 0x46, 0x46, 0x44, 0x0e, 0x00, 0x00, 0x57, 0x45, 0x42, 0x50, 0x56, 0x50, 0x38, 0x20,
+    0x38, 0x0e, 0x00, 0x00, 0x90, 0x78, 0x00, 0x9d, 0x01, 0x2a, 0xe0, 0x01, 0x80, 0x02, 0x3e, 0xb5,
+    0x5a, 0xab, 0x50, 0x27, 0x25, 0xa4, 0x22, 0xa1, 0x54, 0xf8, 0x18, 0xe0, 0x16, 0x89, 0x67, 0x6e,
+    0xe9, 0xd0, 0x53, 0xf4, 0xa2, 0x35, 0x3c, 0x40, 0x57, 0xa4, 0xff, 0x04, 0xff, 0xff, 0xc7, 0xef,
+    0x71, 0x1d, 0x78, 0x3c, 0xd6, 0x2a, 0x97, 0x0e, 0xff, 0xde, 0x27, 0xb0, 0x2f, 0xf3, 0x3f, 0x5b,
+    0xec, 0xf3, 0xc0, 0xff, 0x46, 0x79, 0x6f, 0xbf, 0x5d, 0x9a, 0xf7, 0x0f, 0x3e, 0x1f, 0xb8, 0x0f,
+    0x70, 0x0f, 0xd3, 0x2e, 0x9c, 0xfe, 0x60, 0x3f, 0x60, 0x3d, 0x67, 0x3d, 0x04, 0x7f, 0xa8, 0xf5,
+    0x00, 0xfe, 0xdf, 0xfe, 0x7b, 0xac, 0x03, 0xd0, 0x03, 0xcb, 0x67, 0xd9, 0x0b, 0xf7, 0x3f, 0xd2,
+    0x63, 0x56, 0x5c, 0x0f, 0x4b, 0xda, 0xfe, 0x0e, 0x28, 0x40, 0xda, 0xcb, 0x6c, 0xeb, 0xf6, 0xbf,
+    0x81, 0x52, 0xce, 0x26, 0x8e, 0xb3, 0xa3, 0x16, 0xbd, 0x5e, 0xaf, 0x57, 0xab, 0xd6, 0x2f, 0x9b,
+    0x7c, 0xb5, 0xd6, 0xac, 0x61, 0x12, 0x4b, 0x93, 0xa1, 0xed, 0xfb, 0xbf, 0xd7, 0xd6, 0xaf, 0xf6,
+    0x52, 0x19, 0x0c, 0x86, 0x43, 0x21, 0xb7, 0xff, 0xd2, 0xc3, 0xea, 0x7a, 0x89, 0x7f, 0x48, 0x3f,
+    0x75, 0xea, 0xf6, 0x2b, 0xdb, 0xff, 0xff, 0xfa, 0xba, 0x7d, 0xa7, 0xda, 0x7d, 0xa7, 0xd9, 0x93,
+    0x50, 0x84, 0x92, 0xe5, 0x6a, 0xb5, 0x5a, 0xad, 0x56, 0xab, 0x5f, 0xf1, 0x16, 0x91, 0x20, 0xff,
+    0xfe, 0x78, 0xda, 0xae, 0xcc, 0x6d, 0xf2, 0xd7, 0x5a, 0x87, 0xe0, 0x77, 0x84, 0x7a, 0x0f, 0x88,
+    0x3b, 0x1f, 0x8b, 0x81, 0x7e, 0xaf, 0x21, 0x25, 0xf2, 0x00, 0x80, 0x40, 0x85, 0x42, 0x35, 0x94,
+    0xfe, 0x11, 0x5a, 0x05, 0x8c, 0x26, 0xfc, 0x1b, 0x52, 0xb0, 0x79, 0xf5, 0x4d, 0x69, 0x05, 0x5e,
+    0x57, 0x7c, 0x60, 0x15, 0xe7, 0xd1, 0x9c, 0x16, 0x81, 0x7e, 0xaf, 0x57, 0x90, 0x93, 0x00, 0x80,
+    0x40, 0x1f, 0x96, 0x62, 0x74, 0x00, 0x6b, 0x0b, 0x55, 0x6a, 0xab, 0x78, 0x4b, 0x7e, 0x38, 0xc4,
+    0x3f, 0x99, 0x9e, 0x56, 0x4b, 0xfe, 0xe7, 0x80, 0x40, 0x20, 0x05, 0x5c, 0xcc, 0x17, 0xb4, 0x00,
+    0x88, 0x46, 0x92, 0x2f, 0x84, 0x18, 0x4c, 0x80, 0xbe, 0x2e, 0x02, 0x82, 0x14, 0x2c, 0x1f, 0x99,
+    0x18, 0x3b, 0x2e, 0xaa, 0x84, 0x02, 0x00, 0xff, 0xd1, 0x01, 0x62, 0x7b, 0xcc, 0x03, 0xd7, 0x3d,
+    0x30, 0xd0, 0xb0, 0xe8, 0x2a, 0x23, 0xf2, 0x06, 0x32, 0x40, 0x8a, 0xef, 0x63, 0x7c, 0x1e, 0x48,
+    0xd0, 0xe8, 0x74, 0x39, 0xa5, 0x20, 0x3d, 0x67, 0x58, 0x02, 0x93, 0xd8, 0xe9, 0xcf, 0xc8, 0x90,
+    0x26, 0xb4, 0x89, 0xb8, 0x78, 0xdc, 0xcb, 0x71, 0xbe, 0xb6, 0xd8, 0x7d, 0x59, 0x50, 0xe6, 0x94,
+    0x81, 0x38, 0x69, 0x3d, 0x26, 0xb9, 0xac, 0x67, 0x4d, 0xb7, 0xdb, 0xed, 0xf6, 0xfb, 0x7d, 0xb6,
+    0xe1, 0x7e, 0xc1, 0xea, 0x10, 0x07, 0x87, 0xcd, 0xee, 0xb5, 0x47, 0x7f, 0x81, 0x00, 0x40, 0x20,
+    0x10, 0x08, 0x04, 0x01, 0x54, 0x62, 0x65, 0x7c, 0xbf, 0xb2, 0x43, 0x12, 0x42, 0xf6, 0x66, 0xa0,
+    0x76, 0x98, 0xdb, 0xe5, 0xae, 0xb5, 0x4a, 0x1c, 0xff, 0xc8, 0x7d, 0xda, 0x8c, 0xdb, 0xed, 0xeb,
+    0xe7, 0x89, 0xe9, 0x12, 0x72, 0x6f, 0x48, 0x5d, 0x7a, 0xbd, 0x5e, 0xaf, 0x57, 0xab, 0xcf, 0x20,
+    0x28, 0x21, 0xae, 0xb4, 0xd0, 0xc2, 0xd2, 0x90, 0x27, 0x11, 0x5c, 0x20, 0x0d, 0x2b, 0x44, 0xe6,
+    0xd0, 0x2f, 0xd5, 0xea, 0xf6, 0x2b, 0xd8, 0xb3, 0xf0, 0xba, 0x8d, 0x02, 0x4a, 0xec, 0xf9, 0xb7,
+    0x43, 0xd5, 0xea, 0xf3, 0xcb, 0xe9, 0x66, 0x3c, 0xcc, 0xd5, 0xad, 0x52, 0x87, 0x43, 0xa1, 0xbb,
+    0x8b, 0x0a, 0x09, 0xe0, 0x8a, 0x1f, 0xaa, 0x6a, 0x23, 0xa5, 0x77, 0x2d, 0x75, 0x7f, 0x1f, 0x71,
+    0x51, 0x0d, 0xaa, 0x96, 0x54, 0x3a, 0x1d, 0x0e, 0x87, 0x3f, 0xc5, 0x2a, 0xa5, 0x4e, 0x41, 0x4a,
+    0x70, 0xe7, 0xdd, 0x68, 0xb4, 0x81, 0x38, 0x9c, 0x45, 0x4f, 0x3a, 0x29, 0x6e, 0xea, 0x95, 0x08,
+    0xc0, 0x39, 0x5a, 0xad, 0x56, 0x93, 0x83, 0x62, 0xed, 0x1c, 0xd4, 0x0e, 0x9f, 0x36, 0x88, 0x20,
+    0x4e, 0x26, 0x4f, 0x87, 0x5a, 0xeb, 0x54, 0x24, 0x51, 0x28, 0x1c, 0xf6, 0xf9, 0x59, 0x7e, 0x83,
+    0x0a, 0x1f, 0x8b, 0x78, 0x3a, 0xb0, 0x59, 0xe1, 0x04, 0x3b, 0xdb, 0x30, 0xf4, 0xaa, 0xde, 0xaa,
+    0x83, 0xa9, 0x73, 0x1a, 0x30, 0xc8, 0x64, 0x22, 0x1f, 0x22, 0x94, 0xc8, 0x72, 0x45, 0x03, 0x93,
+    0x32, 0xf2, 0x30, 0xb8, 0x9e, 0xb3, 0x03, 0x2d, 0x03, 0x98, 0xb0, 0x93, 0x1d, 0xaf, 0x3c, 0x56,
+    0xf0, 0x06, 0x59, 0xd1, 0x4e, 0x56, 0xf5, 0x7a, 0xaa, 0x10, 0xa2, 0xbb, 0xe3, 0x50, 0xe3, 0xf1,
+    0x5a, 0xad, 0x52, 0x8c, 0xdc, 0xa3, 0xb5, 0x6a, 0xb5, 0x59, 0xfb, 0x56, 0x4f, 0x2f, 0xd5, 0xea,
+    0xf5, 0x7a, 0xbd, 0x5e, 0xb0, 0x53, 0x1b, 0x7c, 0xb5, 0xd6, 0xa9, 0x43, 0x9d, 0xdc, 0x04, 0xe2,
+    0x71, 0x39, 0x3e, 0x3f, 0x17, 0x02, 0xfd, 0x5e, 0xaf, 0x57, 0xab, 0xd5, 0xea, 0xf5, 0x2e, 0x64,
+    0x32, 0x19, 0x0c, 0x86, 0x43, 0x21, 0x90, 0xc8, 0x64, 0x32, 0x19, 0x0c, 0x86, 0x42, 0x78, 0xe4,
+    0x07, 0xac, 0xe2, 0x71, 0x38, 0x9a, 0xd2, 0x27, 0x13, 0x89, 0xc5, 0x1b, 0x78, 0xfc, 0x5b, 0x79,
+    0x6d, 0x4d, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0x40, 0x24, 0x97,
+    0xf0, 0x7a, 0x6f, 0x21, 0x5b, 0xd5, 0xea, 0xf5, 0x7a, 0xbd, 0x5e, 0xb0, 0x53, 0x1b, 0x7c, 0xb3,
+    0x5c, 0xba, 0x17, 0xbe, 0xd1, 0x60, 0xb3, 0x89, 0xc9, 0xf1, 0xf8, 0xb8, 0x17, 0xea, 0xf5, 0x7b,
+    0x15, 0xa0, 0x6d, 0xf1, 0x0a, 0xd5, 0x6a, 0xb5, 0x5a, 0xad, 0x56, 0xab, 0x55, 0xe0, 0x22, 0xcd,
+    0x44, 0x7b, 0x48, 0x9c, 0x4c, 0x9f, 0x7c, 0x7b, 0x56, 0xa9, 0x43, 0xa1, 0xd0, 0xe8, 0x74, 0x3a,
+    0x1d, 0x0e, 0x87, 0x3c, 0x5e, 0x2d, 0x29, 0x01, 0xeb, 0x38, 0x9c, 0x4e, 0x27, 0x13, 0x89, 0xc4,
+    0xe2, 0x71, 0x39, 0xfe, 0xe3, 0xe2, 0xdf, 0xf5, 0x0e, 0x78, 0xc5, 0x2a, 0x43, 0x21, 0x90, 0xc8,
+    0x64, 0x32, 0x19, 0x0c, 0x86, 0x43, 0x21, 0x8c, 0xc2, 0x04, 0xe2, 0x71, 0x46, 0xde, 0x3f, 0x17,
+    0x03, 0x55, 0xec, 0x6d, 0xf2, 0xd6, 0xe8, 0xa5, 0x0e, 0x69, 0x48, 0x13, 0x89, 0xc4, 0xe2, 0x71,
+    0x38, 0x9c, 0x4e, 0x27, 0x13, 0x89, 0xc3, 0xd5, 0xeb, 0x38, 0x5f, 0x56, 0xba, 0xd5, 0x28, 0x74,
+    0x3a, 0x1d, 0x0e, 0x87, 0x43, 0xa1, 0xd0, 0xe8, 0x73, 0xc6, 0x1c, 0xd2, 0x90, 0x27, 0x14, 0x6d,
+    0xe3, 0xf1, 0x70, 0xab, 0xaf, 0x57, 0xab, 0xd5, 0xea, 0xf5, 0x7a, 0xbc, 0x7b, 0x98, 0xd1, 0x86,
+    0x46, 0x44, 0x92, 0xe5, 0x6a, 0xb5, 0x5a, 0xad, 0x56, 0xab, 0x55, 0xaa, 0xcf, 0xd5, 0x9f, 0xea,
+    0xf5, 0x7a, 0xbd, 0x5e, 0xaf, 0x57, 0xb1, 0x5e, 0xc6, 0xdf, 0x2d, 0x75, 0xaa, 0x4f, 0x16, 0x94,
+    0x9d, 0xa3, 0xbe, 0x2e, 0x05, 0xfa, 0xbd, 0x5e, 0xaf, 0x57, 0xab, 0xd5, 0xea, 0xf5, 0x7a, 0xb3,
+    0x80, 0x00, 0xfe, 0xed, 0xbc, 0xbf, 0xea, 0x52, 0x68, 0xbb, 0x0e, 0xf1, 0x0d, 0x0f, 0x63, 0x3c,
+    0x41, 0x54, 0x6f, 0x28, 0xfe, 0x4a, 0x50, 0xa3, 0x0e, 0xaa, 0x25, 0xbf, 0x63, 0xb6, 0x1f, 0xbd,
+    0x22, 0x55, 0x18, 0xcc, 0x20, 0xe5, 0x7d, 0xda, 0xaf, 0xb6, 0x28, 0x74, 0x75, 0xe4, 0xc4, 0xd8,
+    0x27, 0x11, 0xe6, 0x62, 0x4c, 0x9d, 0x6d, 0x76, 0x20, 0xfe, 0x88, 0xd0, 0x14, 0xbe, 0x6f, 0x8d,
+    0x8b, 0x51, 0x41, 0x13, 0x7c, 0x2f, 0x6b, 0xd0, 0x61, 0x3e, 0xbc, 0xe9, 0x00, 0xd0, 0xbb, 0xe0,
+    0x62, 0x49, 0xbb, 0xbd, 0x92, 0xa2, 0xf0, 0xa8, 0xd6, 0x1f, 0xb8, 0xb9, 0x9e, 0x07, 0x1e, 0x08,
+    0xcb, 0x50, 0xaf, 0xed, 0xa5, 0x9d, 0x49, 0xc8, 0x9e, 0x3d, 0x7d, 0xe2, 0x6f, 0xd8, 0x8e, 0x0c,
+    0x95, 0xaf, 0x2a, 0x29, 0x91, 0x78, 0x23, 0x64, 0xc9, 0x93, 0xc9, 0x45, 0xe1, 0xa6, 0xda, 0xfc,
+    0x0a, 0xc3, 0xb7, 0x4f, 0x24, 0x03, 0x59, 0xd9, 0xb2, 0xd5, 0x98, 0xcd, 0xe7, 0x34, 0x93, 0xa3,
+    0xff, 0xab, 0x9a, 0xe1, 0x56, 0x19, 0x95, 0xbb, 0x8d, 0x54, 0x48, 0x76, 0xec, 0x93, 0xfa, 0xd0,
+    0x19, 0x29, 0x70, 0x8b, 0x88, 0x8e, 0x55, 0x2a, 0xf3, 0x54, 0x72, 0x73, 0x96, 0x5c, 0x26, 0x8b,
+    0x84, 0xe5, 0x9e, 0xca, 0xae, 0xf6, 0x5d, 0xd6, 0xdf, 0x41, 0xbc, 0x5c, 0x34, 0x84, 0x1e, 0xd5,
+    0xbb, 0xad, 0xfb, 0xd6, 0xad, 0x80, 0x56, 0x77, 0x62, 0xf0, 0x5b, 0x67, 0xcd, 0xf7, 0x32, 0xad,
+    0xef, 0x3a, 0xea, 0x73, 0x07, 0x52, 0xf4, 0x8e, 0x06, 0xd6, 0x07, 0x48, 0x43, 0x55, 0xf4, 0x36,
+    0x22, 0x32, 0xc8, 0x6c, 0x4a, 0x4d, 0x97, 0xab, 0x5d, 0xe9, 0xa1, 0x60, 0xa7, 0x71, 0x54, 0xd3,
+    0xf0, 0x55, 0xf5, 0x39, 0x8c, 0xa6, 0x57, 0x2c, 0xd3, 0x51, 0x3d, 0xc0, 0x0e, 0xf4, 0xf5, 0x38,
+    0x8f, 0x31, 0xb1, 0xd9, 0xa2, 0xd8, 0x39, 0x6b, 0x54, 0x1d, 0x70, 0x15, 0x79, 0x14, 0x8c, 0x17,
+    0x84, 0xe0, 0xbd, 0xb2, 0xc9, 0xea, 0xfc, 0xbc, 0x78, 0x5c, 0x5c, 0xef, 0x13, 0x15, 0xce, 0x45,
+    0xb0, 0xa6, 0xb6, 0x2b, 0x04, 0x09, 0x3e, 0x86, 0x74, 0xfe, 0xc3, 0x39, 0x2e, 0x71, 0x7f, 0x7a,
+    0x83, 0x66, 0xbb, 0x85, 0x23, 0x9b, 0x5e, 0xbc, 0x03, 0x37, 0x99, 0x82, 0x7b, 0x54, 0x8b, 0x30,
+    0xf4, 0x66, 0x4c, 0x0f, 0xd3, 0x35, 0x8f, 0x61, 0x38, 0x3f, 0x3f, 0x62, 0x7d, 0x0c, 0x3c, 0x40,
+    0xa3, 0x22, 0x28, 0x85, 0xb7, 0x51, 0x45, 0xfe, 0x2d, 0x3f, 0x0f, 0x15, 0x7f, 0xc1, 0x35, 0x3a,
+    0x52, 0x9c, 0xad, 0xab, 0x30, 0x52, 0xcd, 0x96, 0x0d, 0xb5, 0x19, 0x87, 0x7f, 0x98, 0x74, 0x78,
+    0xaa, 0x03, 0xd5, 0xb1, 0xba, 0xbb, 0x0e, 0x62, 0x76, 0x8a, 0xc7, 0x78, 0x06, 0x84, 0xe2, 0x6c,
+    0x3e, 0x78, 0x3f, 0x0b, 0x41, 0x1b, 0x18, 0x47, 0x0d, 0x86, 0xc1, 0x5a, 0x02, 0x4a, 0xde, 0x14,
+    0xc6, 0xae, 0x13, 0xb7, 0x30, 0x7b, 0x41, 0x7f, 0xef, 0x0b, 0x7d, 0xdf, 0xd6, 0x9e, 0xa2, 0xf2,
+    0xb8, 0x6d, 0x57, 0xc1, 0x7b, 0x58, 0x41, 0xfc, 0x69, 0xcd, 0xcb, 0x38, 0x4b, 0x03, 0xcb, 0xcd,
+    0x13, 0x71, 0xbc, 0x85, 0x10, 0xc7, 0x45, 0xc8, 0x24, 0x9d, 0xd5, 0x46, 0x31, 0x1e, 0xe1, 0x66,
+    0xbb, 0xe0, 0xcc, 0xaf, 0x9d, 0xcd, 0xd2, 0x1b, 0x8e, 0x1a, 0xdd, 0x15, 0x66, 0x09, 0xe8, 0xee,
+    0x50, 0xee, 0x64, 0x02, 0xf0, 0x09, 0xda, 0x6b, 0xcf, 0xc6, 0xa2, 0x87, 0x00, 0x3f, 0xf2, 0xfc,
+    0x20, 0x8f, 0x2b, 0x0d, 0x30, 0x44, 0xff, 0xfe, 0x3a, 0x5d, 0x9f, 0xfd, 0x61, 0x1a, 0x11, 0x74,
+    0xae, 0x2a, 0x78, 0x9b, 0xd3, 0xb7, 0xe8, 0x8d, 0xcf, 0x7b, 0x0f, 0x45, 0x32, 0xbf, 0xe9, 0x57,
+    0x9e, 0x92, 0x9a, 0xda, 0x63, 0x54, 0x31, 0xf2, 0x68, 0xb7, 0x6e, 0xe3, 0xc0, 0x37, 0xbe, 0xae,
+    0x54, 0xeb, 0x58, 0x61, 0x2e, 0x71, 0x2d, 0xd6, 0x2b, 0x0a, 0x44, 0x0d, 0x2e, 0x63, 0xfd, 0x91,
+    0x7f, 0x62, 0xf8, 0xe9, 0xf4, 0xcb, 0xc1, 0xf4, 0xd1, 0x50, 0x38, 0xbc, 0x61, 0x61, 0xbe, 0xf0,
+    0x45, 0x44, 0xda, 0xbb, 0x39, 0xf9, 0x0a, 0xc4, 0xd6, 0x83, 0x96, 0x2f, 0x47, 0x34, 0xb5, 0x51,
+    0xbc, 0x25, 0x6c, 0xd2, 0x48, 0x8e, 0xf1, 0x32, 0xa6, 0xfa, 0x39, 0x22, 0xd8, 0xff, 0x75, 0xcf,
+    0xca, 0x9a, 0xaa, 0x66, 0xc2, 0x0e, 0x23, 0x4a, 0x4b, 0x27, 0xe6, 0xeb, 0xc3, 0xed, 0xe2, 0x7d,
+    0xf1, 0x70, 0x89, 0x08, 0x4a, 0x90, 0x31, 0x61, 0x54, 0x18, 0xa9, 0x38, 0x63, 0x25, 0x76, 0x93,
+    0x25, 0x24, 0x0b, 0xe0, 0xc0, 0x1a, 0x98, 0xf7, 0x2d, 0x0b, 0xac, 0x85, 0x4e, 0x2d, 0x62, 0x99,
+    0xcf, 0xe4, 0xc0, 0x5d, 0x13, 0x20, 0xc9, 0x77, 0xda, 0x76, 0x20, 0x9e, 0xb9, 0xdc, 0x1f, 0x5e,
+    0x52, 0x63, 0x1e, 0x7b, 0x58, 0xf5, 0xfc, 0xdc, 0xe1, 0x3f, 0x10, 0x69, 0x49, 0xea, 0x9b, 0x95,
+    0xb9, 0x5d, 0xd0, 0xf5, 0xfe, 0x56, 0x7b, 0x53, 0x32, 0x0b, 0x7e, 0xc3, 0x40, 0x55, 0xbe, 0xc7,
+    0xdb, 0x25, 0xc8, 0x30, 0x95, 0xa0, 0x10, 0x5b, 0xc7, 0xc2, 0x97, 0x3f, 0xf0, 0xd7, 0x8a, 0x1d,
+    0x40, 0x72, 0xf7, 0x07, 0xa7, 0xfc, 0xf6, 0xb7, 0xfa, 0x65, 0xc9, 0x6f, 0xe5, 0x3d, 0x94, 0xda,
+    0x04, 0x34, 0x29, 0xbb, 0x24, 0xf4, 0xda, 0x96, 0x7d, 0x42, 0x36, 0xd5, 0x5a, 0xbc, 0x5f, 0xfa,
+    0x7b, 0x37, 0xd0, 0x3d, 0x83, 0x23, 0xfa, 0x0e, 0x5f, 0xd1, 0x80, 0xb5, 0x3a, 0xbf, 0xe9, 0x95,
+    0x4c, 0xb2, 0xfb, 0x1a, 0x16, 0xb0, 0x27, 0x10, 0xa9, 0x01, 0x17, 0x8e, 0xef, 0x9b, 0xb4, 0xa1,
+    0x1e, 0x5c, 0xd4, 0x0f, 0x29, 0x42, 0xbd, 0x50, 0xb7, 0xfe, 0x67, 0xfd, 0xeb, 0xff, 0xba, 0x79,
+    0x68, 0xdb, 0x17, 0x96, 0x16, 0x4d, 0x5e, 0x79, 0xa2, 0x28, 0x75, 0x24, 0x64, 0x24, 0x3f, 0x2a,
+    0xa0, 0xfa, 0x2b, 0x30, 0xbc, 0x52, 0x94, 0x71, 0x58, 0xd9, 0x25, 0x00, 0x16, 0x7a, 0xcd, 0x62,
+    0x71, 0x96, 0xb2, 0x7c, 0xd3, 0xc2, 0x4e, 0xbf, 0xe4, 0x83, 0x8f, 0x0b, 0x78, 0x0a, 0xf6, 0x63,
+    0xee, 0x49, 0x29, 0x5a, 0xcd, 0xfd, 0x7f, 0xac, 0xb9, 0x7e, 0xf3, 0xed, 0xf0, 0x65, 0x46, 0xb7,
+    0xb0, 0x9c, 0x68, 0x2d, 0xd4, 0x5b, 0xa3, 0x3c, 0x30, 0xac, 0x92, 0xc0, 0xc2, 0x00, 0xc8, 0xab,
+    0x0e, 0x8b, 0x7c, 0xca, 0x42, 0x0e, 0xa6, 0x09, 0x9c, 0xfe, 0x03, 0x7f, 0xaa, 0xe8, 0x0a, 0x66,
+    0xdc, 0x10, 0xab, 0x49, 0x39, 0x23, 0x01, 0x3c, 0xbe, 0xd0, 0x9b, 0x12, 0xf8, 0x66, 0xa9, 0xa3,
+    0x4d, 0xec, 0xf3, 0x53, 0xf9, 0x45, 0xc8, 0xd5, 0x7d, 0xcb, 0xc2, 0xf0, 0xd7, 0x5c, 0xf2, 0x13,
+    0xef, 0x43, 0x73, 0xc6, 0xcf, 0xfe, 0xa3, 0xfd, 0x3a, 0xe7, 0xe1, 0x21, 0x7f, 0x31, 0xdc, 0x38,
+    0xec, 0x0e, 0x42, 0x4d, 0x41, 0x21, 0xc5, 0x2c, 0x22, 0xd4, 0xfe, 0x98, 0xa9, 0xb7, 0xae, 0xfe,
+    0xcb, 0x7a, 0x37, 0x7e, 0x85, 0x6c, 0x34, 0x13, 0x36, 0x72, 0xa6, 0x82, 0x45, 0xe6, 0x80, 0x3f,
+    0xcf, 0xfd, 0x62, 0xd5, 0x2a, 0x69, 0x69, 0x07, 0xf3, 0xe7, 0xc7, 0x7d, 0x9c, 0xa8, 0x95, 0x66,
+    0xd1, 0x29, 0x0b, 0x6b, 0x6d, 0xf9, 0x67, 0x07, 0x50, 0x56, 0xa1, 0xb3, 0xba, 0x61, 0x7c, 0x03,
+    0xdb, 0xc9, 0x97, 0x4d, 0x4c, 0xda, 0xd5, 0x31, 0x92, 0x24, 0x95, 0x12, 0x4d, 0xd0, 0xfb, 0x11,
+    0x4b, 0x27, 0xf3, 0x68, 0xd7, 0xd2, 0xe5, 0xe8, 0x59, 0xae, 0xfc, 0x5f, 0x01, 0x54, 0xa6, 0xc6,
+    0x7c, 0xda, 0x42, 0x15, 0xda, 0xf3, 0x69, 0xdd, 0x40, 0x05, 0x09, 0x05, 0x72, 0x0d, 0x18, 0x43,
+    0xdf, 0xd8, 0xd2, 0xef, 0xde, 0x7a, 0xb0, 0x5e, 0x1b, 0x8f, 0xfe, 0xac, 0x85, 0x39, 0x93, 0x6d,
+    0x46, 0x1a, 0xa6, 0x49, 0x7a, 0x64, 0x2b, 0x85, 0x84, 0x0e, 0x4c, 0xf2, 0xee, 0x89, 0xb0, 0x03,
+    0xbd, 0xab, 0xc2, 0xf3, 0x34, 0xce, 0xd7, 0x53, 0xe3, 0x94, 0xdb, 0xa3, 0x1e, 0x36, 0xcb, 0x5b,
+    0x40, 0x8f, 0x26, 0xcf, 0xa1, 0x2d, 0x46, 0x14, 0xbc, 0xe3, 0x0f, 0x47, 0x96, 0xec, 0x33, 0x4e,
+    0xdd, 0xd8, 0xe6, 0x35, 0x54, 0x90, 0xe0, 0xb4, 0x05, 0x68, 0xd7, 0x26, 0xa0, 0x62, 0x76, 0x01,
+    0x30, 0xaa, 0xaf, 0xb1, 0x14, 0x7d, 0x2e, 0x7e, 0x16, 0x48, 0x00, 0xf2, 0xb8, 0x60, 0x6e, 0x46,
+    0x75, 0x50, 0xe3, 0xa2, 0x4e, 0x94, 0xa9, 0x5e, 0x28, 0xa1, 0x16, 0xaf, 0x7d, 0x48, 0x8e, 0xc4,
+    0xb6, 0x1f, 0x36, 0xca, 0x50, 0x48, 0x38, 0xe5, 0x00, 0x5d, 0xdc, 0xfb, 0xfc, 0x84, 0x46, 0xad,
+    0x76, 0x9b, 0xd7, 0x25, 0x24, 0x4d, 0x00, 0x2f, 0xbc, 0x50, 0x7b, 0x3a, 0x28, 0xe6, 0x31, 0x7f,
+    0x4c, 0x09, 0x7e, 0xb4, 0xfb, 0xb2, 0xb5, 0xad, 0x74, 0x45, 0xe9, 0x85, 0x56, 0xf2, 0x47, 0xb0,
+    0x9d, 0x2f, 0xe7, 0x31, 0x70, 0x54, 0x7b, 0x8a, 0x30, 0x55, 0xc0, 0x87, 0x17, 0x2b, 0x9a, 0x19,
+    0x54, 0xa2, 0x54, 0x52, 0x00, 0xf0, 0x61, 0x7f, 0x00, 0x61, 0x62, 0x41, 0x84, 0xa2, 0x9f, 0x8f,
+    0xf9, 0xb1, 0x4b, 0x5d, 0x8e, 0x8a, 0xfa, 0x03, 0x50, 0xfb, 0x02, 0xb3, 0x2b, 0x22, 0xb2, 0xc7,
+    0x11, 0xdb, 0xd2, 0xb6, 0x8a, 0xfc, 0x0b, 0x86, 0x68, 0x17, 0xf8, 0x8b, 0x53, 0x41, 0x26, 0x59,
+    0xd8, 0x3d, 0x79, 0x67, 0x97, 0x65, 0xa9, 0x85, 0xbd, 0x4a, 0x23, 0x7e, 0x11, 0xee, 0x61, 0xa4,
+    0x5b, 0x27, 0xf1, 0xc5, 0x2e, 0xe5, 0x4c, 0xcb, 0x04, 0x78, 0x9c, 0xf6, 0x8c, 0x4f, 0xfd, 0xe0,
+    0xcc, 0x91, 0x0a, 0xdf, 0xd1, 0xc1, 0x41, 0x9e, 0x38, 0xeb, 0x6b, 0xd4, 0xb8, 0x2a, 0x95, 0x57,
+    0xd3, 0xb8, 0x85, 0x99, 0x91, 0x61, 0x4f, 0xfb, 0xf6, 0xa1, 0xfd, 0x2a, 0x30, 0x85, 0x19, 0x57,
+    0xd6, 0xa9, 0x0d, 0x09, 0x96, 0xf2, 0x62, 0x61, 0x72, 0x26, 0xee, 0x0d, 0x92, 0x27, 0xb6, 0x00,
+    0xb2, 0x7f, 0x50, 0x68, 0x9d, 0xbb, 0x07, 0x11, 0xf8, 0x81, 0xb1, 0x0f, 0xe4, 0xc3, 0x96, 0x32,
+    0x21, 0x61, 0xb8, 0x7d, 0x45, 0xfc, 0x11, 0x31, 0xd1, 0x6e, 0x2e, 0xb5, 0x1f, 0xd4, 0xb2, 0x1e,
+    0xdb, 0xe7, 0x5f, 0x69, 0x17, 0x05, 0x34, 0x37, 0x55, 0x49, 0x4b, 0xa4, 0xa2, 0xef, 0xf0, 0xb6,
+    0xc4, 0x82, 0xc0, 0xc9, 0xb3, 0x2c, 0xf9, 0xea, 0xbc, 0x39, 0x3c, 0xfe, 0xb1, 0x17, 0xf5, 0x40,
+    0xdc, 0x58, 0x5d, 0x95, 0xc5, 0xe3, 0x4d, 0x88, 0xa1, 0x2a, 0x52, 0xf6, 0x55, 0xb6, 0xc2, 0x87,
+    0xbc, 0xf3, 0xa4, 0x36, 0x8c, 0xbd, 0x9f, 0x2f, 0xbf, 0x8e, 0x7e, 0x09, 0x2b, 0x9e, 0x02, 0x5d,
+    0x67, 0x81, 0x56, 0xa3, 0x34, 0x1e, 0x99, 0x70, 0xa7, 0x8b, 0x07, 0xed, 0x3c, 0x15, 0x69, 0xa3,
+    0x53, 0x20, 0x99, 0x5c, 0xdb, 0x3c, 0xf2, 0x10, 0x92, 0x4d, 0x7c, 0xd0, 0x65, 0x46, 0x33, 0xa7,
+    0xf1, 0xa9, 0xbe, 0xba, 0x93, 0x3f, 0x5e, 0xf7, 0xca, 0x09, 0xb2, 0x7a, 0x5e, 0x5a, 0x4b, 0x5f,
+    0x30, 0x76, 0xdb, 0x6a, 0xd5, 0x00, 0xde, 0x7f, 0x1f, 0xc2, 0x9b, 0xff, 0xc7, 0x5a, 0x85, 0x3b,
+    0xc6, 0xdd, 0x62, 0xf3, 0x10, 0x0b, 0x7b, 0xc7, 0x65, 0xe7, 0x9a, 0xf5, 0x20, 0x37, 0x35, 0x35,
+    0xc0, 0xb1, 0xa1, 0x72, 0x2a, 0xd8, 0xf9, 0x00, 0x18, 0x60, 0xb7, 0xaa, 0x21, 0xec, 0xbf, 0xf1,
+    0xfb, 0x3d, 0x4c, 0x09, 0x19, 0x10, 0xb0, 0x81, 0xb8, 0x92, 0x7e, 0x31, 0x80, 0x4c, 0x4f, 0x24,
+    0xb8, 0x1e, 0x44, 0x5a, 0x5e, 0x9e, 0x56, 0x18, 0xd4, 0x7f, 0xfb, 0xc2, 0xbd, 0x82, 0xf8, 0x17,
+    0x2b, 0xe4, 0xca, 0xce, 0x30, 0x9c, 0xdf, 0x50, 0xad, 0xcd, 0x56, 0x8d, 0xab, 0xa5, 0x1d, 0x29,
+    0xfe, 0xb1, 0xeb, 0x7e, 0xbd, 0xd7, 0x30, 0x33, 0x2e, 0x50, 0x7e, 0xf5, 0x04, 0x9a, 0x37, 0x8d,
+    0x4c, 0xfe, 0x87, 0x65, 0xb0, 0x9d, 0x0d, 0xc0, 0xe0, 0x09, 0x00, 0xc1, 0xb1, 0xf5, 0x97, 0x9f,
+    0x6e, 0xe5, 0x59, 0xf5, 0x4d, 0xcc, 0x37, 0x41, 0xb3, 0x3f, 0x30, 0x90, 0xce, 0x14, 0x23, 0x27,
+    0x64, 0xd2, 0x66, 0xe7, 0x71, 0x81, 0xa1, 0x80, 0xf5, 0xe5, 0xae, 0x3f, 0x80, 0x76, 0x31, 0xff,
+    0xd4, 0x70, 0xdc, 0x9f, 0xca, 0xc4, 0x68, 0xb7, 0x74, 0xc8, 0x20, 0xc1, 0xaa, 0x0a, 0xfc, 0x5d,
+    0x73, 0xf5, 0x58, 0xe2, 0xaf, 0x2d, 0xf2, 0xa9, 0xf7, 0xd4, 0xd6, 0xd3, 0x9d, 0xb4, 0x6d, 0x4a,
+    0x2e, 0x58, 0xcd, 0x48, 0x81, 0x46, 0xea, 0x6e, 0x8a, 0x5a, 0xf0, 0x2e, 0xc0, 0x36, 0x2f, 0x23,
+    0x65, 0x4b, 0x70, 0x63, 0xae, 0x4f, 0xee, 0x0f, 0xf5, 0x33, 0x31, 0x69, 0x5e, 0x79, 0x26, 0x95,
+    0x40, 0x12, 0xbf, 0xc1, 0x66, 0x60, 0xdc, 0x06, 0xe6, 0x4e, 0xc5, 0x4b, 0xe0, 0xf4, 0x30, 0x26,
+    0xeb, 0x7f, 0x6b, 0x5e, 0x1a, 0x55, 0x93, 0xcd, 0x4a, 0xf0, 0x05, 0x8f, 0x2d, 0x3f, 0x58, 0x9a,
+    0xd4, 0x19, 0x7d, 0x26, 0xc5, 0x96, 0x20, 0x61, 0x2a, 0x63, 0xa2, 0x43, 0x20, 0x78, 0x30, 0x4e,
+    0x35, 0x21, 0x36, 0xce, 0xa6, 0xcc, 0x6f, 0x9a, 0xf8, 0x79, 0xb3, 0x42, 0xf1, 0xac, 0xd4, 0xa0,
+    0xc0, 0x12, 0x6a, 0x49, 0xda, 0x79, 0xca, 0xb5, 0x29, 0xe4, 0x6c, 0x22, 0x1f, 0x35, 0xcc, 0x78,
+    0xbe, 0xd3, 0x67, 0x9d, 0x31, 0xa7, 0xce, 0x1a, 0x8d, 0x55, 0xfc, 0x23, 0x80, 0x34, 0x2c, 0x5b,
+    0x9b, 0xaf, 0xd3, 0x7a, 0xd8, 0xd3, 0xf1, 0xab, 0x46, 0x0c, 0xc9, 0x4a, 0x0b, 0x42, 0x7e, 0x95,
+    0x62, 0xe8, 0xce, 0x67, 0x9b, 0x47, 0x26, 0x92, 0xa2, 0x65, 0x02, 0xf2, 0xd9, 0x2e, 0xb1, 0xb8,
+    0x30, 0x86, 0x3c, 0x57, 0x91, 0x30, 0x42, 0x8e, 0xb7, 0x72, 0xc5, 0x77, 0xd7, 0x17, 0x3b, 0xe3,
+    0xd5, 0xad, 0xc7, 0x0d, 0x0f, 0x60, 0x6f, 0x57, 0xe9, 0x7d, 0xc7, 0x80, 0xf3, 0xf8, 0x88, 0xe6,
+    0xd2, 0xdb, 0x78, 0x10, 0xbd, 0xdb, 0xe0, 0x8c, 0xed, 0x78, 0xa2, 0x97, 0x14, 0x93, 0xbc, 0x4a,
+    0x2d, 0x0b, 0x21, 0x07, 0x58, 0x5e, 0x44, 0x6e, 0x4e, 0xe5, 0x5f, 0xc4, 0x8f, 0x8a, 0x31, 0x2f,
+    0x02, 0xdb, 0x5f, 0x8e, 0xbd, 0xeb, 0xe4, 0xf0, 0xfd, 0x61, 0x5e, 0x79, 0x36, 0x86, 0x69, 0x51,
+    0x0b, 0xf1, 0x9d, 0xad, 0x8d, 0xd8, 0xc5, 0x02, 0x1c, 0x55, 0xaa, 0x83, 0x36, 0xcb, 0x69, 0x57,
+    0x82, 0x50, 0xab, 0x33, 0x46, 0xb3, 0x50, 0xf8, 0x93, 0xf7, 0xa8, 0x67, 0x57, 0x76, 0xb9, 0x7d,
+    0x4a, 0x31, 0x78, 0xcd, 0x27, 0x7c, 0xc5, 0x73, 0x03, 0x61, 0xaa, 0x37, 0xcc, 0xd6, 0x3a, 0x88,
+    0xa3, 0x1f, 0x77, 0x9d, 0x0f, 0x25, 0xc6, 0x82, 0x66, 0x97, 0x5f, 0x97, 0x95, 0x81, 0x29, 0x0a,
+    0xc7, 0x60, 0xeb, 0x88, 0x88, 0x0e, 0xc1, 0xab, 0xa6, 0x9a, 0x8a, 0x1c, 0x65, 0x9e, 0x41, 0x98,
+    0x23, 0xb1, 0x2a, 0x1c, 0x40, 0x8e, 0x59, 0x36, 0x56, 0x51, 0xcf, 0x62, 0x96, 0x0c, 0xcc, 0x63,
+    0xa2, 0x6e, 0x8d, 0x43, 0xd4, 0xe1, 0x18, 0x5c, 0xb0, 0xcd, 0x3d, 0xd6, 0xf7, 0x5d, 0xf5, 0x00,
+    0xb1, 0xe3, 0x3e, 0xeb, 0x16, 0x31, 0xa9, 0xed, 0x75, 0xe6, 0xbd, 0x18, 0xb5, 0x7e, 0x53, 0xfe,
+    0x9f, 0x74, 0x90, 0x1b, 0x31, 0x4b, 0x20, 0x95, 0x8f, 0x1c, 0x17, 0xac, 0xbe, 0x35, 0x5e, 0xd5,
+    0xe4, 0x81, 0xc6, 0x42, 0x33, 0xa9, 0xb6, 0x72, 0x25, 0xe9, 0xe9, 0x3a, 0x01, 0x46, 0xa2, 0x40,
+    0x09, 0x9e, 0xf1, 0x1d, 0xe5, 0x90, 0x97, 0x15, 0x11, 0xd7, 0x5e, 0x04, 0x19, 0x58, 0x9d, 0x11,
+    0x46, 0x88, 0x4a, 0xc7, 0x2a, 0x42, 0xd0, 0xdd, 0xc5, 0xd7, 0xd8, 0x0b, 0x78, 0xcf, 0xfa, 0xfe,
+    0x8d, 0x98, 0xc3, 0x91, 0x35, 0x4b, 0x6f, 0xcc, 0xd3, 0x02, 0x7a, 0x3c, 0x7d, 0x99, 0xd9, 0x47,
+    0x42, 0x85, 0xbe, 0xf5, 0x47, 0xd0, 0x4c, 0x1c, 0x1b, 0xb8, 0xda, 0x4e, 0xf8, 0xc3, 0xe7, 0xa2,
+    0xea, 0x77, 0x79, 0x25, 0xe3, 0x01, 0x75, 0x2b, 0x3f, 0x5f, 0x39, 0x94, 0x75, 0x60, 0xf2, 0xa2,
+    0x88, 0xc4, 0x13, 0x4c, 0xd8, 0x31, 0x77, 0x90, 0x3b, 0x13, 0x25, 0xbf, 0x81, 0x18, 0x21, 0x10,
+    0x99, 0x8b, 0xca, 0xfb, 0x08, 0x72, 0x22, 0x57, 0xc2, 0xd4, 0x61, 0xd2, 0xfa, 0xc5, 0xfb, 0xac,
+    0xc9, 0xc8, 0xee, 0xb0, 0xca, 0xca, 0xfd, 0xc8, 0x4e, 0x24, 0xa3, 0x93, 0x4d, 0x98, 0xc3, 0x2f,
+    0x20, 0xab, 0x94, 0xe6, 0xfa, 0x52, 0x62, 0x4b, 0x65, 0xbc, 0xce, 0xcb, 0x10, 0x20, 0xf9, 0x3a,
+    0x1d, 0x6d, 0x25, 0x84, 0x96, 0xfe, 0xde, 0x3e, 0xa1, 0x00, 0xf5, 0x34, 0xe5, 0x3f, 0xc3, 0x7b,
+    0x7a, 0x0d, 0x57, 0x3a, 0xa9, 0xe4, 0xd8, 0x38, 0x4f, 0xe9, 0xfa, 0x69, 0xc4, 0x22, 0xd6, 0x10,
+    0x86, 0xd0, 0xcb, 0x06, 0x9d, 0x91, 0x54, 0x27, 0xdb, 0x48, 0xdc, 0x1a, 0xb6, 0x55, 0x44, 0x5f,
+    0x62, 0x70, 0x38, 0xf0, 0x81, 0x43, 0xfb, 0x96, 0x1f, 0x05, 0xd6, 0x8a, 0x25, 0xb6, 0xbf, 0xed,
+    0x79, 0xb5, 0xa0, 0x83, 0x53, 0xc3, 0x51, 0x48, 0x75, 0x9c, 0x15, 0xc0, 0x72, 0x7f, 0x3e, 0xb2,
+    0x4c, 0x8d, 0xed, 0x63, 0xa2, 0x8c, 0xd0, 0xe8, 0xcd, 0x1f, 0xea, 0x25, 0x61, 0xd8, 0x18, 0x64,
+    0x34, 0x43, 0xba, 0xcb, 0x21, 0x9e, 0x07, 0xf0, 0x7c, 0xbf, 0xa5, 0x96, 0x52, 0x18, 0x43, 0x52,
+    0x6b, 0xc7, 0x03, 0x87, 0xac, 0x24, 0xa8, 0x69, 0x2d, 0x6e, 0x0c, 0x05, 0x1f, 0x9b, 0xca, 0xd4,
+    0x33, 0xb7, 0x4e, 0xde, 0x7d, 0xc8, 0xb2, 0xdf, 0xab, 0x18, 0xaf, 0x6d, 0x77, 0xff, 0xce, 0xe4,
+    0xe7, 0x7d, 0xba, 0x34, 0x44, 0xf7, 0x66, 0xb1, 0xc8, 0x22, 0xad, 0xd8, 0xff, 0x35, 0x7f, 0x19,
+    0xc3, 0xc7, 0x17, 0x8d, 0xaf, 0x43, 0x39, 0x65, 0xc6, 0x71, 0x64, 0x65, 0x16, 0xff, 0x2f, 0x66,
+    0x34, 0xdd, 0x20, 0xda, 0x7f, 0x63, 0x59, 0x29, 0x1b, 0x7b, 0x58, 0x2a, 0xdd, 0x66, 0x57, 0xc9,
+    0xe8, 0x54, 0x3a, 0xfe, 0x78, 0x00, 0x8f, 0xa7, 0x32, 0x86, 0xa8, 0x9a, 0xba, 0xb6, 0x1a, 0x10,
+    0x09, 0x09, 0xec, 0x08, 0x91, 0xf2, 0x12, 0xd5, 0x52, 0xe2, 0xce, 0x94, 0x83, 0x5f, 0x88, 0xd9,
+    0x89, 0xdd, 0x44, 0x1a, 0xff, 0x85, 0x1d, 0xee, 0xd4, 0xcd, 0x4c, 0xaf, 0x86, 0x44, 0x92, 0x8e,
+    0xbf, 0x14, 0x3f, 0x29, 0x26, 0x30, 0xe0, 0x81, 0xcf, 0xf3, 0x42, 0x0a, 0x35, 0xe3, 0x6e, 0x4f,
+    0x55, 0x46, 0xeb, 0xbe, 0xd3, 0x51, 0xba, 0x4f, 0xc5, 0x86, 0x2d, 0x5e, 0x95, 0xfb, 0x69, 0xe1,
+    0xae, 0x35, 0x2e, 0x3f, 0xfb, 0x64, 0x93, 0x5f, 0x75, 0x92, 0xcf, 0xd7, 0xb5, 0x22, 0xa8, 0xee,
+    0x99, 0xc7, 0x1e, 0xdd, 0xb2, 0xe7, 0x04, 0x2e, 0x5a, 0xb3, 0x8a, 0x0e, 0x6d, 0x9e, 0x21, 0xf9,
+    0xac, 0xe4, 0x06, 0xa4, 0x4a, 0x93, 0xbf, 0x0c, 0xfd, 0xe4, 0x71, 0x2c, 0xc4, 0x9e, 0x69, 0xa2,
+    0x4f, 0xab, 0x62, 0xe6, 0xdd, 0x70, 0xb5, 0x42, 0xd4, 0xef, 0x6d, 0x8e, 0x95, 0x90, 0x38, 0xc0,
+    0x29, 0x2e, 0x7c, 0xc6, 0x33, 0x6d, 0xf4, 0x6e, 0xcd, 0xef, 0xb9, 0xad, 0x94, 0x7b, 0x81, 0x7a,
+    0xf9, 0xc7, 0xf6, 0x6b, 0x74, 0x0a, 0xbe, 0xf5, 0x91, 0x3e, 0x16, 0xf9, 0x3b, 0x11, 0x60, 0xb9,
+    0x8e, 0x6a, 0x8e, 0x91, 0x1f, 0x8b, 0x09, 0xcf, 0xee, 0xf5, 0xfa, 0x07, 0x0e, 0x88, 0xa3, 0x2c,
+    0x30, 0x8f, 0xcf, 0x68, 0xb3, 0x0e, 0x75, 0x77, 0xc1, 0x59, 0x57, 0xef, 0xaf, 0xe6, 0x95, 0x50,
+    0xd5, 0xa9, 0xb4, 0x4b, 0xbe, 0xd7, 0xc2, 0x2b, 0x42, 0xf5, 0x76, 0x37, 0x56, 0xb2, 0xc5, 0xcd,
+    0x57, 0x3c, 0xdf, 0xf7, 0xb6, 0xe7, 0x09, 0x23, 0x25, 0x1c, 0xac, 0x38, 0x15, 0x95, 0x8f, 0xde,
+    0x12, 0xc6, 0xde, 0x94, 0x86, 0xa3, 0x78, 0x97, 0x8c, 0x4a, 0x00, 0x00,
+};
+
+static const uint8_t lossless_480x640_webp[] = {
+    0x52, 0x49, 0x46, 0x46, 0x52, 0x07, 0x00, 0x00, 0x57, 0x45, 0x42, 0x50, 0x56, 0x50, 0x38, 0x4c,
+    0x45, 0x07, 0x00, 0x00, 0x2f, 0xdf, 0xc1, 0x9f, 0x00, 0xcd, 0x95, 0x21, 0xa2, 0xff, 0x31, 0x11,
+    0x12, 0x10, 0xfe, 0xaf, 0x75, 0x43, 0x17, 0x62, 0xc0, 0xfb, 0x3f, 0x01, 0x46, 0x7b, 0x24, 0x80,
+    0x24, 0xc0, 0x6d, 0xdc, 0x66, 0xf2, 0xff, 0x5f, 0x77, 0xaf, 0x6d, 0x81, 0x04, 0x90, 0x83, 0x80,
+    0xa0, 0xc8, 0xff, 0xd1, 0x1c, 0x46, 0x92, 0xac, 0x2a, 0x13, 0x1a, 0x13, 0xf9, 0x62, 0xdf, 0x71,
+    0x77, 0x87, 0x34, 0x08, 0x58, 0x90, 0x24, 0xd5, 0x6d, 0x62, 0x58, 0x76, 0x27, 0x1c, 0x96, 0x5d,
+    0x72, 0xaa, 0xec, 0x90, 0xe7, 0x27, 0x7a, 0x80, 0xf8, 0x4d, 0xaf, 0x3e, 0x8c, 0xa7, 0x1d, 0xf5,
+    0x4e, 0xef, 0x82, 0xfa, 0x5e, 0x5e, 0x00, 0xee, 0xc2, 0x06, 0x07, 0x06, 0x10, 0xe5, 0x15, 0xe0,
+    0xb0, 0x6d, 0x6f, 0xf8, 0x8a, 0x9a, 0x2b, 0x2e, 0xdb, 0xe6, 0x86, 0x9f, 0x50, 0x6b, 0xc5, 0x69,
+    0xdb, 0xda, 0xf0, 0x1b, 0x6a, 0xac, 0xfc, 0x66, 0xfd, 0x1d, 0x2a, 0x1b, 0x7e, 0x2f, 0xa9, 0xab,
+    0x18, 0x6e, 0xeb, 0x1a, 0xfe, 0x88, 0xaa, 0x2a, 0xa6, 0xdb, 0xaa, 0x86, 0x7f, 0xa0, 0x9a, 0x8a,
+    0xf1, 0xb6, 0xa6, 0xe1, 0x9f, 0xa8, 0xaf, 0xe2, 0xf7, 0x36, 0xb0, 0x8e, 0x86, 0x7f, 0x97, 0xf4,
+    0x53, 0xfc, 0xb7, 0xfd, 0x0c, 0xd7, 0xa0, 0x6e, 0x4a, 0x06, 0x6c, 0x37, 0xc3, 0x75, 0xa8, 0x97,
+    0x92, 0x03, 0xdb, 0xcb, 0x70, 0x2d, 0x2a, 0xa8, 0xd8, 0xbf, 0x0d, 0xac, 0x94, 0xe1, 0xea, 0x92,
+    0x42, 0x4a, 0x1c, 0x6c, 0x21, 0xc3, 0x2d, 0xa8, 0x8c, 0x12, 0x09, 0x5b, 0xc6, 0x70, 0x1b, 0x2a,
+    0xa2, 0xc4, 0xc2, 0x16, 0x31, 0xdc, 0x8a, 0x1a, 0x29, 0x69, 0xd8, 0x06, 0xd6, 0xc2, 0x70, 0x73,
+    0x49, 0x03, 0x25, 0x1d, 0xb6, 0x81, 0xe1, 0x09, 0xa8, 0x7d, 0x12, 0x60, 0x8b, 0xfc, 0xfd, 0x0d,
+    0xba, 0xb8, 0x1e, 0xce, 0xff, 0x3e, 0x2e, 0x38, 0x5d, 0x78, 0x0a, 0xd2, 0x54, 0x8b, 0xd3, 0xb5,
+    0x07, 0x09, 0xbd, 0xfa, 0x68, 0x81, 0xd3, 0x5d, 0x87, 0x0b, 0x67, 0x92, 0xe7, 0x58, 0x1d, 0xef,
+    0xc3, 0xf1, 0xee, 0xc3, 0x86, 0xde, 0xac, 0x8b, 0xe3, 0x43, 0x8e, 0x1e, 0x9a, 0x43, 0x9e, 0x02,
+    0x26, 0x09, 0x4f, 0x42, 0x67, 0x13, 0x1c, 0x1e, 0x78, 0x4b, 0xa0, 0x13, 0xf3, 0x71, 0x78, 0xea,
+    0xcd, 0x81, 0x43, 0xc8, 0xb3, 0xec, 0xa1, 0xf3, 0xb1, 0xff, 0xe9, 0x36, 0xf9, 0x39, 0x1d, 0xf9,
+    0x99, 0x3c, 0x76, 0xba, 0x01, 0xee, 0x00, 0xa3, 0x3e, 0x3c, 0x0b, 0x11, 0x87, 0x39, 0xec, 0xbe,
+    0xdf, 0xc0, 0x3d, 0x4f, 0x38, 0xd1, 0x1d, 0x64, 0xa4, 0x8b, 0xe4, 0x12, 0x04, 0x60, 0xfb, 0xfd,
+    0x34, 0xde, 0xf6, 0x84, 0xb3, 0xdc, 0x81, 0x66, 0xd9, 0xee, 0x50, 0xa3, 0x39, 0xc8, 0x45, 0x08,
+    0x36, 0x47, 0x9f, 0xd2, 0x70, 0xc3, 0xf4, 0x5b, 0x3f, 0x18, 0x0a, 0x16, 0xad, 0x16, 0xc1, 0x5a,
+    0xc0, 0x89, 0x0d, 0x77, 0x4b, 0xff, 0xd0, 0x57, 0x7e, 0x9d, 0x07, 0x50, 0x05, 0x50, 0x6c, 0x90,
+    0x89, 0x10, 0x80, 0xd5, 0xd7, 0x8f, 0x5f, 0xae, 0x42, 0xe4, 0x9b, 0xd3, 0x01, 0x95, 0x8a, 0x48,
+    0x8b, 0x60, 0x09, 0x80, 0x9a, 0xb6, 0xcd, 0x6b, 0xfb, 0xa1, 0xbb, 0x30, 0xeb, 0xa9, 0x54, 0x0f,
+    0x54, 0x19, 0x04, 0x22, 0x04, 0x0b, 0x59, 0xa7, 0xfb, 0xf4, 0xf6, 0x59, 0x5d, 0x57, 0xd3, 0x28,
+    0xf2, 0x2c, 0x82, 0x39, 0x00, 0xca, 0xda, 0x06, 0xd7, 0xff, 0xa5, 0x7b, 0xb1, 0xfc, 0xb3, 0xa8,
+    0x36, 0x28, 0x36, 0xa8, 0xd9, 0x06, 0x86, 0x60, 0x26, 0xf1, 0xd4, 0x1f, 0xdd, 0x3e, 0xa2, 0x6b,
+    0x6c, 0xf2, 0x44, 0x57, 0x09, 0x82, 0xe9, 0xe7, 0xe9, 0xef, 0x8e, 0xbd, 0xbd, 0xeb, 0x6c, 0x6b,
+    0xeb, 0x4a, 0x9b, 0xb4, 0xa0, 0x0a, 0x21, 0x98, 0x7c, 0x3e, 0x08, 0x2c, 0xb2, 0x77, 0x76, 0xb5,
+    0x4d, 0x98, 0x68, 0xb2, 0x08, 0xba, 0xcf, 0x07, 0x82, 0x4d, 0xf6, 0xae, 0xae, 0xb8, 0xc5, 0xee,
+    0xfb, 0x22, 0x2a, 0x42, 0x08, 0x5a, 0x00, 0xcc, 0x1a, 0xee, 0xe8, 0xaa, 0x9b, 0x28, 0xd1, 0x63,
+    0x11, 0x34, 0x9f, 0x0f, 0x08, 0xbb, 0xec, 0xd5, 0x5d, 0x79, 0x8b, 0xdc, 0x14, 0x35, 0x08, 0x41,
+    0x0d, 0x80, 0x69, 0xc3, 0x95, 0x5d, 0x7d, 0x13, 0x24, 0x5a, 0x2c, 0x82, 0x0a, 0x80, 0x01, 0x5a,
+    0xae, 0x2f, 0x57, 0x8d, 0x13, 0x0c, 0xda, 0xc2, 0xe1, 0xdb, 0xc0, 0x10, 0x94, 0x00, 0xcc, 0xd0,
+    0xe2, 0xb6, 0x90, 0x8e, 0x12, 0x04, 0x05, 0x00, 0xf6, 0x0d, 0xff, 0xef, 0x73, 0xb4, 0xac, 0x05,
+    0x19, 0x08, 0xc1, 0x18, 0x00, 0x0b, 0x87, 0xff, 0xf5, 0x59, 0x9a, 0x68, 0x49, 0xce, 0x0f, 0x49,
+    0x44, 0x30, 0x02, 0x60, 0x9a, 0x21, 0x68, 0x53, 0x34, 0x20, 0x04, 0x43, 0x00, 0xe6, 0x19, 0x72,
+    0x26, 0x12, 0x2c, 0x82, 0x01, 0x00, 0x36, 0x0e, 0x2e, 0xaf, 0xf2, 0x97, 0x71, 0xa6, 0x41, 0x45,
+    0x38, 0x16, 0x59, 0x3d, 0xa2, 0x0f, 0xc0, 0x54, 0x83, 0x08, 0x11, 0x60, 0x91, 0xb9, 0x1e, 0x30,
+    0xf8, 0x6f, 0x61, 0x84, 0x93, 0xdd, 0xa3, 0x19, 0x7b, 0xde, 0x7d, 0x30, 0x22, 0x06, 0x7c, 0x70,
+    0x21, 0x30, 0x63, 0x72, 0x74, 0xc9, 0xd7, 0x87, 0x56, 0x74, 0x87, 0x88, 0x85, 0xc3, 0x11, 0x05,
+    0xce, 0xf7, 0xa4, 0x33, 0xdb, 0x02, 0x10, 0x16, 0x10, 0xf1, 0x1d, 0xb2, 0x1d, 0x10, 0xf8, 0xe5,
+    0x53, 0x94, 0xe3, 0xc5, 0xa4, 0x4d, 0x39, 0x79, 0x93, 0x41, 0x69, 0x2f, 0x08, 0x9c, 0xf2, 0xde,
+    0x3d, 0x3d, 0x34, 0x08, 0x8d, 0x2d, 0x08, 0xfc, 0xc5, 0xba, 0xbb, 0x68, 0x77, 0x42, 0xaa, 0x16,
+    0x40, 0xe0, 0xa4, 0xf7, 0xf0, 0x20, 0xf2, 0xb6, 0xf6, 0x67, 0x5a, 0x1c, 0x1e, 0x52, 0x55, 0x82,
+    0xc0, 0x59, 0xef, 0xe3, 0xa3, 0x45, 0x8e, 0x7d, 0x43, 0x9c, 0x22, 0x08, 0x95, 0x54, 0x10, 0x38,
+    0xab, 0x45, 0xe0, 0x7b, 0xc7, 0x14, 0x49, 0x0b, 0x54, 0x45, 0x42, 0x67, 0xab, 0x12, 0x84, 0xa1,
+    0xce, 0x48, 0xd6, 0xb6, 0x81, 0xf5, 0x24, 0x48, 0x2b, 0xe9, 0x88, 0x64, 0xcf, 0x76, 0x24, 0xe8,
+    0x43, 0xef, 0x7f, 0x41, 0x21, 0x6a, 0x87, 0x24, 0xd0, 0xb6, 0x23, 0xa8, 0x44, 0xcd, 0x90, 0x14,
+    0xda, 0x3e, 0x06, 0x88, 0xcc, 0xba, 0xcd, 0x0f, 0xe2, 0x17, 0xad, 0x29, 0x25, 0x2a, 0x49, 0x56,
+    0x10, 0x8b, 0x9a, 0x28, 0x10, 0x99, 0xd4, 0x42, 0xbc, 0xdf, 0x3c, 0xa6, 0xa4, 0x6a, 0x01, 0x88,
+    0x0c, 0x7a, 0x0f, 0xe3, 0x75, 0xb6, 0x2c, 0xd9, 0xbe, 0x75, 0x4c, 0x11, 0x8d, 0xb2, 0x38, 0x11,
+    0xe2, 0x71, 0xb8, 0xe8, 0xb6, 0xee, 0x5e, 0x92, 0x18, 0x21, 0xee, 0xca, 0xa6, 0x14, 0xf4, 0xbb,
+    0xae, 0xbd, 0x70, 0x7c, 0x9c, 0xb0, 0x04, 0xe2, 0xfa, 0xe6, 0xf1, 0xba, 0x99, 0x80, 0xe2, 0xf1,
+    0x10, 0xc4, 0x25, 0x64, 0xaf, 0x7b, 0x0b, 0x7f, 0xf9, 0x2c, 0x7e, 0x2f, 0xad, 0x40, 0x9c, 0x41,
+    0xba, 0x03, 0x44, 0x66, 0x43, 0x10, 0x27, 0x10, 0x31, 0xd1, 0xbf, 0x40, 0xf0, 0x26, 0x43, 0x1c,
+    0x41, 0xc2, 0x03, 0x44, 0xe6, 0x42, 0x10, 0x07, 0x10, 0x30, 0x51, 0xf1, 0xee, 0xa1, 0x2c, 0xc4,
+    0xbe, 0xbc, 0xfb, 0xbf, 0x20, 0xf6, 0x92, 0x9e, 0x77, 0x2b, 0xdf, 0x06, 0x96, 0xb7, 0x01, 0x62,
+    0xa7, 0x65, 0xca, 0x0c, 0x2f, 0x9f, 0x85, 0x6d, 0x80, 0xd8, 0xa6, 0x6c, 0xdf, 0x97, 0x90, 0x61,
+    0x1a, 0x04, 0xb1, 0x31, 0x17, 0x41, 0x6c, 0xb4, 0xc8, 0x56, 0x17, 0xb0, 0x76, 0x80, 0x58, 0x07,
+    0x6d, 0x5f, 0xbd, 0x96, 0x61, 0x0e, 0x04, 0xb1, 0x32, 0x17, 0x41, 0xac, 0xe4, 0xc8, 0x4a, 0x17,
+    0xb0, 0x76, 0x80, 0x58, 0xae, 0xa6, 0x4d, 0xd1, 0xe5, 0x84, 0x5d, 0x2e, 0x00, 0xb1, 0x48, 0xdb,
+    0xd7, 0x1d, 0x2b, 0x42, 0xe2, 0x2d, 0xc4, 0x7c, 0xc9, 0x0b, 0x9c, 0xdd, 0xad, 0x6d, 0x10, 0x73,
+    0x59, 0xa1, 0x25, 0xcf, 0xbe, 0x21, 0x66, 0xaa, 0xa6, 0x0c, 0xb5, 0xc0, 0x89, 0x03, 0xc4, 0x74,
+    0xd7, 0xf6, 0xd0, 0xbe, 0xa8, 0x26, 0xbb, 0x0b, 0x0c, 0x8b, 0xdb, 0x06, 0x06, 0x31, 0x59, 0xf8,
+    0x62, 0xe7, 0x75, 0x59, 0xb2, 0x43, 0x0b, 0xd1, 0x95, 0xea, 0x9b, 0xca, 0x9f, 0x35, 0x0a, 0x0b,
+    0x1b, 0x44, 0x10, 0xed, 0xd6, 0x2c, 0x40, 0x54, 0xde, 0x3d, 0x1f, 0x5d, 0x9b, 0x68, 0x83, 0x0a,
+    0x2d, 0x44, 0xb3, 0xfd, 0x25, 0x8e, 0xe8, 0xcb, 0x6b, 0xdb, 0xeb, 0x2f, 0x28, 0x6c, 0xda, 0x10,
+    0x44, 0x6d, 0xc1, 0xf5, 0x3e, 0xbd, 0x0b, 0x94, 0xcd, 0x59, 0x88, 0xca, 0x86, 0x57, 0x58, 0x4e,
+    0xea, 0x4e, 0x3e, 0x01, 0x87, 0x40, 0x63, 0x7f, 0x41, 0x27, 0xd4, 0x83, 0x20, 0x4a, 0x33, 0x5e,
+    0x05, 0x9f, 0xbb, 0xbf, 0x20, 0x75, 0x96, 0x92, 0x6d, 0x60, 0x10, 0xa0, 0xf0, 0xf6, 0x13, 0x59,
+    0xf0, 0x57, 0xe7, 0xc0, 0x95, 0x0d, 0x4e, 0x5f, 0x90, 0x0b, 0x15, 0x94, 0xc0, 0x6f, 0xff, 0xe0,
+    0x30, 0x57, 0x21, 0x04, 0x9f, 0x5d, 0xad, 0xc8, 0x85, 0x67, 0x5b, 0xf8, 0xed, 0xdf, 0x1b, 0xe6,
+    0x2a, 0x84, 0xe0, 0xb3, 0xef, 0xd8, 0x2c, 0xca, 0xbd, 0xa0, 0xdb, 0x9c, 0x87, 0x20, 0xf8, 0xe1,
+    0x5f, 0x57, 0xe6, 0xcc, 0x84, 0x89, 0xdd, 0x0b, 0xda, 0xcd, 0x39, 0x16, 0x82, 0x1f, 0xfe, 0xf1,
+    0x5d, 0xfe, 0x4c, 0xb8, 0xd3, 0xad, 0xdd, 0xac, 0xc7, 0xbd, 0x30, 0x81, 0x79, 0x36, 0x82, 0x00,
+    0x7d, 0x03, 0xbe, 0x7e, 0x06, 0x3c, 0x77, 0x3a, 0x04, 0x5f, 0xdd, 0x04, 0x32, 0xc1, 0xf4, 0xab,
+    0xed, 0x0d, 0x5f, 0xb5, 0xe1, 0xc1, 0xf4, 0x87, 0x7e, 0x30, 0x72, 0x03, 0x6c, 0x84, 0xbc, 0x30,
+    0x0e, 0x00, 0xc8, 0x55, 0xe8, 0xca, 0x43, 0xb7, 0x72, 0x59, 0x38, 0xd1, 0xfb, 0x5e, 0x18, 0x0a,
+    0x5c, 0xf0, 0xe0, 0x67, 0x88, 0x6b, 0x8e, 0xd5, 0x9d, 0xab, 0xf9, 0x72, 0xa6, 0xdc, 0x73, 0x80,
+    0x76, 0x95, 0x7e, 0x3d, 0x6f, 0xae, 0x3b, 0xa2, 0x79, 0xc2, 0x9c, 0x27, 0xd8, 0xef, 0x11, 0x21,
+    0x82, 0xfe, 0x7b, 0xa3, 0xcd, 0xf5, 0xad, 0x8b, 0xed, 0xb5, 0x39, 0x0e, 0xb3, 0xa3, 0x0c, 0x4b,
+    0xb6, 0x6d, 0x86, 0xc3, 0xfc, 0x28, 0xbf, 0x92, 0x6f, 0x9b, 0xdf, 0xb0, 0x03, 0x94, 0x5d, 0xd9,
+    0x81, 0xf5, 0x77, 0x08, 0x6f, 0xd8, 0x42, 0x49, 0x70, 0x25, 0xe6, 0x36, 0xb8, 0x61, 0x15, 0x28,
+    0xb4, 0x12, 0x75, 0x1b, 0xda, 0xb0, 0x0e, 0x14, 0x58, 0x89, 0xbb, 0x0d, 0x6c, 0x58, 0x09, 0x0a,
+    0xab, 0x44, 0xde, 0x86, 0x35, 0x2c, 0x05, 0x11, 0x51, 0x95, 0xd0, 0x97, 0x24, 0x35, 0x6c, 0x06,
+    0xa5, 0x54, 0x92, 0x6f, 0x53, 0x1a, 0xb6, 0x83, 0x12, 0x2a, 0xe9, 0xb7, 0x09, 0x0d, 0x1b, 0x42,
+    0xe9, 0x94, 0x06, 0xd8, 0x74, 0x86, 0x1d, 0x21, 0x22, 0x9b, 0xd2, 0x81, 0x92, 0x68, 0x86, 0x45,
+    0xa1, 0x58, 0x4a, 0x11, 0x6c, 0x2c, 0xc3, 0xb2, 0x50, 0x24, 0xa5, 0x0c, 0x36, 0x92, 0x61, 0x61,
+    0x28, 0x8e, 0x52, 0x08, 0x1b, 0xc7, 0xb0, 0x32, 0x44, 0x84, 0x51, 0x2a, 0x51, 0x92, 0xc5, 0xb0,
+    0x37, 0x94, 0x43, 0xe9, 0x85, 0xcd, 0x61, 0xd8, 0x1d, 0xca, 0xa0, 0x74, 0xc3, 0x66, 0x30, 0xec,
+    0x0f, 0xbd, 0xbf, 0x84, 0x0d, 0xa2, 0x28, 0x4a, 0x29, 0xb6, 0x81, 0xc5, 0x2f, 0xec, 0xb0, 0x24,
+    0x7a, 0x52, 0x12, 0x1b, 0xbd, 0xb0, 0x48, 0x14, 0x3b, 0x29, 0x8a, 0x8d, 0x5d, 0x58, 0x26, 0x8a,
+    0x9c, 0x94, 0xc5, 0x46, 0x2e, 0x2c, 0x14, 0x65, 0x4f, 0x3a, 0xb2, 0x0d, 0x2c, 0x6f, 0x61, 0xa5,
+    0x25, 0x59, 0x93, 0xce, 0xd8, 0xac, 0x85, 0xbd, 0xa2, 0x9c, 0x49, 0x6f, 0x6c, 0xce, 0xc2, 0x6e,
+    0x51, 0xc6, 0xa4, 0x3b, 0x36, 0x63, 0x61, 0xbf, 0x28, 0x5f, 0xd2, 0x1f, 0x9b, 0xaf, 0xb0, 0x61,
+    0x44, 0xa4, 0x4b, 0x1a, 0x54, 0x12, 0xae, 0xb0, 0x66, 0x14, 0x2c, 0xa9, 0x91, 0x0d, 0x56, 0x58,
+    0x35, 0x0a, 0x95, 0x54, 0xc9, 0x86, 0x2a, 0xac, 0x1b, 0x05, 0x4a, 0xea, 0x64, 0x03, 0x15, 0x16,
+    0x8e, 0x88, 0x38, 0x49, 0xa1, 0x4a, 0xd2, 0x14, 0xb6, 0x8e, 0x92, 0x24, 0xad, 0xb2, 0x49, 0x0a,
+    0x9b, 0x47, 0x29, 0x92, 0x66, 0xd9, 0x14, 0x85, 0xed, 0xa3, 0x04, 0x49, 0xbb, 0x6c, 0x82, 0xc2,
+    0xfe, 0x11, 0x91, 0x1f, 0xe9, 0x57, 0x49, 0x7c, 0x82, 0x09, 0x28, 0x3a, 0x52, 0x32, 0x1b, 0x9d,
+    0x60, 0x04, 0x8a, 0x8d, 0x14, 0xcd, 0xc6, 0x26, 0x98, 0x81, 0x22, 0x23, 0x65, 0xb3, 0x91, 0x09,
+    0x76, 0x20, 0x22, 0x30, 0x52, 0xb7, 0x92, 0xbc, 0x04, 0x4f, 0x50, 0x56, 0xa4, 0x73, 0x36, 0x2b,
+    0xc1, 0x17, 0x94, 0x13, 0xe9, 0x9d, 0xcd, 0x49, 0xf0, 0x06, 0x65, 0x44, 0xba, 0x67, 0x33, 0x12,
+    0xfc, 0x41, 0x71, 0x91, 0xc2, 0x6d, 0xe4, 0x0c, 0x48, 0x70, 0xa8, 0x24, 0x1c, 0x52, 0x41, 0x1b,
+    0x8e, 0x60, 0x13, 0x0a, 0x86, 0xd4, 0xd0, 0x06, 0x23, 0x58, 0x85, 0x42, 0x21, 0x55, 0xb4, 0xa1,
+    0x08, 0x76, 0xa1, 0x74, 0x48, 0x03, 0xb7, 0x81, 0x25, 0x22, 0x18, 0x56, 0x92, 0x06, 0x69, 0xa4,
+    0x4d, 0x43, 0x70, 0x0d, 0x25, 0x41, 0x5a, 0x69, 0x93, 0x10, 0x9c, 0x43, 0x29, 0x90, 0x66, 0xda,
+    0x14, 0x04, 0xf7, 0x50, 0x1c, 0xa4, 0x90, 0xdb, 0xc0, 0x22, 0x10, 0xfc, 0x2b, 0xb1, 0x5f, 0x0a,
+    0x6a, 0xed, 0x0f, 0x26, 0x22, 0xeb, 0xa5, 0xa4, 0xd6, 0xfa, 0x60, 0x24, 0xb2, 0x5d, 0x8a, 0x6a,
+    0x6d, 0x0f, 0x66, 0x22, 0xff, 0xa5, 0x9f, 0xdb, 0xc0, 0x3c, 0x0f, 0x76, 0x96, 0xf8, 0x2d, 0x7d,
+    0xb5, 0x7e, 0x07, 0x4f, 0x91, 0xd7, 0xd2, 0x59, 0xeb, 0x75, 0xf0, 0x15, 0xf9, 0x2c, 0xbd, 0xb5,
+    0x3e, 0x07, 0x6f, 0x91, 0xc7, 0xe2, 0xad, 0x25, 0x00, 0x00,
+};
+
+static const webp_corpus_image_t webp_corpus[] = {
+    { "lossy_17x9", lossy_17x9_webp, sizeof(lossy_17x9_webp), 17, 9, false, false },
+    { "lossless_17x9", lossless_17x9_webp, sizeof(lossless_17x9_webp), 17, 9, true, false },
+    { "alpha_17x9", alpha_17x9_webp, sizeof(alpha_17x9_webp), 17, 9, false, true },
+    { "lossy_64x48", lossy_64x48_webp, sizeof(lossy_64x48_webp), 64, 48, false, false },
+    { "lossless_64x48", lossless_64x48_webp, sizeof(lossless_64x48_webp), 64, 48, true, false },
+    { "alpha_64x48", alpha_64x48_webp, sizeof(alpha_64x48_webp), 64, 48, false, true },
+    { "lossy_480x640", lossy_480x640_webp, sizeof(lossy_480x640_webp), 480, 640, false, false },
+    { "lossless_480x640", lossless_480x640_webp, sizeof(lossless_480x640_webp), 480, 640, true, false },
+};
+
+#define WEBP_CORPUS_SIZE (sizeof(webp_corpus) / sizeof(webp_corpus[0]))
+
+#endif // WEBP_CORPUS_H
@@ -0,0 +1,1028 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * Tests of the async worker (microej_async_worker.c) on the host OSAL port.
+ *
+ * The Java threads are host threads calling the natives of this file through the virtual machine
+ * stub (sni_stub.h), which serializes them and suspends them as the virtual machine task does.
+ * The actions of the jobs sleep to model blocking operations. The scheduling of the priorities and
+ * the statistics are checked on a stopped platform time (microej_time_stub.h).
+ */
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <embUnit/embUnit.h>
+#include "microej_async_worker.h"
+#include "osal_pthread.h"
+#include "sni_stub.h"
+#include "microej_time_stub.h"
+
+#define JOB_COUNT 8
+#define WAITING_LIST_SIZE 8
+
+/* Java threads of the benchmarks, and jobs executed one after the other by each of them */
+#define BENCH_CLIENTS 8
+#define BENCH_JOBS 40
+
+/* Sleep of the short jobs (a file status) and of the long ones (a read from the SD card) */
+#define SHORT_JOB_US 200
+#define LONG_JOB_US 5000
+
+/* Longest wait of the actions for the other ones executed concurrently */
+#define RENDEZVOUS_TIMEOUT_US 2000000
+
+/* Worker of the contention benchmark, and jobs executed by each Java thread */
+#define CONTENTION_JOB_COUNT 4
+#define CONTENTION_WAITING_LIST_SIZE 4
+#define CONTENTION_JOBS 50
+
+/* Allocations and frees of the uncontended benchmark */
+#define ALLOCATIONS 100000
+
+/* Jobs of the batches of the batch benchmark, and batches executed */
+#define BATCH_JOBS 8
+#define BATCHES 100
+
+/* Java priorities (Thread.MIN_PRIORITY, NORM_PRIORITY and MAX_PRIORITY) */
+#define JAVA_MIN_PRIORITY 1
+#define JAVA_NORM_PRIORITY 5
+#define JAVA_MAX_PRIORITY 10
+
+/* Java threads of the low priority load of the priority benchmark, and duration of their jobs */
+#define LOAD_CLIENTS 6
+#define LOAD_JOB_US 1000
+
+/* Priority given to the jobs by the Java thread priority */
+#define THREAD_PRIORITY (-1)
+
+/* Aging period in microseconds */
+#define AGING_PERIOD_US (MICROEJ_ASYNC_WORKER_AGING_PERIOD * 1000)
+
+/* Java natives of microej_async_worker.c */
+void javaAsyncWorkerStatsDump(void);
+void javaAsyncWorkerStatsReset(void);
+
+typedef struct {
+    uint32_t duration_us;
+    int32_t tag; // recorded in the execution order
+} job_param_t;
+
+/* A Java thread executing jobs in a worker */
+typedef struct {
+    pthread_t thread;
+    MICROEJ_ASYNC_WORKER_handle_t* worker;
+    MICROEJ_ASYNC_WORKER_action_t action;
+    uint32_t duration_us;
+    uint32_t jobs;          // jobs, or batches when batch_jobs is not 0
+    uint32_t batch_jobs;    // jobs of each batch, 0 to execute the jobs one by one
+    uint32_t* latencies_us; // latency of each job, NULL if not measured
+    uint32_t exceptions;
+    uint32_t done_jobs;     // jobs of the batches found by the SNI callbacks
+    int32_t priority;       // Java priority, 0 for the default one
+} client_t;
+
+MICROEJ_ASYNC_WORKER_worker_declare(single_task_worker, JOB_COUNT, job_param_t, WAITING_LIST_SIZE);
+MICROEJ_ASYNC_WORKER_worker_declare_tasks(two_tasks_worker, JOB_COUNT, job_param_t, WAITING_LIST_SIZE, 2);
+MICROEJ_ASYNC_WORKER_worker_declare_tasks(four_tasks_worker, JOB_COUNT, job_param_t, WAITING_LIST_SIZE, 4);
+MICROEJ_ASYNC_WORKER_worker_declare_tasks(contention_worker, CONTENTION_JOB_COUNT, job_param_t, CONTENTION_WAITING_LIST_SIZE, 2);
+MICROEJ_ASYNC_WORKER_worker_declare(one_job_worker, 1, job_param_t, 1);
+
+/* The stack is a size on the FreeRTOS and host OSAL ports: all the tasks of a worker are created with it */
+static OSAL_task_stack_declare(worker_stack, 1024);
+static bool workers_initialized = false;
+
+static __thread client_t* current_client;
+static uint32_t running_jobs;
+static uint32_t max_running_jobs;
+static uint32_t rendezvous_jobs;
+static uint32_t rendezvous_target;
+static MICROEJ_ASYNC_WORKER_job_t* allocated_jobs[JOB_COUNT + 1];
+static uint32_t held_jobs;
+static int32_t batch_size;
+static bool stop_clients;
+static OSAL_binary_semaphore_handle_t release_blocked_job;
+static int32_t executed_tags[JOB_COUNT];
+static uint32_t executed_count;
+static MICROEJ_ASYNC_WORKER_action_t submitted_action;
+static int32_t submitted_tag;
+static int32_t submitted_priority;
+static uint32_t submitted_duration_us;
+static MICROEJ_ASYNC_WORKER_status_t set_priority_status[2];
+
+/* Helpers -------------------------------------------------------------------*/
+
+static uint64_t host_time_us(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000) + ((uint64_t)now.tv_nsec / 1000);
+}
+
+static void sleep_us(uint32_t duration_us)
+{
+    struct timespec delay = { (time_t)(duration_us / 1000000), (long)(duration_us % 1000000) * 1000 };
+    nanosleep(&delay, NULL);
+}
+
+static int compare_latencies(const void* a, const void* b)
+{
+    uint32_t first = *(const uint32_t*)a;
+    uint32_t second = *(const uint32_t*)b;
+    return (first > second) - (first < second);
+}
+
+/* Actions -------------------------------------------------------------------*/
+
+static void nop_action(MICROEJ_ASYNC_WORKER_job_t* job)
+{
+    (void)job;
+}
+
+/*
+ * Block the task until the test releases it.
+ */
+static void block_action(MICROEJ_ASYNC_WORKER_job_t* job)
+{
+    (void)job;
+    OSAL_binary_semaphore_take(&release_blocked_job, OSAL_INFINITE_TIME);
+}
+
+/*
+ * Record the tag of the job (jobs of the single task worker) and advance the stopped clock by its
+ * duration.
+ */
+static void record_action(MICROEJ_ASYNC_WORKER_job_t* job)
+{
+    job_param_t* params = (job_param_t*)job->params;
+
+    executed_tags[executed_count++] = params->tag;
+    MICROEJ_TIME_STUB_advance_us(params->duration_us);
+}
+
+static void sleep_action(MICROEJ_ASYNC_WORKER_job_t* job)
+{
+    sleep_us(((job_param_t*)job->params)->duration_us);
+}
+
+/*
+ * Wait until the expected number of jobs have started (or the timeout) and count the jobs
+ * executed concurrently.
+ */
+static void rendezvous_action(MICROEJ_ASYNC_WORKER_job_t* job)
+{
+    uint64_t deadline = host_time_us() + ((job_param_t*)job->params)->duration_us;
+    uint32_t running = __atomic_add_fetch(&running_jobs, 1, __ATOMIC_SEQ_CST);
+    uint32_t max = __atomic_load_n(&max_running_jobs, __ATOMIC_SEQ_CST);
+
+    while ((running > max) && !__atomic_compare_exchange_n(&max_running_jobs, &max, running, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+    }
+    __atomic_add_fetch(&rendezvous_jobs, 1, __ATOMIC_SEQ_CST);
+    while ((__atomic_load_n(&rendezvous_jobs, __ATOMIC_SEQ_CST) < rendezvous_target) && (host_time_us() < deadline)) {
+        sleep_us(100);
+    }
+    __atomic_sub_fetch(&running_jobs, 1, __ATOMIC_SEQ_CST);
+}
+
+/* Natives -------------------------------------------------------------------*/
+
+static void exec_done(void)
+{
+    MICROEJ_ASYNC_WORKER_job_t* job = MICROEJ_ASYNC_WORKER_get_job_done();
+    MICROEJ_ASYNC_WORKER_free_job(current_client->worker, job);
+}
+
+/*
+ * Execute a job of the current client and wait for it; called again when a job is freed if
+ * none was available.
+ */
+static void exec_native(void)
+{
+    client_t* client = current_client;
+    MICROEJ_ASYNC_WORKER_job_t* job = MICROEJ_ASYNC_WORKER_allocate_job(client->worker, exec_native);
+
+    if (job != NULL) {
+        ((job_param_t*)job->params)->duration_us = client->duration_us;
+        if (MICROEJ_ASYNC_WORKER_OK != MICROEJ_ASYNC_WORKER_async_exec(client->worker, job, client->action, exec_done)) {
+            MICROEJ_ASYNC_WORKER_free_job(client->worker, job);
+        }
+    }
+}
+
+/*
+ * Allocate all the jobs of the single task worker and free them, then allocate the top job of
+ * the free jobs stack; the jobs are free.
+ */
+static void allocate_all_native(void)
+{
+    for (int i = 0; i < JOB_COUNT; i++) {
+        allocated_jobs[i] = MICROEJ_ASYNC_WORKER_allocate_job(&single_task_worker, allocate_all_native);
+    }
+    for (int i = 0; i < JOB_COUNT; i++) {
+        MICROEJ_ASYNC_WORKER_free_job(&single_task_worker, allocated_jobs[i]);
+    }
+    allocated_jobs[JOB_COUNT] = MICROEJ_ASYNC_WORKER_allocate_job(&single_task_worker, allocate_all_native);
+    MICROEJ_ASYNC_WORKER_free_job(&single_task_worker, allocated_jobs[JOB_COUNT]);
+}
+
+/*
+ * Allocate the job of the one job worker and free it; the job is free.
+ */
+static void allocate_one_native(void)
+{
+    allocated_jobs[0] = MICROEJ_ASYNC_WORKER_allocate_job(&one_job_worker, allocate_one_native);
+    MICROEJ_ASYNC_WORKER_free_job(&one_job_worker, allocated_jobs[0]);
+}
+
+/*
+ * Allocate the job of the one job worker and keep it: the job is free.
+ */
+static void hold_one_native(void)
+{
+    allocated_jobs[0] = MICROEJ_ASYNC_WORKER_allocate_job(&one_job_worker, hold_one_native);
+}
+
+static void release_one_native(void)
+{
+    MICROEJ_ASYNC_WORKER_free_job(&one_job_worker, allocated_jobs[0]);
+}
+
+static void allocate_free_native(void)
+{
+    for (int i = 0; i < ALLOCATIONS; i++) {
+        MICROEJ_ASYNC_WORKER_job_t* job = MICROEJ_ASYNC_WORKER_allocate_job(&contention_worker, allocate_free_native);
+        MICROEJ_ASYNC_WORKER_free_job(&contention_worker, job);
+    }
+}
+
+static void exec_batch_done(void)
+{
+    MICROEJ_ASYNC_WORKER_job_t* batch = MICROEJ_ASYNC_WORKER_get_job_done();
+
+    for (MICROEJ_ASYNC_WORKER_job_t* job = batch; job != NULL; job = MICROEJ_ASYNC_WORKER_get_next_batch_job(job)) {
+        current_client->done_jobs++;
+    }
+    MICROEJ_ASYNC_WORKER_free_batch(current_client->worker, batch);
+}
+
+/*
+ * Execute a batch of jobs of the current client and wait for them; called again when jobs are
+ * freed if not enough were available.
+ */
+static void exec_batch_native(void)
+{
+    client_t* client = current_client;
+    MICROEJ_ASYNC_WORKER_job_t* batch = MICROEJ_ASYNC_WORKER_allocate_batch(client->worker, (int32_t)client->batch_jobs, exec_batch_native);
+
+    if (batch != NULL) {
+        for (MICROEJ_ASYNC_WORKER_job_t* job = batch; job != NULL; job = MICROEJ_ASYNC_WORKER_get_next_batch_job(job)) {
+            ((job_param_t*)job->params)->duration_us = client->duration_us;
+        }
+        /* on error, the batch is freed by the worker */
+        (void)MICROEJ_ASYNC_WORKER_async_exec_batch(client->worker, batch, client->action, exec_batch_done);
+    }
+}
+
+/*
+ * Allocate a batch of batch_size jobs in the single task worker: the jobs are free.
+ */
+static void allocate_batch_native(void)
+{
+    allocated_jobs[0] = MICROEJ_ASYNC_WORKER_allocate_batch(&single_task_worker, batch_size, allocate_batch_native);
+    if (allocated_jobs[0] != NULL) {
+        MICROEJ_ASYNC_WORKER_free_batch(&single_task_worker, allocated_jobs[0]);
+    }
+}
+
+/*
+ * Allocate held_jobs jobs of the single task worker and keep them: the jobs are free.
+ */
+static void hold_jobs_native(void)
+{
+    for (uint32_t i = 0; i < held_jobs; i++) {
+        allocated_jobs[i] = MICROEJ_ASYNC_WORKER_allocate_job(&single_task_worker, hold_jobs_native);
+    }
+}
+
+static void release_jobs_native(void)
+{
+    for (uint32_t i = 0; i < held_jobs; i++) {
+        MICROEJ_ASYNC_WORKER_free_job(&single_task_worker, allocated_jobs[i]);
+    }
+}
+
+/*
+ * Submit a job of the submitted action in the single task worker, without waiting for it.
+ */
+static void submit_native(void)
+{
+    MICROEJ_ASYNC_WORKER_job_t* job = MICROEJ_ASYNC_WORKER_allocate_job(&single_task_worker, submit_native);
+
+    if (job != NULL) {
+        ((job_param_t*)job->params)->tag = submitted_tag;
+        ((job_param_t*)job->params)->duration_us = submitted_duration_us;
+        if (submitted_priority != THREAD_PRIORITY) {
+            MICROEJ_ASYNC_WORKER_set_job_priority(job, (MICROEJ_ASYNC_WORKER_priority_t)submitted_priority);
+        }
+        if (MICROEJ_ASYNC_WORKER_OK != MICROEJ_ASYNC_WORKER_async_exec_no_wait(&single_task_worker, job, submitted_action)) {
+            MICROEJ_ASYNC_WORKER_free_job(&single_task_worker, job);
+        }
+    }
+}
+
+static void set_invalid_priority_native(void)
+{
+    MICROEJ_ASYNC_WORKER_job_t* job = MICROEJ_ASYNC_WORKER_allocate_job(&single_task_worker, set_invalid_priority_native);
+
+    set_priority_status[0] = MICROEJ_ASYNC_WORKER_set_job_priority(job, (MICROEJ_ASYNC_WORKER_priority_t)-1);
+    set_priority_status[1] = MICROEJ_ASYNC_WORKER_set_job_priority(job, (MICROEJ_ASYNC_WORKER_priority_t)MICROEJ_ASYNC_WORKER_PRIORITY_LEVELS);
+    MICROEJ_ASYNC_WORKER_free_job(&single_task_worker, job);
+}
+
+static void* client_run(void* args)
+{
+    current_client = (client_t*)args;
+    if (current_client->priority != 0) {
+        SNI_STUB_set_priority(current_client->priority);
+    }
+    for (uint32_t i = 0; (i < current_client->jobs) && !__atomic_load_n(&stop_clients, __ATOMIC_SEQ_CST); i++) {
+        uint64_t start = host_time_us();
+        if (SNI_OK != SNI_STUB_call((current_client->batch_jobs != 0) ? exec_batch_native : exec_native)) {
+            current_client->exceptions++;
+        }
+        if (current_client->latencies_us != NULL) {
+            current_client->latencies_us[i] = (uint32_t)(host_time_us() - start);
+        }
+    }
+    return NULL;
+}
+
+static void start_clients(client_t* clients, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL_INT(0, pthread_create(&clients[i].thread, NULL, client_run, &clients[i]));
+    }
+}
+
+static void join_clients(client_t* clients, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        pthread_join(clients[i].thread, NULL);
+        TEST_ASSERT_EQUAL_INT(0, clients[i].exceptions);
+    }
+}
+
+static void run_clients(client_t* clients, uint32_t count)
+{
+    start_clients(clients, count);
+    join_clients(clients, count);
+}
+
+/*
+ * Submit a job in the single task worker from the main Java thread, with the given priority or
+ * the one of the thread.
+ */
+static void submit(MICROEJ_ASYNC_WORKER_action_t action, int32_t tag, int32_t priority)
+{
+    submitted_action = action;
+    submitted_tag = tag;
+    submitted_priority = priority;
+    submitted_duration_us = 0;
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(submit_native));
+}
+
+/*
+ * Submit a job of the given duration on the stopped clock in the single task worker.
+ */
+static void submit_timed(uint32_t duration_us)
+{
+    submitted_action = record_action;
+    submitted_tag = 0;
+    submitted_priority = MICROEJ_ASYNC_WORKER_PRIORITY_NORMAL;
+    submitted_duration_us = duration_us;
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(submit_native));
+}
+
+/*
+ * Wait until the worker has counted the given number of job waits.
+ */
+static void wait_job_waits(MICROEJ_ASYNC_WORKER_handle_t* worker, uint32_t job_waits)
+{
+    MICROEJ_ASYNC_WORKER_stats_t stats;
+
+    do {
+        sleep_us(100);
+        MICROEJ_ASYNC_WORKER_get_stats(worker, &stats);
+    } while (stats.job_waits < job_waits);
+}
+
+/*
+ * Block the task of the single task worker: the jobs submitted next stay queued until
+ * release_task().
+ */
+static void block_task(void)
+{
+    executed_count = 0;
+    submit(block_action, 0, MICROEJ_ASYNC_WORKER_PRIORITY_HIGH);
+    OSAL_PTHREAD_wait_idle();
+}
+
+static void release_task(void)
+{
+    OSAL_binary_semaphore_give(&release_blocked_job);
+    OSAL_PTHREAD_wait_idle();
+}
+
+/*
+ * Jobs executed by each task of a worker since its initialization.
+ */
+static void get_tasks_jobs(MICROEJ_ASYNC_WORKER_handle_t* worker, uint32_t* jobs)
+{
+    MICROEJ_ASYNC_WORKER_task_stats_t stats;
+
+    for (int32_t i = 0; i < MICROEJ_ASYNC_WORKER_get_task_count(worker); i++) {
+        TEST_ASSERT_EQUAL_INT(MICROEJ_ASYNC_WORKER_OK, MICROEJ_ASYNC_WORKER_get_task_stats(worker, i, &stats));
+        jobs[i] = stats.executed_jobs;
+    }
+}
+
+/*
+ * The given number of Java threads execute one rendezvous job each in the worker: returns the
+ * maximum number of jobs executed concurrently.
+ */
+static uint32_t rendezvous(MICROEJ_ASYNC_WORKER_handle_t* worker, uint32_t count, uint32_t timeout_us)
+{
+    client_t clients[4];
+
+    running_jobs = 0;
+    max_running_jobs = 0;
+    rendezvous_jobs = 0;
+    rendezvous_target = count;
+    for (uint32_t i = 0; i < count; i++) {
+        clients[i] = (client_t){ .worker = worker, .action = rendezvous_action, .duration_us = timeout_us, .jobs = 1 };
+    }
+    run_clients(clients, count);
+    return max_running_jobs;
+}
+
+static void setUp(void)
+{
+    if (!workers_initialized) {
+        TEST_ASSERT_EQUAL_INT(MICROEJ_ASYNC_WORKER_OK, MICROEJ_ASYNC_WORKER_initialize(&single_task_worker, (uint8_t*)"single task", worker_stack, 5));
+        TEST_ASSERT_EQUAL_INT(MICROEJ_ASYNC_WORKER_OK, MICROEJ_ASYNC_WORKER_initialize(&two_tasks_worker, (uint8_t*)"two tasks", worker_stack, 5));
+        TEST_ASSERT_EQUAL_INT(MICROEJ_ASYNC_WORKER_OK, MICROEJ_ASYNC_WORKER_initialize(&four_tasks_worker, (uint8_t*)"four tasks", worker_stack, 5));
+        TEST_ASSERT_EQUAL_INT(MICROEJ_ASYNC_WORKER_OK, MICROEJ_ASYNC_WORKER_initialize(&contention_worker, (uint8_t*)"contention", worker_stack, 5));
+        TEST_ASSERT_EQUAL_INT(MICROEJ_ASYNC_WORKER_OK, MICROEJ_ASYNC_WORKER_initialize(&one_job_worker, (uint8_t*)"one job", worker_stack, 5));
+        TEST_ASSERT_EQUAL_INT(OSAL_OK, OSAL_binary_semaphore_create((uint8_t*)"release blocked job", 0, &release_blocked_job));
+        workers_initialized = true;
+    }
+}
+
+static void tearDown(void)
+{
+    OSAL_PTHREAD_wait_idle();
+    MICROEJ_TIME_STUB_use_host_clock();
+    SNI_STUB_set_priority(JAVA_NORM_PRIORITY);
+}
+
+/* Tests ---------------------------------------------------------------------*/
+
+/*
+ * The tasks of a worker fetch the jobs from the same queue: as many jobs as tasks are executed
+ * concurrently, one by each task.
+ */
+static void async_worker_tasks_f(void)
+{
+    uint32_t jobs_before[4];
+    uint32_t jobs_after[4];
+    MICROEJ_ASYNC_WORKER_task_stats_t stats;
+
+    TEST_ASSERT_EQUAL_INT(4, MICROEJ_ASYNC_WORKER_get_task_count(&four_tasks_worker));
+    TEST_ASSERT_EQUAL_INT(MICROEJ_ASYNC_WORKER_INVALID_ARGS, MICROEJ_ASYNC_WORKER_get_task_stats(&four_tasks_worker, 4, &stats));
+    TEST_ASSERT_EQUAL_INT(MICROEJ_ASYNC_WORKER_INVALID_ARGS, MICROEJ_ASYNC_WORKER_get_task_stats(&four_tasks_worker, -1, &stats));
+
+    get_tasks_jobs(&four_tasks_worker, jobs_before);
+    TEST_ASSERT_EQUAL_INT(4, rendezvous(&four_tasks_worker, 4, RENDEZVOUS_TIMEOUT_US));
+    get_tasks_jobs(&four_tasks_worker, jobs_after);
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(1, jobs_after[i] - jobs_before[i]);
+    }
+
+    /* more jobs than tasks: the extra ones wait for a free task */
+    TEST_ASSERT_EQUAL_INT(2, rendezvous(&two_tasks_worker, 3, 20000));
+}
+
+/*
+ * A worker declared with MICROEJ_ASYNC_WORKER_worker_declare() executes its jobs one after the
+ * other.
+ */
+static void async_worker_single_task_f(void)
+{
+    uint32_t jobs_before;
+    uint32_t jobs_after;
+
+    TEST_ASSERT_EQUAL_INT(1, MICROEJ_ASYNC_WORKER_get_task_count(&single_task_worker));
+    get_tasks_jobs(&single_task_worker, &jobs_before);
+    TEST_ASSERT_EQUAL_INT(1, rendezvous(&single_task_worker, 3, 20000));
+    get_tasks_jobs(&single_task_worker, &jobs_after);
+    TEST_ASSERT_EQUAL_INT(3, jobs_after - jobs_before);
+}
+
+/*
+ * Throughput and latency of the short jobs with 1, 2 and 4 tasks, when all the jobs are short and
+ * when a Java thread executes long jobs.
+ */
+static void async_worker_tasks_report_f(void)
+{
+    static MICROEJ_ASYNC_WORKER_handle_t* const workers[] = { &single_task_worker, &two_tasks_worker, &four_tasks_worker };
+    static uint32_t latencies_us[BENCH_CLIENTS * BENCH_JOBS];
+    client_t clients[BENCH_CLIENTS];
+
+    for (uint32_t mixed = 0; mixed < 2; mixed++) {
+        for (uint32_t w = 0; w < (sizeof(workers) / sizeof(workers[0])); w++) {
+            uint32_t short_jobs = 0;
+            uint64_t start = host_time_us();
+            uint64_t elapsed_us;
+
+            for (uint32_t i = 0; i < BENCH_CLIENTS; i++) {
+                bool long_jobs = (mixed != 0) && (i == 0);
+                clients[i] = (client_t){ .worker = workers[w], .action = sleep_action,
+                                         .duration_us = long_jobs ? LONG_JOB_US : SHORT_JOB_US,
+                                         .jobs = long_jobs ? (BENCH_JOBS / 4) : BENCH_JOBS,
+                                         .latencies_us = long_jobs ? NULL : &latencies_us[short_jobs] };
+                short_jobs += long_jobs ? 0 : BENCH_JOBS;
+            }
+            run_clients(clients, BENCH_CLIENTS);
+            elapsed_us = host_time_us() - start;
+
+            qsort(latencies_us, short_jobs, sizeof(latencies_us[0]), compare_latencies);
+            printf("MICROEJ_ASYNC_WORKER: %s jobs, %d task(s): %u jobs/s, short jobs latency p50 %u us, p99 %u us, max %u us\n",
+                    (mixed != 0) ? "mixed" : "short", (int)MICROEJ_ASYNC_WORKER_get_task_count(workers[w]),
+                    (unsigned int)(((uint64_t)(short_jobs + ((mixed != 0) ? (BENCH_JOBS / 4) : 0)) * 1000000) / elapsed_us),
+                    (unsigned int)latencies_us[short_jobs / 2], (unsigned int)latencies_us[((short_jobs * 99) / 100) - 1],
+                    (unsigned int)latencies_us[short_jobs - 1]);
+        }
+    }
+}
+
+/*
+ * The free jobs are a stack: each job is allocated once, the last freed job is allocated first.
+ */
+static void async_worker_free_jobs_f(void)
+{
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(allocate_all_native));
+    for (int i = 0; i < JOB_COUNT; i++) {
+        TEST_ASSERT(allocated_jobs[i] != NULL);
+        for (int j = 0; j < i; j++) {
+            TEST_ASSERT(allocated_jobs[i] != allocated_jobs[j]);
+            TEST_ASSERT(allocated_jobs[i]->params != allocated_jobs[j]->params);
+        }
+    }
+    TEST_ASSERT(allocated_jobs[JOB_COUNT] == allocated_jobs[JOB_COUNT - 1]);
+}
+
+/*
+ * More Java threads than jobs and waiting threads: the ones which do not fit in the waiting list
+ * retry later, all the jobs are executed and freed.
+ */
+static void async_worker_waiting_list_full_f(void)
+{
+    client_t clients[4];
+    MICROEJ_ASYNC_WORKER_stats_t stats;
+    uint32_t suspensions;
+
+    MICROEJ_ASYNC_WORKER_reset_stats(&one_job_worker);
+    for (int i = 0; i < 4; i++) {
+        clients[i] = (client_t){ .worker = &one_job_worker, .action = sleep_action, .duration_us = 1000, .jobs = 10 };
+    }
+    run_clients(clients, 4);
+
+    MICROEJ_ASYNC_WORKER_get_stats(&one_job_worker, &stats);
+    TEST_ASSERT_EQUAL_INT(40, stats.executed_jobs);
+    TEST_ASSERT_EQUAL_INT(1, stats.max_queued_jobs);
+    TEST_ASSERT_EQUAL_INT(1, stats.max_waiting_threads);
+    TEST_ASSERT(stats.waiting_list_full > 0);
+    TEST_ASSERT(stats.job_waits > stats.waiting_list_full);
+
+    suspensions = SNI_STUB_get_suspensions();
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(allocate_one_native));
+    TEST_ASSERT(allocated_jobs[0] != NULL);
+    TEST_ASSERT_EQUAL_INT(suspensions, SNI_STUB_get_suspensions());
+}
+
+/*
+ * Cost of an allocation and a free when a job is available, then throughput of jobs executed by
+ * more and more Java threads on a worker of 4 jobs and 4 waiting threads.
+ */
+static void async_worker_contention_report_f(void)
+{
+    static const uint32_t client_counts[] = { 1, 4, 16, 32 };
+    static client_t clients[32];
+    uint64_t start = host_time_us();
+
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(allocate_free_native));
+    printf("MICROEJ_ASYNC_WORKER: allocation and free of a job: %u ns\n", (unsigned int)(((host_time_us() - start) * 1000) / ALLOCATIONS));
+
+    for (uint32_t c = 0; c < (sizeof(client_counts) / sizeof(client_counts[0])); c++) {
+        uint32_t count = client_counts[c];
+        uint32_t suspensions = SNI_STUB_get_suspensions();
+        MICROEJ_ASYNC_WORKER_stats_t stats;
+        uint64_t elapsed_us;
+
+        MICROEJ_ASYNC_WORKER_reset_stats(&contention_worker);
+        for (uint32_t i = 0; i < count; i++) {
+            clients[i] = (client_t){ .worker = &contention_worker, .action = nop_action, .jobs = CONTENTION_JOBS };
+        }
+        start = host_time_us();
+        run_clients(clients, count);
+        elapsed_us = host_time_us() - start;
+        MICROEJ_ASYNC_WORKER_get_stats(&contention_worker, &stats);
+
+        TEST_ASSERT_EQUAL_INT(count * CONTENTION_JOBS, stats.executed_jobs);
+        printf("MICROEJ_ASYNC_WORKER: %u Java thread(s) on %d jobs: %u jobs/s, %u job waits (%u waiting list full), %u suspensions\n",
+                (unsigned int)count, CONTENTION_JOB_COUNT, (unsigned int)(((uint64_t)stats.executed_jobs * 1000000) / elapsed_us),
+                (unsigned int)stats.job_waits, (unsigned int)stats.waiting_list_full, (unsigned int)(SNI_STUB_get_suspensions() - suspensions));
+    }
+}
+
+/*
+ * The jobs of a batch are executed concurrently by the tasks of the worker: the Java thread is
+ * resumed once, its SNI callback gets the first job of the batch.
+ */
+static void async_worker_batch_f(void)
+{
+    client_t client = { .worker = &four_tasks_worker, .action = rendezvous_action, .duration_us = RENDEZVOUS_TIMEOUT_US, .jobs = 1, .batch_jobs = 4 };
+    uint32_t resumes = SNI_STUB_get_resumes();
+
+    running_jobs = 0;
+    max_running_jobs = 0;
+    rendezvous_jobs = 0;
+    rendezvous_target = 4;
+    run_clients(&client, 1);
+    TEST_ASSERT_EQUAL_INT(4, max_running_jobs);
+    TEST_ASSERT_EQUAL_INT(4, client.done_jobs);
+    TEST_ASSERT_EQUAL_INT(1, SNI_STUB_get_resumes() - resumes);
+
+    /* the jobs of a batch are distinct */
+    batch_size = JOB_COUNT;
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(allocate_batch_native));
+    for (MICROEJ_ASYNC_WORKER_job_t* job = allocated_jobs[0]; job != NULL; job = MICROEJ_ASYNC_WORKER_get_next_batch_job(job)) {
+        for (MICROEJ_ASYNC_WORKER_job_t* other = MICROEJ_ASYNC_WORKER_get_next_batch_job(job); other != NULL; other = MICROEJ_ASYNC_WORKER_get_next_batch_job(other)) {
+            TEST_ASSERT(job != other);
+        }
+        batch_size--;
+    }
+    TEST_ASSERT_EQUAL_INT(0, batch_size);
+
+    /* a batch has 1 to _job_count jobs */
+    batch_size = 0;
+    TEST_ASSERT_EQUAL_INT(SNI_ERROR, SNI_STUB_call(allocate_batch_native));
+    TEST_ASSERT(allocated_jobs[0] == NULL);
+    batch_size = JOB_COUNT + 1;
+    TEST_ASSERT_EQUAL_INT(SNI_ERROR, SNI_STUB_call(allocate_batch_native));
+    TEST_ASSERT(allocated_jobs[0] == NULL);
+}
+
+/*
+ * A batch waits until all its jobs can be allocated at once: in the waiting list when no job is
+ * free, with the retry delay when some jobs are free but not enough.
+ */
+static void async_worker_batch_wait_f(void)
+{
+    static const uint32_t held[] = { JOB_COUNT, JOB_COUNT - 2 };
+
+    for (uint32_t i = 0; i < (sizeof(held) / sizeof(held[0])); i++) {
+        client_t client = { .worker = &single_task_worker, .action = nop_action, .jobs = 1, .batch_jobs = 4 };
+        MICROEJ_ASYNC_WORKER_stats_t stats;
+        uint32_t job_waits;
+
+        held_jobs = held[i];
+        TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(hold_jobs_native));
+        MICROEJ_ASYNC_WORKER_get_stats(&single_task_worker, &stats);
+        job_waits = stats.job_waits;
+
+        TEST_ASSERT_EQUAL_INT(0, pthread_create(&client.thread, NULL, client_run, &client));
+        wait_job_waits(&single_task_worker, job_waits + 1);
+        TEST_ASSERT_EQUAL_INT(0, client.done_jobs);
+
+        TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(release_jobs_native));
+        pthread_join(client.thread, NULL);
+        TEST_ASSERT_EQUAL_INT(4, client.done_jobs);
+    }
+
+    /* all the jobs are free */
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(allocate_all_native));
+    TEST_ASSERT(allocated_jobs[JOB_COUNT - 1] != NULL);
+}
+
+/*
+ * Latency, Java thread suspensions and resumes per job, for jobs executed one by one then in
+ * batches, with empty and sleeping actions.
+ */
+static void async_worker_batch_report_f(void)
+{
+    static const uint32_t durations_us[] = { 0, SHORT_JOB_US };
+
+    for (uint32_t d = 0; d < (sizeof(durations_us) / sizeof(durations_us[0])); d++) {
+        for (uint32_t batched = 0; batched < 2; batched++) {
+            client_t client = { .worker = &four_tasks_worker, .action = (durations_us[d] == 0) ? nop_action : sleep_action,
+                                .duration_us = durations_us[d], .jobs = (batched != 0) ? BATCHES : (BATCHES * BATCH_JOBS),
+                                .batch_jobs = (batched != 0) ? BATCH_JOBS : 0 };
+            uint32_t suspensions = SNI_STUB_get_suspensions();
+            uint32_t resumes = SNI_STUB_get_resumes();
+            uint64_t start = host_time_us();
+            uint64_t elapsed_us;
+
+            run_clients(&client, 1);
+            elapsed_us = host_time_us() - start;
+            printf("MICROEJ_ASYNC_WORKER: %u us jobs %s, 4 tasks: %u ns per job, %u.%02u suspensions and %u.%02u resumes per job\n",
+                    (unsigned int)durations_us[d], (batched != 0) ? "in batches of 8" : "one by one",
+                    (unsigned int)((elapsed_us * 1000) / (BATCHES * BATCH_JOBS)),
+                    (unsigned int)((SNI_STUB_get_suspensions() - suspensions) / (BATCHES * BATCH_JOBS)),
+                    (unsigned int)((((SNI_STUB_get_suspensions() - suspensions) * 100) / (BATCHES * BATCH_JOBS)) % 100),
+                    (unsigned int)((SNI_STUB_get_resumes() - resumes) / (BATCHES * BATCH_JOBS)),
+                    (unsigned int)((((SNI_STUB_get_resumes() - resumes) * 100) / (BATCHES * BATCH_JOBS)) % 100));
+        }
+    }
+}
+
+/*
+ * The queued jobs are executed by order of priority, given by the Java thread priority or set
+ * explicitly, and in the order of their submission within a priority.
+ */
+static void async_worker_priority_f(void)
+{
+    static const int32_t expected_tags[] = { 3, 5, 2, 6, 1, 4 };
+
+    MICROEJ_TIME_STUB_set_time_us(0);
+    block_task();
+    SNI_STUB_set_priority(JAVA_MIN_PRIORITY);
+    submit(record_action, 1, THREAD_PRIORITY);
+    SNI_STUB_set_priority(JAVA_NORM_PRIORITY);
+    submit(record_action, 2, THREAD_PRIORITY);
+    SNI_STUB_set_priority(JAVA_MAX_PRIORITY);
+    submit(record_action, 3, THREAD_PRIORITY);
+    SNI_STUB_set_priority(JAVA_NORM_PRIORITY - 1);
+    submit(record_action, 4, THREAD_PRIORITY);
+    submit(record_action, 5, MICROEJ_ASYNC_WORKER_PRIORITY_HIGH);
+    SNI_STUB_set_priority(JAVA_MAX_PRIORITY);
+    submit(record_action, 6, MICROEJ_ASYNC_WORKER_PRIORITY_NORMAL);
+    release_task();
+
+    TEST_ASSERT_EQUAL_INT(6, executed_count);
+    for (uint32_t i = 0; i < executed_count; i++) {
+        TEST_ASSERT_EQUAL_INT(expected_tags[i], executed_tags[i]);
+    }
+
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(set_invalid_priority_native));
+    TEST_ASSERT_EQUAL_INT(MICROEJ_ASYNC_WORKER_INVALID_ARGS, set_priority_status[0]);
+    TEST_ASSERT_EQUAL_INT(MICROEJ_ASYNC_WORKER_INVALID_ARGS, set_priority_status[1]);
+}
+
+/*
+ * A queued job gains one priority level per aging period: the oldest job wins on equal
+ * effective priorities.
+ */
+static void async_worker_aging_f(void)
+{
+    /* a low priority job queued 1.99 aging periods before a high priority one is executed after it */
+    MICROEJ_TIME_STUB_set_time_us(0);
+    block_task();
+    submit(record_action, 1, MICROEJ_ASYNC_WORKER_PRIORITY_LOW);
+    MICROEJ_TIME_STUB_set_time_us((2 * AGING_PERIOD_US) - 1);
+    submit(record_action, 2, MICROEJ_ASYNC_WORKER_PRIORITY_HIGH);
+    release_task();
+    TEST_ASSERT_EQUAL_INT(2, executed_count);
+    TEST_ASSERT_EQUAL_INT(2, executed_tags[0]);
+    TEST_ASSERT_EQUAL_INT(1, executed_tags[1]);
+
+    /* two aging periods: same effective priority, the oldest job first */
+    MICROEJ_TIME_STUB_set_time_us(0);
+    block_task();
+    submit(record_action, 1, MICROEJ_ASYNC_WORKER_PRIORITY_LOW);
+    MICROEJ_TIME_STUB_set_time_us(2 * AGING_PERIOD_US);
+    submit(record_action, 2, MICROEJ_ASYNC_WORKER_PRIORITY_HIGH);
+    release_task();
+    TEST_ASSERT_EQUAL_INT(2, executed_count);
+    TEST_ASSERT_EQUAL_INT(1, executed_tags[0]);
+    TEST_ASSERT_EQUAL_INT(2, executed_tags[1]);
+
+    /* low at 0, normal at 0.5 and high at 2.5 periods, dequeued at 2.5 periods: the normal job has
+       gained two levels and goes first, the low one too and goes before the younger high one */
+    MICROEJ_TIME_STUB_set_time_us(0);
+    block_task();
+    submit(record_action, 1, MICROEJ_ASYNC_WORKER_PRIORITY_LOW);
+    MICROEJ_TIME_STUB_set_time_us(AGING_PERIOD_US / 2);
+    submit(record_action, 2, MICROEJ_ASYNC_WORKER_PRIORITY_NORMAL);
+    MICROEJ_TIME_STUB_set_time_us((5 * AGING_PERIOD_US) / 2);
+    submit(record_action, 3, MICROEJ_ASYNC_WORKER_PRIORITY_HIGH);
+    release_task();
+    TEST_ASSERT_EQUAL_INT(3, executed_count);
+    TEST_ASSERT_EQUAL_INT(2, executed_tags[0]);
+    TEST_ASSERT_EQUAL_INT(1, executed_tags[1]);
+    TEST_ASSERT_EQUAL_INT(3, executed_tags[2]);
+}
+
+/*
+ * Latency of the jobs of a Java thread while 6 Java threads of minimum priority saturate a
+ * worker of 2 tasks with 1 ms jobs: the thread has the same priority as the load (the jobs are
+ * executed in the order of their submission), then the maximum priority.
+ */
+static void async_worker_priority_report_f(void)
+{
+    static const int32_t priorities[] = { JAVA_MIN_PRIORITY, JAVA_MAX_PRIORITY };
+    static uint32_t latencies_us[BENCH_JOBS];
+    client_t load[LOAD_CLIENTS];
+
+    for (uint32_t p = 0; p < (sizeof(priorities) / sizeof(priorities[0])); p++) {
+        client_t client = { .worker = &two_tasks_worker, .action = sleep_action, .duration_us = SHORT_JOB_US,
+                            .jobs = BENCH_JOBS, .latencies_us = latencies_us, .priority = priorities[p] };
+
+        for (uint32_t i = 0; i < LOAD_CLIENTS; i++) {
+            load[i] = (client_t){ .worker = &two_tasks_worker, .action = sleep_action, .duration_us = LOAD_JOB_US,
+                                  .jobs = UINT32_MAX, .priority = JAVA_MIN_PRIORITY };
+        }
+        stop_clients = false;
+        start_clients(load, LOAD_CLIENTS);
+        sleep_us(5 * LOAD_JOB_US);
+        run_clients(&client, 1);
+        __atomic_store_n(&stop_clients, true, __ATOMIC_SEQ_CST);
+        join_clients(load, LOAD_CLIENTS);
+
+        qsort(latencies_us, BENCH_JOBS, sizeof(latencies_us[0]), compare_latencies);
+        printf("MICROEJ_ASYNC_WORKER: %u us jobs of a Java thread of priority %d under a load of priority %d: latency p50 %u us, p90 %u us, max %u us\n",
+                (unsigned int)SHORT_JOB_US, (int)priorities[p], JAVA_MIN_PRIORITY, (unsigned int)latencies_us[BENCH_JOBS / 2],
+                (unsigned int)latencies_us[((BENCH_JOBS * 9) / 10) - 1], (unsigned int)latencies_us[BENCH_JOBS - 1]);
+    }
+    stop_clients = false;
+}
+
+/*
+ * Wait and service times of jobs on the stopped clock: a blocked job of 5000 us, then jobs of 0,
+ * 1023, 1024, 2047, 2048 and 2^25 us queued at the same time. The first class of the histograms
+ * is below 1024 us, the last one gets all the longer times.
+ */
+static void async_worker_histograms_f(void)
+{
+    static const uint32_t durations_us[] = { 0, 1023, 1024, 2047, 2048, 1u << 25 };
+    static const uint32_t wait_histogram[MICROEJ_ASYNC_WORKER_HISTOGRAM_SIZE] = { 1, 0, 0, 4, 2 };
+    static const uint32_t service_histogram[MICROEJ_ASYNC_WORKER_HISTOGRAM_SIZE] = { 2, 2, 1, 1, [15] = 1 };
+    MICROEJ_ASYNC_WORKER_task_stats_t task_before;
+    MICROEJ_ASYNC_WORKER_task_stats_t task_after;
+    MICROEJ_ASYNC_WORKER_stats_t stats;
+    uint64_t busy_time_us = 5000;
+
+    TEST_ASSERT_EQUAL_INT(MICROEJ_ASYNC_WORKER_OK, MICROEJ_ASYNC_WORKER_get_task_stats(&single_task_worker, 0, &task_before));
+    MICROEJ_ASYNC_WORKER_reset_stats(&single_task_worker);
+    MICROEJ_TIME_STUB_set_time_us(0);
+    block_task();
+    for (uint32_t i = 0; i < (sizeof(durations_us) / sizeof(durations_us[0])); i++) {
+        submit_timed(durations_us[i]);
+        busy_time_us += durations_us[i];
+    }
+    MICROEJ_TIME_STUB_set_time_us(5000);
+    release_task();
+
+    /* the waits: 0 for the blocked job, 5000 + the durations of the previous jobs for the others */
+    MICROEJ_ASYNC_WORKER_get_stats(&single_task_worker, &stats);
+    TEST_ASSERT_EQUAL_INT(7, stats.executed_jobs);
+    for (int i = 0; i < MICROEJ_ASYNC_WORKER_HISTOGRAM_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(wait_histogram[i], stats.wait_histogram[i]);
+        TEST_ASSERT_EQUAL_INT(service_histogram[i], stats.service_histogram[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(5000 + 1023 + 1024 + 2047 + 2048, stats.max_wait_time_us);
+    TEST_ASSERT_EQUAL_INT(1u << 25, stats.max_service_time_us);
+    TEST_ASSERT_EQUAL_INT(6, stats.max_queued_jobs);
+    TEST_ASSERT_EQUAL_INT(0, stats.max_waiting_threads);
+    TEST_ASSERT_EQUAL_INT(0, stats.job_waits);
+
+    TEST_ASSERT_EQUAL_INT(MICROEJ_ASYNC_WORKER_OK, MICROEJ_ASYNC_WORKER_get_task_stats(&single_task_worker, 0, &task_after));
+    TEST_ASSERT_EQUAL_INT(7, task_after.executed_jobs - task_before.executed_jobs);
+    TEST_ASSERT(busy_time_us == (task_after.busy_time_us - task_before.busy_time_us));
+    TEST_ASSERT_EQUAL_INT(1u << 25, task_after.max_job_time_us);
+
+    /* the natives print the statistics of all the workers and clear them */
+    javaAsyncWorkerStatsDump();
+    MICROEJ_ASYNC_WORKER_get_stats(&single_task_worker, &stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.executed_jobs);
+    TEST_ASSERT_EQUAL_INT(0, stats.wait_histogram[3]);
+    TEST_ASSERT_EQUAL_INT(0, stats.max_service_time_us);
+    TEST_ASSERT_EQUAL_INT(0, stats.max_queued_jobs);
+}
+
+/*
+ * High-water mark of the waiting list and waits of the Java threads: a thread in the waiting
+ * list, another one which finds it full. The high-water marks restart from the current values.
+ */
+static void async_worker_waiting_stats_f(void)
+{
+    client_t clients[2];
+    MICROEJ_ASYNC_WORKER_stats_t stats;
+
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(hold_one_native));
+    javaAsyncWorkerStatsReset();
+    for (int i = 0; i < 2; i++) {
+        clients[i] = (client_t){ .worker = &one_job_worker, .action = nop_action, .jobs = 1 };
+        start_clients(&clients[i], 1);
+        wait_job_waits(&one_job_worker, (uint32_t)i + 1);
+    }
+    MICROEJ_ASYNC_WORKER_get_stats(&one_job_worker, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.max_waiting_threads);
+    TEST_ASSERT_EQUAL_INT(1, stats.waiting_list_full);
+
+    /* the first thread is still waiting */
+    MICROEJ_ASYNC_WORKER_reset_stats(&one_job_worker);
+    MICROEJ_ASYNC_WORKER_get_stats(&one_job_worker, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.max_waiting_threads);
+    TEST_ASSERT_EQUAL_INT(0, stats.job_waits);
+    TEST_ASSERT_EQUAL_INT(0, stats.waiting_list_full);
+
+    TEST_ASSERT_EQUAL_INT(SNI_OK, SNI_STUB_call(release_one_native));
+    join_clients(clients, 2);
+    MICROEJ_ASYNC_WORKER_get_stats(&one_job_worker, &stats);
+    TEST_ASSERT_EQUAL_INT(2, stats.executed_jobs);
+    TEST_ASSERT_EQUAL_INT(1, stats.max_queued_jobs);
+}
+
+/*
+ * Statistics of the mixed load of the tasks benchmark on the two tasks worker, as used to size a
+ * worker: the histograms count all the jobs, the high-water marks stay within the sizes of the
+ * worker.
+ */
+static void async_worker_stats_report_f(void)
+{
+    client_t clients[BENCH_CLIENTS];
+    MICROEJ_ASYNC_WORKER_task_stats_t tasks_before[2];
+    MICROEJ_ASYNC_WORKER_task_stats_t task;
+    MICROEJ_ASYNC_WORKER_stats_t stats;
+    uint32_t wait_jobs = 0;
+    uint32_t service_jobs = 0;
+    uint32_t task_jobs = 0;
+    uint64_t start;
+    uint64_t elapsed_us;
+
+    for (int32_t i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_INT(MICROEJ_ASYNC_WORKER_OK, MICROEJ_ASYNC_WORKER_get_task_stats(&two_tasks_worker, i, &tasks_before[i]));
+    }
+    MICROEJ_ASYNC_WORKER_reset_stats(&two_tasks_worker);
+    for (uint32_t i = 0; i < BENCH_CLIENTS; i++) {
+        clients[i] = (client_t){ .worker = &two_tasks_worker, .action = sleep_action,
+                                 .duration_us = (i == 0) ? LONG_JOB_US : SHORT_JOB_US, .jobs = (i == 0) ? (BENCH_JOBS / 4) : BENCH_JOBS };
+    }
+    start = host_time_us();
+    run_clients(clients, BENCH_CLIENTS);
+    elapsed_us = host_time_us() - start;
+
+    MICROEJ_ASYNC_WORKER_get_stats(&two_tasks_worker, &stats);
+    for (int i = 0; i < MICROEJ_ASYNC_WORKER_HISTOGRAM_SIZE; i++) {
+        wait_jobs += stats.wait_histogram[i];
+        service_jobs += stats.service_histogram[i];
+    }
+    TEST_ASSERT_EQUAL_INT(((BENCH_CLIENTS - 1) * BENCH_JOBS) + (BENCH_JOBS / 4), stats.executed_jobs);
+    TEST_ASSERT_EQUAL_INT(stats.executed_jobs, wait_jobs);
+    TEST_ASSERT_EQUAL_INT(stats.executed_jobs, service_jobs);
+    TEST_ASSERT(stats.max_service_time_us >= LONG_JOB_US);
+    TEST_ASSERT(stats.max_queued_jobs <= JOB_COUNT);
+    TEST_ASSERT(stats.max_waiting_threads <= WAITING_LIST_SIZE);
+    MICROEJ_ASYNC_WORKER_dump_stats(&two_tasks_worker);
+
+    for (int32_t i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_INT(MICROEJ_ASYNC_WORKER_OK, MICROEJ_ASYNC_WORKER_get_task_stats(&two_tasks_worker, i, &task));
+        task_jobs += task.executed_jobs - tasks_before[i].executed_jobs;
+        printf("MICROEJ_ASYNC_WORKER: two tasks: task %d: %u jobs, busy %u%%, longest job since the start %u us\n", (int)i,
+                (unsigned int)(task.executed_jobs - tasks_before[i].executed_jobs),
+                (unsigned int)(((task.busy_time_us - tasks_before[i].busy_time_us) * 100) / elapsed_us), (unsigned int)task.max_job_time_us);
+    }
+    TEST_ASSERT_EQUAL_INT(stats.executed_jobs, task_jobs);
+}
+
+TestRef microej_async_worker_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture("async_worker_tasks", async_worker_tasks_f),
+        new_TestFixture("async_worker_single_task", async_worker_single_task_f),
+        new_TestFixture("async_worker_tasks_report", async_worker_tasks_report_f),
+        new_TestFixture("async_worker_free_jobs", async_worker_free_jobs_f),
+        new_TestFixture("async_worker_waiting_list_full", async_worker_waiting_list_full_f),
+        new_TestFixture("async_worker_contention_report", async_worker_contention_report_f),
+        new_TestFixture("async_worker_batch", async_worker_batch_f),
+        new_TestFixture("async_worker_batch_wait", async_worker_batch_wait_f),
+        new_TestFixture("async_worker_batch_report", async_worker_batch_report_f),
+        new_TestFixture("async_worker_priority", async_worker_priority_f),
+        new_TestFixture("async_worker_aging", async_worker_aging_f),
+        new_TestFixture("async_worker_priority_report", async_worker_priority_report_f),
+        new_TestFixture("async_worker_histograms", async_worker_histograms_f),
+        new_TestFixture("async_worker_waiting_stats", async_worker_waiting_stats_f),
+        new_TestFixture("async_worker_stats_report", async_worker_stats_report_f),
+    };
+    EMB_UNIT_TESTCALLER(microej_async_worker, "microej_async_worker", setUp, tearDown, fixtures);
+
+    return (TestRef)&microej_async_worker;
+}